@@ -5,13 +5,14 @@
 #include "CoreGeometry/points.hpp"
 
 #include <cstdint>
+#include <span>
 #include <vector>
 
 using Mask2D = std::vector<Point2D<uint32_t>>;
 
 Mask2D create_mask(std::vector<uint32_t> const & x, std::vector<uint32_t> const & y);
 
-Mask2D create_mask(std::vector<float> const & x, std::vector<float> const & y);
+Mask2D create_mask(std::span<float const> x, std::span<float const> y);
 
 
 std::pair<Point2D<uint32_t>, Point2D<uint32_t>> get_bounding_box(Mask2D const & mask);
@@ -16,7 +16,7 @@ Mask2D create_mask(std::vector<uint32_t> const & x, std::vector<uint32_t> const
     return new_mask;
 }
 
-Mask2D create_mask(std::vector<float> const & x, std::vector<float> const & y) {
+Mask2D create_mask(std::span<float const> x, std::span<float const> y) {
     auto new_mask = Mask2D{};
     new_mask.reserve(x.size());// Reserve space to avoid reallocations
 
@@ -37,10 +37,36 @@ _time_storage(DenseTimeRange(TimeFrameIndex(0), num_samples)) {
     setData(std::move(analog_vector));
 }
 
+AnalogTimeSeries::AnalogTimeSeries(std::span<float const> analog_values,
+                                   std::shared_ptr<void const> owner,
+                                   std::vector<TimeFrameIndex> time_vector) :
+_data(),
+_time_storage(DenseTimeRange(TimeFrameIndex(0), 0)) {
+    if (analog_values.size() != time_vector.size()) {
+        std::cerr << "Error: size of analog values and time vector are not the same!" << std::endl;
+        return;
+    }
+    _external = true;
+    _external_data = analog_values;
+    _external_owner = std::move(owner);
+    _setTimeStorage(std::move(time_vector));
+}
+
+AnalogTimeSeries::AnalogTimeSeries(std::span<float const> analog_values, std::shared_ptr<void const> owner) :
+_data(),
+_external(true),
+_external_data(analog_values),
+_external_owner(std::move(owner)),
+_time_storage(DenseTimeRange(TimeFrameIndex(0), analog_values.size())) {}
+
 void AnalogTimeSeries::setData(std::vector<float> analog_vector) {
+    _external = false;
+    _external_data = {};
+    _external_owner.reset();
     _data = std::move(analog_vector);
     // Use dense time storage for consecutive indices starting from 0
     _time_storage = DenseTimeRange(TimeFrameIndex(0), _data.size());
+    _invalidateSummaryStatistics();
 }
 
 void AnalogTimeSeries::setData(std::vector<float> analog_vector, std::vector<TimeFrameIndex> time_vector) {
@@ -49,8 +75,15 @@ void AnalogTimeSeries::setData(std::vector<float> analog_vector, std::vector<Tim
         return;
     }
     
+    _external = false;
+    _external_data = {};
+    _external_owner.reset();
     _data = std::move(analog_vector);
-    
+    _invalidateSummaryStatistics();
+    _setTimeStorage(std::move(time_vector));
+}
+
+void AnalogTimeSeries::_setTimeStorage(std::vector<TimeFrameIndex> time_vector) {
     // Check if we can use dense storage (consecutive indices)
     bool is_dense = true;
     if (!time_vector.empty()) {
@@ -71,6 +104,9 @@ void AnalogTimeSeries::setData(std::vector<float> analog_vector, std::vector<Tim
 }
 
 void AnalogTimeSeries::setData(std::map<int, float> analog_map) {
+    _external = false;
+    _external_data = {};
+    _external_owner.reset();
     _data.clear();
     _data = std::vector<float>();
     auto time_storage = std::vector<TimeFrameIndex>();
@@ -79,6 +115,7 @@ void AnalogTimeSeries::setData(std::map<int, float> analog_map) {
         _data.push_back(value);
     }
     _time_storage = SparseTimeIndices(std::move(time_storage));
+    _invalidateSummaryStatistics();
 }
 
 // ========== Overwriting Data ==========
@@ -88,6 +125,7 @@ void AnalogTimeSeries::overwriteAtTimeIndexes(std::vector<float> & analog_data,
         std::cerr << "Analog data and time indices vectors must be the same size" << std::endl;
         return;
     }
+    _convertToOwnedStorage();
 
     for (size_t i = 0; i < time_indices.size(); ++i) {
         // Find the DataArrayIndex that corresponds to this TimeFrameIndex
@@ -100,6 +138,7 @@ void AnalogTimeSeries::overwriteAtTimeIndexes(std::vector<float> & analog_data,
             std::cerr << "TimeFrameIndex " << time_indices[i].getValue() << " not found in time series" << std::endl;
         }
     }
+    _invalidateSummaryStatistics();
 }
 
 void AnalogTimeSeries::overwriteAtDataArrayIndexes(std::vector<float> & analog_data, std::vector<DataArrayIndex> & data_indices) {
@@ -107,6 +146,7 @@ void AnalogTimeSeries::overwriteAtDataArrayIndexes(std::vector<float> & analog_d
         std::cerr << "Analog data and data indices vectors must be the same size" << std::endl;
         return;
     }
+    _convertToOwnedStorage();
 
     for (size_t i = 0; i < data_indices.size(); ++i) {
         if (data_indices[i].getValue() < _data.size()) {
@@ -115,10 +155,59 @@ void AnalogTimeSeries::overwriteAtDataArrayIndexes(std::vector<float> & analog_d
             std::cerr << "DataArrayIndex " << data_indices[i].getValue() << " is out of bounds (data size: " << _data.size() << ")" << std::endl;
         }
     }
+    _invalidateSummaryStatistics();
+}
+
+void AnalogTimeSeries::_convertToOwnedStorage() {
+    if (!_external) {
+        return;
+    }
+    if (_data.size() != _external_data.size()) {
+        _data.assign(_external_data.begin(), _external_data.end());
+    }
+    _external = false;
+    _external_data = {};
+    _external_owner.reset();
+}
+
+// ========== Summary Statistics ==========
+
+SummaryStatistics const & AnalogTimeSeries::getSummaryStatistics() const {
+    std::lock_guard<std::mutex> const lock(_statistics_mutex.mutex);
+    if (!_summary_statistics.has_value()) {
+        _summary_statistics = calculate_summary(_samples());
+    }
+    return *_summary_statistics;
+}
+
+QuantileSketch const & AnalogTimeSeries::getQuantileSketch() const {
+    std::lock_guard<std::mutex> const lock(_statistics_mutex.mutex);
+    if (!_quantile_sketch.has_value()) {
+        QuantileSketch sketch;
+        sketch.update(_samples());
+        _quantile_sketch = std::move(sketch);
+    }
+    return *_quantile_sketch;
+}
+
+void AnalogTimeSeries::_invalidateSummaryStatistics() {
+    std::lock_guard<std::mutex> const lock(_statistics_mutex.mutex);
+    _summary_statistics.reset();
+    _quantile_sketch.reset();
 }
 
 // ========== Getting Data ==========
 
+std::vector<float> const & AnalogTimeSeries::getAnalogTimeSeries() const {
+    if (_external) {
+        std::lock_guard<std::mutex> const lock(_external_copy_mutex.mutex);
+        if (_data.size() != _external_data.size()) {
+            _data.assign(_external_data.begin(), _external_data.end());
+        }
+    }
+    return _data;
+}
+
 std::span<const float> AnalogTimeSeries::getDataInTimeFrameIndexRange(TimeFrameIndex start_time, TimeFrameIndex end_time) const {
     // Find the start and end indices using our boundary-finding methods
     auto start_index_opt = findDataArrayIndexGreaterOrEqual(start_time);
@@ -143,7 +232,7 @@ std::span<const float> AnalogTimeSeries::getDataInTimeFrameIndexRange(TimeFrameI
     size_t range_size = end_idx - start_idx + 1;
 
     // Return span from start_idx with range_size elements
-    return std::span<const float>(_data.data() + start_idx, range_size);
+    return _samples().subspan(start_idx, range_size);
 }
 
 
@@ -167,14 +256,127 @@ std::span<const float> AnalogTimeSeries::getDataInTimeFrameIndexRange(TimeFrameI
     auto end_time_value = source_timeFrame->getTimeAtIndex(end_time);
 
     // 2. Convert that time value to an index in the analog timeframe
-    auto target_start_index = analog_timeFrame->getIndexAtTime(static_cast<float>(start_time_value), false);
-    auto target_end_index = analog_timeFrame->getIndexAtTime(static_cast<float>(end_time_value));
+    auto target_start_index = analog_timeFrame->getIndexAtTime(static_cast<double>(start_time_value), false);
+    auto target_end_index = analog_timeFrame->getIndexAtTime(static_cast<double>(end_time_value));
 
     // 3. Use the converted indices to get the data in the target timeframe
     return getDataInTimeFrameIndexRange(target_start_index, target_end_index);
 }
 
 
+namespace {
+
+/**
+ * @brief std::partition_point that probes exponentially further from @p first
+ *
+ * Cost is logarithmic in the distance to the partition point rather than in the
+ * size of the whole range, which makes a sequence of forward searches linear overall.
+ */
+template<typename It, typename Pred>
+It gallop_partition_point(It first, It last, Pred pred) {
+    std::ptrdiff_t step = 1;
+    while (true) {
+        auto const remaining = std::distance(first, last);
+        if (remaining <= step) {
+            return std::partition_point(first, last, pred);
+        }
+        auto const probe = first + step;
+        if (!pred(*probe)) {
+            return std::partition_point(first, probe, pred);
+        }
+        first = probe + 1;
+        step *= 2;
+    }
+}
+
+}// namespace
+
+std::vector<std::pair<DataArrayIndex, DataArrayIndex>> AnalogTimeSeries::findDataArrayBoundsInTimeFrameIndexRanges(
+        std::span<TimeFrameInterval const> ranges,
+        TimeFrame const * source_timeFrame,
+        TimeFrame const * analog_timeFrame) const {
+
+    std::vector<std::pair<DataArrayIndex, DataArrayIndex>> bounds;
+    bounds.reserve(ranges.size());
+
+    bool const convert = source_timeFrame && analog_timeFrame && source_timeFrame != analog_timeFrame;
+
+    // Same conversion as getDataInTimeFrameIndexRange with timeframes, done for all
+    // range starts and all range ends at once so the analog clock is walked in order
+    std::vector<TimeFrameIndex> analog_starts;
+    std::vector<TimeFrameIndex> analog_ends;
+    if (convert) {
+        std::vector<TimeFrameIndex> starts;
+        std::vector<TimeFrameIndex> ends;
+        starts.reserve(ranges.size());
+        ends.reserve(ranges.size());
+        for (auto const & range: ranges) {
+            starts.push_back(range.start);
+            ends.push_back(range.end);
+        }
+        analog_starts = convertTimeFrameIndices(starts, source_timeFrame, analog_timeFrame, false);
+        analog_ends = convertTimeFrameIndices(ends, source_timeFrame, analog_timeFrame);
+    }
+
+    auto to_analog_range = [&](size_t r) -> std::pair<TimeFrameIndex, TimeFrameIndex> {
+        if (!convert) {
+            return {ranges[r].start, ranges[r].end};
+        }
+        return {analog_starts[r], analog_ends[r]};
+    };
+
+    auto const empty = std::make_pair(DataArrayIndex(0), DataArrayIndex(0));
+
+    std::visit([&](auto const & time_storage) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(time_storage)>, DenseTimeRange>) {
+            int64_t const first_time = time_storage.start_time_frame_index.getValue();
+            int64_t const last_time = first_time + static_cast<int64_t>(time_storage.count) - 1;
+
+            for (size_t r = 0; r < ranges.size(); ++r) {
+                auto const [start, end] = to_analog_range(r);
+                int64_t const clamped_start = std::max(start.getValue(), first_time);
+                int64_t const clamped_end = std::min(end.getValue(), last_time);
+                if (time_storage.count == 0 || clamped_start > clamped_end) {
+                    bounds.push_back(empty);
+                    continue;
+                }
+                bounds.emplace_back(DataArrayIndex(static_cast<size_t>(clamped_start - first_time)),
+                                    DataArrayIndex(static_cast<size_t>(clamped_end - first_time) + 1));
+            }
+        } else {
+            auto const & times = time_storage.time_frame_indices;
+            auto hint = times.begin();
+            std::optional<TimeFrameIndex> previous_start;
+
+            for (size_t r = 0; r < ranges.size(); ++r) {
+                auto const [start, end] = to_analog_range(r);
+
+                // Only continue the sweep while starts are non-decreasing
+                if (previous_start.has_value() && start < previous_start.value()) {
+                    hint = times.begin();
+                }
+                previous_start = start;
+
+                auto const first = gallop_partition_point(hint, times.end(),
+                                                          [start](TimeFrameIndex t) { return t < start; });
+                auto const last = gallop_partition_point(first, times.end(),
+                                                         [end](TimeFrameIndex t) { return t <= end; });
+                hint = first;
+
+                if (first >= last) {
+                    bounds.push_back(empty);
+                    continue;
+                }
+                bounds.emplace_back(DataArrayIndex(static_cast<size_t>(std::distance(times.begin(), first))),
+                                    DataArrayIndex(static_cast<size_t>(std::distance(times.begin(), last))));
+            }
+        }
+    }, _time_storage);
+
+    return bounds;
+}
+
+
 // ========== TimeFrame Support ==========
 
 std::optional<DataArrayIndex> AnalogTimeSeries::findDataArrayIndexForTimeFrameIndex(TimeFrameIndex time_index) const {
@@ -1,16 +1,22 @@
 #ifndef ANALOG_TIME_SERIES_HPP
 #define ANALOG_TIME_SERIES_HPP
 
+#include "AnalogTimeSeries/utils/quantile_sketch.hpp"
+#include "AnalogTimeSeries/utils/statistics.hpp"
 #include "Observer/Observer_Data.hpp"
 #include "TimeFrame/StrongTimeTypes.hpp"
 #include "TimeFrame/TimeFrame.hpp"
+#include "TimeFrame/interval_data.hpp"
 
 #include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <ranges>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 #include <variant>
 #include <span>
@@ -72,6 +78,30 @@ public:
      */
     explicit AnalogTimeSeries(std::vector<float> analog_vector, size_t num_samples);
 
+    /**
+     * @brief Constructor for AnalogTimeSeries that views samples stored elsewhere
+     *
+     * No samples are copied: the series reads @p analog_values in place, for example
+     * straight from a memory-mapped .npy file, and holds @p owner to keep that memory
+     * alive. The samples are copied into the series the first time they are modified
+     * or requested as a std::vector through getAnalogTimeSeries().
+     *
+     * @param analog_values Samples to view
+     * @param owner Keeps @p analog_values valid for the lifetime of the series
+     * @param time_vector TimeFrameIndex of each sample
+     * @see getAnalogTimeSeriesSpan() for zero-copy access to all samples
+     */
+    explicit AnalogTimeSeries(std::span<float const> analog_values,
+                              std::shared_ptr<void const> owner,
+                              std::vector<TimeFrameIndex> time_vector);
+
+    /**
+     * @brief Constructor for AnalogTimeSeries that views consecutive samples stored elsewhere
+     *
+     * Same as the constructor above, with sample i at TimeFrameIndex i.
+     */
+    explicit AnalogTimeSeries(std::span<float const> analog_values, std::shared_ptr<void const> owner);
+
     // ========== Overwriting Data ==========
 
     /**
@@ -109,9 +139,9 @@ public:
      * @param i The DataArrayIndex to get the data value at
      * @return The data value at the specified DataArrayIndex
      */
-    [[nodiscard]] float getDataAtDataArrayIndex(DataArrayIndex i) const { return _data[i.getValue()]; };
+    [[nodiscard]] float getDataAtDataArrayIndex(DataArrayIndex i) const { return _samples()[i.getValue()]; };
 
-    [[nodiscard]] size_t getNumSamples() const { return _data.size(); };
+    [[nodiscard]] size_t getNumSamples() const { return _samples().size(); };
 
     /**
      * @brief Get a const reference to the analog data vector
@@ -123,11 +153,25 @@ public:
      * 
      * @note This method returns by const reference for performance - no data copying occurs.
      *       Use this when you need to iterate over or access the raw data values efficiently.
+     *       A series that views external samples (e.g. a memory-mapped file) copies them
+     *       into a vector once, on the first call from any thread; prefer
+     *       getAnalogTimeSeriesSpan(), which never copies.
      * 
      * @see getTimeSeries() for accessing the corresponding time indices
      * @see getDataInRange() for accessing data within a specific time range
      */
-    [[nodiscard]] std::vector<float> const & getAnalogTimeSeries() const { return _data; };
+    [[nodiscard]] std::vector<float> const & getAnalogTimeSeries() const;
+
+    /**
+     * @brief Get a span (view) of all data values
+     *
+     * Zero-copy for every kind of storage, including samples viewed in a
+     * memory-mapped file.
+     *
+     * @note The span is valid as long as the AnalogTimeSeries object exists and is not modified
+     * @see getAnalogTimeSeries() for a std::vector
+     */
+    [[nodiscard]] std::span<float const> getAnalogTimeSeriesSpan() const { return _samples(); }
 
      /**
      * @brief Get a span (view) of data values within a TimeFrameIndex range
@@ -177,6 +221,26 @@ public:
                                                                       TimeFrame const * analog_timeFrame) const;
 
 
+    /**
+     * @brief Find the DataArrayIndex bounds of many TimeFrameIndex ranges at once
+     *
+     * Gives the same slices as calling getDataInTimeFrameIndexRange() for every range,
+     * with the same boundary approximation and timeframe conversion, but resolves
+     * them together. For sparse time storage, ranges sorted by start are located with
+     * a galloping search that continues from the previous range instead of a fresh
+     * binary search over the whole series; unsorted ranges are still handled correctly.
+     *
+     * @param ranges The [start, end] (inclusive) TimeFrameIndex ranges, expressed in source_timeFrame
+     * @param source_timeFrame The timeframe that the ranges are expressed in
+     * @param analog_timeFrame The timeframe that this data series uses
+     * @return Half-open [first, second) DataArrayIndex bounds for each range, in input order.
+     *         Ranges without data have first == second.
+     */
+    [[nodiscard]] std::vector<std::pair<DataArrayIndex, DataArrayIndex>> findDataArrayBoundsInTimeFrameIndexRanges(
+            std::span<TimeFrameInterval const> ranges,
+            TimeFrame const * source_timeFrame,
+            TimeFrame const * analog_timeFrame) const;
+
         /**
      * @brief Find the DataArrayIndex that corresponds to a given TimeFrameIndex
      * 
@@ -212,6 +276,37 @@ public:
     [[nodiscard]] std::optional<DataArrayIndex> findDataArrayIndexLessOrEqual(TimeFrameIndex target_time) const;
 
 
+    // ========== Summary Statistics ==========
+
+    /**
+     * @brief Get the count, mean, variance, minimum and maximum of all samples
+     *
+     * Computed in a single pass on first use and cached until the data is modified,
+     * so repeated scaling or display queries do not rescan the series.
+     *
+     * @return const reference to the cached SummaryStatistics
+     *
+     * @note The cache is filled by the first const call, under a lock, so concurrent
+     *       readers are safe. Modifying the series invalidates it; like the data
+     *       itself, do not query it while another thread modifies the series.
+     * @see calculate_summary() for summaries of sub-ranges
+     */
+    [[nodiscard]] SummaryStatistics const & getSummaryStatistics() const;
+
+    /**
+     * @brief Get a quantile sketch of all samples
+     *
+     * Built in a single pass on first use, without copying or sorting the data,
+     * and cached until the data is modified.
+     *
+     * @return const reference to the cached QuantileSketch
+     *
+     * @note Filled by the first const call under the same lock as
+     *       getSummaryStatistics(); modifying the series invalidates it.
+     * @see calculate_quantile_exact() when exact quantiles are required
+     */
+    [[nodiscard]] QuantileSketch const & getQuantileSketch() const;
+
     // ========== Time-Value Range Access ==========
 
     /**
@@ -470,10 +565,46 @@ public:
 
 protected:
 private:
-    std::vector<float> _data;
+    // Owned samples. While viewing external samples this is empty, or a copy
+    // made on demand by getAnalogTimeSeries(), hence mutable.
+    mutable std::vector<float> _data;
+
+    // Mutex for state filled from const methods. A copied series gets its own
+    // mutex; the guarded state itself is copied as usual.
+    struct CopyableMutex {
+        CopyableMutex() = default;
+        CopyableMutex(CopyableMutex const &) {}
+        CopyableMutex & operator=(CopyableMutex const &) { return *this; }
+        std::mutex mutex;
+    };
+
+    // Serializes the on-demand copy of external samples
+    mutable CopyableMutex _external_copy_mutex;
+
+    bool _external{false};
+    std::span<float const> _external_data;
+    std::shared_ptr<void const> _external_owner;
     TimeStorage _time_storage;
     std::shared_ptr<TimeFrame> _time_frame {nullptr};
 
+    // Caches filled by the first const call, guarded by _statistics_mutex
+    mutable CopyableMutex _statistics_mutex;
+    mutable std::optional<SummaryStatistics> _summary_statistics;
+    mutable std::optional<QuantileSketch> _quantile_sketch;
+
+    void _invalidateSummaryStatistics();
+
+    [[nodiscard]] std::span<float const> _samples() const {
+        return _external ? _external_data : std::span<float const>(_data);
+    }
+
+    /**
+     * @brief Copy viewed external samples into _data so they can be modified
+     */
+    void _convertToOwnedStorage();
+
+    void _setTimeStorage(std::vector<TimeFrameIndex> time_vector);
+
     void setData(std::vector<float> analog_vector);
     void setData(std::vector<float> analog_vector, std::vector<TimeFrameIndex> time_vector);
     void setData(std::map<int, float> analog_map);
@@ -7,6 +7,7 @@
 
 #include <cmath>
 #include <map>
+#include <numeric>
 #include <ranges>
 #include <random>
 #include <vector>
@@ -579,6 +580,67 @@ TEST_CASE("AnalogTimeSeries - getDataInTimeFrameIndexRange functionality", "[ana
     }
 }
 
+TEST_CASE("AnalogTimeSeries - findDataArrayBoundsInTimeFrameIndexRanges matches per-range lookup", "[analog][timeseries][span_range][batch]") {
+
+    auto check_matches_single_lookups = [](AnalogTimeSeries const & series, std::vector<TimeFrameInterval> const & ranges) {
+        auto const bounds = series.findDataArrayBoundsInTimeFrameIndexRanges(ranges, nullptr, nullptr);
+        REQUIRE(bounds.size() == ranges.size());
+
+        auto const & data = series.getAnalogTimeSeries();
+        for (size_t i = 0; i < ranges.size(); ++i) {
+            auto const expected = series.getDataInTimeFrameIndexRange(ranges[i].start, ranges[i].end);
+            auto const [first, last] = bounds[i];
+            REQUIRE(last - first == expected.size());
+            if (!expected.empty()) {
+                REQUIRE(expected.data() == data.data() + first.getValue());
+            }
+        }
+    };
+
+    std::vector<TimeFrameInterval> const ranges{
+            {TimeFrameIndex(0), TimeFrameIndex(15)},
+            {TimeFrameIndex(10), TimeFrameIndex(30)},
+            {TimeFrameIndex(31), TimeFrameIndex(39)},
+            {TimeFrameIndex(35), TimeFrameIndex(100)},
+            {TimeFrameIndex(5), TimeFrameIndex(25)},// out of order
+            {TimeFrameIndex(60), TimeFrameIndex(40)},// inverted
+            {TimeFrameIndex(200), TimeFrameIndex(300)}// past the end
+    };
+
+    SECTION("Sparse storage") {
+        std::vector<float> data{1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+        std::vector<TimeFrameIndex> times{TimeFrameIndex(10), TimeFrameIndex(20), TimeFrameIndex(30), TimeFrameIndex(40), TimeFrameIndex(50)};
+        AnalogTimeSeries series(data, times);
+
+        check_matches_single_lookups(series, ranges);
+    }
+
+    SECTION("Dense storage") {
+        std::vector<float> data(60);
+        std::iota(data.begin(), data.end(), 0.0f);
+        AnalogTimeSeries series(data, data.size());
+
+        check_matches_single_lookups(series, ranges);
+    }
+
+    SECTION("Many sorted ranges over sparse storage") {
+        std::vector<float> data;
+        std::vector<TimeFrameIndex> times;
+        for (int64_t i = 0; i < 5000; ++i) {
+            data.push_back(static_cast<float>(i));
+            times.emplace_back(i * 3);
+        }
+        AnalogTimeSeries series(data, times);
+
+        std::vector<TimeFrameInterval> many_ranges;
+        for (int64_t start = 0; start < 15000; start += 7) {
+            many_ranges.push_back({TimeFrameIndex(start), TimeFrameIndex(start + 11)});
+        }
+
+        check_matches_single_lookups(series, many_ranges);
+    }
+}
+
 TEST_CASE("AnalogTimeSeries - findDataArrayIndexForTimeFrameIndex functionality", "[analog][timeseries][index_lookup]") {
 
     SECTION("Regular spacing - even TimeFrameIndex values") {
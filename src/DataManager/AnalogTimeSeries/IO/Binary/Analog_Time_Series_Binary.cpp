@@ -4,7 +4,8 @@
 #include "AnalogTimeSeries/Analog_Time_Series.hpp"
 #include "loaders/binary_loaders.hpp"
 
-#include <iostream>
+#include <algorithm>
+#include <iterator>
 
 
 std::vector<std::shared_ptr<AnalogTimeSeries>> load(BinaryAnalogLoaderOptions & opts) {
@@ -19,8 +20,6 @@ std::vector<std::shared_ptr<AnalogTimeSeries>> load(BinaryAnalogLoaderOptions &
 
         auto data = Loader::readBinaryFileMultiChannel<int16_t>(binary_loader_opts);
 
-        std::cout << "Read " << data.size() << " channels" << std::endl;
-
         for (auto & channel: data) {
             // convert to float with std::transform
             std::vector<float> data_float;
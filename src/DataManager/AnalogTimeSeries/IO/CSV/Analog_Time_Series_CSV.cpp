@@ -1,5 +1,6 @@
 #include "Analog_Time_Series_CSV.hpp"
 #include "AnalogTimeSeries/Analog_Time_Series.hpp"
+#include "loaders/CSV_Engine.hpp"
 
 #include <fstream>
 #include <iostream>
@@ -11,88 +12,89 @@
 
 std::vector<float> load_analog_series_from_csv(std::string const & filename) {
 
-    std::string csv_line;
-    std::fstream myfile;
-    myfile.open(filename, std::fstream::in);
+    Loader::MappedFile const file(filename);
 
-    if (!myfile.is_open()) {
+    if (!file.isOpen()) {
         std::cerr << "Error: File " << filename << " not found." << std::endl;
         return {};
     }
 
-    std::string y_str;
-    auto output = std::vector<float>{};
-
-    while (getline(myfile, csv_line)) {
-
-        std::stringstream ss(csv_line);
-
-        getline(ss, y_str);
-
-        output.push_back(std::stof(y_str));
-    }
-
-    myfile.close();
-
-    return output;
+    return Loader::parseLines<float>(file.view(), '\n', [](std::string_view csv_line, std::vector<float> & output) {
+        float value = 0.0f;
+        if (!Loader::parseFloat(csv_line, value)) {
+            throw std::invalid_argument("Could not parse value: " + std::string(csv_line));
+        }
+        output.push_back(value);
+    });
 }
 
 std::shared_ptr<AnalogTimeSeries> load(CSVAnalogLoaderOptions const & options) {
-    std::ifstream file(options.filepath);
-    if (!file.is_open()) {
+    Loader::MappedFile const file(options.filepath);
+    if (!file.isOpen()) {
         throw std::runtime_error("Error: Could not open file: " + options.filepath);
     }
 
-    std::vector<float> data_values;
-    std::vector<TimeFrameIndex> time_values;
-    std::string line;
-    
+    auto text = file.view();
+
     // Skip header if present
-    if (options.has_header && std::getline(file, line)) {
-        // Header line consumed, continue with data
+    if (options.has_header) {
+        text = Loader::skipLines(text, 1);
     }
 
-    while (std::getline(file, line)) {
-        if (line.empty()) continue;
-        
-        std::stringstream ss(line);
-        std::string cell;
-        std::vector<std::string> row;
-        
-        // Parse the line based on delimiter
-        while (std::getline(ss, cell, options.delimiter[0])) {
-            row.push_back(cell);
-        }
-        
-        if (row.empty()) continue;
-        
-        try {
+    char const delimiter = options.delimiter.empty() ? ',' : options.delimiter[0];
+    size_t const time_column = static_cast<size_t>(options.time_column);
+    size_t const data_column = static_cast<size_t>(options.data_column);
+    size_t const last_column = options.single_column_format ? 0 : std::max(time_column, data_column);
+
+    // Time is left as 0 in single column format and inferred from the row index below
+    using Sample = std::pair<int64_t, float>;
+    auto const samples = Loader::parseLines<Sample>(text, '\n', [&](std::string_view line, std::vector<Sample> & out) {
+        if (line.empty()) return;
+
+        std::string_view time_field;
+        std::string_view data_field;
+        size_t num_fields = 0;
+        Loader::forEachField(line, delimiter, [&](size_t index, std::string_view cell) {
             if (options.single_column_format) {
-                // Single column format: only data, time is inferred as index
-                if (!row.empty()) {
-                    data_values.push_back(std::stof(row[0]));
-                    time_values.push_back(TimeFrameIndex(static_cast<int64_t>(time_values.size()))); // Use index as time
-                }
+                data_field = cell;
             } else {
-                // Two column format: time and data columns
-                if (row.size() > static_cast<size_t>(std::max(options.time_column, options.data_column))) {
-                    time_values.push_back(TimeFrameIndex(static_cast<int64_t>(std::stof(row[static_cast<size_t>(options.time_column)]))));
-                    data_values.push_back(std::stof(row[static_cast<size_t>(options.data_column)]));
-                }
+                if (index == time_column) time_field = cell;
+                if (index == data_column) data_field = cell;
             }
-        } catch (std::exception const & e) {
-            std::cerr << "Warning: Could not parse line: " << line << " - " << e.what() << std::endl;
-            continue;
+            num_fields = index + 1;
+            return index < last_column;
+        });
+
+        if (num_fields <= last_column) {
+            return;
         }
-    }
-    
-    file.close();
-    
-    if (data_values.empty()) {
+
+        float time = 0.0f;
+        float value = 0.0f;
+        if ((!options.single_column_format && !Loader::parseFloat(time_field, time)) ||
+            !Loader::parseFloat(data_field, value)) {
+            std::cerr << "Warning: Could not parse line: " << line << std::endl;
+            return;
+        }
+        out.emplace_back(static_cast<int64_t>(time), value);
+    });
+
+    if (samples.empty()) {
         throw std::runtime_error("Error: No valid data found in file: " + options.filepath);
     }
-    
-    return std::make_shared<AnalogTimeSeries>(data_values, time_values);
+
+    std::vector<float> data_values;
+    std::vector<TimeFrameIndex> time_values;
+    data_values.reserve(samples.size());
+    time_values.reserve(samples.size());
+    for (auto const & [time, value]: samples) {
+        // Single column format: only data, time is inferred as index
+        int64_t const t = options.single_column_format ? static_cast<int64_t>(time_values.size()) : time;
+        time_values.push_back(TimeFrameIndex(t));
+        data_values.push_back(value);
+    }
+
+    return std::make_shared<AnalogTimeSeries>(std::move(data_values), std::move(time_values));
 }
 
 void save(AnalogTimeSeries * analog_data,
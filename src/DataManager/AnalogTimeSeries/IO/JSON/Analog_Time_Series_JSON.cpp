@@ -4,6 +4,7 @@
 #include "AnalogTimeSeries/Analog_Time_Series.hpp"
 #include "AnalogTimeSeries/IO/Binary/Analog_Time_Series_Binary.hpp"
 #include "AnalogTimeSeries/IO/CSV/Analog_Time_Series_CSV.hpp"
+#include "AnalogTimeSeries/IO/numpy/Analog_Time_Series_numpy.hpp"
 #include "utils/json_helpers.hpp"
 
 #include <iostream>
@@ -11,6 +12,7 @@
 AnalogDataType stringToAnalogDataType(std::string const & data_type_str) {
     if (data_type_str == "int16") return AnalogDataType::int16;
     if (data_type_str == "csv") return AnalogDataType::csv;
+    if (data_type_str == "numpy") return AnalogDataType::numpy;
     return AnalogDataType::Unknown;
 }
 
@@ -56,6 +58,15 @@ std::vector<std::shared_ptr<AnalogTimeSeries>> load_into_AnalogTimeSeries(std::s
 
             break;
         }
+        case AnalogDataType::numpy: {
+
+            auto opts = NumpyAnalogLoaderOptions();
+            opts.filepath = file_path;
+            opts.array_name = item.value("array", "");
+            analog_time_series = load(opts);
+
+            break;
+        }
         default: {
             std::cout << "Format " << data_type_str << " not found " << std::endl;
         }
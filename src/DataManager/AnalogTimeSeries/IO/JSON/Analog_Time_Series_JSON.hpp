@@ -10,6 +10,7 @@
 enum class AnalogDataType {
     int16,
     csv,
+    numpy,
     Unknown
 };
 
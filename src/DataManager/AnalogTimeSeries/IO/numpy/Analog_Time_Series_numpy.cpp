@@ -0,0 +1,96 @@
+#include "Analog_Time_Series_numpy.hpp"
+
+#include "AnalogTimeSeries/Analog_Time_Series.hpp"
+#include "Tracing/Tracing.hpp"
+#include "loaders/Npy_Reader.hpp"
+#include "utils/parallel_for.hpp"
+
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+
+// Samples converted per task when the data cannot be viewed in place
+constexpr size_t min_samples_per_task = size_t{1} << 16;
+
+/**
+ * @brief Path of the optional sample-time file next to an analog .npy file
+ */
+std::filesystem::path times_path_for(std::string const & filepath) {
+    std::filesystem::path path(filepath);
+    path.replace_extension(".times.npy");
+    return path;
+}
+
+std::vector<TimeFrameIndex> load_sample_times(std::string const & filepath, size_t num_samples) {
+    auto const times_path = times_path_for(filepath);
+    if (!std::filesystem::exists(times_path)) {
+        return {};
+    }
+    auto const npy_times = Loader::NpyArray::openNpy(times_path.string()).toVector<int64_t>();
+    if (npy_times.size() != num_samples) {
+        std::cerr << "Ignoring " << times_path << ": expected " << num_samples << " sample times" << std::endl;
+        return {};
+    }
+    std::vector<TimeFrameIndex> times;
+    times.reserve(num_samples);
+    for (int64_t const time: npy_times) {
+        times.emplace_back(time);
+    }
+    return times;
+}
+
+}// namespace
+
+std::vector<std::shared_ptr<AnalogTimeSeries>> load(NumpyAnalogLoaderOptions const & options) {
+    TRACE_ZONE_NAMED(zone, "load numpy analog", "loader", options.filepath);
+
+    std::vector<std::shared_ptr<AnalogTimeSeries>> analog_time_series;
+
+    try {
+        auto const array = Loader::NpyArray::open(options.filepath, options.array_name);
+        auto const & shape = array.shape();
+        if (shape.empty() || shape.size() > 2) {
+            std::cerr << "Error: expected a 1-D or 2-D array in " << options.filepath << std::endl;
+            return analog_time_series;
+        }
+
+        size_t const num_samples = shape[0];
+        size_t const num_channels = shape.size() == 2 ? shape[1] : 1;
+        auto const times = load_sample_times(options.filepath, num_samples);
+
+        // Channel c starts at element first and advances by stride in storage order
+        bool const channels_contiguous = num_channels == 1 || array.fortranOrder();
+        size_t const stride = channels_contiguous ? 1 : num_channels;
+
+        for (size_t channel = 0; channel < num_channels; ++channel) {
+            size_t const first = channels_contiguous ? channel * num_samples : channel;
+
+            if (channels_contiguous && array.hasNativeType<float>()) {
+                auto const samples = array.view<float>().subspan(first, num_samples);
+                analog_time_series.push_back(times.empty()
+                                                     ? std::make_shared<AnalogTimeSeries>(samples, array.owner())
+                                                     : std::make_shared<AnalogTimeSeries>(samples, array.owner(), times));
+                continue;
+            }
+
+            std::vector<float> samples(num_samples);
+            parallel_for_chunks(num_samples, min_samples_per_task, [&](size_t begin, size_t end) {
+                array.convert<float>(first + begin * stride, stride, std::span<float>(samples).subspan(begin, end - begin));
+            });
+            analog_time_series.push_back(times.empty()
+                                                 ? std::make_shared<AnalogTimeSeries>(std::move(samples), num_samples)
+                                                 : std::make_shared<AnalogTimeSeries>(std::move(samples), times));
+        }
+
+        TRACE_ZONE_VALUE(zone, "channels", num_channels);
+        TRACE_ZONE_VALUE(zone, "samples", num_samples);
+
+    } catch (std::exception const & e) {
+        std::cerr << "Error loading analog data from " << options.filepath << ": " << e.what() << std::endl;
+        analog_time_series.clear();
+    }
+
+    return analog_time_series;
+}
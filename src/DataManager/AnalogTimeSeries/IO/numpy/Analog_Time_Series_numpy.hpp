@@ -0,0 +1,32 @@
+#ifndef ANALOG_TIME_SERIES_NUMPY_HPP
+#define ANALOG_TIME_SERIES_NUMPY_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class AnalogTimeSeries;
+
+struct NumpyAnalogLoaderOptions {
+    std::string filepath;
+    std::string array_name{};// Array to load from an .npz archive; empty for its first array
+};
+
+/**
+ * @brief Load analog time series from a .npy file or an .npz archive written by numpy.savez
+ *
+ * A 1-D array gives one series. A 2-D array of shape (samples, channels) gives
+ * one series per channel. Sample i is at TimeFrameIndex i unless a 1-D integer
+ * array of sample times is stored next to the file as "<name>.times.npy".
+ *
+ * The file is memory-mapped. float32 samples in native byte order that are
+ * contiguous for a channel (1-D arrays, single-channel or Fortran-ordered 2-D
+ * arrays) are viewed in place, so opening them does not read the data. Other
+ * dtypes and layouts are converted to float32 once, in parallel chunks.
+ *
+ * @param options Configuration options for loading
+ * @return One AnalogTimeSeries per channel; empty if the file could not be loaded
+ */
+std::vector<std::shared_ptr<AnalogTimeSeries>> load(NumpyAnalogLoaderOptions const & options);
+
+#endif// ANALOG_TIME_SERIES_NUMPY_HPP
@@ -0,0 +1,115 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "AnalogTimeSeries/Analog_Time_Series.hpp"
+#include "AnalogTimeSeries/IO/numpy/Analog_Time_Series_numpy.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Version 1.0 .npy file in this machine's byte order, data 64-byte aligned as numpy writes it
+template<typename T>
+void write_npy(std::filesystem::path const & path, std::string const & descr, bool fortran_order,
+               std::string const & shape, std::vector<T> const & values) {
+    std::string header = "{'descr': '" + descr + "', 'fortran_order': " + (fortran_order ? "True" : "False") +
+                         ", 'shape': " + shape + ", }";
+    header.append(63 - (10 + header.size()) % 64, ' ');
+    header += '\n';
+
+    std::ofstream out(path, std::ios::binary);
+    out.write("\x93NUMPY\x01\x00", 8);
+    out.put(static_cast<char>(header.size() & 0xFF));
+    out.put(static_cast<char>(header.size() >> 8));
+    out.write(header.data(), static_cast<std::streamsize>(header.size()));
+    out.write(reinterpret_cast<char const *>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+std::string native(std::string const & type) {
+    return (std::endian::native == std::endian::little ? "<" : ">") + type;
+}
+
+}// namespace
+
+TEST_CASE("Analog - Load numpy", "[DataManager][numpy]") {
+    auto const directory = std::filesystem::temp_directory_path() / "whiskertoolbox_analog_npy_test";
+    std::filesystem::create_directories(directory);
+    auto const path = directory / "analog.npy";
+
+    SECTION("1-D float32 is viewed in the mapped file") {
+        write_npy(path, native("f4"), false, "(5,)", std::vector<float>{1, 2, 3, 4, 5});
+
+        auto const series = load(NumpyAnalogLoaderOptions{.filepath = path.string()});
+        REQUIRE(series.size() == 1);
+        REQUIRE(series[0]->getNumSamples() == 5);
+        REQUIRE(series[0]->getDataAtDataArrayIndex(DataArrayIndex(3)) == 4.0f);
+        REQUIRE(series[0]->getTimeFrameIndexAtDataArrayIndex(DataArrayIndex(4)) == TimeFrameIndex(4));
+        REQUIRE(series[0]->getSummaryStatistics().max == 5.0);
+
+        // Span accessors read the mapped file in place
+        auto const view = series[0]->getAnalogTimeSeriesSpan();
+        REQUIRE(std::vector<float>(view.begin(), view.end()) == std::vector<float>{1, 2, 3, 4, 5});
+        REQUIRE(series[0]->getDataInTimeFrameIndexRange(TimeFrameIndex(1), TimeFrameIndex(2)).data() == view.data() + 1);
+
+        // The vector accessor is a fallback: it copies once, even when first called from several threads
+        std::vector<float const *> copies(4, nullptr);
+        std::vector<std::thread> readers;
+        for (std::size_t i = 0; i < copies.size(); ++i) {
+            readers.emplace_back([&series, &copies, i] { copies[i] = series[0]->getAnalogTimeSeries().data(); });
+        }
+        for (auto & reader: readers) {
+            reader.join();
+        }
+        auto const & copy = series[0]->getAnalogTimeSeries();
+        REQUIRE(copy == std::vector<float>{1, 2, 3, 4, 5});
+        REQUIRE(view.data() != copy.data());
+        for (auto const * data: copies) {
+            REQUIRE(data == copy.data());
+        }
+        REQUIRE(series[0]->getAnalogTimeSeriesSpan().data() == view.data());
+
+        // Writes go to an owned copy
+        std::vector<float> values{-1.0f};
+        std::vector<DataArrayIndex> indices{DataArrayIndex(0)};
+        series[0]->overwriteAtDataArrayIndexes(values, indices);
+        REQUIRE(series[0]->getAnalogTimeSeries() == std::vector<float>{-1, 2, 3, 4, 5});
+        REQUIRE(series[0]->getAnalogTimeSeriesSpan().data() == series[0]->getAnalogTimeSeries().data());
+    }
+
+    SECTION("2-D int16 gives one converted series per channel") {
+        // Three samples of two channels in C order, with sparse sample times next to the data
+        write_npy(path, native("i2"), false, "(3, 2)", std::vector<int16_t>{10, -10, 20, -20, 30, -30});
+        write_npy(directory / "analog.times.npy", native("i8"), false, "(3,)", std::vector<int64_t>{100, 200, 400});
+
+        auto const series = load(NumpyAnalogLoaderOptions{.filepath = path.string()});
+        REQUIRE(series.size() == 2);
+        REQUIRE(series[0]->getAnalogTimeSeries() == std::vector<float>{10, 20, 30});
+        REQUIRE(series[1]->getAnalogTimeSeries() == std::vector<float>{-10, -20, -30});
+        REQUIRE(series[1]->getTimeSeries() == std::vector<TimeFrameIndex>{TimeFrameIndex(100), TimeFrameIndex(200), TimeFrameIndex(400)});
+
+        std::filesystem::remove(directory / "analog.times.npy");
+    }
+
+    SECTION("Fortran-ordered float32 channels are viewed in place") {
+        write_npy(path, native("f4"), true, "(2, 2)", std::vector<float>{1, 2, 3, 4});
+
+        auto const series = load(NumpyAnalogLoaderOptions{.filepath = path.string()});
+        REQUIRE(series.size() == 2);
+        REQUIRE(series[1]->getAnalogTimeSeriesSpan().data() == series[0]->getAnalogTimeSeriesSpan().data() + 2);
+        REQUIRE(series[1]->getDataAtDataArrayIndex(DataArrayIndex(1)) == 4.0f);
+    }
+
+    SECTION("Unsupported files load nothing") {
+        write_npy(path, native("f4"), false, "(1, 1, 1)", std::vector<float>{1});
+        REQUIRE(load(NumpyAnalogLoaderOptions{.filepath = path.string()}).empty());
+        REQUIRE(load(NumpyAnalogLoaderOptions{.filepath = (directory / "missing.npy").string()}).empty());
+    }
+
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,166 @@
+#include "quantile_sketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace {
+
+// Each level below the top may hold 2/3 as many items as the one above it
+constexpr double level_capacity_ratio = 2.0 / 3.0;
+
+// Lower levels never shrink below this, so compactions stay worthwhile
+constexpr size_t min_level_capacity = 8;
+
+}// namespace
+
+QuantileSketch::QuantileSketch(uint16_t k)
+    : _k(std::max<uint16_t>(k, static_cast<uint16_t>(min_level_capacity))),
+      _levels(1) {
+    _updateMaxRetained();
+}
+
+void QuantileSketch::update(float value) {
+    if (std::isnan(value)) {
+        return;
+    }
+
+    ++_count;
+    _min = std::min(_min, value);
+    _max = std::max(_max, value);
+
+    _levels[0].push_back(value);
+    if (++_retained >= _max_retained) {
+        _compress();
+    }
+}
+
+void QuantileSketch::update(std::span<float const> values) {
+    for (float const value: values) {
+        update(value);
+    }
+}
+
+void QuantileSketch::merge(QuantileSketch const & other) {
+    if (other._count == 0) {
+        return;
+    }
+
+    if (other._levels.size() > _levels.size()) {
+        _levels.resize(other._levels.size());
+    }
+    for (size_t level = 0; level < other._levels.size(); ++level) {
+        _levels[level].insert(_levels[level].end(), other._levels[level].begin(), other._levels[level].end());
+    }
+
+    _count += other._count;
+    _retained += other._retained;
+    _min = std::min(_min, other._min);
+    _max = std::max(_max, other._max);
+
+    _updateMaxRetained();
+    while (_retained >= _max_retained) {
+        size_t const before = _retained;
+        _compress();
+        if (_retained == before) {
+            break;
+        }
+    }
+}
+
+float QuantileSketch::quantile(double q) const {
+    if (_count == 0) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+
+    q = std::clamp(q, 0.0, 1.0);
+    if (q == 0.0) {
+        return _min;
+    }
+    if (q == 1.0) {
+        return _max;
+    }
+
+    std::vector<std::pair<float, uint64_t>> items;
+    items.reserve(_retained);
+    for (size_t level = 0; level < _levels.size(); ++level) {
+        uint64_t const weight = uint64_t{1} << level;
+        for (float const value: _levels[level]) {
+            items.emplace_back(value, weight);
+        }
+    }
+    std::sort(items.begin(), items.end(), [](auto const & a, auto const & b) { return a.first < b.first; });
+
+    auto const value_at_rank = [&items](uint64_t rank) {
+        uint64_t cumulative = 0;
+        for (auto const & [value, weight]: items) {
+            cumulative += weight;
+            if (cumulative > rank) {
+                return value;
+            }
+        }
+        return items.back().first;
+    };
+
+    double const position = q * static_cast<double>(_count - 1);
+    double const lower_position = std::floor(position);
+    auto const lower_rank = static_cast<uint64_t>(lower_position);
+    uint64_t const upper_rank = std::min<uint64_t>(lower_rank + 1, _count - 1);
+
+    double const lower = value_at_rank(lower_rank);
+    double const upper = value_at_rank(upper_rank);
+    return static_cast<float>(lower + (position - lower_position) * (upper - lower));
+}
+
+size_t QuantileSketch::_capacity(size_t level) const {
+    auto const depth = static_cast<double>(_levels.size() - 1 - level);
+    auto const capacity = static_cast<size_t>(std::ceil(static_cast<double>(_k) * std::pow(level_capacity_ratio, depth)));
+    return std::max(capacity, min_level_capacity);
+}
+
+void QuantileSketch::_updateMaxRetained() {
+    _max_retained = 0;
+    for (size_t level = 0; level < _levels.size(); ++level) {
+        _max_retained += _capacity(level);
+    }
+}
+
+void QuantileSketch::_compress() {
+    for (size_t level = 0; level < _levels.size(); ++level) {
+        if (_levels[level].size() < _capacity(level)) {
+            continue;
+        }
+        if (level + 1 == _levels.size()) {
+            _levels.emplace_back();
+            _updateMaxRetained();
+        }
+
+        auto & items = _levels[level];
+        auto & next = _levels[level + 1];
+        std::sort(items.begin(), items.end());
+
+        // An odd item out stays on this level so the total weight is preserved exactly
+        size_t const kept = items.size() % 2;
+        size_t const compacted = items.size() - kept;
+        for (size_t i = _randomBit() ? 1 : 0; i < compacted; i += 2) {
+            next.push_back(items[i]);
+        }
+        if (kept != 0) {
+            items[0] = items.back();
+        }
+        items.resize(kept);
+        _retained -= compacted / 2;
+
+        if (_retained < _max_retained) {
+            break;
+        }
+    }
+}
+
+bool QuantileSketch::_randomBit() {
+    // xorshift64
+    _random_state ^= _random_state << 13;
+    _random_state ^= _random_state >> 7;
+    _random_state ^= _random_state << 17;
+    return (_random_state & 1u) != 0;
+}
@@ -0,0 +1,90 @@
+#ifndef ANALOG_TIME_SERIES_QUANTILE_SKETCH_HPP
+#define ANALOG_TIME_SERIES_QUANTILE_SKETCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Mergeable streaming quantile sketch (KLL)
+ *
+ * Keeps a stack of compactors: items at level h stand for 2^h samples. When
+ * the sketch reaches its capacity, the lowest full level is sorted and every
+ * other item is promoted to the next level. Memory stays at O(k) items no
+ * matter how many samples are added, and the rank error of a quantile query
+ * is roughly 1.7 / k^0.9 of the sample count (about 1.4% for the default k).
+ *
+ * Sketches built over disjoint sets of samples can be merged, so a long
+ * series can be sketched in independent blocks. Compaction choices come from
+ * a fixed-seed generator, so the same input always gives the same sketch.
+ *
+ * Until the first compaction every sample is kept, so small inputs give exact
+ * quantiles.
+ */
+class QuantileSketch {
+public:
+    static constexpr uint16_t default_k = 200;
+
+    /**
+     * @param k Size of the top compactor; larger values trade memory for accuracy
+     */
+    explicit QuantileSketch(uint16_t k = default_k);
+
+    /**
+     * @brief Add one sample; NaN is ignored
+     */
+    void update(float value);
+
+    /**
+     * @brief Add every sample of @p values; NaNs are ignored
+     */
+    void update(std::span<float const> values);
+
+    /**
+     * @brief Fold a sketch of a disjoint set of samples into this one
+     */
+    void merge(QuantileSketch const & other);
+
+    /**
+     * @brief Number of samples added
+     */
+    [[nodiscard]] size_t count() const { return _count; }
+
+    [[nodiscard]] bool empty() const { return _count == 0; }
+
+    /**
+     * @brief Approximate q-quantile
+     *
+     * Uses the same definition as calculate_quantile_exact(): linear
+     * interpolation between the samples at ranks floor(q * (n - 1)) and
+     * ceil(q * (n - 1)). q = 0 and q = 1 give the exact minimum and maximum.
+     *
+     * @param q Quantile in [0, 1]; values outside are clamped
+     * @return The quantile, or NaN if the sketch is empty
+     */
+    [[nodiscard]] float quantile(double q) const;
+
+    /**
+     * @brief Number of items currently retained
+     */
+    [[nodiscard]] size_t retainedItems() const { return _retained; }
+
+private:
+    [[nodiscard]] size_t _capacity(size_t level) const;
+    void _updateMaxRetained();
+    void _compress();
+    bool _randomBit();
+
+    uint16_t _k;
+    size_t _count{0};
+    size_t _retained{0};
+    size_t _max_retained{0};
+    std::vector<std::vector<float>> _levels;///< Items at level h each stand for 2^h samples
+    float _min{std::numeric_limits<float>::infinity()};
+    float _max{-std::numeric_limits<float>::infinity()};
+    uint64_t _random_state{0x9E3779B97F4A7C15ull};
+};
+
+#endif// ANALOG_TIME_SERIES_QUANTILE_SKETCH_HPP
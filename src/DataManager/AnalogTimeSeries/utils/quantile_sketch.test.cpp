@@ -0,0 +1,107 @@
+#include "AnalogTimeSeries/utils/quantile_sketch.hpp"
+#include "AnalogTimeSeries/utils/statistics.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace {
+
+// Fraction of samples strictly below value
+double rank_of(std::vector<float> const & sorted, float value) {
+    auto const below = std::lower_bound(sorted.begin(), sorted.end(), value) - sorted.begin();
+    return static_cast<double>(below) / static_cast<double>(sorted.size());
+}
+
+}// namespace
+
+TEST_CASE("QuantileSketch - Rank error stays bounded", "[analog][statistics][quantile]") {
+
+    SECTION("Small inputs are exact") {
+        std::vector<float> const data{5.0f, 1.0f, 4.0f, 2.0f, 3.0f, 6.0f};
+        QuantileSketch sketch;
+        sketch.update(data);
+
+        REQUIRE(sketch.count() == 6);
+        for (double const q: {0.0, 0.1, 0.25, 0.5, 0.8, 1.0}) {
+            REQUIRE_THAT(sketch.quantile(q), Catch::Matchers::WithinAbs(calculate_quantile_exact(data, q), 1e-6));
+        }
+        REQUIRE_THAT(sketch.quantile(0.5), Catch::Matchers::WithinAbs(3.5, 1e-6));
+    }
+
+    SECTION("Large inputs stay within the rank error and use bounded memory") {
+        std::default_random_engine generator(11);
+        std::normal_distribution<float> distribution(0.0f, 1.0f);
+        std::vector<float> data(200000);
+        for (auto & v: data) {
+            v = distribution(generator);
+        }
+
+        QuantileSketch sketch;
+        sketch.update(data);
+
+        std::vector<float> sorted = data;
+        std::sort(sorted.begin(), sorted.end());
+
+        REQUIRE(sketch.count() == data.size());
+        REQUIRE(sketch.retainedItems() < 2000);
+        for (double const q: {0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99}) {
+            REQUIRE_THAT(rank_of(sorted, sketch.quantile(q)), Catch::Matchers::WithinAbs(q, 0.02));
+        }
+        REQUIRE(sketch.quantile(0.0) == sorted.front());
+        REQUIRE(sketch.quantile(1.0) == sorted.back());
+    }
+
+    SECTION("Merged sketches match a sketch of all samples") {
+        std::vector<float> data(50000);
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<float>((i * 7919) % data.size());
+        }
+
+        QuantileSketch first;
+        QuantileSketch second;
+        first.update(std::span<float const>(data).subspan(0, 20000));
+        second.update(std::span<float const>(data).subspan(20000));
+        first.merge(second);
+
+        std::vector<float> sorted = data;
+        std::sort(sorted.begin(), sorted.end());
+
+        REQUIRE(first.count() == data.size());
+        for (double const q: {0.1, 0.5, 0.9}) {
+            REQUIRE_THAT(rank_of(sorted, first.quantile(q)), Catch::Matchers::WithinAbs(q, 0.02));
+        }
+    }
+
+    SECTION("Empty sketches and NaN samples") {
+        QuantileSketch sketch;
+        REQUIRE(std::isnan(sketch.quantile(0.5)));
+
+        sketch.update(std::nanf(""));
+        sketch.update(2.0f);
+        REQUIRE(sketch.count() == 1);
+        REQUIRE(sketch.quantile(0.5) == 2.0f);
+    }
+}
+
+TEST_CASE("Exact quantiles", "[analog][statistics][quantile]") {
+    std::vector<float> const data{9.0f, 1.0f, 8.0f, 2.0f, 7.0f, 3.0f, 6.0f, 4.0f, 5.0f, 10.0f};
+
+    REQUIRE_THAT(calculate_quantile_exact(data, 0.5), Catch::Matchers::WithinAbs(5.5, 1e-6));
+    REQUIRE_THAT(calculate_quantile_exact(data, 0.25), Catch::Matchers::WithinAbs(3.25, 1e-6));
+    REQUIRE(calculate_quantile_exact(data, 0.0) == 1.0f);
+    REQUIRE(calculate_quantile_exact(data, 1.0) == 10.0f);
+    REQUIRE(std::isnan(calculate_quantile_exact(std::span<const float>(), 0.5)));
+
+    std::vector<double> const quantiles{0.75, 0.25, 0.5, 0.25};
+    auto const values = calculate_quantiles_exact(data, quantiles);
+    REQUIRE(values.size() == 4);
+    for (size_t i = 0; i < quantiles.size(); ++i) {
+        REQUIRE(values[i] == calculate_quantile_exact(data, quantiles[i]));
+    }
+}
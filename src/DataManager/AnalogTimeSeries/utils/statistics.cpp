@@ -3,13 +3,14 @@
 #include "AnalogTimeSeries/Analog_Time_Series.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
 #include <numeric>
 
 // ========== Mean ==========
 
-float calculate_mean_impl(std::vector<float> const & data, size_t start, size_t end) {
+float calculate_mean_impl(std::span<float const> data, size_t start, size_t end) {
     if (data.empty() || start >= end || start >= data.size() || end > data.size()) {
         return std::numeric_limits<float>::quiet_NaN();
     }
@@ -21,12 +22,15 @@ float calculate_mean(std::span<const float> data_span) {
 }
 
 float calculate_mean(AnalogTimeSeries const & series) {
-    auto const & data = series.getAnalogTimeSeries();
-    return calculate_mean_impl(data, 0, data.size());
+    auto const & summary = series.getSummaryStatistics();
+    if (summary.count == 0) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+    return static_cast<float>(summary.mean);
 }
 
 float calculate_mean(AnalogTimeSeries const & series, int64_t start, int64_t end) {
-    auto const & data = series.getAnalogTimeSeries();
+    auto const data = series.getAnalogTimeSeriesSpan();
     if (start < 0 || end < 0 || start >= end) {
         return std::numeric_limits<float>::quiet_NaN();
     }
@@ -41,7 +45,7 @@ float calculate_mean_in_time_range(AnalogTimeSeries const & series, TimeFrameInd
 
 // ========== Standard Deviation ==========
 
-float calculate_std_dev_impl(std::vector<float> const & data, size_t start, size_t end) {
+float calculate_std_dev_impl(std::span<float const> data, size_t start, size_t end) {
     if (data.empty() || start >= end || start >= data.size() || end > data.size()) {
         return std::numeric_limits<float>::quiet_NaN();
     }
@@ -53,12 +57,11 @@ float calculate_std_dev(std::span<const float> data_span) {
 }
 
 float calculate_std_dev(AnalogTimeSeries const & series) {
-    auto const & data = series.getAnalogTimeSeries();
-    return calculate_std_dev_impl(data, 0, data.size());
+    return static_cast<float>(std::sqrt(series.getSummaryStatistics().populationVariance()));
 }
 
 float calculate_std_dev(AnalogTimeSeries const & series, int64_t start, int64_t end) {
-    auto const & data = series.getAnalogTimeSeries();
+    auto const data = series.getAnalogTimeSeriesSpan();
     if (start < 0 || end < 0 || start >= end) {
         return std::numeric_limits<float>::quiet_NaN();
     }
@@ -73,7 +76,7 @@ float calculate_std_dev_in_time_range(AnalogTimeSeries const & series, TimeFrame
 float calculate_std_dev_approximate(AnalogTimeSeries const & series,
                                     float sample_percentage,
                                     size_t min_sample_threshold) {
-    auto const & data = series.getAnalogTimeSeries();
+    auto const data = series.getAnalogTimeSeriesSpan();
     if (data.empty()) {
         return std::numeric_limits<float>::quiet_NaN();
     }
@@ -115,7 +118,7 @@ float calculate_std_dev_adaptive(AnalogTimeSeries const & series,
                                  size_t initial_sample_size,
                                  size_t max_sample_size,
                                  float convergence_tolerance) {
-    auto const & data = series.getAnalogTimeSeries();
+    auto const data = series.getAnalogTimeSeriesSpan();
     if (data.empty()) {
         return std::numeric_limits<float>::quiet_NaN();
     }
@@ -215,7 +218,7 @@ float calculate_std_dev_approximate_in_time_range(AnalogTimeSeries const & serie
 
 // ========== Minimum ==========
 
-float calculate_min_impl(std::vector<float> const & data, size_t start, size_t end) {
+float calculate_min_impl(std::span<float const> data, size_t start, size_t end) {
     if (data.empty() || start >= end || start >= data.size() || end > data.size()) {
         return std::numeric_limits<float>::quiet_NaN();
     }
@@ -227,12 +230,15 @@ float calculate_min(std::span<const float> data_span) {
 }
 
 float calculate_min(AnalogTimeSeries const & series) {
-    auto const & data = series.getAnalogTimeSeries();
-    return calculate_min_impl(data, 0, data.size());
+    auto const & summary = series.getSummaryStatistics();
+    if (summary.count == 0) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+    return summary.min;
 }
 
 float calculate_min(AnalogTimeSeries const & series, int64_t start, int64_t end) {
-    auto const & data = series.getAnalogTimeSeries();
+    auto const data = series.getAnalogTimeSeriesSpan();
     if (start < 0 || end < 0 || start >= end) {
         return std::numeric_limits<float>::quiet_NaN();
     }
@@ -246,7 +252,7 @@ float calculate_min_in_time_range(AnalogTimeSeries const & series, TimeFrameInde
 
 // ========== Maximum ==========
 
-float calculate_max_impl(std::vector<float> const & data, size_t start, size_t end) {
+float calculate_max_impl(std::span<float const> data, size_t start, size_t end) {
     if (data.empty() || start >= end || start >= data.size() || end > data.size()) {
         return std::numeric_limits<float>::quiet_NaN();
     }
@@ -258,12 +264,15 @@ float calculate_max(std::span<const float> data_span) {
 }
 
 float calculate_max(AnalogTimeSeries const & series) {
-    auto const & data = series.getAnalogTimeSeries();
-    return calculate_max_impl(data, 0, data.size());
+    auto const & summary = series.getSummaryStatistics();
+    if (summary.count == 0) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+    return summary.max;
 }
 
 float calculate_max(AnalogTimeSeries const & series, int64_t start, int64_t end) {
-    auto const & data = series.getAnalogTimeSeries();
+    auto const data = series.getAnalogTimeSeriesSpan();
     if (start < 0 || end < 0 || start >= end) {
         return std::numeric_limits<float>::quiet_NaN();
     }
@@ -275,5 +284,167 @@ float calculate_max_in_time_range(AnalogTimeSeries const & series, TimeFrameInde
     return calculate_max(data_span);
 }
 
+// ========== Fused Summary ==========
+
+namespace {
 
+// Number of independent accumulators per loop; wide enough for AVX on floats
+constexpr size_t summary_lanes = 8;
+
+// Samples per block; small enough that the second pass over a block hits L1
+constexpr size_t summary_block_size = 512;
+
+SummaryStatistics summarize_block(float const * data, size_t n) {
+    std::array<float, summary_lanes> lane_sum{};
+    std::array<float, summary_lanes> lane_min;
+    std::array<float, summary_lanes> lane_max;
+    lane_min.fill(std::numeric_limits<float>::infinity());
+    lane_max.fill(-std::numeric_limits<float>::infinity());
+
+    size_t const n_vec = n - (n % summary_lanes);
+
+    for (size_t i = 0; i < n_vec; i += summary_lanes) {
+        for (size_t l = 0; l < summary_lanes; ++l) {
+            float const v = data[i + l];
+            lane_sum[l] += v;
+            lane_min[l] = std::min(lane_min[l], v);
+            lane_max[l] = std::max(lane_max[l], v);
+        }
+    }
+    for (size_t i = n_vec; i < n; ++i) {
+        lane_sum[0] += data[i];
+        lane_min[0] = std::min(lane_min[0], data[i]);
+        lane_max[0] = std::max(lane_max[0], data[i]);
+    }
 
+    SummaryStatistics block;
+    block.count = n;
+    for (size_t l = 0; l < summary_lanes; ++l) {
+        block.sum += static_cast<double>(lane_sum[l]);
+        block.min = std::min(block.min, lane_min[l]);
+        block.max = std::max(block.max, lane_max[l]);
+    }
+    block.mean = block.sum / static_cast<double>(n);
+
+    // Deviations are taken about the block mean, so the float lanes never
+    // accumulate the large cancelling terms of the naive sum-of-squares form
+    auto const block_mean = static_cast<float>(block.mean);
+    std::array<float, summary_lanes> lane_m2{};
+    for (size_t i = 0; i < n_vec; i += summary_lanes) {
+        for (size_t l = 0; l < summary_lanes; ++l) {
+            float const diff = data[i + l] - block_mean;
+            lane_m2[l] += diff * diff;
+        }
+    }
+    for (size_t i = n_vec; i < n; ++i) {
+        float const diff = data[i] - block_mean;
+        lane_m2[0] += diff * diff;
+    }
+    for (size_t l = 0; l < summary_lanes; ++l) {
+        block.m2 += static_cast<double>(lane_m2[l]);
+    }
+
+    return block;
+}
+
+}// namespace
+
+void SummaryStatistics::merge(SummaryStatistics const & other) {
+    if (other.count == 0) {
+        return;
+    }
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+
+    auto const n_a = static_cast<double>(count);
+    auto const n_b = static_cast<double>(other.count);
+    double const n = n_a + n_b;
+    double const delta = other.mean - mean;
+
+    mean += delta * n_b / n;
+    m2 += other.m2 + delta * delta * n_a * n_b / n;
+    sum += other.sum;
+    count += other.count;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+}
+
+double SummaryStatistics::populationVariance() const {
+    if (count == 0) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    return m2 / static_cast<double>(count);
+}
+
+double SummaryStatistics::sampleVariance() const {
+    if (count == 0) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (count == 1) {
+        return 0.0;
+    }
+    return m2 / static_cast<double>(count - 1);
+}
+
+SummaryStatistics calculate_summary(std::span<const float> data_span) {
+    SummaryStatistics summary;
+    for (size_t offset = 0; offset < data_span.size(); offset += summary_block_size) {
+        size_t const n = std::min(summary_block_size, data_span.size() - offset);
+        summary.merge(summarize_block(data_span.data() + offset, n));
+    }
+    return summary;
+}
+
+SummaryStatistics calculate_summary(AnalogTimeSeries const & series) {
+    return calculate_summary(series.getAnalogTimeSeriesSpan());
+}
+
+// ========== Quantiles ==========
+
+float calculate_quantile_exact(std::span<const float> data_span, double q) {
+    return calculate_quantiles_exact(data_span, std::span<double const>(&q, 1)).front();
+}
+
+std::vector<float> calculate_quantiles_exact(std::span<const float> data_span, std::span<double const> quantiles) {
+    std::vector<float> result(quantiles.size(), std::numeric_limits<float>::quiet_NaN());
+    if (data_span.empty()) {
+        return result;
+    }
+
+    std::vector<size_t> order(quantiles.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::sort(order.begin(), order.end(), [&quantiles](size_t a, size_t b) { return quantiles[a] < quantiles[b]; });
+
+    std::vector<float> data(data_span.begin(), data_span.end());
+    auto selected_end = data.begin();
+    for (size_t const index: order) {
+        double const position = std::clamp(quantiles[index], 0.0, 1.0) * static_cast<double>(data.size() - 1);
+        double const lower_position = std::floor(position);
+        auto const lower_it = data.begin() + static_cast<std::ptrdiff_t>(lower_position);
+
+        // Quantiles are visited in increasing order and everything before selected_end
+        // is already <= the rest, so only the remainder needs partitioning
+        std::nth_element(selected_end, lower_it, data.end());
+        selected_end = lower_it;
+
+        double const lower = *lower_it;
+        if (position == lower_position) {
+            result[index] = static_cast<float>(lower);
+            continue;
+        }
+        // nth_element leaves everything above the lower rank after it, so the next rank is its minimum
+        double const upper = *std::min_element(lower_it + 1, data.end());
+        result[index] = static_cast<float>(lower + (position - lower_position) * (upper - lower));
+    }
+    return result;
+}
+
+float calculate_quantile_exact(AnalogTimeSeries const & series, double q) {
+    return calculate_quantile_exact(series.getAnalogTimeSeriesSpan(), q);
+}
+
+float calculate_quantile_approximate(AnalogTimeSeries const & series, double q) {
+    return series.getQuantileSketch().quantile(q);
+}
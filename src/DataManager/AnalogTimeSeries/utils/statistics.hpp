@@ -50,12 +50,12 @@ float calculate_mean_impl(Iterator begin, Iterator end) {
  * 
  * This is an alternative implementation for when you have indices rather than iterators.
  * 
- * @param data Vector containing the data
+ * @param data Data containing the range
  * @param start Start index of the range (inclusive)
  * @param end End index of the range (exclusive)
  * @return float The mean value in the specified range
  */
-float calculate_mean_impl(std::vector<float> const & data, size_t start, size_t end);
+float calculate_mean_impl(std::span<float const> data, size_t start, size_t end);
 
 /**
  * @brief Calculate the mean value of a span of data
@@ -140,12 +140,12 @@ float calculate_std_dev_impl(Iterator begin, Iterator end) {
  * 
  * This is an alternative implementation for when you have indices rather than iterators.
  * 
- * @param data Vector containing the data
+ * @param data Data containing the range
  * @param start Start index of the range (inclusive)
  * @param end End index of the range (exclusive)
  * @return float The standard deviation in the specified range
  */
-float calculate_std_dev_impl(std::vector<float> const & data, size_t start, size_t end);
+float calculate_std_dev_impl(std::span<float const> data, size_t start, size_t end);
 
 /**
  * @brief Calculate the standard deviation of a span of data
@@ -268,12 +268,12 @@ float calculate_min_impl(Iterator begin, Iterator end) {
  * 
  * This is an alternative implementation for when you have indices rather than iterators.
  * 
- * @param data Vector containing the data
+ * @param data Data containing the range
  * @param start Start index of the range (inclusive)
  * @param end End index of the range (exclusive)
  * @return float The minimum value in the specified range
  */
-float calculate_min_impl(std::vector<float> const & data, size_t start, size_t end);
+float calculate_min_impl(std::span<float const> data, size_t start, size_t end);
 
 /**
  * @brief Calculate the minimum value of a span of data
@@ -345,12 +345,12 @@ float calculate_max_impl(Iterator begin, Iterator end) {
  * 
  * This is an alternative implementation for when you have indices rather than iterators.
  * 
- * @param data Vector containing the data
+ * @param data Data containing the range
  * @param start Start index of the range (inclusive)
  * @param end End index of the range (exclusive)
  * @return float The maximum value in the specified range
  */
-float calculate_max_impl(std::vector<float> const & data, size_t start, size_t end);
+float calculate_max_impl(std::span<float const> data, size_t start, size_t end);
 
 /**
  * @brief Calculate the maximum value of a span of data
@@ -393,6 +393,116 @@ float calculate_max(AnalogTimeSeries const & series, int64_t start, int64_t end)
 float calculate_max_in_time_range(AnalogTimeSeries const & series, TimeFrameIndex start_time, TimeFrameIndex end_time);
 
 
+// ========== Fused Summary ==========
 
+/**
+ * @brief Summary statistics of a range of samples computed in a single pass
+ *
+ * Holds the count, sum, running mean, sum of squared deviations from the mean (M2),
+ * minimum and maximum. Two summaries can be combined with merge() using Chan's
+ * parallel form of Welford's update, so ranges can be summarized in independent
+ * blocks (or on different threads) and combined without losing precision.
+ */
+struct SummaryStatistics {
+    size_t count{0};
+    double sum{0.0};
+    double mean{0.0};
+    double m2{0.0};
+    float min{std::numeric_limits<float>::infinity()};
+    float max{-std::numeric_limits<float>::infinity()};
+
+    /**
+     * @brief Fold another summary into this one
+     *
+     * @param other Summary of a disjoint set of samples
+     */
+    void merge(SummaryStatistics const & other);
+
+    /**
+     * @brief Population variance (N denominator)
+     *
+     * @return The variance, or NaN if the summary is empty
+     */
+    [[nodiscard]] double populationVariance() const;
+
+    /**
+     * @brief Sample variance (N-1 denominator)
+     *
+     * @return The variance, 0 for a single sample, or NaN if the summary is empty
+     */
+    [[nodiscard]] double sampleVariance() const;
+};
+
+/**
+ * @brief Calculate count, sum, mean, variance, min and max of a span of data in one pass
+ *
+ * The span is processed in small cache-resident blocks. Within a block, sum/min/max
+ * and then the squared deviations about the block mean are accumulated across
+ * independent lanes so the compiler can vectorize both loops; blocks are then
+ * combined with SummaryStatistics::merge(). Memory is only streamed once.
+ *
+ * @param data_span Span of float data
+ * @return SummaryStatistics for the span (count == 0 if the span is empty)
+ */
+SummaryStatistics calculate_summary(std::span<const float> data_span);
+
+/**
+ * @brief Calculate count, sum, mean, variance, min and max of an AnalogTimeSeries in one pass
+ *
+ * @param series The time series to summarize
+ * @return SummaryStatistics for all samples in the series
+ */
+SummaryStatistics calculate_summary(AnalogTimeSeries const & series);
+
+// ========== Quantiles ==========
+
+/**
+ * @brief Calculate an exact quantile of a span of data
+ *
+ * Linearly interpolates between the samples at ranks floor(q * (n - 1)) and
+ * ceil(q * (n - 1)), so q = 0.5 is the usual median. Selects with
+ * std::nth_element on a copy of the data, which is O(n) time but O(n) memory.
+ *
+ * @param data_span Span of float data
+ * @param q Quantile in [0, 1]; values outside are clamped
+ * @return float The quantile, or NaN if the span is empty
+ */
+float calculate_quantile_exact(std::span<const float> data_span, double q);
+
+/**
+ * @brief Calculate several exact quantiles of a span of data with a single copy
+ *
+ * Same definition as calculate_quantile_exact(). Quantiles are selected in
+ * increasing order, each std::nth_element working only on the part of the
+ * copy above the previous rank.
+ *
+ * @param data_span Span of float data
+ * @param quantiles Quantiles in [0, 1], in any order
+ * @return The quantiles in the order requested (all NaN if the span is empty)
+ */
+std::vector<float> calculate_quantiles_exact(std::span<const float> data_span, std::span<double const> quantiles);
+
+/**
+ * @brief Calculate an exact quantile of an AnalogTimeSeries
+ *
+ * @param series The time series to calculate the quantile from
+ * @param q Quantile in [0, 1]
+ * @return float The quantile, or NaN if the series is empty
+ * @see calculate_quantile_approximate() to avoid copying the series
+ */
+float calculate_quantile_exact(AnalogTimeSeries const & series, double q);
+
+/**
+ * @brief Calculate an approximate quantile of an AnalogTimeSeries from its cached sketch
+ *
+ * The first call builds the series' QuantileSketch in one pass without copying
+ * the data; later calls only query the sketch until the series is modified.
+ *
+ * @param series The time series to calculate the quantile from
+ * @param q Quantile in [0, 1]
+ * @return float The quantile, or NaN if the series is empty
+ * @see AnalogTimeSeries::getQuantileSketch()
+ */
+float calculate_quantile_approximate(AnalogTimeSeries const & series, double q);
 
 #endif // ANALOG_TIME_SERIES_STATISTICS_HPP
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <map>
 #include <ranges>
 #include <random>
+#include <thread>
 #include <vector>
 
 
@@ -800,3 +801,141 @@ TEST_CASE("AnalogTimeSeries - Approximate Statistics", "[analog][timeseries][app
         REQUIRE(std::isnan(calculate_std_dev_approximate_in_time_range(empty_series, TimeFrameIndex(0), TimeFrameIndex(10))));
     }
 }
+
+TEST_CASE("AnalogTimeSeries - Fused Summary Statistics", "[analog][timeseries][statistics][summary]") {
+
+    SECTION("Matches separate statistics") {
+        std::vector<float> data{1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+        AnalogTimeSeries series(data, 5);
+
+        auto const summary = calculate_summary(series);
+
+        REQUIRE(summary.count == 5);
+        REQUIRE_THAT(summary.sum, Catch::Matchers::WithinRel(15.0, 1e-9));
+        REQUIRE_THAT(summary.mean, Catch::Matchers::WithinRel(3.0, 1e-9));
+        REQUIRE_THAT(std::sqrt(summary.populationVariance()), Catch::Matchers::WithinRel(1.41421, 1e-4));
+        REQUIRE_THAT(std::sqrt(summary.sampleVariance()), Catch::Matchers::WithinRel(1.58114, 1e-4));
+        REQUIRE(summary.min == 1.0f);
+        REQUIRE(summary.max == 5.0f);
+    }
+
+    SECTION("Empty and single sample") {
+        auto const empty = calculate_summary(std::span<const float>());
+        REQUIRE(empty.count == 0);
+        REQUIRE(std::isnan(empty.sampleVariance()));
+
+        std::vector<float> one{42.0f};
+        auto const single = calculate_summary(one);
+        REQUIRE(single.count == 1);
+        REQUIRE(single.mean == 42.0);
+        REQUIRE(single.sampleVariance() == 0.0);
+        REQUIRE(single.min == 42.0f);
+        REQUIRE(single.max == 42.0f);
+    }
+
+    SECTION("Stable with large offset across many blocks") {
+        // Large constant offset makes the naive sum-of-squares form cancel catastrophically
+        std::vector<float> data;
+        data.reserve(10007);
+        for (int i = 0; i < 10007; ++i) {
+            data.push_back(10000.0f + static_cast<float>(i % 2));
+        }
+
+        auto const summary = calculate_summary(data);
+
+        REQUIRE(summary.count == data.size());
+        REQUIRE_THAT(summary.mean, Catch::Matchers::WithinAbs(10000.5, 1e-3));
+        REQUIRE_THAT(summary.populationVariance(), Catch::Matchers::WithinAbs(0.25, 1e-4));
+        REQUIRE(summary.min == 10000.0f);
+        REQUIRE(summary.max == 10001.0f);
+    }
+
+    SECTION("Merging partial summaries equals summary of the whole") {
+        std::default_random_engine generator(7);
+        std::normal_distribution<float> distribution(5.0f, 2.0f);
+        std::vector<float> data(3001);
+        for (auto & v: data) {
+            v = distribution(generator);
+        }
+
+        auto const whole = calculate_summary(data);
+
+        auto merged = calculate_summary(std::span<const float>(data).subspan(0, 1000));
+        merged.merge(calculate_summary(std::span<const float>(data).subspan(1000)));
+
+        REQUIRE(merged.count == whole.count);
+        // Block lanes accumulate in float, so the two splits agree to float precision
+        REQUIRE_THAT(merged.mean, Catch::Matchers::WithinRel(whole.mean, 1e-7));
+        REQUIRE_THAT(merged.m2, Catch::Matchers::WithinRel(whole.m2, 1e-7));
+        REQUIRE(merged.min == whole.min);
+        REQUIRE(merged.max == whole.max);
+    }
+}
+
+TEST_CASE("AnalogTimeSeries - Cached summary statistics", "[analog][timeseries][statistics][summary]") {
+    std::vector<float> data{4.0f, 1.0f, 3.0f, 2.0f};
+    std::vector<TimeFrameIndex> times{TimeFrameIndex(0), TimeFrameIndex(2), TimeFrameIndex(4), TimeFrameIndex(6)};
+    AnalogTimeSeries series(data, times);
+
+    SECTION("Whole-series statistics read the cached summary") {
+        auto const & summary = series.getSummaryStatistics();
+        REQUIRE(&summary == &series.getSummaryStatistics());
+        REQUIRE(summary.count == 4);
+        REQUIRE(calculate_mean(series) == Catch::Approx(2.5f));
+        REQUIRE(calculate_std_dev(series) == Catch::Approx(std::sqrt(1.25f)));
+        REQUIRE(calculate_min(series) == 1.0f);
+        REQUIRE(calculate_max(series) == 4.0f);
+        REQUIRE(calculate_quantile_approximate(series, 0.5) == Catch::Approx(2.5f));
+        REQUIRE(calculate_quantile_exact(series, 0.5) == Catch::Approx(2.5f));
+    }
+
+    SECTION("Overwriting data invalidates the cache") {
+        REQUIRE(calculate_max(series) == 4.0f);
+        REQUIRE(series.getQuantileSketch().quantile(1.0) == 4.0f);
+
+        std::vector<float> new_values{10.0f};
+        std::vector<TimeFrameIndex> new_times{TimeFrameIndex(2)};
+        series.overwriteAtTimeIndexes(new_values, new_times);
+
+        REQUIRE(calculate_max(series) == 10.0f);
+        REQUIRE(calculate_mean(series) == Catch::Approx(4.75f));
+        REQUIRE(series.getQuantileSketch().quantile(1.0) == 10.0f);
+
+        std::vector<float> more_values{-1.0f};
+        std::vector<DataArrayIndex> indices{DataArrayIndex(0)};
+        series.overwriteAtDataArrayIndexes(more_values, indices);
+
+        REQUIRE(calculate_min(series) == -1.0f);
+        REQUIRE(series.getQuantileSketch().quantile(0.0) == -1.0f);
+    }
+
+    SECTION("Concurrent readers fill the cache once") {
+        std::vector<SummaryStatistics const *> summaries(4, nullptr);
+        std::vector<QuantileSketch const *> sketches(4, nullptr);
+        std::vector<std::thread> readers;
+        for (std::size_t i = 0; i < summaries.size(); ++i) {
+            readers.emplace_back([&series, &summaries, &sketches, i] {
+                summaries[i] = &series.getSummaryStatistics();
+                sketches[i] = &series.getQuantileSketch();
+            });
+        }
+        for (auto & reader: readers) {
+            reader.join();
+        }
+        for (std::size_t i = 0; i < summaries.size(); ++i) {
+            REQUIRE(summaries[i] == &series.getSummaryStatistics());
+            REQUIRE(sketches[i] == &series.getQuantileSketch());
+        }
+        REQUIRE(series.getSummaryStatistics().count == 4);
+        REQUIRE(series.getQuantileSketch().count() == 4);
+    }
+
+    SECTION("Empty series") {
+        AnalogTimeSeries empty;
+        REQUIRE(empty.getSummaryStatistics().count == 0);
+        REQUIRE(std::isnan(calculate_mean(empty)));
+        REQUIRE(std::isnan(calculate_std_dev(empty)));
+        REQUIRE(std::isnan(calculate_min(empty)));
+        REQUIRE(std::isnan(calculate_quantile_approximate(empty, 0.5)));
+    }
+}
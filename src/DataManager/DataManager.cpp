@@ -34,33 +34,46 @@
 #include "transforms/Masks/mask_area.hpp"
 
 #include "TimeFrame/TimeFrame.hpp"
+#include "Tracing/Tracing.hpp"
 
 #include "nlohmann/json.hpp"
 
 #include "transforms/TransformPipeline.hpp"
 #include "transforms/TransformRegistry.hpp"
+#include "utils/parallel_for.hpp"
 #include "utils/string_manip.hpp"
 
 #include "Entity/EntityRegistry.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <iostream>
+#include <mutex>
+#include <numeric>
 #include <optional>
 #include <regex>
 
 using namespace nlohmann;
 
 /**
- * @brief Try loading data using new registry system first, fallback to legacy if needed
+ * @brief Try decoding data using the loader registry
+ *
+ * Only decodes; the result is not touched by the DataManager until it is committed.
+ *
+ * @return The loaded data, or std::nullopt if no registered loader handled the
+ *         format and the legacy loader should be used instead
  */
-bool tryRegistryThenLegacyLoad(
-        DataManager * dm,
+std::optional<LoadedDataVariant> tryRegistryLoad(
         std::string const & file_path,
         DM_DataType data_type,
         nlohmann::json const & item,
         std::string const & name,
-        std::vector<DataInfo> & data_info_list,
         DataFactory * factory) {
     // Extract format if available
     if (item.contains("format")) {
@@ -73,58 +86,7 @@ bool tryRegistryThenLegacyLoad(
 
             LoadResult result = registry.tryLoad(format, toIODataType(data_type), file_path, item, factory);
             if (result.success) {
-                // Handle data setting and post-loading setup based on data type
-                switch (data_type) {
-                    case DM_DataType::Line: {
-                        // Set the LineData in DataManager
-                        if (std::holds_alternative<std::shared_ptr<LineData>>(result.data)) {
-                            auto line_data = std::get<std::shared_ptr<LineData>>(result.data);
-
-                            // Set up identity context
-                            if (line_data) {
-                                line_data->setIdentityContext(name, dm->getEntityRegistry());
-                                line_data->rebuildAllEntityIds();
-                            }
-
-                            dm->setData<LineData>(name, line_data, TimeKey("time"));
-
-                            std::string const color = item.value("color", "0000FF");
-                            data_info_list.push_back({name, "LineData", color});
-                        }
-                        break;
-                    }
-                    case DM_DataType::Mask: {
-                        // Set the MaskData in DataManager
-                        if (std::holds_alternative<std::shared_ptr<MaskData>>(result.data)) {
-                            auto mask_data = std::get<std::shared_ptr<MaskData>>(result.data);
-
-                            dm->setData<MaskData>(name, mask_data, TimeKey("time"));
-
-                            std::string const color = item.value("color", "0000FF");
-                            data_info_list.push_back({name, "MaskData", color});
-
-                            // Handle operations if present (same as legacy)
-                            if (item.contains("operations")) {
-                                for (auto const & operation: item["operations"]) {
-                                    std::string const operation_type = operation["type"];
-                                    if (operation_type == "area") {
-                                        std::cout << "Calculating area for mask: " << name << std::endl;
-                                        auto area_data = area(dm->getData<MaskData>(name).get());
-                                        std::string const output_name = name + "_area";
-                                        dm->setData<AnalogTimeSeries>(output_name, area_data, TimeKey("time"));
-                                    }
-                                }
-                            }
-                        }
-                        break;
-                    }
-                    // Add other data types as they get plugin support...
-                    default:
-                        std::cerr << "Registry loaded unsupported data type: " << static_cast<int>(data_type) << std::endl;
-                        return false;
-                }
-
-                return true;
+                return std::move(result.data);
             } else {
                 std::cout << "Registry loading failed for " << name << ": " << result.error_message
                           << ", falling back to legacy loader" << std::endl;
@@ -132,7 +94,73 @@ bool tryRegistryThenLegacyLoad(
         }
     }
 
-    return false;// Indicates we should use legacy loading
+    return std::nullopt;// Indicates we should use legacy loading
+}
+
+/**
+ * @brief Register data decoded by the loader registry with the DataManager
+ *
+ * @return True if the data type is handled, false if legacy loading should be used
+ */
+bool commitRegistryLoad(
+        DataManager * dm,
+        LoadedDataVariant const & data,
+        DM_DataType data_type,
+        nlohmann::json const & item,
+        std::string const & name,
+        std::vector<DataInfo> & data_info_list) {
+    // Handle data setting and post-loading setup based on data type
+    switch (data_type) {
+        case DM_DataType::Line: {
+            // Set the LineData in DataManager
+            if (std::holds_alternative<std::shared_ptr<LineData>>(data)) {
+                auto line_data = std::get<std::shared_ptr<LineData>>(data);
+
+                // Set up identity context
+                if (line_data) {
+                    line_data->setIdentityContext(name, dm->getEntityRegistry());
+                    line_data->rebuildAllEntityIds();
+                }
+
+                dm->setData<LineData>(name, line_data, TimeKey("time"));
+
+                std::string const color = item.value("color", "0000FF");
+                data_info_list.push_back({name, "LineData", color});
+            }
+            break;
+        }
+        case DM_DataType::Mask: {
+            // Set the MaskData in DataManager
+            if (std::holds_alternative<std::shared_ptr<MaskData>>(data)) {
+                auto mask_data = std::get<std::shared_ptr<MaskData>>(data);
+
+                dm->setData<MaskData>(name, mask_data, TimeKey("time"));
+
+                std::string const color = item.value("color", "0000FF");
+                data_info_list.push_back({name, "MaskData", color});
+
+                // Handle operations if present (same as legacy)
+                if (item.contains("operations")) {
+                    for (auto const & operation: item["operations"]) {
+                        std::string const operation_type = operation["type"];
+                        if (operation_type == "area") {
+                            std::cout << "Calculating area for mask: " << name << std::endl;
+                            auto area_data = area(dm->getData<MaskData>(name).get());
+                            std::string const output_name = name + "_area";
+                            dm->setData<AnalogTimeSeries>(output_name, area_data, TimeKey("time"));
+                        }
+                    }
+                }
+            }
+            break;
+        }
+        // Add other data types as they get plugin support...
+        default:
+            std::cerr << "Registry loaded unsupported data type: " << static_cast<int>(data_type) << std::endl;
+            return false;
+    }
+
+    return true;
 }
 
 DataManager::DataManager() {
@@ -468,67 +496,115 @@ DM_DataType stringToDataType(std::string const & data_type_str) {
     return DM_DataType::Unknown;
 }
 
-std::vector<DataInfo> load_data_from_json_config(DataManager * dm, json const & j, std::filesystem::path const & base_path) {
-    std::vector<DataInfo> data_info_list;
-    // Create factory for plugin system
-    ConcreteDataFactory factory;
-
-    // Iterate through JSON array
-    for (auto const & item: j) {
-
-        // Skip transformation objects - they will be processed separately
-        if (item.contains("transformations")) {
-            continue;
-        }
-
-        if (!checkRequiredFields(item, {"data_type", "name", "filepath"})) {
-            continue;// Exit if any required field is missing
-        }
+/**
+ * @brief Commits decoded data to the DataManager and appends any DataInfo entries
+ */
+using DataCommit = std::function<void(DataManager *, std::vector<DataInfo> &)>;
 
-        std::string const data_type_str = item["data_type"];
-        auto const data_type = stringToDataType(data_type_str);
-        if (data_type == DM_DataType::Unknown) {
-            std::cout << "Unknown data type: " << data_type_str << std::endl;
-            continue;
-        }
+/**
+ * @brief A validated data entry from a JSON configuration
+ */
+struct ConfigLoadEntry {
+    nlohmann::json const * item = nullptr;
+    DM_DataType data_type = DM_DataType::Unknown;
+    std::string data_type_str;
+    std::string name;
+    std::string file_path;
+    bool exclusive = false;// Decoder is not thread-safe (e.g. HDF5) and must not overlap with another
+};
 
-        std::string const name = item["name"];
+/**
+ * @brief Result slot for one decoded entry, filled by a worker thread
+ */
+struct ConfigLoadResult {
+    DataCommit commit;
+    std::string error;
+    double decode_time_ms = 0.0;
+    bool ready = false;
+};
 
-        auto file_exists = processFilePath(item["filepath"], base_path);
-        if (!file_exists) {
-            std::cerr << "File does not exist: " << item["filepath"] << std::endl;
-            continue;
-        }
+/**
+ * @brief Class name reported in DataInfo::data_class for a data type
+ */
+std::string dataClassName(DM_DataType data_type) {
+    switch (data_type) {
+        case DM_DataType::Video:
+            return "VideoData";
+        case DM_DataType::Images:
+            return "ImageData";
+        case DM_DataType::Points:
+            return "PointData";
+        case DM_DataType::Mask:
+            return "MaskData";
+        case DM_DataType::Line:
+            return "LineData";
+        case DM_DataType::Analog:
+            return "AnalogTimeSeries";
+        case DM_DataType::DigitalEvent:
+            return "DigitalEventSeries";
+        case DM_DataType::DigitalInterval:
+            return "DigitalIntervalSeries";
+        case DM_DataType::Tensor:
+            return "TensorData";
+        case DM_DataType::Time:
+            return "TimeFrame";
+        default:
+            return "Unknown";
+    }
+}
 
-        std::string const file_path = file_exists.value();
+bool requiresExclusiveDecode(nlohmann::json const & item, std::string const & file_path) {
+    if (item.contains("format") && item["format"].is_string() && item["format"] == "hdf5") {
+        return true;
+    }
+    auto const extension = std::filesystem::path(file_path).extension().string();
+    return extension == ".h5" || extension == ".hdf5" || extension == ".mat";
+}
 
-        switch (data_type) {
-            case DM_DataType::Video: {
-                auto media_data = MediaDataFactory::loadMediaData(data_type, file_path, item);
-                if (media_data) {
-                    dm->setData<MediaData>("media", media_data, TimeKey("time"));
-                    data_info_list.push_back({name, "VideoData", ""});
-                } else {
-                    std::cerr << "Failed to load video data: " << file_path << std::endl;
-                }
-                break;
+/**
+ * @brief Decode a single configuration entry from disk
+ *
+ * Decoding does not touch the DataManager, so it may run on a worker thread.
+ * Identity contexts, time keys and derived data are set up by the returned
+ * commit, which must run on the thread that owns the DataManager.
+ *
+ * @return Commit for the decoded data, or an empty function if nothing was loaded
+ */
+DataCommit decodeConfigEntry(ConfigLoadEntry const & entry, DataFactory * factory) {
+    auto const & item = *entry.item;
+    auto const & name = entry.name;
+    auto const & file_path = entry.file_path;
+    auto const data_type = entry.data_type;
+
+    switch (data_type) {
+        case DM_DataType::Video: {
+            auto media_data = MediaDataFactory::loadMediaData(data_type, file_path, item);
+            if (!media_data) {
+                std::cerr << "Failed to load video data: " << file_path << std::endl;
+                return {};
             }
+            return [media_data, name](DataManager * dm, std::vector<DataInfo> & data_info_list) {
+                dm->setData<MediaData>("media", media_data, TimeKey("time"));
+                data_info_list.push_back({name, "VideoData", ""});
+            };
+        }
 #ifdef ENABLE_OPENCV
-            case DM_DataType::Images: {
-                auto media_data = MediaDataFactory::loadMediaData(data_type, file_path, item);
-                if (media_data) {
-                    dm->setData<MediaData>("media", media_data, TimeKey("time"));
-                    data_info_list.push_back({name, "ImageData", ""});
-                } else {
-                    std::cerr << "Failed to load image data: " << file_path << std::endl;
-                }
-                break;
+        case DM_DataType::Images: {
+            auto media_data = MediaDataFactory::loadMediaData(data_type, file_path, item);
+            if (!media_data) {
+                std::cerr << "Failed to load image data: " << file_path << std::endl;
+                return {};
             }
+            return [media_data, name](DataManager * dm, std::vector<DataInfo> & data_info_list) {
+                dm->setData<MediaData>("media", media_data, TimeKey("time"));
+                data_info_list.push_back({name, "ImageData", ""});
+            };
+        }
 #endif
-            case DM_DataType::Points: {
-
-                auto point_data = load_into_PointData(file_path, item);
-
+        case DM_DataType::Points: {
+            auto point_data = load_into_PointData(file_path, item);
+            std::string const color = item.value("color", "#0000FF");
+            return [point_data, name, color](DataManager * dm, std::vector<DataInfo> & data_info_list) {
                 // Attach identity context and generate EntityIds
                 if (point_data) {
                     point_data->setIdentityContext(name, dm->getEntityRegistry());
@@ -536,24 +612,38 @@ std::vector<DataInfo> load_data_from_json_config(DataManager * dm, json const &
                 }
 
                 dm->setData<PointData>(name, point_data, TimeKey("time"));
-
-                std::string const color = item.value("color", "#0000FF");
                 data_info_list.push_back({name, "PointData", color});
-                break;
+            };
+        }
+        case DM_DataType::Mask:
+        case DM_DataType::Line: {
+
+            // Try registry system first, then fallback to legacy
+            if (auto loaded = tryRegistryLoad(file_path, data_type, item, name, factory)) {
+                return [data = std::move(*loaded), data_type, &item, name](DataManager * dm, std::vector<DataInfo> & data_info_list) {
+                    commitRegistryLoad(dm, data, data_type, item, name, data_info_list);
+                };
             }
-            case DM_DataType::Mask: {
 
-                // Try registry system first, then fallback to legacy
-                if (tryRegistryThenLegacyLoad(dm, file_path, data_type, item, name, data_info_list, &factory)) {
-                    break;// Successfully loaded with plugin
-                }
+            // Legacy loading fallback
+            std::string const color = item.value("color", "0000FF");
+            if (data_type == DM_DataType::Line) {
+                auto line_data = load_into_LineData(file_path, item);
+                return [line_data, name, color](DataManager * dm, std::vector<DataInfo> & data_info_list) {
+                    // Attach identity context and generate EntityIds
+                    if (line_data) {
+                        line_data->setIdentityContext(name, dm->getEntityRegistry());
+                        line_data->rebuildAllEntityIds();
+                    }
 
-                // Legacy loading fallback
-                auto mask_data = load_into_MaskData(file_path, item);
+                    dm->setData<LineData>(name, line_data, TimeKey("time"));
+                    data_info_list.push_back({name, "LineData", color});
+                };
+            }
 
-                std::string const color = item.value("color", "0000FF");
+            auto mask_data = load_into_MaskData(file_path, item);
+            return [mask_data, &item, name, color](DataManager * dm, std::vector<DataInfo> & data_info_list) {
                 dm->setData<MaskData>(name, mask_data, TimeKey("time"));
-
                 data_info_list.push_back({name, "MaskData", color});
 
                 if (item.contains("operations")) {
@@ -570,40 +660,16 @@ std::vector<DataInfo> load_data_from_json_config(DataManager * dm, json const &
                         }
                     }
                 }
-                break;
-            }
-            case DM_DataType::Line: {
-
-                // Try registry system first, then fallback to legacy
-                if (tryRegistryThenLegacyLoad(dm, file_path, data_type, item, name, data_info_list, &factory)) {
-                    break;// Successfully loaded with plugin
-                }
-
-                // Legacy loading fallback
-                auto line_data = load_into_LineData(file_path, item);
-
-                // Attach identity context and generate EntityIds
-                if (line_data) {
-                    line_data->setIdentityContext(name, dm->getEntityRegistry());
-                    line_data->rebuildAllEntityIds();
-                }
-
-                dm->setData<LineData>(name, line_data, TimeKey("time"));
-
-                std::string const color = item.value("color", "0000FF");
-
-                data_info_list.push_back({name, "LineData", color});
-
-                break;
-            }
-            case DM_DataType::Analog: {
-
-                auto analog_time_series = load_into_AnalogTimeSeries(file_path, item);
-
+            };
+        }
+        case DM_DataType::Analog: {
+            auto analog_time_series = load_into_AnalogTimeSeries(file_path, item);
+            return [analog_time_series = std::move(analog_time_series), &item, name](DataManager * dm, std::vector<DataInfo> & data_info_list) {
                 for (size_t channel = 0; channel < analog_time_series.size(); channel++) {
                     std::string const channel_name = name + "_" + std::to_string(channel);
 
                     dm->setData<AnalogTimeSeries>(channel_name, analog_time_series[channel], TimeKey("time"));
+                    data_info_list.push_back({channel_name, "AnalogTimeSeries", ""});
 
                     if (item.contains("clock")) {
                         std::string const clock_str = item["clock"];
@@ -611,12 +677,11 @@ std::vector<DataInfo> load_data_from_json_config(DataManager * dm, json const &
                         dm->setTimeKey(channel_name, clock);
                     }
                 }
-                break;
-            }
-            case DM_DataType::DigitalEvent: {
-
-                auto digital_event_series = load_into_DigitalEventSeries(file_path, item);
-
+            };
+        }
+        case DM_DataType::DigitalEvent: {
+            auto digital_event_series = load_into_DigitalEventSeries(file_path, item);
+            return [digital_event_series = std::move(digital_event_series), &item, name](DataManager * dm, std::vector<DataInfo> & data_info_list) {
                 for (size_t channel = 0; channel < digital_event_series.size(); channel++) {
                     std::string const channel_name = name + "_" + std::to_string(channel);
 
@@ -627,6 +692,7 @@ std::vector<DataInfo> load_data_from_json_config(DataManager * dm, json const &
                     }
 
                     dm->setData<DigitalEventSeries>(channel_name, digital_event_series[channel], TimeKey("time"));
+                    data_info_list.push_back({channel_name, "DigitalEventSeries", ""});
 
                     if (item.contains("clock")) {
                         std::string const clock_str = item["clock"];
@@ -634,128 +700,277 @@ std::vector<DataInfo> load_data_from_json_config(DataManager * dm, json const &
                         dm->setTimeKey(channel_name, clock);
                     }
                 }
-                break;
-            }
-            case DM_DataType::DigitalInterval: {
-
-                auto digital_interval_series = load_into_DigitalIntervalSeries(file_path, item);
+            };
+        }
+        case DM_DataType::DigitalInterval: {
+            auto digital_interval_series = load_into_DigitalIntervalSeries(file_path, item);
+            return [digital_interval_series, name](DataManager * dm, std::vector<DataInfo> & data_info_list) {
                 if (digital_interval_series) {
                     digital_interval_series->setIdentityContext(name, dm->getEntityRegistry());
                     digital_interval_series->rebuildAllEntityIds();
                 }
                 dm->setData<DigitalIntervalSeries>(name, digital_interval_series, TimeKey("time"));
+                data_info_list.push_back({name, "DigitalIntervalSeries", ""});
+            };
+        }
+        case DM_DataType::Tensor: {
+
+            if (item["format"] == "numpy") {
 
-                break;
+                auto tensor_data = std::make_shared<TensorData>();
+                loadNpyToTensorData(file_path, *tensor_data, item.value("array", ""));
+
+                return [tensor_data, name](DataManager * dm, std::vector<DataInfo> & data_info_list) {
+                    dm->setData<TensorData>(name, tensor_data, TimeKey("time"));
+                    data_info_list.push_back({name, "TensorData", ""});
+                };
             }
-            case DM_DataType::Tensor: {
 
-                if (item["format"] == "numpy") {
+            std::cout << "Format " << item["format"] << " not found for " << name << std::endl;
+            return {};
+        }
+        case DM_DataType::Time: {
+
+            std::shared_ptr<TimeFrame> timeframe;
 
-                    TensorData tensor_data;
-                    loadNpyToTensorData(file_path, tensor_data);
+            if (item["format"] == "uint16") {
 
-                    dm->setData<TensorData>(name, std::make_shared<TensorData>(tensor_data), TimeKey("time"));
+                int const channel = item["channel"];
+                std::string const transition = item["transition"];
 
-                } else {
-                    std::cout << "Format " << item["format"] << " not found for " << name << std::endl;
+                int const header_size = item.value("header_size", 0);
+
+                auto opts = Loader::BinaryAnalogOptions{.file_path = file_path,
+                                                        .header_size_bytes = static_cast<size_t>(header_size)};
+                auto data = Loader::readBinaryFile<uint16_t>(opts);
+
+                auto digital_data = Loader::extractDigitalData(data, channel);
+                auto events = Loader::extractEvents(digital_data, transition);
+
+                std::vector<int64_t> event_times;
+                event_times.reserve(events.size());
+                for (auto e: events) {
+                    event_times.push_back(static_cast<int64_t>(e));
                 }
-                break;
+                std::cout << "Loaded " << event_times.size() << " events for " << name << std::endl;
+
+                timeframe = std::make_shared<TimeFrame>(std::move(event_times));
             }
-            case DM_DataType::Time: {
 
-                if (item["format"] == "uint16") {
+            if (item["format"] == "uint16_length") {
 
-                    int const channel = item["channel"];
-                    std::string const transition = item["transition"];
+                int const header_size = item.value("header_size", 0);
 
-                    int const header_size = item.value("header_size", 0);
+                // One tick per uint16 sample; only the file size is needed for an implicit clock
+                std::error_code ec;
+                auto file_size = std::filesystem::file_size(file_path, ec);
+                if (ec) {
+                    std::cout << "Cannot open file: " << file_path << std::endl;
+                    file_size = 0;
+                }
+                auto const header_bytes = static_cast<std::uintmax_t>(header_size);
+                auto const sample_count = file_size > header_bytes ? (file_size - header_bytes) / sizeof(uint16_t) : 0;
 
-                    auto opts = Loader::BinaryAnalogOptions{.file_path = file_path,
-                                                            .header_size_bytes = static_cast<size_t>(header_size)};
-                    auto data = Loader::readBinaryFile<uint16_t>(opts);
+                std::cout << "Total of " << sample_count << " timestamps for " << name << std::endl;
 
-                    auto digital_data = Loader::extractDigitalData(data, channel);
-                    auto events = Loader::extractEvents(digital_data, transition);
+                timeframe = TimeFrame::createRegular(static_cast<int64_t>(sample_count));
+            }
 
-                    // convert to int with std::transform
-                    std::vector<int> events_int;
-                    events_int.reserve(events.size());
-                    for (auto e: events) {
-                        events_int.push_back(static_cast<int>(e));
-                    }
-                    std::cout << "Loaded " << events_int.size() << " events for " << name << std::endl;
+            if (item["format"] == "filename") {
 
-                    auto timeframe = std::make_shared<TimeFrame>(events_int);
-                    dm->setTime(TimeKey(name), timeframe, true);
+                // Get required parameters
+                std::string const folder_path = file_path;// file path is required argument
+                std::string const regex_pattern = item["regex_pattern"];
+
+                // Get optional parameters with defaults
+                std::string const file_extension = item.value("file_extension", "");
+                std::string const mode_str = item.value("mode", "found_values");
+                bool const sort_ascending = item.value("sort_ascending", true);
+
+                // Convert mode string to enum
+                FilenameTimeFrameMode mode = FilenameTimeFrameMode::FOUND_VALUES;
+                if (mode_str == "zero_to_max") {
+                    mode = FilenameTimeFrameMode::ZERO_TO_MAX;
+                } else if (mode_str == "min_to_max") {
+                    mode = FilenameTimeFrameMode::MIN_TO_MAX;
                 }
 
-                if (item["format"] == "uint16_length") {
+                // Create options
+                FilenameTimeFrameOptions options;
+                options.folder_path = folder_path;
+                options.file_extension = file_extension;
+                options.regex_pattern = regex_pattern;
+                options.mode = mode;
+                options.sort_ascending = sort_ascending;
+
+                // Create TimeFrame from filenames
+                timeframe = createTimeFrameFromFilenames(options);
+                if (timeframe) {
+                    std::cout << "Created TimeFrame '" << name << "' from filenames in "
+                              << folder_path << std::endl;
+                } else {
+                    std::cerr << "Error: Failed to create TimeFrame from filenames for "
+                              << name << std::endl;
+                }
+            }
+
+            if (!timeframe) {
+                return {};
+            }
+            return [timeframe, name](DataManager * dm, std::vector<DataInfo> & data_info_list) {
+                dm->setTime(TimeKey(name), timeframe, true);
+                data_info_list.push_back({name, "TimeFrame", ""});
+            };
+        }
+        default:
+            std::cout << "Unsupported data type: " << entry.data_type_str << std::endl;
+            return {};
+    }
+}
 
-                    int const header_size = item.value("header_size", 0);
+std::vector<DataInfo> load_data_from_json_config(DataManager * dm, json const & j, std::filesystem::path const & base_path) {
+    std::vector<DataInfo> data_info_list;
+    // Create factory for plugin system
+    ConcreteDataFactory factory;
 
-                    auto opts = Loader::BinaryAnalogOptions{.file_path = file_path,
-                                                            .header_size_bytes = static_cast<size_t>(header_size)};
-                    auto data = Loader::readBinaryFile<uint16_t>(opts);
+    // Validate every entry up front so that decoding can be scheduled across threads
+    std::vector<ConfigLoadEntry> entries;
+    for (auto const & item: j) {
 
-                    std::vector<int> t(data.size());
-                    std::iota(std::begin(t), std::end(t), 0);
+        // Skip transformation objects - they will be processed separately
+        if (item.contains("transformations")) {
+            continue;
+        }
 
-                    std::cout << "Total of " << t.size() << " timestamps for " << name << std::endl;
+        if (!checkRequiredFields(item, {"data_type", "name", "filepath"})) {
+            continue;// Exit if any required field is missing
+        }
 
-                    auto timeframe = std::make_shared<TimeFrame>(t);
-                    dm->setTime(TimeKey(name), timeframe, true);
-                }
+        std::string const data_type_str = item["data_type"];
+        auto const data_type = stringToDataType(data_type_str);
+        if (data_type == DM_DataType::Unknown) {
+            std::cout << "Unknown data type: " << data_type_str << std::endl;
+            continue;
+        }
 
-                if (item["format"] == "filename") {
+        std::string const name = item["name"];
 
-                    // Get required parameters
-                    std::string const folder_path = file_path;// file path is required argument
-                    std::string const regex_pattern = item["regex_pattern"];
+        auto file_exists = processFilePath(item["filepath"], base_path);
+        if (!file_exists) {
+            std::cerr << "File does not exist: " << item["filepath"] << std::endl;
+            continue;
+        }
 
-                    // Get optional parameters with defaults
-                    std::string const file_extension = item.value("file_extension", "");
-                    std::string const mode_str = item.value("mode", "found_values");
-                    bool const sort_ascending = item.value("sort_ascending", true);
+        std::string const file_path = file_exists.value();
 
-                    // Convert mode string to enum
-                    FilenameTimeFrameMode mode = FilenameTimeFrameMode::FOUND_VALUES;
-                    if (mode_str == "zero_to_max") {
-                        mode = FilenameTimeFrameMode::ZERO_TO_MAX;
-                    } else if (mode_str == "min_to_max") {
-                        mode = FilenameTimeFrameMode::MIN_TO_MAX;
-                    }
+        entries.push_back({&item,
+                           data_type,
+                           data_type_str,
+                           name,
+                           file_path,
+                           requiresExclusiveDecode(item, file_path)});
+    }
 
-                    // Create options
-                    FilenameTimeFrameOptions options;
-                    options.folder_path = folder_path;
-                    options.file_extension = file_extension;
-                    options.regex_pattern = regex_pattern;
-                    options.mode = mode;
-                    options.sort_ascending = sort_ascending;
-
-                    // Create TimeFrame from filenames
-                    auto timeframe = createTimeFrameFromFilenames(options);
-                    if (timeframe) {
-                        dm->setTime(TimeKey(name), timeframe, true);
-                        std::cout << "Created TimeFrame '" << name << "' from filenames in "
-                                  << folder_path << std::endl;
-                    } else {
-                        std::cerr << "Error: Failed to create TimeFrame from filenames for "
-                                  << name << std::endl;
-                    }
+    // TimeFrames are decoded and committed first so that every other entry can
+    // refer to its clock regardless of where the clock appears in the file.
+    // Relative order is otherwise preserved, which keeps data_info_list in config order.
+    std::vector<size_t> schedule(entries.size());
+    std::iota(schedule.begin(), schedule.end(), size_t{0});
+    std::stable_partition(schedule.begin(), schedule.end(), [&entries](size_t i) {
+        return entries[i].data_type == DM_DataType::Time;
+    });
+
+    std::vector<ConfigLoadResult> results(entries.size());
+    std::mutex results_mutex;
+    std::condition_variable results_ready;
+    std::mutex exclusive_mutex;
+    std::atomic<size_t> next_scheduled{0};
+
+    auto decode_worker = [&]() {
+        for (size_t s = next_scheduled++; s < schedule.size(); s = next_scheduled++) {
+            size_t const index = schedule[s];
+            auto const & entry = entries[index];
+
+            auto const start = std::chrono::steady_clock::now();
+            DataCommit commit;
+            std::string error;
+            try {
+                std::unique_lock<std::mutex> exclusive_lock(exclusive_mutex, std::defer_lock);
+                if (entry.exclusive) {
+                    exclusive_lock.lock();
+                }
+                TRACE_ZONE_DETAIL("decode data entry", "loader", entry.name);
+                commit = decodeConfigEntry(entry, &factory);
+                if (!commit) {
+                    error = "No " + entry.data_type_str + " data could be loaded from " + entry.file_path;
                 }
-                break;
+            } catch (std::exception const & e) {
+                error = e.what();
+            } catch (...) {
+                error = "unknown error";
+            }
+            if (!error.empty()) {
+                std::cerr << "Failed to load " << entry.name << ": " << error << std::endl;
+            }
+            auto const elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+
+            {
+                std::lock_guard<std::mutex> lock(results_mutex);
+                results[index].commit = std::move(commit);
+                results[index].error = std::move(error);
+                results[index].decode_time_ms = elapsed.count();
+                results[index].ready = true;
             }
-            default:
-                std::cout << "Unsupported data type: " << data_type_str << std::endl;
-                continue;
+            results_ready.notify_all();
         }
+    };
+
+    size_t const num_workers = std::min(parallel_worker_count(), entries.size());
+    std::vector<std::future<void>> workers;
+    workers.reserve(num_workers);
+    for (size_t w = 0; w < num_workers; ++w) {
+        workers.push_back(std::async(std::launch::async, decode_worker));
+    }
+
+    // Commit on this thread in schedule order as soon as each entry is decoded
+    for (size_t const index: schedule) {
+        auto const & entry = entries[index];
+
+        ConfigLoadResult result;
+        {
+            std::unique_lock<std::mutex> lock(results_mutex);
+            results_ready.wait(lock, [&results, index]() { return results[index].ready; });
+            result = std::move(results[index]);
+        }
+
+        // Failed entries stay in the result so the caller can report them
+        if (!result.commit) {
+            data_info_list.push_back({entry.name, dataClassName(entry.data_type), "", result.decode_time_ms, std::move(result.error)});
+            continue;
+        }
+
+        TRACE_ZONE_DETAIL("commit data entry", "loader", entry.name);
+        auto const commit_start = std::chrono::steady_clock::now();
+        size_t const first_info = data_info_list.size();
+        result.commit(dm, data_info_list);
+
+        auto const & item = *entry.item;
         if (item.contains("clock")) {
             std::string clock_str = item["clock"];
             auto clock = TimeKey(clock_str);
-            std::cout << "Setting time for " << name << " to " << clock << std::endl;
-            dm->setTimeKey(name, clock);
+            std::cout << "Setting time for " << entry.name << " to " << clock << std::endl;
+            dm->setTimeKey(entry.name, clock);
         }
+
+        auto const commit_time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - commit_start);
+        double const load_time_ms = result.decode_time_ms + commit_time.count();
+        for (size_t i = first_info; i < data_info_list.size(); ++i) {
+            data_info_list[i].load_time_ms = load_time_ms;
+        }
+    }
+
+    for (auto & worker: workers) {
+        worker.get();
     }
 
     // Process all transformation objects found in the JSON array
@@ -314,6 +314,12 @@ private:
     std::unique_ptr<EntityRegistry> _entity_registry;
 };
 
+/**
+ * @brief Load every data entry listed in a JSON config
+ *
+ * Entries that fail to decode are still returned, in config order, with
+ * DataInfo::error set and nothing registered in the DataManager.
+ */
 std::vector<DataInfo> load_data_from_json_config(DataManager *, std::string const & json_filepath);
 std::vector<DataInfo> load_data_from_json_config(DataManager * dm, nlohmann::json const & j, std::filesystem::path const & base_path);
 
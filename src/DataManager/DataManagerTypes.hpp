@@ -54,6 +54,8 @@ struct DataInfo {
     std::string key;
     std::string data_class;
     std::string color;
+    double load_time_ms{0.0};///< Wall time spent decoding and registering the data
+    std::string error{};     ///< Why the entry failed to load; empty if it loaded
 };
 
 struct DataGroup {
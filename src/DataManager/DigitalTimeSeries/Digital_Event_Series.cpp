@@ -23,6 +23,35 @@ std::vector<float> const & DigitalEventSeries::getEventSeries() const {
     return _data;
 }
 
+std::span<float const> DigitalEventSeries::getEventSpanInRange(TimeFrameIndex start_time, TimeFrameIndex stop_time) const {
+    auto const start_value = static_cast<float>(start_time.getValue());
+    auto const stop_value = static_cast<float>(stop_time.getValue());
+    if (stop_value < start_value) {
+        return {};
+    }
+
+    auto const first = std::lower_bound(_data.begin(), _data.end(), start_value);
+    auto const last = std::upper_bound(first, _data.end(), stop_value);
+    return {first, last};
+}
+
+std::span<float const> DigitalEventSeries::getEventSpanInRange(TimeFrameIndex start_index,
+                                                               TimeFrameIndex stop_index,
+                                                               TimeFrame const * source_time_frame,
+                                                               TimeFrame const * event_time_frame) const {
+    if (source_time_frame == event_time_frame || !source_time_frame || !event_time_frame) {
+        return getEventSpanInRange(start_index, stop_index);
+    }
+
+    auto const start_time_value = source_time_frame->getTimeAtIndex(start_index);
+    auto const stop_time_value = source_time_frame->getTimeAtIndex(stop_index);
+
+    auto const target_start_index = event_time_frame->getIndexAtTime(static_cast<double>(start_time_value), false);
+    auto const target_stop_index = event_time_frame->getIndexAtTime(static_cast<double>(stop_time_value));
+
+    return getEventSpanInRange(target_start_index, target_stop_index);
+}
+
 void DigitalEventSeries::addEvent(float const event_time) {
 
     if (std::find(_data.begin(), _data.end(), event_time) != _data.end()) {
@@ -6,6 +6,7 @@
 #include "Entity/EntityTypes.hpp"
 
 #include <ranges>
+#include <span>
 #include <vector>
 
 class EntityRegistry;
@@ -68,12 +69,25 @@ public:
         auto start_time_value = source_time_frame->getTimeAtIndex(start_index);
         auto stop_time_value = source_time_frame->getTimeAtIndex(stop_index);
 
-        auto target_start_index = event_time_frame->getIndexAtTime(static_cast<float>(start_time_value), false);
-        auto target_stop_index = event_time_frame->getIndexAtTime(static_cast<float>(stop_time_value));
+        auto target_start_index = event_time_frame->getIndexAtTime(static_cast<double>(start_time_value), false);
+        auto target_stop_index = event_time_frame->getIndexAtTime(static_cast<double>(stop_time_value));
 
         return getEventsInRange(target_start_index, target_stop_index);
     };
 
+    /**
+     * @brief Contiguous view of the events between two indices (inclusive)
+     *
+     * Same selection as getEventsInRange, but events are kept sorted so the
+     * range is found with a binary search instead of a filter over every event.
+     */
+    [[nodiscard]] std::span<float const> getEventSpanInRange(TimeFrameIndex start_time, TimeFrameIndex stop_time) const;
+
+    [[nodiscard]] std::span<float const> getEventSpanInRange(TimeFrameIndex start_index,
+                                                             TimeFrameIndex stop_index,
+                                                             TimeFrame const * source_time_frame,
+                                                             TimeFrame const * event_time_frame) const;
+
     template<typename TransformFunc>
     auto getEventsInRange(float start_time, float stop_time, TransformFunc time_transform) const {
         return _data | std::views::filter([start_time, stop_time, time_transform](float time) {
@@ -128,6 +128,54 @@ void DigitalIntervalSeries::_removeEventAtTime(TimeFrameIndex const time) {
     }
 }
 
+void DigitalIntervalSeries::_applyEventRuns(std::vector<Interval> const & set_runs,
+                                            std::vector<Interval> const & clear_runs) {
+    if (set_runs.empty() && clear_runs.empty()) {
+        return;
+    }
+
+    // Cut the cleared runs out of every interval. Runs are sorted and disjoint,
+    // so their ends are sorted too.
+    std::vector<Interval> kept;
+    kept.reserve(_data.size() + clear_runs.size());
+    for (auto const & interval: _data) {
+        auto run = std::lower_bound(clear_runs.begin(), clear_runs.end(), interval.start,
+                                    [](Interval const & r, int64_t time) { return r.end < time; });
+        int64_t start = interval.start;
+        for (; run != clear_runs.end() && run->start <= interval.end; ++run) {
+            if (run->start > start) {
+                kept.push_back(Interval{start, run->start - 1});
+            }
+            start = run->end + 1;
+        }
+        if (start <= interval.end) {
+            kept.push_back(Interval{start, interval.end});
+        }
+    }
+    if (!std::is_sorted(kept.begin(), kept.end())) {
+        std::sort(kept.begin(), kept.end());
+    }
+
+    // Merge in the set runs, joining every interval that overlaps or touches
+    // its neighbour
+    std::vector<Interval> merged;
+    merged.reserve(kept.size() + set_runs.size());
+    size_t k = 0;
+    size_t r = 0;
+    while (k < kept.size() || r < set_runs.size()) {
+        bool const take_new = k == kept.size() || (r < set_runs.size() && set_runs[r].start < kept[k].start);
+        Interval const next = take_new ? set_runs[r++] : kept[k++];
+
+        if (!merged.empty() && (is_overlapping(merged.back(), next) || is_contiguous(merged.back(), next))) {
+            merged.back().end = std::max(merged.back().end, next.end);
+        } else {
+            merged.push_back(next);
+        }
+    }
+
+    _data = std::move(merged);
+}
+
 void DigitalIntervalSeries::_sortData() {
     std::sort(_data.begin(), _data.end());
 }
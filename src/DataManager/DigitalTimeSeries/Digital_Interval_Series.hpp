@@ -6,9 +6,11 @@
 #include "TimeFrame/TimeFrame.hpp"
 #include "Entity/EntityTypes.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <iostream>
 #include <ranges>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -89,6 +91,46 @@ public:
         notifyObservers();
     }
 
+    /**
+     * @brief Set the event state at many sorted times in one pass
+     *
+     * Consecutive times with the same state are applied as one run, so
+     * per-frame labels over a long session cost one pass over the series
+     * instead of one pass per frame.
+     *
+     * On a series whose intervals are already merged, as addEvent and
+     * setEventAtTime keep them, this gives the same result as calling
+     * setEventAtTime(times[i], events[i]) for every i. Intervals that touch
+     * or overlap but were never merged (e.g. from the vector constructor) are
+     * joined, wherever they are in the series.
+     *
+     * @param times Strictly increasing times
+     * @param events State at each time; non-zero marks an event
+     * @param notify If true, observers are notified afterwards
+     */
+    template<typename T, typename B>
+    void setEventsAtSortedTimes(std::span<T const> times, std::span<B const> events, bool notify = true) {
+        std::vector<Interval> set_runs;
+        std::vector<Interval> clear_runs;
+        size_t const count = std::min(times.size(), events.size());
+        size_t i = 0;
+        while (i < count) {
+            bool const state = static_cast<bool>(events[i]);
+            auto const start = static_cast<int64_t>(times[i]);
+            auto end = start;
+            ++i;
+            while (i < count && static_cast<bool>(events[i]) == state && static_cast<int64_t>(times[i]) == end + 1) {
+                end = static_cast<int64_t>(times[i]);
+                ++i;
+            }
+            (state ? set_runs : clear_runs).push_back(Interval{start, end});
+        }
+        _applyEventRuns(set_runs, clear_runs);
+        if (notify) {
+            notifyObservers();
+        }
+    }
+
     template<typename T>
     void createIntervalsFromBool(std::vector<T> const & bool_vector) {
         bool in_interval = false;
@@ -171,8 +213,8 @@ public:
             auto stop_time_value = source_timeframe->getTimeAtIndex(stop_time);
 
             // 2. Convert that time value to an index in the target timeframe
-            auto target_start_index = interval_timeframe->getIndexAtTime(static_cast<float>(start_time_value));
-            auto target_stop_index = interval_timeframe->getIndexAtTime(static_cast<float>(stop_time_value));
+            auto target_start_index = interval_timeframe->getIndexAtTime(static_cast<double>(start_time_value));
+            auto target_stop_index = interval_timeframe->getIndexAtTime(static_cast<double>(stop_time_value));
 
             return getIntervalsInRange<mode>(target_start_index.getValue(), target_stop_index.getValue());
         }
@@ -201,6 +243,7 @@ private:
     void _addEvent(Interval new_interval);
     void _setEventAtTime(TimeFrameIndex time, bool event);
     void _removeEventAtTime(TimeFrameIndex time);
+    void _applyEventRuns(std::vector<Interval> const & set_runs, std::vector<Interval> const & clear_runs);
 
     void _sortData();
 
@@ -40,3 +40,75 @@ TEST_CASE("DigitalIntervalSeries - Range-based access", "[DataManager]") {
         REQUIRE(collected[2].end == 40);
     }
 }
+
+TEST_CASE("DigitalIntervalSeries - setEventsAtSortedTimes", "[DataManager]") {
+
+    auto make_series = []() {
+        DigitalIntervalSeries dis;
+        dis.addEvent(TimeFrameIndex(0), TimeFrameIndex(10));
+        dis.addEvent(TimeFrameIndex(20), TimeFrameIndex(30));
+        dis.addEvent(TimeFrameIndex(50), TimeFrameIndex(50));
+        return dis;
+    };
+
+    SECTION("Matches setting each time individually") {
+        std::vector<int64_t> times;
+        std::vector<int> events;
+        for (int64_t t = 5; t < 60; ++t) {
+            if (t == 40) continue;// a gap in the times breaks a run
+            times.push_back(t);
+            events.push_back((t / 3) % 2 == 0 || (t >= 24 && t <= 28) ? 1 : 0);
+        }
+
+        auto expected = make_series();
+        for (size_t i = 0; i < times.size(); ++i) {
+            expected.setEventAtTime(TimeFrameIndex(times[i]), events[i] != 0);
+        }
+
+        auto bulk = make_series();
+        bulk.setEventsAtSortedTimes(std::span<int64_t const>(times), std::span<int const>(events));
+
+        REQUIRE(bulk.getDigitalIntervalSeries() == expected.getDigitalIntervalSeries());
+    }
+
+    SECTION("Runs join neighbouring intervals") {
+        auto dis = make_series();
+        std::vector<size_t> times{11, 12, 13, 14, 15, 16, 17, 18, 19};
+        std::vector<size_t> events(times.size(), 1);
+
+        dis.setEventsAtSortedTimes(std::span<size_t const>(times), std::span<size_t const>(events));
+
+        auto const & data = dis.getDigitalIntervalSeries();
+        REQUIRE(data.size() == 2);
+        REQUIRE(data[0] == Interval{0, 30});
+        REQUIRE(data[1] == Interval{50, 50});
+    }
+
+    SECTION("Cleared runs split intervals") {
+        auto dis = make_series();
+        std::vector<size_t> times{3, 4, 5, 50};
+        std::vector<size_t> events(times.size(), 0);
+
+        dis.setEventsAtSortedTimes(std::span<size_t const>(times), std::span<size_t const>(events));
+
+        auto const & data = dis.getDigitalIntervalSeries();
+        REQUIRE(data.size() == 3);
+        REQUIRE(data[0] == Interval{0, 2});
+        REQUIRE(data[1] == Interval{6, 10});
+        REQUIRE(data[2] == Interval{20, 30});
+    }
+
+    SECTION("Touching intervals that were never merged are joined") {
+        DigitalIntervalSeries dis(std::vector<Interval>{{0, 2}, {3, 5}, {10, 12}});
+        std::vector<size_t> times{3, 20};
+        std::vector<size_t> events{1, 1};
+
+        dis.setEventsAtSortedTimes(std::span<size_t const>(times), std::span<size_t const>(events));
+
+        auto const & data = dis.getDigitalIntervalSeries();
+        REQUIRE(data.size() == 3);
+        REQUIRE(data[0] == Interval{0, 5});
+        REQUIRE(data[1] == Interval{10, 12});
+        REQUIRE(data[2] == Interval{20, 20});
+    }
+}
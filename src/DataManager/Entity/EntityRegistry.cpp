@@ -1,37 +1,239 @@
 #include "EntityRegistry.hpp"
 
+#include <algorithm>
 #include <cassert>
 
+namespace {
+
+/// Dense offset tables may always span at least this many time values
+constexpr std::size_t kMinDenseSpan = 4096;
+
+/// Beyond kMinDenseSpan, a dense table may hold at most this many empty entries per registered time
+constexpr std::size_t kMaxDenseFactor = 4;
+
+}// namespace
+
 EntityId EntityRegistry::ensureId(std::string const & data_key,
                                   EntityKind kind,
                                   TimeFrameIndex const & time,
                                   int local_index) {
     assert(local_index >= 0);
 
-    EntityTupleKey const key{data_key, kind, time.getValue(), local_index};
-    auto it = m_tuple_to_id.find(key);
-    if (it != m_tuple_to_id.end()) {
-        return it->second;
+    auto const dataset_index = datasetIndex(data_key, kind);
+    auto & dataset = m_datasets[dataset_index];
+    auto const time_value = time.getValue();
+
+    if (auto * slot = findSlot(dataset, time_value)) {
+        return ensureInSlot(dataset_index, *slot, time_value, local_index);
     }
 
-    EntityId const id = m_next_id++;
-    m_tuple_to_id.emplace(key, id);
-    m_id_to_descriptor.emplace(id, EntityDescriptor{data_key, kind, time.getValue(), local_index});
-    return id;
+    auto & slot = createSlot(dataset, time_value);
+    slot.first = IdRun{allocateRun(dataset_index, time_value, local_index, 1), local_index, 1};
+    return slot.first.first_id;
+}
+
+std::vector<EntityId> EntityRegistry::ensureIds(std::string const & data_key,
+                                                EntityKind kind,
+                                                TimeFrameIndex const & time,
+                                                int count,
+                                                int first_local_index) {
+    assert(count >= 0);
+    assert(first_local_index >= 0);
+
+    std::vector<EntityId> ids;
+    if (count <= 0) {
+        return ids;
+    }
+    ids.reserve(static_cast<std::size_t>(count));
+
+    auto const dataset_index = datasetIndex(data_key, kind);
+    auto & dataset = m_datasets[dataset_index];
+    auto const time_value = time.getValue();
+
+    if (auto * slot = findSlot(dataset, time_value)) {
+        for (int i = 0; i < count; ++i) {
+            ids.push_back(ensureInSlot(dataset_index, *slot, time_value, first_local_index + i));
+        }
+        return ids;
+    }
+
+    // Nothing registered at this time yet: one run covers every entity
+    auto & slot = createSlot(dataset, time_value);
+    auto const run_length = static_cast<std::uint32_t>(count);
+    slot.first = IdRun{allocateRun(dataset_index, time_value, first_local_index, run_length), first_local_index, run_length};
+    for (std::uint32_t i = 0; i < run_length; ++i) {
+        ids.push_back(slot.first.first_id + i);
+    }
+    return ids;
+}
+
+std::vector<EntityId> EntityRegistry::ensureIds(std::string const & data_key,
+                                                EntityKind kind,
+                                                std::span<TimeFrameIndex const> times,
+                                                std::span<int const> local_indices) {
+    assert(times.size() == local_indices.size());
+
+    std::vector<EntityId> ids;
+    ids.reserve(times.size());
+
+    auto const dataset_index = datasetIndex(data_key, kind);
+    auto & dataset = m_datasets[dataset_index];
+
+    for (std::size_t i = 0; i < times.size(); ++i) {
+        auto const time_value = times[i].getValue();
+        int const local_index = local_indices[i];
+        assert(local_index >= 0);
+
+        if (auto * slot = findSlot(dataset, time_value)) {
+            ids.push_back(ensureInSlot(dataset_index, *slot, time_value, local_index));
+        } else {
+            auto & slot_ref = createSlot(dataset, time_value);
+            slot_ref.first = IdRun{allocateRun(dataset_index, time_value, local_index, 1), local_index, 1};
+            ids.push_back(slot_ref.first.first_id);
+        }
+    }
+    return ids;
 }
 
 std::optional<EntityDescriptor> EntityRegistry::get(EntityId id) const {
-    auto it = m_id_to_descriptor.find(id);
-    if (it == m_id_to_descriptor.end()) {
+    if (id >= m_next_id) {
         return std::nullopt;
     }
-    return it->second;
+
+    // Blocks cover [0, m_next_id) without gaps and are sorted by first_id
+    auto it = std::upper_bound(m_blocks.begin(), m_blocks.end(), id, [](EntityId value, Block const & block) {
+        return value < block.first_id;
+    });
+    if (it == m_blocks.begin()) {
+        return std::nullopt;
+    }
+    --it;
+    if (id - it->first_id >= it->count) {
+        return std::nullopt;
+    }
+
+    auto const & dataset = m_datasets[it->dataset];
+    return EntityDescriptor{dataset.data_key,
+                            dataset.kind,
+                            it->time_value,
+                            it->first_local + static_cast<int>(id - it->first_id)};
 }
 
 void EntityRegistry::clear() {
-    m_tuple_to_id.clear();
-    m_id_to_descriptor.clear();
+    m_datasets.clear();
+    m_dataset_lookup.clear();
+    m_last_dataset = 0;
+    m_blocks.clear();
     m_next_id = 0;
 }
 
+std::uint32_t EntityRegistry::datasetIndex(std::string const & data_key, EntityKind kind) {
+    // Registration usually comes in long runs for the same dataset
+    if (m_last_dataset < m_datasets.size()) {
+        auto const & last = m_datasets[m_last_dataset];
+        if (last.kind == kind && last.data_key == data_key) {
+            return m_last_dataset;
+        }
+    }
+
+    auto [it, inserted] = m_dataset_lookup.try_emplace(DatasetKey{data_key, kind}, static_cast<std::uint32_t>(m_datasets.size()));
+    if (inserted) {
+        Dataset dataset;
+        dataset.data_key = data_key;
+        dataset.kind = kind;
+        m_datasets.push_back(std::move(dataset));
+    }
+    m_last_dataset = it->second;
+    return it->second;
+}
+
+EntityRegistry::TimeSlot * EntityRegistry::findSlot(Dataset & dataset, std::int64_t time) {
+    if (time >= dataset.dense_origin) {
+        auto const offset = static_cast<std::uint64_t>(time - dataset.dense_origin);
+        if (offset < dataset.dense.size()) {
+            auto const entry = dataset.dense[offset];
+            if (entry != 0) {
+                return &dataset.slots[entry - 1];
+            }
+        }
+    }
+    // The dense table may have grown over a time that was registered as sparse
+    if (dataset.sparse.empty()) {
+        return nullptr;
+    }
+    auto it = dataset.sparse.find(time);
+    return it == dataset.sparse.end() ? nullptr : &dataset.slots[it->second];
+}
+
+EntityRegistry::TimeSlot & EntityRegistry::createSlot(Dataset & dataset, std::int64_t time) {
+    auto const slot_index = static_cast<std::uint32_t>(dataset.slots.size());
+    dataset.slots.emplace_back();
+
+    if (dataset.dense.empty()) {
+        dataset.dense_origin = time;
+        dataset.dense.push_back(slot_index + 1);
+        return dataset.slots.back();
+    }
+
+    // Grow the dense table to cover the new time if it stays reasonably full
+    std::int64_t const dense_end = dataset.dense_origin + static_cast<std::int64_t>(dataset.dense.size());
+    std::int64_t const low = std::min(dataset.dense_origin, time);
+    std::int64_t const high = std::max(dense_end, time + 1);
+    auto const span = static_cast<std::uint64_t>(high - low);
+    std::size_t const budget = std::max(kMinDenseSpan, kMaxDenseFactor * dataset.slots.size());
 
+    if (span <= budget) {
+        if (time < dataset.dense_origin) {
+            // Leave headroom so times registered in descending order do not shift the table every time
+            auto const needed = static_cast<std::size_t>(dataset.dense_origin - time);
+            auto const headroom = std::min(dataset.dense.size() / 2, budget - static_cast<std::size_t>(span));
+            auto const grow = needed + headroom;
+            dataset.dense.insert(dataset.dense.begin(), grow, 0);
+            dataset.dense_origin -= static_cast<std::int64_t>(grow);
+        } else if (time >= dense_end) {
+            dataset.dense.resize(static_cast<std::size_t>(time - dataset.dense_origin) + 1, 0);
+        }
+        dataset.dense[static_cast<std::size_t>(time - dataset.dense_origin)] = slot_index + 1;
+    } else {
+        dataset.sparse.emplace(time, slot_index);
+    }
+    return dataset.slots.back();
+}
+
+EntityId EntityRegistry::ensureInSlot(std::uint32_t dataset_index, TimeSlot & slot, std::int64_t time, int local_index) {
+    auto contains = [local_index](IdRun const & run) {
+        return local_index >= run.first_local &&
+               static_cast<std::uint32_t>(local_index - run.first_local) < run.count;
+    };
+
+    if (contains(slot.first)) {
+        return slot.first.first_id + static_cast<EntityId>(local_index - slot.first.first_local);
+    }
+    for (auto const & run: slot.more) {
+        if (contains(run)) {
+            return run.first_id + static_cast<EntityId>(local_index - run.first_local);
+        }
+    }
+
+    // Appending the next local index right after the newest run extends it in place
+    IdRun & last = slot.more.empty() ? slot.first : slot.more.back();
+    if (!m_blocks.empty() &&
+        m_blocks.back().first_id == last.first_id &&
+        last.first_id + last.count == m_next_id &&
+        local_index == last.first_local + static_cast<int>(last.count)) {
+        ++last.count;
+        ++m_blocks.back().count;
+        return m_next_id++;
+    }
+
+    auto const id = allocateRun(dataset_index, time, local_index, 1);
+    slot.more.push_back(IdRun{id, local_index, 1});
+    return id;
+}
+
+EntityId EntityRegistry::allocateRun(std::uint32_t dataset_index, std::int64_t time, int first_local, std::uint32_t count) {
+    EntityId const first_id = m_next_id;
+    m_next_id += count;
+    m_blocks.push_back(Block{first_id, count, dataset_index, time, first_local});
+    return first_id;
+}
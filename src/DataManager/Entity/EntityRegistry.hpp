@@ -4,14 +4,25 @@
 #include "Entity/EntityTypes.hpp"
 #include "TimeFrame/TimeFrame.hpp"
 
+#include <cstdint>
 #include <optional>
+#include <span>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 /**
  * @brief Central registry of session-scoped entity identifiers.
  *
  * @details Provides deterministic, session-local mapping between
  * (data_key, kind, time, local_index) tuples and opaque EntityId values.
+ *
+ * Ids are handed out in contiguous runs. Each (data_key, kind) pair is a
+ * dataset with an offset table from time to the id runs registered at that
+ * time, so resolving an id is a table lookup plus an addition. The offset
+ * table is a dense vector while the registered times are reasonably compact
+ * and falls back to a hash map for sparse times. The reverse lookup is a
+ * binary search over the runs, which are stored in id order.
  */
 class EntityRegistry {
 public:
@@ -24,22 +35,110 @@ public:
                                     TimeFrameIndex const & time,
                                     int local_index);
 
+    /**
+     * @brief Get or create the EntityIds of @p count consecutive entities at one time.
+     *
+     * Equivalent to calling ensureId for local indices
+     * [first_local_index, first_local_index + count). Entities that are not yet
+     * registered receive a single contiguous run of ids.
+     *
+     * @pre count >= 0 and first_local_index >= 0
+     * @return Ids in local index order
+     */
+    [[nodiscard]] std::vector<EntityId> ensureIds(std::string const & data_key,
+                                                  EntityKind kind,
+                                                  TimeFrameIndex const & time,
+                                                  int count,
+                                                  int first_local_index = 0);
+
+    /**
+     * @brief Get or create the EntityIds of a sequence of (time, local_index) tuples.
+     *
+     * Equivalent to calling ensureId for every pair, but the dataset is
+     * resolved once.
+     *
+     * @pre times.size() == local_indices.size()
+     * @return Ids in input order
+     */
+    [[nodiscard]] std::vector<EntityId> ensureIds(std::string const & data_key,
+                                                  EntityKind kind,
+                                                  std::span<TimeFrameIndex const> times,
+                                                  std::span<int const> local_indices);
+
     /**
      * @brief Lookup descriptor for an EntityId.
      */
     [[nodiscard]] std::optional<EntityDescriptor> get(EntityId id) const;
 
+    /**
+     * @brief Number of registered entities.
+     */
+    [[nodiscard]] std::size_t size() const { return static_cast<std::size_t>(m_next_id); }
+
     /**
      * @brief Clear all registered entities (session reset).
      */
     void clear();
 
 private:
-    std::unordered_map<EntityTupleKey, EntityId, EntityTupleKeyHash> m_tuple_to_id;
-    std::unordered_map<EntityId, EntityDescriptor> m_id_to_descriptor;
+    /// Ids [first_id, first_id + count) belong to local indices [first_local, first_local + count)
+    struct IdRun {
+        EntityId first_id{0};
+        int first_local{0};
+        std::uint32_t count{0};
+    };
+
+    /// Runs registered at one time. Almost every time has a single run.
+    struct TimeSlot {
+        IdRun first;
+        std::vector<IdRun> more;
+    };
+
+    struct Dataset {
+        std::string data_key;
+        EntityKind kind{EntityKind::PointEntity};
+
+        std::int64_t dense_origin{0};
+        std::vector<std::uint32_t> dense;///< slot index + 1 per time offset, 0 if unregistered
+        std::unordered_map<std::int64_t, std::uint32_t> sparse;///< Times outside the dense table
+        std::vector<TimeSlot> slots;
+    };
+
+    /// Reverse lookup entry; m_blocks is sorted by first_id
+    struct Block {
+        EntityId first_id{0};
+        std::uint32_t count{0};
+        std::uint32_t dataset{0};
+        std::int64_t time_value{0};
+        int first_local{0};
+    };
+
+    struct DatasetKey {
+        std::string data_key;
+        EntityKind kind;
+
+        bool operator==(DatasetKey const & other) const {
+            return kind == other.kind && data_key == other.data_key;
+        }
+    };
+
+    struct DatasetKeyHash {
+        std::size_t operator()(DatasetKey const & k) const noexcept {
+            return std::hash<std::string>{}(k.data_key) ^ (static_cast<std::size_t>(k.kind) * 0x9e3779b97f4a7c15ULL);
+        }
+    };
+
+    [[nodiscard]] std::uint32_t datasetIndex(std::string const & data_key, EntityKind kind);
+    [[nodiscard]] TimeSlot * findSlot(Dataset & dataset, std::int64_t time);
+    [[nodiscard]] TimeSlot & createSlot(Dataset & dataset, std::int64_t time);
+    [[nodiscard]] EntityId ensureInSlot(std::uint32_t dataset_index, TimeSlot & slot, std::int64_t time, int local_index);
+    [[nodiscard]] EntityId allocateRun(std::uint32_t dataset_index, std::int64_t time, int first_local, std::uint32_t count);
+
+    std::vector<Dataset> m_datasets;
+    std::unordered_map<DatasetKey, std::uint32_t, DatasetKeyHash> m_dataset_lookup;
+    std::uint32_t m_last_dataset{0};///< Most recently used dataset, checked before hashing
+    std::vector<Block> m_blocks;
     EntityId m_next_id {0};
 };
 
 #endif // ENTITYREGISTRY_HPP
-
-
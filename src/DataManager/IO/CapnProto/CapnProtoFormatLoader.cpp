@@ -84,23 +84,9 @@ LoadResult CapnProtoFormatLoader::loadLineDataCapnProto(std::string const& filep
             return LoadResult("Failed to load CapnProto LineData from: " + filepath);
         }
         
-        // Convert to factory-created object
-        // First extract the data map from the loaded LineData
-        std::map<TimeFrameIndex, std::vector<Line2D>> line_map;
-        for (auto const& time : loaded_line_data->getTimesWithData()) {
-            line_map[time] = loaded_line_data->getAtTime(time);
-        }
-        
-        // Create new LineData using factory
-        auto line_data_variant = factory->createLineData(line_map);
-        
-        // Apply image size from the loaded data
-        ImageSize image_size = loaded_line_data->getImageSize();
-        if (image_size.width > 0 && image_size.height > 0) {
-            factory->setLineDataImageSize(line_data_variant, 
-                                         static_cast<int>(image_size.width), 
-                                         static_cast<int>(image_size.height));
-        }
+        // The loaded LineData already carries its image size, so it is returned
+        // as is rather than copied line by line into a factory-created one
+        LoadedDataVariant line_data_variant = std::move(loaded_line_data);
         
         // Apply image size override from config if specified
         if (config.contains("image_width") && config.contains("image_height")) {
@@ -20,14 +20,14 @@ kj::Array<capnp::word> serializeLineData(LineData const* lineData) {
     auto timeLinesList = lineDataProto.initTimeLines(times.size());
  
     size_t i = 0;
-    for (auto [time, lines] : lineData->GetAllLinesAsRange()) {
+    for (auto const & [time, lines] : lineData->GetAllLineViewsAsRange()) {
         auto timeLine = timeLinesList[i];
         timeLine.setTime(time.getValue());
 
         auto linesList = timeLine.initLines(lines.size());
 
         for (size_t j = 0; j < lines.size(); j++) {
-            Line2D const& line = lines[j];
+            auto const line = lines[j];
             auto lineBuilder = linesList[j];
             auto pointsList = lineBuilder.initPoints(line.size());
 
@@ -4,10 +4,9 @@
 #include "CoreGeometry/masks.hpp"
 #include "CoreGeometry/points.hpp"
 #include "IO/interface/DataFactory.hpp"
+#include "Tracing/Tracing.hpp"
 #include "hdf5_loaders.hpp"
 
-#include <iostream>
-
 std::string HDF5Loader::getFormatId() const {
     return "hdf5";
 }
@@ -52,6 +51,8 @@ LoadResult HDF5Loader::loadMaskData(
     nlohmann::json const& config,
     DataFactory* factory
 ) const {
+    TRACE_ZONE_NAMED(zone, "load HDF5 masks", "loader", file_path);
+
     try {
         // Extract configuration with defaults
         std::string frame_key = "frames";
@@ -70,10 +71,10 @@ LoadResult HDF5Loader::loadMaskData(
         
         // Load data using HDF5 utilities
         auto frames = Loader::read_array_hdf5({file_path, frame_key});
-        auto x_coords = Loader::read_ragged_hdf5({file_path, x_key});
-        auto y_coords = Loader::read_ragged_hdf5({file_path, y_key});
+        auto x_coords = Loader::read_ragged_hdf5_flat({file_path, x_key});
+        auto y_coords = Loader::read_ragged_hdf5_flat({file_path, y_key});
         
-        if (frames.empty() && x_coords.empty() && y_coords.empty()) {
+        if (frames.empty() && x_coords.rows() == 0 && y_coords.rows() == 0) {
             return LoadResult("No data found in HDF5 file: " + file_path);
         }
         
@@ -84,11 +85,11 @@ LoadResult HDF5Loader::loadMaskData(
             int32_t frame = frames[i];
             std::vector<Mask2D> frame_masks;
             
-            if (i < x_coords.size() && i < y_coords.size()) {
+            if (i < x_coords.rows() && i < y_coords.rows()) {
                 Mask2D mask_points;
                 
-                auto const& x_vec = x_coords[i];
-                auto const& y_vec = y_coords[i];
+                auto const x_vec = x_coords.row(i);
+                auto const y_vec = y_coords.row(i);
                 
                 size_t min_size = std::min(x_vec.size(), y_vec.size());
                 for (size_t j = 0; j < min_size; j++) {
@@ -119,7 +120,7 @@ LoadResult HDF5Loader::loadMaskData(
         // Create MaskData using factory
         auto mask_data = factory->createMaskDataFromRaw(raw_data);
         
-        std::cout << "HDF5 mask loading complete: " << frames.size() << " frames loaded" << std::endl;
+        TRACE_ZONE_VALUE(zone, "frames", frames.size());
         
         return LoadResult(std::move(mask_data));
         
@@ -133,6 +134,8 @@ LoadResult HDF5Loader::loadLineData(
     nlohmann::json const& config,
     DataFactory* factory
 ) const {
+    TRACE_ZONE_NAMED(zone, "load HDF5 lines", "loader", file_path);
+
     try {
         // Extract configuration with defaults
         std::string frame_key = "frames";
@@ -151,10 +154,10 @@ LoadResult HDF5Loader::loadLineData(
         
         // Load data using HDF5 utilities
         auto frames = Loader::read_array_hdf5({file_path, frame_key});
-        auto x_coords = Loader::read_ragged_hdf5({file_path, x_key});
-        auto y_coords = Loader::read_ragged_hdf5({file_path, y_key});
+        auto x_coords = Loader::read_ragged_hdf5_flat({file_path, x_key});
+        auto y_coords = Loader::read_ragged_hdf5_flat({file_path, y_key});
         
-        if (frames.empty() && x_coords.empty() && y_coords.empty()) {
+        if (frames.empty() && x_coords.rows() == 0 && y_coords.rows() == 0) {
             return LoadResult("No data found in HDF5 file: " + file_path);
         }
         
@@ -165,11 +168,11 @@ LoadResult HDF5Loader::loadLineData(
             int32_t frame = frames[i];
             std::vector<Line2D> frame_lines;
             
-            if (i < x_coords.size() && i < y_coords.size()) {
+            if (i < x_coords.rows() && i < y_coords.rows()) {
                 Line2D line;
                 
-                auto const& x_vec = x_coords[i];
-                auto const& y_vec = y_coords[i];
+                auto const x_vec = x_coords.row(i);
+                auto const y_vec = y_coords.row(i);
                 
                 size_t min_size = std::min(x_vec.size(), y_vec.size());
                 for (size_t j = 0; j < min_size; j++) {
@@ -197,7 +200,7 @@ LoadResult HDF5Loader::loadLineData(
         // Create LineData using factory
         auto line_data = factory->createLineDataFromRaw(raw_data);
         
-        std::cout << "HDF5 line loading complete: " << frames.size() << " frames loaded" << std::endl;
+        TRACE_ZONE_VALUE(zone, "frames", frames.size());
         
         return LoadResult(std::move(line_data));
         
@@ -3,19 +3,34 @@
 #include "CoreGeometry/ImageSize.hpp"
 #include "hdf5_loaders.hpp"
 #include "Masks/Mask_Data.hpp"
+#include "Tracing/Tracing.hpp"
+#include "utils/parallel_for.hpp"
+
+#include <algorithm>
 
 std::shared_ptr<MaskData> load(HDF5MaskLoaderOptions & opts) {
+    TRACE_ZONE_NAMED(zone, "load HDF5 masks", "loader", opts.filename);
 
     auto frames = Loader::read_array_hdf5({opts.filename,  opts.frame_key});
     // auto probs = Loader::read_ragged_hdf5({filename, "probs"}); // Probs not used currently
-    auto x_coords = Loader::read_ragged_hdf5({opts.filename, opts.x_key});
-    auto y_coords = Loader::read_ragged_hdf5({opts.filename, opts.y_key});
+    auto const x_coords = Loader::read_ragged_hdf5_flat({opts.filename, opts.x_key});
+    auto const y_coords = Loader::read_ragged_hdf5_flat({opts.filename, opts.y_key});
+
+    auto const n_masks = std::min({frames.size(), x_coords.rows(), y_coords.rows()});
+    TRACE_ZONE_VALUE(zone, "masks", n_masks);
+
+    // Decoding the coordinates is independent per frame; only the insertion into the map is serial
+    std::vector<Mask2D> masks(n_masks);
+    parallel_for_chunks(n_masks, 1024, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            masks[i] = create_mask(x_coords.row(i), y_coords.row(i));
+        }
+    });
 
     auto mask_data_ptr = std::make_shared<MaskData>();
 
-    for (std::size_t i = 0; i < frames.size(); i++) {
-        auto mask = create_mask(std::move(x_coords[i]), std::move(y_coords[i]));
-        mask_data_ptr->addAtTime(TimeFrameIndex(frames[i]), std::move(mask), false);
+    for (std::size_t i = 0; i < n_masks; i++) {
+        mask_data_ptr->addAtTime(TimeFrameIndex(frames[i]), std::move(masks[i]), false);
     }
 
     return mask_data_ptr;
@@ -14,6 +14,12 @@ std::vector<std::vector<float>> read_ragged_hdf5(HDF5LoadOptions const & opts) {
     return hdf5::load_ragged_array<float>(convert_options(opts));
 }
 
+RaggedArray<float> read_ragged_hdf5_flat(HDF5LoadOptions const & opts) {
+    RaggedArray<float> ragged;
+    hdf5::load_ragged_array_flat<float>(convert_options(opts), ragged.values, ragged.offsets);
+    return ragged;
+}
+
 std::vector<int> read_array_hdf5(HDF5LoadOptions const & opts) {
     return hdf5::load_array<int>(convert_options(opts));
 }
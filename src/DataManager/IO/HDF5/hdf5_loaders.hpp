@@ -1,6 +1,8 @@
 #ifndef HDF5_LOADERS_HPP
 #define HDF5_LOADERS_HPP
 
+#include <cstddef>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -11,9 +13,35 @@ struct HDF5LoadOptions {
     std::string key;
 };
 
+/**
+ * @brief A ragged array held as one flat buffer plus row offsets
+ *
+ * Row i is values[offsets[i]] to values[offsets[i + 1]], so offsets has one
+ * more entry than there are rows.
+ */
+template<typename T>
+struct RaggedArray {
+    std::vector<T> values;
+    std::vector<std::size_t> offsets{0};
+
+    [[nodiscard]] std::size_t rows() const { return offsets.size() - 1; }
+
+    [[nodiscard]] std::span<T const> row(std::size_t i) const {
+        return std::span<T const>(values).subspan(offsets[i], offsets[i + 1] - offsets[i]);
+    }
+};
+
 // Return by value - RVO and move semantics will optimize
 std::vector<std::vector<float>> read_ragged_hdf5(HDF5LoadOptions const & opts);
 
+/**
+ * @brief Read a ragged float dataset in large chunks into a single flat buffer
+ *
+ * Preferred over read_ragged_hdf5 for large files: it makes two allocations
+ * instead of one per row.
+ */
+RaggedArray<float> read_ragged_hdf5_flat(HDF5LoadOptions const & opts);
+
 std::vector<int> read_array_hdf5(HDF5LoadOptions const & opts);
 
 } // namespace Loader
@@ -1,6 +1,7 @@
 #ifndef HDF5_UTILITIES_HPP
 #define HDF5_UTILITIES_HPP
 
+#include <cstddef>
 #include <iostream>
 #include <string>
 #include <variant>
@@ -45,6 +46,25 @@ H5::PredType get_datatype();
 template<typename T>
 std::vector<std::vector<T>> load_ragged_array(H5::DataSet & dataset);
 
+/**
+ * @brief Load a ragged array from an HDF5 dataset into one flat buffer
+ *
+ * Rows are read @p rows_per_chunk at a time through a hyperslab selection and
+ * appended to @p values, so only one chunk of variable-length buffers is held
+ * by the HDF5 library at once and no per-row vectors are allocated.
+ *
+ * @tparam T The data type (float, double, int)
+ * @param dataset HDF5 dataset
+ * @param values Receives the elements of all rows back to back
+ * @param offsets Receives n_rows + 1 offsets; row i is values[offsets[i]] to values[offsets[i + 1]]
+ * @param rows_per_chunk Number of rows to read per call into the library
+ */
+template<typename T>
+void load_ragged_array_flat(H5::DataSet & dataset,
+                            std::vector<T> & values,
+                            std::vector<std::size_t> & offsets,
+                            hsize_t rows_per_chunk = 65536);
+
 /**
  * @brief Load a regular array from an HDF5 dataset
  * @tparam T The data type (float, double, int)
@@ -77,6 +97,15 @@ std::vector<T> load_array(HDF5LoadOptions const & opts);
 template<typename T>
 std::vector<std::vector<T>> load_ragged_array(HDF5LoadOptions const & opts);
 
+/**
+ * @brief Load a ragged array from an HDF5 file into one flat buffer
+ * @see load_ragged_array_flat(H5::DataSet &, std::vector<T> &, std::vector<std::size_t> &, hsize_t)
+ */
+template<typename T>
+void load_ragged_array_flat(HDF5LoadOptions const & opts,
+                            std::vector<T> & values,
+                            std::vector<std::size_t> & offsets);
+
 } // hdf5
 
 // Include template implementations
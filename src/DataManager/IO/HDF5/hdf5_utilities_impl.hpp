@@ -3,6 +3,8 @@
 
 #include "hdf5_utilities.hpp"
 
+#include <algorithm>
+
 namespace hdf5 {
 
 template<typename T>
@@ -56,6 +58,46 @@ std::vector<std::vector<T>> load_ragged_array(H5::DataSet & dataset) {
     return data;
 }
 
+template<typename T>
+void load_ragged_array_flat(H5::DataSet & dataset,
+                            std::vector<T> & values,
+                            std::vector<std::size_t> & offsets,
+                            hsize_t rows_per_chunk) {
+    auto dims = get_ragged_dims(dataset);
+    hsize_t const n_rows = dims.empty() ? 0 : dims[0];
+    rows_per_chunk = std::max<hsize_t>(rows_per_chunk, 1);
+
+    values.clear();
+    offsets.assign(1, 0);
+    offsets.reserve(static_cast<std::size_t>(n_rows) + 1);
+
+    auto mem_type = get_varlen_type<T>();
+    H5::DataSpace file_space = dataset.getSpace();
+    std::vector<hvl_t> varlen_specs(static_cast<std::size_t>(std::min(n_rows, rows_per_chunk)));
+
+    for (hsize_t first = 0; first < n_rows; first += rows_per_chunk) {
+        hsize_t count = std::min(rows_per_chunk, n_rows - first);
+        H5::DataSpace const mem_space(1, &count);
+        file_space.selectHyperslab(H5S_SELECT_SET, &count, &first);
+
+        dataset.read(static_cast<void *>(varlen_specs.data()), mem_type, mem_space, file_space);
+
+        for (hsize_t i = 0; i < count; ++i) {
+            auto const & varlen_spec = varlen_specs[static_cast<std::size_t>(i)];
+            auto data_ptr = static_cast<T const *>(varlen_spec.p);
+            values.insert(values.end(), data_ptr, data_ptr + varlen_spec.len);
+            offsets.push_back(values.size());
+        }
+
+        H5::DataSet::vlenReclaim(static_cast<void *>(varlen_specs.data()), mem_type, mem_space);
+
+        // Size the buffer once from the first chunk rather than growing it row by row
+        if (first == 0 && count < n_rows) {
+            values.reserve(values.size() * static_cast<std::size_t>((n_rows + count - 1) / count));
+        }
+    }
+}
+
 template<typename T>
 std::vector<T> load_array(H5::DataSet & dataset) {
     auto dims = get_ragged_dims(dataset);
@@ -106,6 +148,18 @@ std::vector<std::vector<T>> load_ragged_array(HDF5LoadOptions const & opts) {
     return data;
 }
 
+template<typename T>
+void load_ragged_array_flat(HDF5LoadOptions const & opts,
+                            std::vector<T> & values,
+                            std::vector<std::size_t> & offsets) {
+    H5::H5File file(opts.filepath.c_str(), H5F_ACC_RDONLY);
+    H5::DataSet dataset{file.openDataSet(opts.key)};
+
+    load_ragged_array_flat<T>(dataset, values, offsets);
+
+    file.close();
+}
+
 } // hdf5
 
 #endif// HDF5_UTILITIES_IMPL_HPP
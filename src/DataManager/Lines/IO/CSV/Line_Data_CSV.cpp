@@ -1,9 +1,11 @@
 #include "Line_Data_CSV.hpp"
 
 #include "Lines/Line_Data.hpp"
+#include "Tracing/Tracing.hpp"
+#include "loaders/CSV_Engine.hpp"
 #include "utils/string_manip.hpp"
 
-#include <chrono>
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
@@ -46,8 +48,8 @@ void save(
     }
 
     // Write the data
-    for (auto const & frame_and_line: line_data->GetAllLinesAsRange()) {
-        for (auto const & line: frame_and_line.lines) {
+    for (auto const & frame_and_line: line_data->GetAllLineViewsAsRange()) {
+        for (auto const line: frame_and_line.lines) {
             std::ostringstream x_values;
             std::ostringstream y_values;
 
@@ -83,7 +85,7 @@ void save(
     int files_skipped = 0;
 
     // Iterate through all timestamps with data
-    for (auto const & frame_and_line: line_data->GetAllLinesAsRange()) {
+    for (auto const & frame_and_line: line_data->GetAllLineViewsAsRange()) {
         // Only save if there are lines at this timestamp
         if (frame_and_line.lines.empty()) {
             files_skipped++;
@@ -91,7 +93,7 @@ void save(
         }
 
         // Only save the first line (index 0) as documented
-        Line2D const & first_line = frame_and_line.lines[0];
+        auto const first_line = frame_and_line.lines[0];
         
         // Generate filename with zero-padded frame number
         std::string const padded_frame = pad_frame_id(static_cast<int>(frame_and_line.time.getValue()), opts.frame_id_padding);
@@ -152,60 +154,115 @@ std::vector<float> parse_string_to_float_vector(std::string const & str, std::st
     return result;
 }
 
+namespace {
+
+/**
+ * @brief Parse a delimited list of floats directly into one coordinate of a line
+ */
+template<typename Setter>
+size_t parse_coordinates(std::string_view str, char delimiter, Setter && set) {
+    size_t count = 0;
+    bool ok = true;
+    if (Loader::trimField(str).empty()) {
+        return count;
+    }
+    Loader::forEachField(str, delimiter, [&](size_t index, std::string_view item) {
+        float value = 0.0f;
+        if (!Loader::parseFloat(item, value)) {
+            ok = false;
+            return false;
+        }
+        set(index, value);
+        count = index + 1;
+        return true;
+    });
+    if (!ok) {
+        throw std::invalid_argument("Could not parse coordinate list: " + std::string(str));
+    }
+    return count;
+}
+
+/**
+ * @brief Extract the next double-quoted field after @p pos
+ */
+std::string_view next_quoted(std::string_view line, size_t & pos) {
+    size_t const open = line.find('"', pos);
+    if (open == std::string_view::npos) {
+        pos = line.size();
+        return {};
+    }
+    size_t const close = line.find('"', open + 1);
+    size_t const end = close == std::string_view::npos ? line.size() : close;
+    pos = close == std::string_view::npos ? line.size() : close + 1;
+    return line.substr(open + 1, end - open - 1);
+}
+
+}// namespace
+
 std::map<TimeFrameIndex, std::vector<Line2D>> load(CSVSingleFileLineLoaderOptions const & opts) {
-    auto t1 = std::chrono::high_resolution_clock::now();
+    TRACE_ZONE_NAMED(zone, "load single-file line CSV", "loader", opts.filepath);
     std::map<TimeFrameIndex, std::vector<Line2D>> data_map;
-    std::ifstream file(opts.filepath);
-    if (!file.is_open()) {
+
+    Loader::MappedFile const file(opts.filepath);
+    if (!file.isOpen()) {
         throw std::runtime_error("Could not open file: " + opts.filepath);
     }
 
-    std::string line;
-    int loaded_lines = 0;
-    
-    while (std::getline(file, line)) {
-        std::istringstream ss(line);
-        std::string frame_num_str, x_str, y_str;
+    char const delimiter = opts.delimiter.empty() ? ',' : opts.delimiter[0];
+    char const coordinate_delimiter = opts.coordinate_delimiter.empty() ? ',' : opts.coordinate_delimiter[0];
+
+    using FrameLine = std::pair<TimeFrameIndex, Line2D>;
+    auto rows = Loader::parseLines<FrameLine>(file.view(), '\n', [&](std::string_view line, std::vector<FrameLine> & out) {
+        if (line.empty()) {
+            return;
+        }
 
         // Get frame number (first column)
-        std::getline(ss, frame_num_str, opts.delimiter[0]);
+        size_t const first_delim = line.find(delimiter);
+        auto const frame_num_str = line.substr(0, first_delim);
 
         // Skip header if present
         if (opts.has_header && frame_num_str == opts.header_identifier) {
-            continue;
+            return;
         }
 
-        // Get X coordinates (second column, enclosed in quotes)
-        std::getline(ss, x_str, '"');
-        std::getline(ss, x_str, '"');
+        int frame_num = 0;
+        if (!Loader::parseInteger(frame_num_str, frame_num)) {
+            throw std::invalid_argument("Could not parse frame number: " + std::string(frame_num_str));
+        }
 
-        // Get Y coordinates (third column, enclosed in quotes)
-        std::getline(ss, y_str, '"');
-        std::getline(ss, y_str, '"');
+        // X and Y coordinates are the next two quoted columns
+        size_t pos = first_delim == std::string_view::npos ? line.size() : first_delim;
+        auto const x_str = next_quoted(line, pos);
+        auto const y_str = next_quoted(line, pos);
 
-        int const frame_num = std::stoi(frame_num_str);
+        std::vector<Point2D<float>> points;
+        points.reserve(static_cast<size_t>(std::count(x_str.begin(), x_str.end(), coordinate_delimiter)) + 1);
 
-        std::vector<float> const x_values = parse_string_to_float_vector(x_str, opts.coordinate_delimiter);
-        std::vector<float> const y_values = parse_string_to_float_vector(y_str, opts.coordinate_delimiter);
+        size_t const num_x = parse_coordinates(x_str, coordinate_delimiter, [&points](size_t, float x) {
+            points.push_back(Point2D<float>{x, 0.0f});
+        });
+        size_t const num_y = parse_coordinates(y_str, coordinate_delimiter, [&points](size_t i, float y) {
+            if (i < points.size()) {
+                points[i].y = y;
+            }
+        });
 
-        if (x_values.size() != y_values.size()) {
+        if (num_x != num_y) {
             std::cerr << "Mismatched x and y values at frame: " << frame_num << std::endl;
-            continue;
+            return;
         }
 
-        if (data_map.find(TimeFrameIndex(frame_num)) == data_map.end()) {
-            data_map[TimeFrameIndex(frame_num)] = std::vector<Line2D>();
-        }
+        out.emplace_back(TimeFrameIndex(frame_num), Line2D(std::move(points)));
+    });
 
-        data_map[TimeFrameIndex(frame_num)].emplace_back(create_line(x_values, y_values));
-        loaded_lines += 1;
+    // Lines at the same frame keep their file order
+    for (auto & [frame, line]: rows) {
+        data_map[frame].push_back(std::move(line));
     }
+    TRACE_ZONE_VALUE(zone, "lines", rows.size());
+    TRACE_ZONE_VALUE(zone, "bytes", file.view().size());
 
-    file.close();
-    auto t2 = std::chrono::high_resolution_clock::now();
-
-    auto duration = std::chrono::duration<double>(t2 - t1).count();
-    std::cout << "Loaded " << loaded_lines << " lines from " << opts.filepath << " in " << duration << "s" << std::endl;
     return data_map;
 }
 
@@ -183,9 +183,8 @@ std::map<int, std::vector<Line2D>> getLineDataTimeFrames(std::string const & dbP
 
     // Extract only the requested time frames
     for (int const time: times) {
-        if (std::find(lineData->getTimesWithLines().begin(),
-                      lineData->getTimesWithLines().end(), time) != lineData->getTimesWithLines().end()) {
-            result[time] = lineData->getAtTime(time);
+        if (lineData->getLineCountAtTime(TimeFrameIndex(time)) > 0) {
+            result[time] = lineData->getAtTime(TimeFrameIndex(time));
         }
     }
 
@@ -1,7 +1,6 @@
 #include "Line_Data.hpp"
 
 #include "CoreGeometry/points.hpp"
-#include "utils/map_timeseries.hpp"
 #include "Entity/EntityRegistry.hpp"
 
 #include <cmath>
@@ -10,80 +9,76 @@
 
 // ========== Constructors ==========
 
-LineData::LineData(std::map<TimeFrameIndex, std::vector<Line2D>> const & data)
-    : _data(data)
-{
+LineData::LineData(std::map<TimeFrameIndex, std::vector<Line2D>> const & data) {
+    std::size_t total_lines = 0;
+    std::size_t total_vertices = 0;
+    for (auto const & [time, lines] : data) {
+        total_lines += lines.size();
+        for (auto const & line : lines) {
+            total_vertices += line.size();
+        }
+    }
+
+    _times.reserve(data.size());
+    _frame_offsets.reserve(data.size() + 1);
+    _line_offsets.reserve(total_lines + 1);
+    _entity_ids.reserve(total_lines);
+    _vertices.reserve(total_vertices);
 
+    for (auto const & [time, lines] : data) {
+        _ensureFrame(time);
+        for (auto const & line : lines) {
+            _appendLine(time, std::span<Point2D<float> const>(line.begin(), line.end()));
+        }
+    }
 }
 
 // ========== Setters ==========
 
 bool LineData::clearAtTime(TimeFrameIndex const time, bool notify) {
+    auto const frame = _findFrame(time);
+    if (frame == _times.size()) {
+        return false;
+    }
 
-    if (clear_at_time(time, _data)) {
-        _entity_ids_by_time.erase(time);
-        if (notify) {
-            notifyObservers();
-        }
-        return true;
+    _eraseFrames({frame});
+    if (notify) {
+        notifyObservers();
     }
-    return false;   
+    return true;
 }
 
 bool LineData::clearAtTime(TimeFrameIndex const time, int const line_id, bool notify) {
+    auto const frame = _findFrame(time);
+    if (frame == _times.size() || line_id < 0) {
+        return false;
+    }
+    auto const line = _frame_offsets[frame] + static_cast<std::size_t>(line_id);
+    if (line >= _frame_offsets[frame + 1]) {
+        return false;
+    }
 
-    if (clear_at_time(time, line_id, _data)) {
-        auto it = _entity_ids_by_time.find(time);
-        if (it != _entity_ids_by_time.end()) {
-            if (static_cast<size_t>(line_id) < it->second.size()) {
-                it->second.erase(it->second.begin() + static_cast<long int>(line_id));
-            }
-            if (it->second.empty()) {
-                _entity_ids_by_time.erase(it);
-            }
-        }
-        if (notify) {
-            notifyObservers();
-        }
-        return true;
+    _eraseLine(frame, line);
+    if (notify) {
+        notifyObservers();
     }
-    return false;
+    return true;
 }
 
 void LineData::addAtTime(TimeFrameIndex const time, std::vector<float> const & x, std::vector<float> const & y, bool notify) {
+    addAtTime(time, create_line(x, y), notify);
+}
 
-    auto new_line = create_line(x, y);
-    add_at_time(time, new_line, _data);
-
-    int const local_index = static_cast<int>(_data[time].size()) - 1;
-    if (_identity_registry) {
-        _entity_ids_by_time[time].push_back(
-            _identity_registry->ensureId(_identity_data_key, EntityKind::LineEntity, time, local_index)
-        );
-    } else {
-        _entity_ids_by_time[time].push_back(0);
-    }
+void LineData::addAtTime(TimeFrameIndex const time, std::vector<Point2D<float>> const & line, bool notify) {
+    _appendLine(time, line);
 
     if (notify) {
         notifyObservers();
     }
 }
 
-void LineData::addAtTime(TimeFrameIndex const time, std::vector<Point2D<float>> const & line, bool notify) {
-    addAtTime(time, std::move(Line2D(line)), notify);
-}
-
 void LineData::addAtTime(TimeFrameIndex const time, Line2D const & line, bool notify) {
-    add_at_time(time, line, _data);
-
-    int const local_index = static_cast<int>(_data[time].size()) - 1;
-    if (_identity_registry) {
-        _entity_ids_by_time[time].push_back(
-            _identity_registry->ensureId(_identity_data_key, EntityKind::LineEntity, time, local_index)
-        );
-    } else {
-        _entity_ids_by_time[time].push_back(0);
-    }
+    _appendLine(time, std::span<Point2D<float> const>(line.begin(), line.end()));
 
     if (notify) {
         notifyObservers();
@@ -91,13 +86,25 @@ void LineData::addAtTime(TimeFrameIndex const time, Line2D const & line, bool no
 }
 
 void LineData::addPointToLine(TimeFrameIndex const time, int const line_id, Point2D<float> point, bool notify) {
-
-    if (static_cast<size_t>(line_id) < _data[time].size()) {
-        _data[time][static_cast<size_t>(line_id)].push_back(point);
+    auto const frame = _ensureFrame(time);
+    auto const line = _frame_offsets[frame] + static_cast<std::size_t>(line_id);
+
+    if (line_id >= 0 && line < _frame_offsets[frame + 1]) {
+        if (line + 2 == _line_offsets.size()) {
+            // The last line in the pool grows in place
+            _vertices.push_back(point);
+            ++_line_offsets.back();
+        } else {
+            // Append after the last vertex of the line; later lines shift by one vertex
+            auto const end = _line_offsets[line + 1];
+            _vertices.insert(_vertices.begin() + static_cast<std::ptrdiff_t>(end), point);
+            for (std::size_t i = line + 1; i < _line_offsets.size(); ++i) {
+                ++_line_offsets[i];
+            }
+        }
     } else {
         std::cerr << "LineData::addPointToLine: line_id out of range" << std::endl;
-        _data[time].emplace_back();
-        _data[time].back().push_back(point);
+        _appendLine(time, std::span<Point2D<float> const>(&point, 1));
     }
 
     if (notify) {
@@ -106,13 +113,16 @@ void LineData::addPointToLine(TimeFrameIndex const time, int const line_id, Poin
 }
 
 void LineData::addPointToLineInterpolate(TimeFrameIndex const time, int const line_id, Point2D<float> point, bool notify) {
+    auto const frame = _ensureFrame(time);
+    auto line_index = _frame_offsets[frame] + static_cast<std::size_t>(line_id);
 
-    if (static_cast<size_t>(line_id) >= _data[time].size()) {
+    if (line_id < 0 || line_index >= _frame_offsets[frame + 1]) {
         std::cerr << "LineData::addPointToLineInterpolate: line_id out of range" << std::endl;
-        _data[time].emplace_back();
+        line_index = _appendLine(time, {});
     }
 
-    Line2D & line = _data[time][static_cast<size_t>(line_id)];
+    auto const current = _frameViews(frame)[line_index - _frame_offsets[frame]];
+    Line2D line(std::vector<Point2D<float>>(current.begin(), current.end()));
     if (!line.empty()) {
         Point2D<float> const last_point = line.back();
         float const distance = std::sqrt(std::pow(point.x - last_point.x, 2.0f) + std::pow(point.y - last_point.y, 2.0f));
@@ -126,6 +136,7 @@ void LineData::addPointToLineInterpolate(TimeFrameIndex const time, int const li
     }
     line.push_back(point);
     smooth_line(line);
+    _replaceLineVertices(line_index, std::span<Point2D<float> const>(line.begin(), line.end()));
 
     if (notify) {
         notifyObservers();
@@ -134,33 +145,53 @@ void LineData::addPointToLineInterpolate(TimeFrameIndex const time, int const li
 
 // ========== Getters ==========
 
-std::vector<Line2D> const & LineData::getAtTime(TimeFrameIndex const time) const {
-    return get_at_time(time, _data, _empty);
+std::vector<Line2D> LineData::getAtTime(TimeFrameIndex const time) const {
+    auto const frame = _findFrame(time);
+    if (frame == _times.size()) {
+        return {};
+    }
+    return _copyLines(frame);
+}
+
+std::vector<Line2D> LineData::getAtTime(TimeFrameIndex const time, 
+                                        TimeFrame const * source_timeframe,
+                                        TimeFrame const * line_timeframe) const {
+    return getAtTime(convertTimeFrameIndex(time, source_timeframe, line_timeframe));
 }
 
-std::vector<Line2D> const & LineData::getAtTime(TimeFrameIndex const time, 
-                                                TimeFrame const * source_timeframe,
-                                                TimeFrame const * line_timeframe) const {
+LineData::LineViews LineData::getLineViewsAtTime(TimeFrameIndex const time) const {
+    auto const frame = _findFrame(time);
+    if (frame == _times.size()) {
+        return {};
+    }
+    return _frameViews(frame);
+}
 
-    return get_at_time(time, _data, _empty, source_timeframe, line_timeframe);
+LineData::LineViews LineData::getLineViewsAtTime(TimeFrameIndex const time,
+                                                 TimeFrame const * source_timeframe,
+                                                 TimeFrame const * line_timeframe) const {
+    return getLineViewsAtTime(convertTimeFrameIndex(time, source_timeframe, line_timeframe));
 }
 
-std::vector<EntityId> const & LineData::getEntityIdsAtTime(TimeFrameIndex const time) const {
-    auto it = _entity_ids_by_time.find(time);
-    if (it == _entity_ids_by_time.end()) {
-        static const std::vector<EntityId> kEmpty;
-        return kEmpty;
+std::size_t LineData::getLineCountAtTime(TimeFrameIndex const time) const {
+    auto const frame = _findFrame(time);
+    if (frame == _times.size()) {
+        return 0;
     }
-    return it->second;
+    return _frame_offsets[frame + 1] - _frame_offsets[frame];
 }
 
-std::vector<EntityId> LineData::getAllEntityIds() const {
-    std::vector<EntityId> out;
-    for (auto const & [t, ids] : _entity_ids_by_time) {
-        (void)t;
-        out.insert(out.end(), ids.begin(), ids.end());
+std::span<EntityId const> LineData::getEntityIdsAtTime(TimeFrameIndex const time) const {
+    auto const frame = _findFrame(time);
+    if (frame == _times.size()) {
+        return {};
     }
-    return out;
+    auto const first = _frame_offsets[frame];
+    return std::span<EntityId const>(_entity_ids).subspan(first, _frame_offsets[frame + 1] - first);
+}
+
+std::vector<EntityId> LineData::getAllEntityIds() const {
+    return _entity_ids;
 }
 
 // ========== Image Size ==========
@@ -180,13 +211,9 @@ void LineData::changeImageSize(ImageSize const & image_size)
     float const scale_x = static_cast<float>(image_size.width) / static_cast<float>(_image_size.width);
     float const scale_y = static_cast<float>(image_size.height) / static_cast<float>(_image_size.height);
 
-    for (auto & [time, lines] : _data) {
-        for (auto & line : lines) {
-            for (auto & point : line) {
-                point.x *= scale_x;
-                point.y *= scale_y;
-            }
-        }
+    for (auto & point : _vertices) {
+        point.x *= scale_x;
+        point.y *= scale_y;
     }
     _image_size = image_size;
 
@@ -199,18 +226,14 @@ void LineData::setIdentityContext(std::string const & data_key, EntityRegistry *
 
 void LineData::rebuildAllEntityIds() {
     if (!_identity_registry) {
-        for (auto & [t, lines] : _data) {
-            _entity_ids_by_time[t].assign(lines.size(), 0);
-        }
+        std::fill(_entity_ids.begin(), _entity_ids.end(), EntityId{0});
         return;
     }
-    for (auto & [t, lines] : _data) {
-        auto & ids = _entity_ids_by_time[t];
-        ids.clear();
-        ids.reserve(lines.size());
-        for (int i = 0; i < static_cast<int>(lines.size()); ++i) {
-            ids.push_back(_identity_registry->ensureId(_identity_data_key, EntityKind::LineEntity, t, i));
-        }
+    for (std::size_t frame = 0; frame < _times.size(); ++frame) {
+        auto const first = _frame_offsets[frame];
+        auto const count = _frame_offsets[frame + 1] - first;
+        auto const ids = _identity_registry->ensureIds(_identity_data_key, EntityKind::LineEntity, _times[frame], static_cast<int>(count));
+        std::copy(ids.begin(), ids.end(), _entity_ids.begin() + static_cast<std::ptrdiff_t>(first));
     }
 }
 
@@ -226,12 +249,10 @@ std::size_t LineData::copyTo(LineData& target, TimeFrameInterval const & interva
     std::size_t total_lines_copied = 0;
 
     // Iterate through all times in the source data within the interval
-    for (auto const & [time, lines] : _data) {
-        if (time >= interval.start && time <= interval.end && !lines.empty()) {
-            for (auto const& line : lines) {
-                target.addAtTime(time, line, false); // Don't notify for each operation
-                total_lines_copied++;
-            }
+    for (auto const & [time, lines] : GetLineViewsInRange(interval)) {
+        for (auto const line : lines) {
+            target._appendLine(time, line); // Don't notify for each operation
+            total_lines_copied++;
         }
     }
 
@@ -248,12 +269,9 @@ std::size_t LineData::copyTo(LineData& target, std::vector<TimeFrameIndex> const
 
     // Copy lines for each specified time
     for (TimeFrameIndex time : times) {
-        auto it = _data.find(time);
-        if (it != _data.end() && !it->second.empty()) {
-            for (auto const& line : it->second) {
-                target.addAtTime(time, line, false); // Don't notify for each operation
-                total_lines_copied++;
-            }
+        for (auto const line : getLineViewsAtTime(time)) {
+            target._appendLine(time, line); // Don't notify for each operation
+            total_lines_copied++;
         }
     }
 
@@ -273,23 +291,24 @@ std::size_t LineData::moveTo(LineData& target, TimeFrameInterval const & interva
     }
 
     std::size_t total_lines_moved = 0;
-    std::vector<TimeFrameIndex> times_to_clear;
+    std::vector<std::size_t> frames_to_clear;
 
     // First, copy all lines in the interval to target
-    for (auto const & [time, lines] : _data) {
-        if (time >= interval.start && time <= interval.end && !lines.empty()) {
-            for (auto const& line : lines) {
-                target.addAtTime(time, line, false); // Don't notify for each operation
-                total_lines_moved++;
-            }
-            times_to_clear.push_back(time);
+    auto const [first, last] = _framesInInterval(interval);
+    for (std::size_t frame = first; frame < last; ++frame) {
+        auto const lines = _frameViews(frame);
+        if (lines.empty()) {
+            continue;
+        }
+        for (auto const line : lines) {
+            target._appendLine(_times[frame], line); // Don't notify for each operation
+            total_lines_moved++;
         }
+        frames_to_clear.push_back(frame);
     }
 
-    // Then, clear all the times from source
-    for (TimeFrameIndex time : times_to_clear) {
-        (void)clearAtTime(time, false); // Don't notify for each operation
-    }
+    // Then, clear all the frames from source in a single pass
+    _eraseFrames(frames_to_clear);
 
     // Notify observers only once at the end if requested
     if (notify && total_lines_moved > 0) {
@@ -302,24 +321,29 @@ std::size_t LineData::moveTo(LineData& target, TimeFrameInterval const & interva
 
 std::size_t LineData::moveTo(LineData& target, std::vector<TimeFrameIndex> const & times, bool notify) {
     std::size_t total_lines_moved = 0;
-    std::vector<TimeFrameIndex> times_to_clear;
+    std::vector<std::size_t> frames_to_clear;
 
     // First, copy lines for each specified time to target
     for (TimeFrameIndex time : times) {
-        auto it = _data.find(time);
-        if (it != _data.end() && !it->second.empty()) {
-            for (auto const& line : it->second) {
-                target.addAtTime(time, line, false); // Don't notify for each operation
-                total_lines_moved++;
-            }
-            times_to_clear.push_back(time);
+        auto const frame = _findFrame(time);
+        if (frame == _times.size()) {
+            continue;
+        }
+        auto const lines = _frameViews(frame);
+        if (lines.empty()) {
+            continue;
+        }
+        for (auto const line : lines) {
+            target._appendLine(time, line); // Don't notify for each operation
+            total_lines_moved++;
         }
+        frames_to_clear.push_back(frame);
     }
 
-    // Then, clear all the times from source
-    for (TimeFrameIndex time : times_to_clear) {
-        (void)clearAtTime(time, false); // Don't notify for each operation
-    }
+    // Then, clear all the frames from source in a single pass
+    std::sort(frames_to_clear.begin(), frames_to_clear.end());
+    frames_to_clear.erase(std::unique(frames_to_clear.begin(), frames_to_clear.end()), frames_to_clear.end());
+    _eraseFrames(frames_to_clear);
 
     // Notify observers only once at the end if requested
     if (notify && total_lines_moved > 0) {
@@ -328,4 +352,150 @@ std::size_t LineData::moveTo(LineData& target, std::vector<TimeFrameIndex> const
     }
 
     return total_lines_moved;
-}
\ No newline at end of file
+}
+
+// ========== Vertex pool ==========
+
+std::vector<Line2D> LineData::_copyLines(std::size_t const frame) const {
+    std::vector<Line2D> lines;
+    auto const views = _frameViews(frame);
+    lines.reserve(views.size());
+    for (auto const line : views) {
+        lines.emplace_back(std::vector<Point2D<float>>(line.begin(), line.end()));
+    }
+    return lines;
+}
+
+std::pair<std::size_t, std::size_t> LineData::_framesInInterval(TimeFrameInterval const & interval) const {
+    auto const first = std::lower_bound(_times.begin(), _times.end(), interval.start);
+    auto const last = std::upper_bound(first, _times.end(), interval.end);
+    return {static_cast<std::size_t>(first - _times.begin()), static_cast<std::size_t>(last - _times.begin())};
+}
+
+TimeFrameInterval LineData::_convertInterval(TimeFrameInterval const & interval,
+                                             TimeFrame const * source_timeframe,
+                                             TimeFrame const * target_timeframe) {
+    // If the timeframes are the same object or either is missing, no conversion is needed
+    if (source_timeframe == target_timeframe || !source_timeframe || !target_timeframe) {
+        return interval;
+    }
+
+    // Convert the time range from source timeframe to target timeframe
+    auto start_time_value = source_timeframe->getTimeAtIndex(interval.start);
+    auto end_time_value = source_timeframe->getTimeAtIndex(interval.end);
+
+    auto target_start_index = target_timeframe->getIndexAtTime(static_cast<double>(start_time_value));
+    auto target_end_index = target_timeframe->getIndexAtTime(static_cast<double>(end_time_value));
+
+    return TimeFrameInterval{target_start_index, target_end_index};
+}
+
+std::size_t LineData::_findFrame(TimeFrameIndex const time) const {
+    auto const it = std::lower_bound(_times.begin(), _times.end(), time);
+    if (it != _times.end() && *it == time) {
+        return static_cast<std::size_t>(it - _times.begin());
+    }
+    return _times.size();
+}
+
+std::size_t LineData::_ensureFrame(TimeFrameIndex const time) {
+    auto const it = std::lower_bound(_times.begin(), _times.end(), time);
+    auto const frame = static_cast<std::size_t>(it - _times.begin());
+    if (it != _times.end() && *it == time) {
+        return frame;
+    }
+
+    _times.insert(it, time);
+    // The new frame starts empty where the following frame begins
+    auto const first_line = _frame_offsets[frame];
+    _frame_offsets.insert(_frame_offsets.begin() + static_cast<std::ptrdiff_t>(frame), first_line);
+    return frame;
+}
+
+std::size_t LineData::_appendLine(TimeFrameIndex const time, std::span<Point2D<float> const> vertices) {
+    auto const frame = _ensureFrame(time);
+    auto const line = _frame_offsets[frame + 1];
+    auto const local_index = static_cast<int>(line - _frame_offsets[frame]);
+
+    EntityId const id = _identity_registry
+                                ? _identity_registry->ensureId(_identity_data_key, EntityKind::LineEntity, time, local_index)
+                                : EntityId{0};
+
+    auto const vertex = _line_offsets[line];
+    _vertices.insert(_vertices.begin() + static_cast<std::ptrdiff_t>(vertex), vertices.begin(), vertices.end());
+    _line_offsets.insert(_line_offsets.begin() + static_cast<std::ptrdiff_t>(line), vertex);
+    for (std::size_t i = line + 1; i < _line_offsets.size(); ++i) {
+        _line_offsets[i] += vertices.size();
+    }
+    _entity_ids.insert(_entity_ids.begin() + static_cast<std::ptrdiff_t>(line), id);
+
+    for (std::size_t i = frame + 1; i < _frame_offsets.size(); ++i) {
+        ++_frame_offsets[i];
+    }
+    return line;
+}
+
+void LineData::_replaceLineVertices(std::size_t const line, std::span<Point2D<float> const> vertices) {
+    auto const begin = _line_offsets[line];
+    auto const end = _line_offsets[line + 1];
+
+    _vertices.erase(_vertices.begin() + static_cast<std::ptrdiff_t>(begin), _vertices.begin() + static_cast<std::ptrdiff_t>(end));
+    _vertices.insert(_vertices.begin() + static_cast<std::ptrdiff_t>(begin), vertices.begin(), vertices.end());
+    for (std::size_t i = line + 1; i < _line_offsets.size(); ++i) {
+        _line_offsets[i] = _line_offsets[i] + vertices.size() - (end - begin);
+    }
+}
+
+void LineData::_eraseLine(std::size_t const frame, std::size_t const line) {
+    _replaceLineVertices(line, {});
+    _line_offsets.erase(_line_offsets.begin() + static_cast<std::ptrdiff_t>(line));
+    _entity_ids.erase(_entity_ids.begin() + static_cast<std::ptrdiff_t>(line));
+    for (std::size_t i = frame + 1; i < _frame_offsets.size(); ++i) {
+        --_frame_offsets[i];
+    }
+}
+
+void LineData::_eraseFrames(std::vector<std::size_t> const & frames) {
+    if (frames.empty()) {
+        return;
+    }
+
+    // Compact the surviving frames towards the front; writes never overtake reads
+    auto next_erased = frames.begin();
+    std::size_t write_frame = 0;
+    std::size_t write_line = 0;
+    std::size_t write_vertex = 0;
+    for (std::size_t frame = 0; frame < _times.size(); ++frame) {
+        auto const first_line = _frame_offsets[frame];
+        auto const last_line = _frame_offsets[frame + 1];
+        if (next_erased != frames.end() && *next_erased == frame) {
+            ++next_erased;
+            continue;
+        }
+
+        _times[write_frame] = _times[frame];
+        _frame_offsets[write_frame] = write_line;
+        for (std::size_t line = first_line; line < last_line; ++line) {
+            auto const begin = _line_offsets[line];
+            auto const end = _line_offsets[line + 1];
+            if (write_vertex != begin) {
+                std::copy(_vertices.begin() + static_cast<std::ptrdiff_t>(begin),
+                          _vertices.begin() + static_cast<std::ptrdiff_t>(end),
+                          _vertices.begin() + static_cast<std::ptrdiff_t>(write_vertex));
+            }
+            _entity_ids[write_line] = _entity_ids[line];
+            _line_offsets[write_line] = write_vertex;
+            write_vertex += end - begin;
+            ++write_line;
+        }
+        ++write_frame;
+    }
+    _frame_offsets[write_frame] = write_line;
+    _line_offsets[write_line] = write_vertex;
+
+    _times.resize(write_frame, TimeFrameIndex(0));
+    _frame_offsets.resize(write_frame + 1);
+    _line_offsets.resize(write_line + 1);
+    _entity_ids.resize(write_line);
+    _vertices.resize(write_vertex);
+}
@@ -9,9 +9,13 @@
 #include "CoreGeometry/lines.hpp"
 #include "Entity/EntityTypes.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <map>
 #include <ranges>
+#include <span>
+#include <utility>
 #include <vector>
 
 class EntityRegistry;
@@ -22,10 +26,102 @@ class EntityRegistry;
  * LineData is used for storing 2D lines
  * Line data implies that the elements in the line have an order
  * Compare to MaskData where the elements in the mask have no order
+ *
+ * The vertices of every line are stored in a single pool, ordered by time and
+ * then by line. Per-line offsets mark where each line starts in the pool, and
+ * per-frame offsets mark which lines belong to each time. Lines can be read
+ * without copying as spans into the pool (getLineViewsAtTime,
+ * GetAllLineViewsAsRange); the Line2D accessors copy the lines out.
  */
 class LineData : public ObserverData {
 public:
 
+    /// Vertices of one line, viewed in the shared vertex pool
+    using LineView = std::span<Point2D<float> const>;
+
+    /**
+     * @brief The lines stored at one time, viewed in the shared vertex pool
+     *
+     * Views are invalidated by any modification of the LineData.
+     */
+    class LineViews {
+    public:
+        class Iterator {
+        public:
+            using value_type = LineView;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator() = default;
+            Iterator(std::size_t const * offset, std::span<Point2D<float> const> vertices)
+                : _offset(offset),
+                  _vertices(vertices) {}
+
+            LineView operator*() const { return _vertices.subspan(_offset[0], _offset[1] - _offset[0]); }
+
+            Iterator & operator++() {
+                ++_offset;
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator previous = *this;
+                ++_offset;
+                return previous;
+            }
+
+            bool operator==(Iterator const & other) const { return _offset == other._offset; }
+
+        private:
+            std::size_t const * _offset{nullptr};
+            std::span<Point2D<float> const> _vertices;
+        };
+
+        LineViews() = default;
+
+        /**
+         * @param offsets Start of each line in @p vertices, followed by the end of the last line
+         * @param vertices The vertex pool the offsets refer to
+         */
+        LineViews(std::span<std::size_t const> offsets, std::span<Point2D<float> const> vertices)
+            : _offsets(offsets),
+              _vertices(vertices) {}
+
+        [[nodiscard]] std::size_t size() const { return _offsets.empty() ? 0 : _offsets.size() - 1; }
+        [[nodiscard]] bool empty() const { return size() == 0; }
+
+        [[nodiscard]] LineView operator[](std::size_t line) const {
+            return _vertices.subspan(_offsets[line], _offsets[line + 1] - _offsets[line]);
+        }
+
+        /// All vertices of these lines, back to back
+        [[nodiscard]] std::span<Point2D<float> const> vertices() const {
+            return empty() ? std::span<Point2D<float> const>{} : _vertices.subspan(_offsets.front(), _offsets.back() - _offsets.front());
+        }
+
+        [[nodiscard]] Iterator begin() const { return Iterator(_offsets.data(), _vertices); }
+        [[nodiscard]] Iterator end() const { return Iterator(_offsets.data() + size(), _vertices); }
+
+    private:
+        std::span<std::size_t const> _offsets;
+        std::span<Point2D<float> const> _vertices;
+    };
+
+    /**
+     * @brief Lines at one time, as returned by the copying range accessors
+     */
+    struct TimeLinesPair {
+        TimeFrameIndex time;
+        std::vector<Line2D> lines;
+    };
+
+    /**
+     * @brief Lines at one time, as returned by the view range accessors
+     */
+    struct TimeLineViewsPair {
+        TimeFrameIndex time;
+        LineViews lines;
+    };
+
     // ========== Constructors ==========
     /**
      * @brief Default constructor
@@ -138,23 +234,25 @@ public:
     /**
      * @brief Get all times with data
      * 
-     * Returns a view over the keys of the data map for zero-copy iteration.
+     * Returns a view over the sorted frame times for zero-copy iteration.
      * 
      * @return A view of TimeFrameIndex keys
      */
-    [[nodiscard]] auto getTimesWithData() const {
-        return _data | std::views::keys;
+    [[nodiscard]] std::span<TimeFrameIndex const> getTimesWithData() const {
+        return _times;
     }
 
     /**
      * @brief Get the lines at a specific time
      * 
-     * If the time does not exist, an empty vector will be returned.
+     * The lines are copied out of the vertex pool. If the time does not exist,
+     * an empty vector will be returned. Use getLineViewsAtTime to read the
+     * lines without copying.
      * 
      * @param time The time to get the lines at
      * @return A vector of lines
      */
-    [[nodiscard]] std::vector<Line2D> const & getAtTime(TimeFrameIndex time) const;
+    [[nodiscard]] std::vector<Line2D> getAtTime(TimeFrameIndex time) const;
 
     /**
      * @brief Get the lines at a specific time with timeframe conversion
@@ -168,14 +266,54 @@ public:
      * @param line_timeframe The timeframe that this line data uses
      * @return A vector of lines at the converted time
      */
-    [[nodiscard]] std::vector<Line2D> const & getAtTime(TimeFrameIndex time, 
-                                                        TimeFrame const * source_timeframe,
-                                                        TimeFrame const * line_timeframe) const;
+    [[nodiscard]] std::vector<Line2D> getAtTime(TimeFrameIndex time, 
+                                                TimeFrame const * source_timeframe,
+                                                TimeFrame const * line_timeframe) const;
+
+    /**
+     * @brief Get views of the lines at a specific time without copying
+     *
+     * If the time does not exist, an empty LineViews will be returned.
+     *
+     * @param time The time to get the lines at
+     * @return Spans into the vertex pool, one per line
+     */
+    [[nodiscard]] LineViews getLineViewsAtTime(TimeFrameIndex time) const;
+
+    /**
+     * @brief Get views of the lines at a specific time with timeframe conversion
+     *
+     * @param time The time index in the source timeframe
+     * @param source_timeframe The timeframe that the time index is expressed in
+     * @param line_timeframe The timeframe that this line data uses
+     * @return Spans into the vertex pool, one per line
+     */
+    [[nodiscard]] LineViews getLineViewsAtTime(TimeFrameIndex time,
+                                               TimeFrame const * source_timeframe,
+                                               TimeFrame const * line_timeframe) const;
+
+    /**
+     * @brief Get the number of lines at a specific time without copying them
+     *
+     * @param time The time to count the lines at
+     * @return The number of lines, or 0 if the time does not exist
+     */
+    [[nodiscard]] std::size_t getLineCountAtTime(TimeFrameIndex time) const;
+
+    /**
+     * @brief Get the vertices of all lines, ordered by time and then by line
+     */
+    [[nodiscard]] std::span<Point2D<float> const> getAllVertices() const { return _vertices; }
+
+    /**
+     * @brief Get the total number of lines across all times
+     */
+    [[nodiscard]] std::size_t getTotalLineCount() const { return _entity_ids.size(); }
 
     /**
      * @brief Get EntityIds aligned with lines at a specific time.
      */
-    [[nodiscard]] std::vector<EntityId> const & getEntityIdsAtTime(TimeFrameIndex time) const;
+    [[nodiscard]] std::span<EntityId const> getEntityIdsAtTime(TimeFrameIndex time) const;
 
     /**
      * @brief Get flattened EntityIds for all lines across all times.
@@ -185,40 +323,45 @@ public:
      /**
     * @brief Get all lines with their associated times as a range
     *
+    * Each element copies its lines out of the vertex pool; prefer
+    * GetAllLineViewsAsRange when the lines are only read.
+    *
     * @return A view of time-lines pairs for all times
     */
     [[nodiscard]] auto GetAllLinesAsRange() const {
-        struct TimeLinesPair {
-            TimeFrameIndex time;
-            std::vector<Line2D> const & lines;
-        };
+        return std::views::iota(std::size_t{0}, _times.size())
+               | std::views::transform([this](std::size_t frame) {
+                     return TimeLinesPair{_times[frame], _copyLines(frame)};
+                 });
+    }
 
-        return _data | std::views::transform([](auto const & pair) {
-                   return TimeLinesPair{TimeFrameIndex(pair.first), pair.second};
-               });
+    /**
+    * @brief Get views of all lines with their associated times as a range
+    *
+    * @return A view of time-line views pairs for all times
+    */
+    [[nodiscard]] auto GetAllLineViewsAsRange() const {
+        return std::views::iota(std::size_t{0}, _times.size())
+               | std::views::transform([this](std::size_t frame) {
+                     return TimeLineViewsPair{_times[frame], _frameViews(frame)};
+                 });
     }
 
     /**
     * @brief Get lines with their associated times as a range within a TimeFrameInterval
     *
-    * Returns a filtered view of time-lines pairs for times within the specified interval [start, end] (inclusive).
+    * Returns a view of time-lines pairs for times within the specified interval [start, end] (inclusive).
+    * The bounds of the interval are found by binary search.
     *
     * @param interval The TimeFrameInterval specifying the range [start, end] (inclusive)
     * @return A view of time-lines pairs for times within the specified interval
     */
     [[nodiscard]] auto GetLinesInRange(TimeFrameInterval const & interval) const {
-        struct TimeLinesPair {
-            TimeFrameIndex time;
-            std::vector<Line2D> const & lines;
-        };
-
-        return _data 
-            | std::views::filter([interval](auto const & pair) {
-                return pair.first >= interval.start && pair.first <= interval.end;
-              })
-            | std::views::transform([](auto const & pair) {
-                return TimeLinesPair{pair.first, pair.second};
-              });
+        auto const [first, last] = _framesInInterval(interval);
+        return std::views::iota(first, last)
+               | std::views::transform([this](std::size_t frame) {
+                     return TimeLinesPair{_times[frame], _copyLines(frame)};
+                 });
     }
 
     /**
@@ -236,28 +379,35 @@ public:
     [[nodiscard]] auto GetLinesInRange(TimeFrameInterval const & interval,
                                        TimeFrame const * source_timeframe,
                                        TimeFrame const * target_timeframe) const {
-        // If the timeframes are the same object, no conversion is needed
-        if (source_timeframe == target_timeframe) {
-            return GetLinesInRange(interval);
-        }
-
-        // If either timeframe is null, fall back to original behavior
-        if (!source_timeframe || !target_timeframe) {
-            return GetLinesInRange(interval);
-        }
-
-        // Convert the time range from source timeframe to target timeframe
-        // 1. Get the time values from the source timeframe
-        auto start_time_value = source_timeframe->getTimeAtIndex(interval.start);
-        auto end_time_value = source_timeframe->getTimeAtIndex(interval.end);
+        return GetLinesInRange(_convertInterval(interval, source_timeframe, target_timeframe));
+    }
 
-        // 2. Convert those time values to indices in the target timeframe
-        auto target_start_index = target_timeframe->getIndexAtTime(static_cast<float>(start_time_value));
-        auto target_end_index = target_timeframe->getIndexAtTime(static_cast<float>(end_time_value));
+    /**
+    * @brief Get views of lines with their associated times within a TimeFrameInterval
+    *
+    * @param interval The TimeFrameInterval specifying the range [start, end] (inclusive)
+    * @return A view of time-line views pairs for times within the specified interval
+    */
+    [[nodiscard]] auto GetLineViewsInRange(TimeFrameInterval const & interval) const {
+        auto const [first, last] = _framesInInterval(interval);
+        return std::views::iota(first, last)
+               | std::views::transform([this](std::size_t frame) {
+                     return TimeLineViewsPair{_times[frame], _frameViews(frame)};
+                 });
+    }
 
-        // 3. Create converted interval and use the original function
-        TimeFrameInterval target_interval{target_start_index, target_end_index};
-        return GetLinesInRange(target_interval);
+    /**
+    * @brief Get views of lines within a TimeFrameInterval with timeframe conversion
+    *
+    * @param interval The TimeFrameInterval in the source timeframe specifying the range [start, end] (inclusive)
+    * @param source_timeframe The timeframe that the interval is expressed in
+    * @param target_timeframe The timeframe that this line data uses
+    * @return A view of time-line views pairs for times within the converted interval range
+    */
+    [[nodiscard]] auto GetLineViewsInRange(TimeFrameInterval const & interval,
+                                           TimeFrame const * source_timeframe,
+                                           TimeFrame const * target_timeframe) const {
+        return GetLineViewsInRange(_convertInterval(interval, source_timeframe, target_timeframe));
     }
 
     // ========== Copy and Move ==========
@@ -337,15 +487,52 @@ public:
 
 protected:
 private:
-    std::map<TimeFrameIndex, std::vector<Line2D>> _data;
-    std::vector<Line2D> _empty{};
+    // Frame f holds lines [_frame_offsets[f], _frame_offsets[f + 1]) at time _times[f].
+    // Line l holds vertices [_line_offsets[l], _line_offsets[l + 1]).
+    std::vector<TimeFrameIndex> _times;
+    std::vector<std::size_t> _frame_offsets{0};
+    std::vector<std::size_t> _line_offsets{0};
+    std::vector<Point2D<float>> _vertices;
+    std::vector<EntityId> _entity_ids;///< One per line
+
     ImageSize _image_size;
     std::shared_ptr<TimeFrame> _time_frame {nullptr};
 
     // Identity management
     std::string _identity_data_key;
     EntityRegistry * _identity_registry {nullptr};
-    std::map<TimeFrameIndex, std::vector<EntityId>> _entity_ids_by_time;
+
+    [[nodiscard]] LineViews _frameViews(std::size_t frame) const {
+        auto const first = _frame_offsets[frame];
+        auto const count = _frame_offsets[frame + 1] - first;
+        return LineViews(std::span<std::size_t const>(_line_offsets).subspan(first, count + 1), _vertices);
+    }
+
+    [[nodiscard]] std::vector<Line2D> _copyLines(std::size_t frame) const;
+
+    /// First and one-past-last frame with times in [interval.start, interval.end]
+    [[nodiscard]] std::pair<std::size_t, std::size_t> _framesInInterval(TimeFrameInterval const & interval) const;
+
+    [[nodiscard]] static TimeFrameInterval _convertInterval(TimeFrameInterval const & interval,
+                                                            TimeFrame const * source_timeframe,
+                                                            TimeFrame const * target_timeframe);
+
+    /// Index of the frame at @p time, or _times.size() if there is none
+    [[nodiscard]] std::size_t _findFrame(TimeFrameIndex time) const;
+
+    /// Index of the frame at @p time, inserting an empty frame if there is none
+    std::size_t _ensureFrame(TimeFrameIndex time);
+
+    /// Append a line to the frame at @p time and return its global line index
+    std::size_t _appendLine(TimeFrameIndex time, std::span<Point2D<float> const> vertices);
+
+    /// Replace the vertices of global line @p line
+    void _replaceLineVertices(std::size_t line, std::span<Point2D<float> const> vertices);
+
+    void _eraseLine(std::size_t frame, std::size_t line);
+
+    /// Remove the given frames (sorted, unique) with their lines in one pass
+    void _eraseFrames(std::vector<std::size_t> const & frames);
 };
 
 
@@ -331,4 +331,98 @@ TEST_CASE("LineData - Range-based access", "[line][data][range]") {
             REQUIRE(count == 3); // Should include converted times 2, 3, 4
         }
     }
-} 
\ No newline at end of file
+} 
+TEST_CASE("LineData - Shared vertex pool", "[line][data][storage]") {
+    LineData line_data;
+
+    std::vector<Point2D<float>> const a = {{0.0f, 0.0f}, {1.0f, 0.0f}};
+    std::vector<Point2D<float>> const b = {{2.0f, 2.0f}, {3.0f, 3.0f}, {4.0f, 4.0f}};
+    std::vector<Point2D<float>> const c = {{9.0f, 9.0f}};
+
+    // Inserted out of time order; the pool is kept ordered by time, then line
+    line_data.addAtTime(TimeFrameIndex(20), c, false);
+    line_data.addAtTime(TimeFrameIndex(10), a, false);
+    line_data.addAtTime(TimeFrameIndex(10), b, false);
+
+    SECTION("Vertices are contiguous in time and line order") {
+        auto const vertices = line_data.getAllVertices();
+        REQUIRE(vertices.size() == 6);
+        REQUIRE(vertices[0].x == 0.0f);
+        REQUIRE(vertices[2].x == 2.0f);
+        REQUIRE(vertices[5].x == 9.0f);
+        REQUIRE(line_data.getTotalLineCount() == 3);
+
+        auto const times = line_data.getTimesWithData();
+        REQUIRE(times.size() == 2);
+        REQUIRE(times[0] == TimeFrameIndex(10));
+        REQUIRE(times[1] == TimeFrameIndex(20));
+    }
+
+    SECTION("Line views match the copied lines") {
+        auto const views = line_data.getLineViewsAtTime(TimeFrameIndex(10));
+        auto const lines = line_data.getAtTime(TimeFrameIndex(10));
+        REQUIRE(views.size() == 2);
+        REQUIRE(lines.size() == 2);
+        REQUIRE(views[1].size() == 3);
+        REQUIRE(views[1][2].y == lines[1][2].y);
+        REQUIRE(views.vertices().size() == 5);
+
+        std::size_t line_count = 0;
+        for (auto const view: views) {
+            REQUIRE(view.size() == lines[line_count].size());
+            ++line_count;
+        }
+        REQUIRE(line_count == 2);
+        REQUIRE(line_data.getLineViewsAtTime(TimeFrameIndex(15)).empty());
+    }
+
+    SECTION("Editing one line shifts the lines stored after it") {
+        line_data.addPointToLine(TimeFrameIndex(10), 0, Point2D<float>{1.5f, 0.5f}, false);
+        REQUIRE(line_data.getLineViewsAtTime(TimeFrameIndex(10))[0].size() == 3);
+        REQUIRE(line_data.getLineViewsAtTime(TimeFrameIndex(10))[1][0].x == 2.0f);
+        REQUIRE(line_data.getLineViewsAtTime(TimeFrameIndex(20))[0][0].x == 9.0f);
+
+        REQUIRE(line_data.clearAtTime(TimeFrameIndex(10), 0, false));
+        auto const remaining = line_data.getLineViewsAtTime(TimeFrameIndex(10));
+        REQUIRE(remaining.size() == 1);
+        REQUIRE(remaining[0][0].x == 2.0f);
+        REQUIRE(line_data.getEntityIdsAtTime(TimeFrameIndex(10)).size() == 1);
+        REQUIRE(line_data.getAllVertices().size() == 4);
+    }
+
+    SECTION("Appending to the last line in the pool grows it in place") {
+        line_data.addPointToLine(TimeFrameIndex(20), 0, Point2D<float>{10.0f, 1.0f}, false);
+        line_data.addPointToLine(TimeFrameIndex(20), 0, Point2D<float>{11.0f, 1.0f}, false);
+        auto const last = line_data.getLineViewsAtTime(TimeFrameIndex(20))[0];
+        REQUIRE(last.size() == 3);
+        REQUIRE(last[2].x == 11.0f);
+        REQUIRE(line_data.getLineViewsAtTime(TimeFrameIndex(10))[1].size() == 3);
+        REQUIRE(line_data.getAllVertices().size() == 8);
+    }
+
+    SECTION("Line counts are read without copying") {
+        REQUIRE(line_data.getLineCountAtTime(TimeFrameIndex(10)) == 2);
+        REQUIRE(line_data.getLineCountAtTime(TimeFrameIndex(20)) == 1);
+        REQUIRE(line_data.getLineCountAtTime(TimeFrameIndex(15)) == 0);
+    }
+
+    SECTION("Clearing a time removes its lines and vertices") {
+        REQUIRE(line_data.clearAtTime(TimeFrameIndex(10), false));
+        REQUIRE(line_data.getTimesWithData().size() == 1);
+        REQUIRE(line_data.getTotalLineCount() == 1);
+        REQUIRE(line_data.getAllVertices().size() == 1);
+        REQUIRE(line_data.getLineViewsAtTime(TimeFrameIndex(20))[0][0].x == 9.0f);
+    }
+
+    SECTION("View ranges cover the requested interval") {
+        std::size_t frames = 0;
+        std::size_t lines = 0;
+        for (auto const & [time, views]: line_data.GetLineViewsInRange(TimeFrameInterval(TimeFrameIndex(5), TimeFrameIndex(15)))) {
+            REQUIRE(time == TimeFrameIndex(10));
+            lines += views.size();
+            ++frames;
+        }
+        REQUIRE(frames == 1);
+        REQUIRE(lines == 2);
+    }
+}
@@ -31,7 +31,7 @@ bool MaskData::clearAtTime(TimeIndexAndFrame const & time_index_and_frame, bool
     }
 
     auto time = time_index_and_frame.time_frame->getTimeAtIndex(time_index_and_frame.index);
-    auto time_index = _time_frame->getIndexAtTime(static_cast<float>(time));
+    auto time_index = _time_frame->getIndexAtTime(static_cast<double>(time));
 
 
     if (clear_at_time(time_index, _data)) {
@@ -87,7 +87,7 @@ void MaskData::addAtTime(TimeIndexAndFrame const & time_index_and_frame,
     }
 
     auto time = time_index_and_frame.time_frame->getTimeAtIndex(time_index_and_frame.index);
-    auto time_index = _time_frame->getIndexAtTime(static_cast<float>(time));
+    auto time_index = _time_frame->getIndexAtTime(static_cast<double>(time));
 
     add_at_time(time_index, std::move(mask), _data);
 }
@@ -209,8 +209,8 @@ public:
         auto end_time_value = source_timeframe->getTimeAtIndex(interval.end);
 
         // 2. Convert those time values to indices in the target timeframe
-        auto target_start_index = target_timeframe->getIndexAtTime(static_cast<float>(start_time_value));
-        auto target_end_index = target_timeframe->getIndexAtTime(static_cast<float>(end_time_value));
+        auto target_start_index = target_timeframe->getIndexAtTime(static_cast<double>(start_time_value));
+        auto target_end_index = target_timeframe->getIndexAtTime(static_cast<double>(end_time_value));
 
         // 3. Create converted interval and use the original function
         TimeFrameInterval target_interval{target_start_index, target_end_index};
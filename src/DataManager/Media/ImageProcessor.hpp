@@ -35,6 +35,21 @@ public:
         std::vector<uint8_t> const& input_data,
         ImageSize const& image_size) = 0;
 
+    /**
+     * @brief Process image data in place, reusing the buffer of @p data
+     *
+     * Backends that can operate on the caller's buffer directly should
+     * override this to avoid the copies made by processImage. The default
+     * falls back to processImage.
+     *
+     * @param data Image data, replaced by the processed image
+     * @param image_size Dimensions of the image
+     */
+    virtual void processImageInPlace(std::vector<uint8_t>& data,
+                                     ImageSize const& image_size) {
+        data = processImage(data, image_size);
+    }
+
     /**
      * @brief Add a processing step to the chain
      * @param key Unique identifier for the processing step
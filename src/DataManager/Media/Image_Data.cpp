@@ -1,12 +1,15 @@
 
 #include "Media/Image_Data.hpp"
 
+#include "utils/parallel_for.hpp"
 #include "utils/string_manip.hpp"
 
 #include <opencv2/core/core.hpp>
 #include <opencv2/imgcodecs.hpp>
 #include <opencv2/imgproc.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <iostream>
 #include <set>
@@ -32,38 +35,158 @@ void ImageData::doLoadMedia(std::string const & dir_name) {
         std::cout << std::endl;
     }
 
+    _decoded_sizes.clear();
     setTotalFrameCount(static_cast<int>(_image_paths.size()));
 }
 
-cv::Mat convert_to_display_format(cv::Mat & image, ImageData::DisplayFormat format) {
-    cv::Mat converted_image;
-    if (format == ImageData::DisplayFormat::Gray) {
-        cv::cvtColor(image, converted_image, cv::COLOR_BGR2GRAY);
-        // std::cout << "Converting to Gray" << std::endl;
-    } else if (format == ImageData::DisplayFormat::Color) {
-        cv::cvtColor(image, converted_image, cv::COLOR_BGR2BGRA);
-        // std::cout << "Converting to 4channel" << std::endl;
+namespace {
+
+int imread_flags(ImageData::DisplayFormat format, ImageData::DecodeScale scale) {
+    // Gray frames are decoded straight to one channel instead of converting from BGR
+    bool const gray = (format == ImageData::DisplayFormat::Gray);
+    switch (scale) {
+        case ImageData::DecodeScale::Half:
+            return gray ? cv::IMREAD_REDUCED_GRAYSCALE_2 : cv::IMREAD_REDUCED_COLOR_2;
+        case ImageData::DecodeScale::Quarter:
+            return gray ? cv::IMREAD_REDUCED_GRAYSCALE_4 : cv::IMREAD_REDUCED_COLOR_4;
+        case ImageData::DecodeScale::Eighth:
+            return gray ? cv::IMREAD_REDUCED_GRAYSCALE_8 : cv::IMREAD_REDUCED_COLOR_8;
+        case ImageData::DecodeScale::Full:
+        default:
+            return gray ? cv::IMREAD_GRAYSCALE : cv::IMREAD_COLOR;
     }
-    return converted_image;
 }
 
+size_t scale_slot(ImageData::DecodeScale scale) {
+    switch (scale) {
+        case ImageData::DecodeScale::Half:
+            return 1;
+        case ImageData::DecodeScale::Quarter:
+            return 2;
+        case ImageData::DecodeScale::Eighth:
+            return 3;
+        case ImageData::DecodeScale::Full:
+        default:
+            return 0;
+    }
+}
+
+size_t bytes_per_pixel(ImageData::DisplayFormat format) {
+    return format == ImageData::DisplayFormat::Color ? 4 : 1;
+}
+
+/**
+ * @brief Write a decoded image into @p output in the display format
+ *
+ * @p output must hold exactly rows * cols * bytes_per_pixel(format) bytes.
+ * Color images are converted by cvtColor directly into the output buffer.
+ */
+void write_display_format(cv::Mat const & image, ImageData::DisplayFormat format, std::span<uint8_t> output) {
+    if (format == ImageData::DisplayFormat::Color) {
+        cv::Mat destination(image.rows, image.cols, CV_8UC4, output.data());
+        cv::cvtColor(image, destination, cv::COLOR_BGR2BGRA);
+    } else {
+        cv::Mat destination(image.rows, image.cols, CV_8UC1, output.data());
+        image.copyTo(destination);
+    }
+}
+
+}// namespace
+
 void ImageData::doLoadFrame(int frame_id) {
 
-    if (frame_id > _image_paths.size()) {
+    if (frame_id < 0 || static_cast<size_t>(frame_id) >= _image_paths.size()) {
         std::cout << "Error: Requested frame ID is larger than the number of frames in Media Data" << std::endl;
         return;
     }
 
-    auto loaded_image = cv::imread(_image_paths[frame_id].string());
+    auto const format = this->getFormat();
+    auto const loaded_image = cv::imread(_image_paths[static_cast<size_t>(frame_id)].string(),
+                                         imread_flags(format, DecodeScale::Full));
+    if (loaded_image.empty()) {
+        std::cout << "Error: Could not read image " << _image_paths[static_cast<size_t>(frame_id)] << std::endl;
+        return;
+    }
 
     updateHeight(loaded_image.rows);
     updateWidth(loaded_image.cols);
 
-    auto converted_image = convert_to_display_format(loaded_image, this->getFormat());
+    std::vector<uint8_t> frame(loaded_image.total() * bytes_per_pixel(format));
+    write_display_format(loaded_image, format, frame);
+    this->setRawData(std::move(frame));
+}
+
+ImageSize ImageData::decodedFrameSize(DecodeScale scale) const {
+    auto const slot = scale_slot(scale);
+    if (_decoded_sizes.size() <= slot) {
+        _decoded_sizes.resize(slot + 1);
+    }
+
+    auto & size = _decoded_sizes[slot];
+    if (size.width < 0 && !_image_paths.empty()) {
+        auto const image = cv::imread(_image_paths.front().string(), imread_flags(getFormat(), scale));
+        if (!image.empty()) {
+            size = ImageSize{image.cols, image.rows};
+        }
+    }
+    return size;
+}
+
+size_t ImageData::decodedFrameBytes(DecodeScale scale) const {
+    auto const size = decodedFrameSize(scale);
+    if (size.width <= 0 || size.height <= 0) {
+        return 0;
+    }
+    return static_cast<size_t>(size.width) * static_cast<size_t>(size.height) * bytes_per_pixel(getFormat());
+}
+
+int ImageData::decodeFrameRange(int first_frame,
+                                int count,
+                                std::span<uint8_t> output,
+                                DecodeScale scale) const {
+    if (first_frame < 0 || count <= 0) {
+        return 0;
+    }
+
+    auto const last_frame = std::min(static_cast<size_t>(first_frame) + static_cast<size_t>(count), _image_paths.size());
+    if (static_cast<size_t>(first_frame) >= last_frame) {
+        return 0;
+    }
+    auto const num_frames = last_frame - static_cast<size_t>(first_frame);
+
+    auto const expected_size = decodedFrameSize(scale);
+    auto const frame_bytes = decodedFrameBytes(scale);
+    if (frame_bytes == 0 || output.size() < num_frames * frame_bytes) {
+        std::cout << "Error: Output buffer is too small for the requested frame range" << std::endl;
+        return 0;
+    }
+
+    std::atomic<int> decoded{0};
+
+    // One image per item; decoding dominates, so even single frames are worth a thread
+    parallel_for_chunks(num_frames, 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            auto frame_output = output.subspan(i * frame_bytes, frame_bytes);
+            if (_decodeFrameInto(first_frame + static_cast<int>(i), scale, expected_size, frame_output)) {
+                decoded.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                std::fill(frame_output.begin(), frame_output.end(), uint8_t{0});
+            }
+        }
+    });
+
+    return decoded.load();
+}
+
+bool ImageData::_decodeFrameInto(int frame_id, DecodeScale scale, ImageSize expected_size, std::span<uint8_t> output) const {
+    auto const format = getFormat();
+    auto const image = cv::imread(_image_paths[static_cast<size_t>(frame_id)].string(), imread_flags(format, scale));
+    if (image.empty() || image.cols != expected_size.width || image.rows != expected_size.height) {
+        return false;
+    }
 
-    size_t const num_bytes = converted_image.total() * converted_image.elemSize();
-    // std::cout << converted_image.elemSize() << ' ' << converted_image.total() << std::endl;
-    this->setRawData(std::vector<uint8_t>(static_cast<uint8_t *>(converted_image.data), static_cast<uint8_t *>(converted_image.data) + num_bytes));
+    write_display_format(image, format, output);
+    return true;
 }
 
 std::string ImageData::GetFrameID(int frame_id) const {
@@ -83,5 +206,6 @@ int ImageData::getFrameIndexFromNumber(int frame_id) {
 
 void ImageData::setImagePaths(std::vector<std::filesystem::path> const & image_paths) {
     _image_paths = image_paths;
+    _decoded_sizes.clear();
     setTotalFrameCount(static_cast<int>(_image_paths.size()));
 }
@@ -4,7 +4,10 @@
 
 #include "Media/Media_Data.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -29,12 +32,63 @@ public:
      */
     void setImagePaths(std::vector<std::filesystem::path> const & image_paths);
 
+    /**
+     * @brief Downscaling applied while decoding
+     *
+     * Reduced decodes are meant for previews. JPEG files are decoded directly
+     * at the reduced scale, which is much cheaper than a full decode.
+     */
+    enum class DecodeScale {
+        Full = 1,
+        Half = 2,
+        Quarter = 4,
+        Eighth = 8
+    };
+
+    /**
+     * @brief Size of a frame decoded at @p scale
+     *
+     * Determined by decoding the first image once per scale. All images of a
+     * sequence are expected to have the same size.
+     *
+     * @return Frame size, or {-1, -1} if there are no images or the first one cannot be read
+     */
+    [[nodiscard]] ImageSize decodedFrameSize(DecodeScale scale = DecodeScale::Full) const;
+
+    /**
+     * @brief Number of bytes of one frame decoded at @p scale in the current display format
+     */
+    [[nodiscard]] size_t decodedFrameBytes(DecodeScale scale = DecodeScale::Full) const;
+
+    /**
+     * @brief Decode frames [first_frame, first_frame + count) concurrently into @p output
+     *
+     * Frame first_frame + i is written to output[i * decodedFrameBytes(scale)].
+     * Frames are decoded straight to grayscale when the display format is Gray.
+     * The loaded frame and processed data of the media are not changed.
+     *
+     * Frames that cannot be read, or whose size differs from decodedFrameSize(scale),
+     * are zero-filled.
+     *
+     * @pre output.size() >= count * decodedFrameBytes(scale)
+     * @return Number of frames decoded successfully
+     */
+    int decodeFrameRange(int first_frame,
+                         int count,
+                         std::span<uint8_t> output,
+                         DecodeScale scale = DecodeScale::Full) const;
+
 protected:
     void doLoadMedia(std::string const & name) override;
     void doLoadFrame(int frame_id) override;
 
 private:
     std::vector<std::filesystem::path> _image_paths;
+
+    /// decodedFrameSize cache, indexed by log2 of the scale
+    mutable std::vector<ImageSize> _decoded_sizes;
+
+    [[nodiscard]] bool _decodeFrameInto(int frame_id, DecodeScale scale, ImageSize expected_size, std::span<uint8_t> output) const;
 };
 
 
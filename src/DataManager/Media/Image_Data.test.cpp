@@ -0,0 +1,95 @@
+#include "Media/Image_Data.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <opencv2/core/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace {
+
+class ImageSequenceFixture {
+public:
+    ImageSequenceFixture() {
+        test_dir = std::filesystem::current_path() / "test_image_data_decode";
+        std::filesystem::create_directories(test_dir);
+
+        // Frame i is a uniform gray image with value 10 * (i + 1)
+        for (int i = 0; i < frame_count; ++i) {
+            cv::Mat frame(height, width, CV_8UC3, cv::Scalar::all(10 * (i + 1)));
+            auto path = test_dir / ("frame_" + std::to_string(i) + ".png");
+            cv::imwrite(path.string(), frame);
+            paths.push_back(path);
+        }
+    }
+
+    ~ImageSequenceFixture() {
+        std::filesystem::remove_all(test_dir);
+    }
+
+protected:
+    static constexpr int frame_count = 6;
+    static constexpr int width = 32;
+    static constexpr int height = 16;
+
+    std::filesystem::path test_dir;
+    std::vector<std::filesystem::path> paths;
+};
+
+}// namespace
+
+TEST_CASE_METHOD(ImageSequenceFixture, "ImageData decodes frame ranges into a caller buffer", "[ImageData][decode]") {
+    ImageData images;
+    images.setImagePaths(paths);
+
+    SECTION("Gray frames match frames loaded one by one") {
+        auto const frame_bytes = images.decodedFrameBytes();
+        REQUIRE(frame_bytes == static_cast<size_t>(width * height));
+
+        std::vector<uint8_t> frames(frame_bytes * frame_count);
+        REQUIRE(images.decodeFrameRange(0, frame_count, frames) == frame_count);
+
+        for (int i = 0; i < frame_count; ++i) {
+            auto const & loaded = images.getRawData(i);
+            REQUIRE(loaded.size() == frame_bytes);
+            REQUIRE(std::equal(loaded.begin(), loaded.end(), frames.begin() + static_cast<std::ptrdiff_t>(static_cast<size_t>(i) * frame_bytes)));
+        }
+    }
+
+    SECTION("Color frames are written as four channels") {
+        images.setFormat(ImageData::DisplayFormat::Color);
+        auto const frame_bytes = images.decodedFrameBytes();
+        REQUIRE(frame_bytes == static_cast<size_t>(width * height * 4));
+
+        std::vector<uint8_t> frames(frame_bytes * 2);
+        REQUIRE(images.decodeFrameRange(1, 2, frames) == 2);
+        REQUIRE(frames[0] == 20);
+        REQUIRE(frames[3] == 255);
+        REQUIRE(frames[frame_bytes] == 30);
+    }
+
+    SECTION("Reduced decode halves both dimensions") {
+        auto const size = images.decodedFrameSize(ImageData::DecodeScale::Half);
+        REQUIRE(size.width == width / 2);
+        REQUIRE(size.height == height / 2);
+
+        std::vector<uint8_t> frames(images.decodedFrameBytes(ImageData::DecodeScale::Half));
+        REQUIRE(images.decodeFrameRange(2, 1, frames, ImageData::DecodeScale::Half) == 1);
+        REQUIRE(frames.front() == 30);
+    }
+
+    SECTION("Ranges past the last frame are truncated") {
+        std::vector<uint8_t> frames(images.decodedFrameBytes() * 2);
+        REQUIRE(images.decodeFrameRange(frame_count - 1, 4, frames) == 1);
+        REQUIRE(frames.front() == 60);
+    }
+
+    SECTION("Undersized buffers are rejected") {
+        std::vector<uint8_t> frames(images.decodedFrameBytes());
+        REQUIRE(images.decodeFrameRange(0, 2, frames) == 0);
+    }
+}
@@ -1,5 +1,6 @@
 
 #include "Media/Media_Data.hpp"
+#include "Tracing/Tracing.hpp"
 #ifdef ENABLE_OPENCV
 #include "OpenCVImageProcessor.hpp"
 #endif
@@ -35,29 +36,33 @@ void MediaData::setFormat(DisplayFormat const format) {
     }
     int const new_size = _height * _width * _display_format_bytes;
     _rawData.resize(static_cast<size_t>(new_size));
-    _processedData.resize(static_cast<size_t>(new_size));
+    _last_processed_frame = -1;
 };
 
 void MediaData::updateHeight(int const height) {
     _height = height;
     int const new_size = _height * _width * _display_format_bytes;
     _rawData.resize(static_cast<size_t>(new_size));
-    _processedData.resize(static_cast<size_t>(new_size));
+    _last_processed_frame = -1;
 };
 
 void MediaData::updateWidth(int const width) {
     _width = width;
     int const new_size = _height * _width * _display_format_bytes;
     _rawData.resize(static_cast<size_t>(new_size));
-    _processedData.resize(static_cast<size_t>(new_size));
+    _last_processed_frame = -1;
 };
 
 void MediaData::LoadMedia(std::string const & name) {
+    TRACE_ZONE_DETAIL("MediaData::LoadMedia", "media", name);
     doLoadMedia(name);
 }
 
 void MediaData::LoadFrame(int const frame_id) {
+    TRACE_ZONE_NAMED(zone, "MediaData::LoadFrame", "media", {});
+    TRACE_ZONE_VALUE(zone, "frame", frame_id);
     doLoadFrame(frame_id);
+    TRACE_ZONE_VALUE(zone, "bytes", _rawData.size());
 
     _last_loaded_frame = frame_id;
 }
@@ -70,12 +75,12 @@ std::vector<uint8_t> const & MediaData::getRawData(int const frame_number) {
     return _rawData;
 }
 
-std::vector<uint8_t> MediaData::getProcessedData(int const frame_number) {
+std::vector<uint8_t> const & MediaData::getProcessedData(int const frame_number) {
     if (frame_number != _last_loaded_frame) {
         LoadFrame(frame_number);
     }
 
-    if (_last_processed_frame != _last_loaded_frame) {
+    if (_last_processed_frame != _last_loaded_frame || _processed_version != _processing_version) {
         _processData();
     }
 
@@ -89,9 +94,8 @@ bool MediaData::setImageProcessor(std::string const& processor_name) {
     if (new_processor) {
         _image_processor = std::move(new_processor);
         _processor_name = processor_name;
-        // Reprocess data with new processor
+        ++_processing_version;
         if (_last_loaded_frame != -1) {
-            _processData();
             notifyObservers();
         }
         return true;
@@ -106,7 +110,7 @@ std::string MediaData::getImageProcessorName() const {
 void MediaData::addProcessingStep(std::string const& key, std::function<void(void*)> processor) {
     if (_image_processor) {
         _image_processor->addProcessingStep(key, std::move(processor));
-        _processData();
+        ++_processing_version;
         notifyObservers();
     }
 }
@@ -114,7 +118,7 @@ void MediaData::addProcessingStep(std::string const& key, std::function<void(voi
 void MediaData::removeProcessingStep(std::string const& key) {
     if (_image_processor) {
         _image_processor->removeProcessingStep(key);
-        _processData();
+        ++_processing_version;
         notifyObservers();
     }
 }
@@ -122,7 +126,7 @@ void MediaData::removeProcessingStep(std::string const& key) {
 void MediaData::clearProcessingSteps() {
     if (_image_processor) {
         _image_processor->clearProcessingSteps();
-        _processData();
+        ++_processing_version;
         notifyObservers();
     }
 }
@@ -136,12 +140,15 @@ size_t MediaData::getProcessingStepCount() const {
 }
 
 void MediaData::_processData() {
-    _processedData = _rawData;
+    TRACE_ZONE("MediaData::processData", "media");
+    // assign reuses the capacity of the previous processed frame
+    _processedData.assign(_rawData.begin(), _rawData.end());
 
     // Use ImageProcessor system if available
     if (_image_processor && _image_processor->getProcessingStepCount() > 0) {
-        _processedData = _image_processor->processImage(_processedData, getImageSize());
+        _image_processor->processImageInPlace(_processedData, getImageSize());
     }
 
     _last_processed_frame = _last_loaded_frame;
+    _processed_version = _processing_version;
 }
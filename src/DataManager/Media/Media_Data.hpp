@@ -86,9 +86,18 @@ public:
     };
 
     std::vector<uint8_t> const & getRawData(int frame_number);
-    void setRawData(std::vector<uint8_t> data) { _rawData = std::move(data); };
+    void setRawData(std::vector<uint8_t> data) {
+        _rawData = std::move(data);
+        _last_processed_frame = -1;
+    };
 
-    std::vector<uint8_t> getProcessedData(int frame_number);
+    /**
+     * @brief Get the frame after the processing chain has been applied
+     *
+     * The processed frame is cached and only recomputed when the frame or the
+     * processing chain changes. The reference stays valid until the next call.
+     */
+    std::vector<uint8_t> const & getProcessedData(int frame_number);
 
     // Image processing methods using ImageProcessor system
     /**
@@ -169,7 +178,11 @@ private:
     std::string _processor_name;
     
     int _last_loaded_frame = -1;
+
+    // _processedData holds _last_processed_frame run through chain version _processed_version
     int _last_processed_frame = -1;
+    uint64_t _processing_version = 0;
+    uint64_t _processed_version = 0;
 
     std::shared_ptr<TimeFrame> _time_frame {nullptr};
 
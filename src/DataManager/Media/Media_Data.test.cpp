@@ -0,0 +1,125 @@
+#include "Media_Data.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+int processed_frame_count = 0;
+
+/**
+ * @brief Processor that adds one to every byte per step and counts processed frames
+ */
+class CountingImageProcessor : public ImageProcessing::ImageProcessor {
+public:
+    std::vector<uint8_t> processImage(std::vector<uint8_t> const & input_data,
+                                      ImageSize const & image_size) override {
+        static_cast<void>(image_size);
+        ++processed_frame_count;
+        auto output = input_data;
+        for (auto & value: output) {
+            value = static_cast<uint8_t>(value + _steps.size());
+        }
+        return output;
+    }
+
+    void addProcessingStep(std::string const & key, std::function<void(void *)> processor) override {
+        _steps[key] = std::move(processor);
+    }
+
+    void removeProcessingStep(std::string const & key) override { _steps.erase(key); }
+
+    void clearProcessingSteps() override { _steps.clear(); }
+
+    bool hasProcessingStep(std::string const & key) const override { return _steps.contains(key); }
+
+    size_t getProcessingStepCount() const override { return _steps.size(); }
+
+protected:
+    void * convertFromRaw(std::vector<uint8_t> const & data, ImageSize const & size) override {
+        static_cast<void>(data);
+        static_cast<void>(size);
+        return nullptr;
+    }
+
+    std::vector<uint8_t> convertToRaw(void * internal_data, ImageSize const & size) override {
+        static_cast<void>(internal_data);
+        static_cast<void>(size);
+        return {};
+    }
+
+private:
+    std::map<std::string, std::function<void(void *)>> _steps;
+};
+
+std::unique_ptr<EmptyMediaData> makeCountingMedia() {
+    ImageProcessing::ProcessorRegistry::registerProcessor("counting_test", []() -> std::unique_ptr<ImageProcessing::ImageProcessor> {
+        return std::make_unique<CountingImageProcessor>();
+    });
+
+    auto media = std::make_unique<EmptyMediaData>();
+    media->updateWidth(2);
+    media->updateHeight(2);
+    REQUIRE(media->setImageProcessor("counting_test"));
+    return media;
+}
+
+}// namespace
+
+TEST_CASE("MediaData processed frame cache", "[MediaData][processing]") {
+    auto media = makeCountingMedia();
+    processed_frame_count = 0;
+
+    media->LoadFrame(0);
+    media->setRawData(std::vector<uint8_t>{1, 2, 3, 4});
+    media->addProcessingStep("1__step", [](void *) {});
+
+    SECTION("Adding a step does not process until the frame is requested") {
+        REQUIRE(processed_frame_count == 0);
+
+        auto const & processed = media->getProcessedData(0);
+        std::vector<uint8_t> const expected{2, 3, 4, 5};
+        REQUIRE(processed == expected);
+        REQUIRE(processed_frame_count == 1);
+    }
+
+    SECTION("Repeated requests for the same frame reuse the cached result") {
+        static_cast<void>(media->getProcessedData(0));
+        static_cast<void>(media->getProcessedData(0));
+        REQUIRE(processed_frame_count == 1);
+    }
+
+    SECTION("Changing the chain reprocesses the frame once") {
+        static_cast<void>(media->getProcessedData(0));
+        media->addProcessingStep("2__step", [](void *) {});
+        media->removeProcessingStep("1__step");
+        media->addProcessingStep("3__step", [](void *) {});
+
+        auto const & processed = media->getProcessedData(0);
+        std::vector<uint8_t> const expected{3, 4, 5, 6};
+        REQUIRE(processed == expected);
+        REQUIRE(processed_frame_count == 2);
+    }
+
+    SECTION("New raw data invalidates the cached frame") {
+        static_cast<void>(media->getProcessedData(0));
+        media->setRawData(std::vector<uint8_t>{10, 20, 30, 40});
+
+        auto const & processed = media->getProcessedData(0);
+        std::vector<uint8_t> const expected{11, 21, 31, 41};
+        REQUIRE(processed == expected);
+        REQUIRE(processed_frame_count == 2);
+    }
+
+    SECTION("Clearing the chain returns the raw frame without processing") {
+        media->clearProcessingSteps();
+
+        auto const & processed = media->getProcessedData(0);
+        std::vector<uint8_t> const expected{1, 2, 3, 4};
+        REQUIRE(processed == expected);
+        REQUIRE(processed_frame_count == 0);
+    }
+}
@@ -8,25 +8,34 @@ std::vector<uint8_t> OpenCVImageProcessor::processImage(
     std::vector<uint8_t> const& input_data,
     ImageSize const& image_size) {
     
-    if (input_data.empty() || _opencv_process_chain.empty()) {
-        return input_data;  // Return unmodified data if no processing needed
+    std::vector<uint8_t> output = input_data;
+    processImageInPlace(output, image_size);
+    return output;
+}
+
+void OpenCVImageProcessor::processImageInPlace(
+    std::vector<uint8_t>& data,
+    ImageSize const& image_size) {
+
+    if (data.empty() || _opencv_process_chain.empty()) {
+        return;  // Leave data unmodified if no processing needed
     }
 
-    // Convert to internal format (cv::Mat)
-    std::unique_ptr<cv::Mat> mat_ptr(
-        static_cast<cv::Mat*>(convertFromRaw(input_data, image_size)));
-    
-    if (!mat_ptr || mat_ptr->empty()) {
-        return input_data;  // Return original data if conversion failed
+    // Header over the caller's buffer; no pixel data is copied
+    cv::Mat mat = convert_vector_to_mat(data, image_size);
+    if (mat.empty()) {
+        return;
     }
 
     // Apply all processing steps in order
     for (auto const& [key, process] : _opencv_process_chain) {
-        process(*mat_ptr);
+        process(mat);
     }
 
-    // Convert back to raw format
-    return convertToRaw(mat_ptr.get(), image_size);
+    // A step replaced the Mat instead of writing into it
+    if (mat.data != data.data()) {
+        convert_mat_to_vector(data, mat, image_size);
+    }
 }
 
 void OpenCVImageProcessor::addProcessingStep(std::string const& key, 
@@ -61,11 +70,8 @@ size_t OpenCVImageProcessor::getProcessingStepCount() const {
 
 void* OpenCVImageProcessor::convertFromRaw(std::vector<uint8_t> const& data, 
                                          ImageSize const& size) {
-    // Create a mutable copy for the conversion function
-    std::vector<uint8_t> mutable_data = data;
-    
-    // Use existing utility function to convert to cv::Mat
-    cv::Mat mat = convert_vector_to_mat(mutable_data, size);
+    // The returned Mat owns its pixels, so wrap the input and clone once
+    cv::Mat mat = convert_vector_to_mat(const_cast<std::vector<uint8_t>&>(data), size);
     
     if (mat.empty()) {
         return nullptr;
@@ -34,6 +34,19 @@ public:
         std::vector<uint8_t> const& input_data,
         ImageSize const& image_size) override;
 
+    /**
+     * @brief Run the processing chain directly on the buffer of @p data
+     *
+     * The buffer is wrapped in a cv::Mat header without copying. Steps that
+     * write their result into the same Mat leave it in place; if a step
+     * reallocates the Mat, the result is copied back into @p data once.
+     *
+     * @param data Image data, replaced by the processed image
+     * @param image_size Dimensions of the image
+     */
+    void processImageInPlace(std::vector<uint8_t>& data,
+                             ImageSize const& image_size) override;
+
     /**
      * @brief Add an OpenCV processing step to the chain
      * @param key Unique identifier for the processing step
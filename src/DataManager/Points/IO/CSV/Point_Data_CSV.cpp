@@ -1,42 +1,38 @@
 #include "Point_Data_CSV.hpp"
 
 #include "Points/Point_Data.hpp"
+#include "Tracing/Tracing.hpp"
+#include "loaders/CSV_Engine.hpp"
 #include "transforms/data_transforms.hpp"
 #include "utils/string_manip.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <cmath>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <sstream>
 
-//https://stackoverflow.com/questions/4654636/how-to-determine-if-a-string-is-a-number-with-c
-bool is_number(std::string const & s) {
-    return !s.empty() && std::find_if(s.begin(),
-                                      s.end(), [](unsigned char c) { return !std::isdigit(c); }) == s.end();
-}
-
 std::map<TimeFrameIndex, Point2D<float>> load(CSVPointLoaderOptions const & opts) {
-    std::string csv_line;
+    TRACE_ZONE_NAMED(zone, "load point CSV", "loader", opts.filename);
 
     auto line_output = std::map<TimeFrameIndex, Point2D<float>>{};
 
-    std::fstream myfile;
-    myfile.open(opts.filename, std::fstream::in);
-
-    std::string x_str;
-    std::string y_str;
-    std::string frame_str;
-    std::string col_value;
-
-    std::vector<std::pair<TimeFrameIndex, Point2D<float>>> csv_vector = {};
+    Loader::MappedFile const file(opts.filename);
 
-    while (getline(myfile, csv_line)) {
+    int const last_column = std::max({opts.frame_column, opts.x_column, opts.y_column});
 
-        std::stringstream ss(csv_line);
+    using FramePoint = std::pair<TimeFrameIndex, Point2D<float>>;
+    auto const csv_vector = Loader::parseLines<FramePoint>(file.view(), '\n', [&opts, last_column](std::string_view csv_line, std::vector<FramePoint> & rows) {
+        std::string_view frame_str;
+        std::string_view x_str;
+        std::string_view y_str;
 
-        int cols_read = 0;
-        while (getline(ss, col_value, opts.column_delim)) {
+        Loader::forEachField(csv_line, opts.column_delim, [&](size_t col, std::string_view col_value) {
+            int const cols_read = static_cast<int>(col);
             if (cols_read == opts.frame_column) {
                 frame_str = col_value;
             } else if (cols_read == opts.x_column) {
@@ -44,67 +40,146 @@ std::map<TimeFrameIndex, Point2D<float>> load(CSVPointLoaderOptions const & opts
             } else if (cols_read == opts.y_column) {
                 y_str = col_value;
             }
-            cols_read++;
+            return cols_read < last_column;
+        });
+
+        // Rows whose frame is not a plain integer (e.g. headers) are skipped
+        if (frame_str.empty() || !std::all_of(frame_str.begin(), frame_str.end(), [](unsigned char c) { return std::isdigit(c); })) {
+            return;
         }
 
-        if (is_number(frame_str)) {
-            //line_output[TimeFrameIndex(std::stoi(frame_str))]=Point2D<float>{std::stof(x_str),std::stof(y_str)};
-            csv_vector.emplace_back(TimeFrameIndex(std::stoi(frame_str)), Point2D<float>{std::stof(x_str), std::stof(y_str)});
+        int64_t frame = 0;
+        Point2D<float> point;
+        if (!Loader::parseInteger(frame_str, frame) || !Loader::parseFloat(x_str, point.x) || !Loader::parseFloat(y_str, point.y)) {
+            return;
         }
-    }
-    std::cout.flush();
+        rows.emplace_back(TimeFrameIndex(frame), point);
+    });
 
-    std::cout << "Read " << csv_vector.size() << " lines from " << opts.filename << std::endl;
+    TRACE_ZONE_VALUE(zone, "points", csv_vector.size());
+    TRACE_ZONE_VALUE(zone, "bytes", file.view().size());
 
     line_output.insert(csv_vector.begin(), csv_vector.end());
 
     return line_output;
 }
 
-std::map<std::string, std::map<TimeFrameIndex, Point2D<float>>> load_multiple_points_from_csv(std::string const & filename, int const frame_column) {
-    std::fstream file;
-    file.open(filename, std::fstream::in);
+namespace {
 
-    std::string ln, ele;
+/**
+ * @brief Parse the first run of digits in a field (e.g. the frame number in "img0042.png")
+ */
+bool parse_first_number(std::string_view field, int & value) {
+    auto const first_digit = std::find_if(field.begin(), field.end(), [](unsigned char c) { return std::isdigit(c); });
+    if (first_digit == field.end()) {
+        return false;
+    }
+    field.remove_prefix(static_cast<size_t>(first_digit - field.begin()));
+    return Loader::parseInteger(field, value);
+}
+
+std::vector<std::string> split_header_row(std::string_view row) {
+    std::vector<std::string> fields;
+    Loader::forEachField(row, ',', [&fields](size_t, std::string_view field) {
+        fields.emplace_back(Loader::trimField(field));
+        return true;
+    });
+    return fields;
+}
 
-    getline(file, ln);// skip the "scorer" row
+}// namespace
 
-    getline(file, ln);// bodyparts row
-    std::vector<std::string> bodyparts;
-    {
-        std::stringstream ss(ln);
-        while (getline(ss, ele, ',')) {
-            bodyparts.push_back(ele);
+std::map<std::string, std::map<TimeFrameIndex, Point2D<float>>> load_multiple_points_from_csv(std::string const & filename, int const frame_column) {
+    Loader::MappedFile const file(filename);
+    auto text = file.view();
+
+    auto next_row = [&text]() {
+        size_t const eol = text.find('\n');
+        auto row = text.substr(0, eol);
+        text.remove_prefix(eol == std::string_view::npos ? text.size() : eol + 1);
+        return row;
+    };
+
+    next_row();// skip the "scorer" row
+
+    std::vector<std::string> const bodyparts = split_header_row(next_row());// bodyparts row
+    std::vector<std::string> const dims = split_header_row(next_row());     // coords row
+
+    // Columns holding x or y coordinates for a known bodypart
+    struct CoordinateColumn {
+        size_t column;
+        size_t bodypart;
+        bool is_x;
+    };
+    std::vector<std::string> bodypart_names;
+    std::vector<CoordinateColumn> coordinate_columns;
+    size_t const num_columns = std::min(dims.size(), bodyparts.size());
+    for (size_t col_no = 0; col_no < num_columns; ++col_no) {
+        if (static_cast<int>(col_no) == frame_column || (dims[col_no] != "x" && dims[col_no] != "y")) {
+            continue;
+        }
+        auto const name_it = std::find(bodypart_names.begin(), bodypart_names.end(), bodyparts[col_no]);
+        size_t const bodypart = static_cast<size_t>(name_it - bodypart_names.begin());
+        if (name_it == bodypart_names.end()) {
+            bodypart_names.push_back(bodyparts[col_no]);
         }
+        coordinate_columns.push_back({col_no, bodypart, dims[col_no] == "x"});
     }
 
-    getline(file, ln);// coords row
-    std::vector<std::string> dims;
-    {
-        std::stringstream ss(ln);
-        while (getline(ss, ele, ',')) {
-            dims.push_back(ele);
+    // One parsed value per coordinate column; NaN where the cell is empty or unparseable
+    struct Row {
+        TimeFrameIndex frame{0};
+        std::vector<float> values;
+    };
+
+    auto const rows = Loader::parseLines<Row>(text, '\n', [&](std::string_view line, std::vector<Row> & out) {
+        if (line.empty()) {
+            return;
         }
-    }
 
-    std::map<std::string, std::map<TimeFrameIndex, Point2D<float>>> data;
-    while (getline(file, ln)) {
-        std::stringstream ss(ln);
-        size_t col_no = 0;
-        TimeFrameIndex frame_no(0);
-        while (getline(ss, ele, ',')) {
+        Row row;
+        row.values.assign(coordinate_columns.size(), std::numeric_limits<float>::quiet_NaN());
+
+        size_t next_coordinate = 0;
+        bool has_frame = false;
+        Loader::forEachField(line, ',', [&](size_t col_no, std::string_view ele) {
             if (static_cast<int>(col_no) == frame_column) {
-                frame_no = TimeFrameIndex(std::stoi(extract_numbers_from_string(ele)));
-            } else if (col_no < dims.size() && dims[col_no] == "x") {
-                if (col_no < bodyparts.size()) {
-                    data[bodyparts[col_no]][frame_no].x = std::stof(ele);
-                }
-            } else if (col_no < dims.size() && dims[col_no] == "y") {
-                if (col_no < bodyparts.size()) {
-                    data[bodyparts[col_no]][frame_no].y = std::stof(ele);
+                int frame = 0;
+                has_frame = parse_first_number(ele, frame);
+                row.frame = TimeFrameIndex(frame);
+            } else if (next_coordinate < coordinate_columns.size() && coordinate_columns[next_coordinate].column == col_no) {
+                float value = 0.0f;
+                if (Loader::parseFloat(ele, value)) {
+                    row.values[next_coordinate] = value;
                 }
+                ++next_coordinate;
+            }
+            return true;
+        });
+
+        if (has_frame) {
+            out.push_back(std::move(row));
+        }
+    });
+
+    std::map<std::string, std::map<TimeFrameIndex, Point2D<float>>> data;
+    std::vector<std::map<TimeFrameIndex, Point2D<float>> *> bodypart_data;
+    bodypart_data.reserve(bodypart_names.size());
+    for (auto const & name: bodypart_names) {
+        bodypart_data.push_back(&data[name]);
+    }
+
+    for (auto const & row: rows) {
+        for (size_t i = 0; i < coordinate_columns.size(); ++i) {
+            if (std::isnan(row.values[i])) {
+                continue;
+            }
+            auto & point = (*bodypart_data[coordinate_columns[i].bodypart])[row.frame];
+            if (coordinate_columns[i].is_x) {
+                point.x = row.values[i];
+            } else {
+                point.y = row.values[i];
             }
-            ++col_no;
         }
     }
 
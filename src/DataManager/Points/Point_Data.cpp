@@ -1,6 +1,5 @@
 #include "Point_Data.hpp"
 
-#include "utils/map_timeseries.hpp"
 #include "Entity/EntityRegistry.hpp"
 
 #include <algorithm>
@@ -10,78 +9,90 @@
 // ========== Constructors ==========
 
 PointData::PointData(std::map<TimeFrameIndex, Point2D<float>> const & data) {
+    _offsets.reserve(data.size() + 1);
+    _points.reserve(data.size());
+    _entity_ids.reserve(data.size());
     for (auto const & [time, point]: data) {
-        _data[time].push_back(point);
-        _entity_ids_by_time[time].push_back(0); // placeholder until identity context is set
+        _appendPoints(time, std::span<Point2D<float> const>(&point, 1));
     }
 }
 
-PointData::PointData(std::map<TimeFrameIndex, std::vector<Point2D<float>>> const & data) 
-    : _data(data) {
-    for (auto const & [time, points] : _data) {
-        _entity_ids_by_time[time].resize(points.size(), 0);
+PointData::PointData(std::map<TimeFrameIndex, std::vector<Point2D<float>>> const & data) {
+    std::size_t total_points = 0;
+    for (auto const & [time, points]: data) {
+        total_points += points.size();
+    }
+    _offsets.reserve(data.size() + 1);
+    _points.reserve(total_points);
+    _entity_ids.reserve(total_points);
+    for (auto const & [time, points]: data) {
+        _appendPoints(time, points);
     }
 }
 
 // ========== Setters ==========
 
 bool PointData::clearAtTime(TimeFrameIndex const time, bool notify) {
-    if (clear_at_time(time, _data)) {
-        _entity_ids_by_time.erase(time);
-        if (notify) {
-            notifyObservers();
+    auto const frame = _findFrame(time);
+    if (frame == _frameCount()) {
+        return false;
+    }
+    _eraseFrames({frame});
+    if (notify) {
+        notifyObservers();
+    }
+    return true;
+}
+
+std::size_t PointData::clearAtTimes(std::span<TimeFrameIndex const> const times, bool notify) {
+    std::vector<std::size_t> frames_to_clear;
+    frames_to_clear.reserve(times.size());
+    for (TimeFrameIndex const time: times) {
+        auto const frame = _findFrame(time);
+        if (frame != _frameCount()) {
+            frames_to_clear.push_back(frame);
         }
-        return true;
     }
-    return false;
+
+    std::sort(frames_to_clear.begin(), frames_to_clear.end());
+    frames_to_clear.erase(std::unique(frames_to_clear.begin(), frames_to_clear.end()), frames_to_clear.end());
+    if (frames_to_clear.empty()) {
+        return 0;
+    }
+
+    std::size_t points_removed = 0;
+    for (std::size_t const frame: frames_to_clear) {
+        points_removed += _offsets[frame + 1] - _offsets[frame];
+    }
+    _eraseFrames(frames_to_clear);
+    if (notify) {
+        notifyObservers();
+    }
+    return points_removed;
 }
 
 bool PointData::clearAtTime(TimeFrameIndex const time, size_t const index, bool notify) {
-    if (clear_at_time(time, index, _data)) {
-        auto it = _entity_ids_by_time.find(time);
-        if (it != _entity_ids_by_time.end()) {
-            if (index < it->second.size()) {
-                it->second.erase(it->second.begin() + static_cast<std::ptrdiff_t>(index));
-            }
-            if (it->second.empty()) {
-                _entity_ids_by_time.erase(it);
-            }
-        }
-        if (notify) {
-            notifyObservers();
-        }
-        return true;
+    auto const frame = _findFrame(time);
+    if (frame == _frameCount() || index >= _offsets[frame + 1] - _offsets[frame]) {
+        return false;
     }
-    return false;
+    auto const point = _offsets[frame] + index;
+    _replacePoints(frame, point, point + 1, {}, {});
+    if (notify) {
+        notifyObservers();
+    }
+    return true;
 }
 
 void PointData::overwritePointAtTime(TimeFrameIndex const time, Point2D<float> const point, bool notify) {
-    _data[time] = {point};
-    if (_identity_registry) {
-        _entity_ids_by_time[time] = {
-            _identity_registry->ensureId(_identity_data_key, EntityKind::PointEntity, time, 0)
-        };
-    } else {
-        _entity_ids_by_time[time] = {0};
-    }
+    _overwritePoints(time, std::span<Point2D<float> const>(&point, 1));
     if (notify) {
         notifyObservers();
     }
 }
 
 void PointData::overwritePointsAtTime(TimeFrameIndex const time, std::vector<Point2D<float>> const & points, bool notify) {
-    _data[time] = points;
-    _entity_ids_by_time[time].clear();
-    _entity_ids_by_time[time].reserve(points.size());
-    for (int i = 0; i < static_cast<int>(points.size()); ++i) {
-        if (_identity_registry) {
-            _entity_ids_by_time[time].push_back(
-                _identity_registry->ensureId(_identity_data_key, EntityKind::PointEntity, time, i)
-            );
-        } else {
-            _entity_ids_by_time[time].push_back(0);
-        }
-    }
+    _overwritePoints(time, points);
     if (notify) {
         notifyObservers();
     }
@@ -97,18 +108,7 @@ void PointData::overwritePointsAtTimes(
     }
 
     for (std::size_t i = 0; i < times.size(); i++) {
-        _data[times[i]] = points[i];
-        _entity_ids_by_time[times[i]].clear();
-        _entity_ids_by_time[times[i]].reserve(points[i].size());
-        for (int j = 0; j < static_cast<int>(points[i].size()); ++j) {
-            if (_identity_registry) {
-                _entity_ids_by_time[times[i]].push_back(
-                    _identity_registry->ensureId(_identity_data_key, EntityKind::PointEntity, times[i], j)
-                );
-            } else {
-                _entity_ids_by_time[times[i]].push_back(0);
-            }
-        }
+        _overwritePoints(times[i], points[i]);
     }
     if (notify) {
         notifyObservers();
@@ -116,14 +116,7 @@ void PointData::overwritePointsAtTimes(
 }
 
 void PointData::addAtTime(TimeFrameIndex const time, Point2D<float> const point, bool notify) {
-    add_at_time(time, point, _data);
-    int local_index = static_cast<int>(_data[time].size()) - 1;
-    if (_identity_registry) {
-        EntityId id = _identity_registry->ensureId(_identity_data_key, EntityKind::PointEntity, time, local_index);
-        _entity_ids_by_time[time].push_back(id);
-    } else {
-        _entity_ids_by_time[time].push_back(0);
-    }
+    _appendPoints(time, std::span<Point2D<float> const>(&point, 1));
 
     if (notify) {
         notifyObservers();
@@ -131,17 +124,7 @@ void PointData::addAtTime(TimeFrameIndex const time, Point2D<float> const point,
 }
 
 void PointData::addPointsAtTime(TimeFrameIndex const time, std::vector<Point2D<float>> const & points, bool notify) {
-    _data[time].insert(_data[time].end(), points.begin(), points.end());
-    int start_index = static_cast<int>(_entity_ids_by_time[time].size());
-    for (int i = 0; i < static_cast<int>(points.size()); ++i) {
-        if (_identity_registry) {
-            _entity_ids_by_time[time].push_back(
-                _identity_registry->ensureId(_identity_data_key, EntityKind::PointEntity, time, start_index + i)
-            );
-        } else {
-            _entity_ids_by_time[time].push_back(0);
-        }
-    }
+    _appendPoints(time, points);
     
     if (notify) {
         notifyObservers();
@@ -150,20 +133,24 @@ void PointData::addPointsAtTime(TimeFrameIndex const time, std::vector<Point2D<f
 
 // ========== Getters ==========
 
-std::vector<Point2D<float>> const & PointData::getAtTime(TimeFrameIndex const time) const {
-    return get_at_time(time, _data, _empty);
+std::span<Point2D<float> const> PointData::getAtTime(TimeFrameIndex const time) const {
+    auto const frame = _findFrame(time);
+    if (frame == _frameCount()) {
+        return {};
+    }
+    return _framePoints(frame);
 }
 
-std::vector<Point2D<float>> const & PointData::getAtTime(TimeFrameIndex const time, 
-                                                        TimeFrame const * source_timeframe,
-                                                        TimeFrame const * target_timeframe) const {
-    return get_at_time(time, _data, _empty, source_timeframe, target_timeframe);
+std::span<Point2D<float> const> PointData::getAtTime(TimeFrameIndex const time,
+                                                     TimeFrame const * source_timeframe,
+                                                     TimeFrame const * target_timeframe) const {
+    return getAtTime(convertTimeFrameIndex(time, source_timeframe, target_timeframe));
 }
 
 std::size_t PointData::getMaxPoints() const {
     std::size_t max_points = 0;
-    for (auto const & [time, points] : _data) {
-        max_points = std::max(max_points, points.size());
+    for (std::size_t frame = 0; frame < _frameCount(); ++frame) {
+        max_points = std::max(max_points, _offsets[frame + 1] - _offsets[frame]);
     }
     return max_points;
 }
@@ -186,11 +173,9 @@ void PointData::changeImageSize(ImageSize const & image_size) {
     float const scale_x = static_cast<float>(image_size.width) / static_cast<float>(_image_size.width);
     float const scale_y = static_cast<float>(image_size.height) / static_cast<float>(_image_size.height);
 
-    for (auto & [time, points] : _data) {
-        for (auto & point : points) {
-            point.x *= scale_x;
-            point.y *= scale_y;
-        }
+    for (auto & point : _points) {
+        point.x *= scale_x;
+        point.y *= scale_y;
     }
     _image_size = image_size;
 }
@@ -207,9 +192,9 @@ std::size_t PointData::copyTo(PointData& target, TimeFrameInterval const & inter
     std::size_t total_points_copied = 0;
 
     // Iterate through all times in the source data within the interval
-    for (auto const & [time, points] : _data) {
-        if (time >= interval.start && time <= interval.end && !points.empty()) {
-            target.addPointsAtTime(time, points, false); // Don't notify for each operation
+    for (auto const & [time, points] : GetPointsInRange(interval)) {
+        if (!points.empty()) {
+            target._appendPoints(time, points); // Don't notify for each operation
             total_points_copied += points.size();
         }
     }
@@ -227,10 +212,10 @@ std::size_t PointData::copyTo(PointData& target, std::vector<TimeFrameIndex> con
 
     // Copy points for each specified time
     for (TimeFrameIndex time : times) {
-        auto it = _data.find(time);
-        if (it != _data.end() && !it->second.empty()) {
-            target.addPointsAtTime(time, it->second, false); // Don't notify for each operation
-            total_points_copied += it->second.size();
+        auto const points = getAtTime(time);
+        if (!points.empty()) {
+            target._appendPoints(time, points); // Don't notify for each operation
+            total_points_copied += points.size();
         }
     }
 
@@ -250,21 +235,22 @@ std::size_t PointData::moveTo(PointData& target, TimeFrameInterval const & inter
     }
 
     std::size_t total_points_moved = 0;
-    std::vector<TimeFrameIndex> times_to_clear;
+    std::vector<std::size_t> frames_to_clear;
 
     // First, copy all points in the interval to target
-    for (auto const & [time, points] : _data) {
-        if (time >= interval.start && time <= interval.end && !points.empty()) {
-            target.addPointsAtTime(time, points, false); // Don't notify for each operation
+    auto const first = _lowerFrame(interval.start);
+    auto const last = std::max(first, _lowerFrame(TimeFrameIndex(interval.end.getValue() + 1)));
+    for (std::size_t frame = first; frame < last; ++frame) {
+        auto const points = _framePoints(frame);
+        if (!points.empty()) {
+            target._appendPoints(_frameTime(frame), points); // Don't notify for each operation
             total_points_moved += points.size();
-            times_to_clear.push_back(time);
+            frames_to_clear.push_back(frame);
         }
     }
 
-    // Then, clear all the times from source
-    for (TimeFrameIndex time : times_to_clear) {
-        (void) clearAtTime(time, false); // Don't notify for each operation
-    }
+    // Then, clear all the frames from source in a single pass
+    _eraseFrames(frames_to_clear);
 
     // Notify observers only once at the end if requested
     if (notify && total_points_moved > 0) {
@@ -277,22 +263,26 @@ std::size_t PointData::moveTo(PointData& target, TimeFrameInterval const & inter
 
 std::size_t PointData::moveTo(PointData& target, std::vector<TimeFrameIndex> const& times, bool notify) {
     std::size_t total_points_moved = 0;
-    std::vector<TimeFrameIndex> times_to_clear;
+    std::vector<std::size_t> frames_to_clear;
 
     // First, copy points for each specified time to target
     for (TimeFrameIndex time : times) {
-        auto it = _data.find(time);
-        if (it != _data.end() && !it->second.empty()) {
-            target.addPointsAtTime(time, it->second, false); // Don't notify for each operation
-            total_points_moved += it->second.size();
-            times_to_clear.push_back(time);
+        auto const frame = _findFrame(time);
+        if (frame == _frameCount()) {
+            continue;
+        }
+        auto const points = _framePoints(frame);
+        if (!points.empty()) {
+            target._appendPoints(time, points); // Don't notify for each operation
+            total_points_moved += points.size();
+            frames_to_clear.push_back(frame);
         }
     }
 
-    // Then, clear all the times from source
-    for (TimeFrameIndex time : times_to_clear) {
-        (void) clearAtTime(time, false); // Don't notify for each operation
-    }
+    // Then, clear all the frames from source in a single pass
+    std::sort(frames_to_clear.begin(), frames_to_clear.end());
+    frames_to_clear.erase(std::unique(frames_to_clear.begin(), frames_to_clear.end()), frames_to_clear.end());
+    _eraseFrames(frames_to_clear);
 
     // Notify observers only once at the end if requested
     if (notify && total_points_moved > 0) {
@@ -311,34 +301,176 @@ void PointData::setIdentityContext(std::string const & data_key, EntityRegistry
 void PointData::rebuildAllEntityIds() {
     if (!_identity_registry) {
         // Clear to placeholder zeros to maintain alignment
-        for (auto & [t, pts] : _data) {
-            _entity_ids_by_time[t].assign(pts.size(), 0);
+        std::fill(_entity_ids.begin(), _entity_ids.end(), EntityId{0});
+        return;
+    }
+    for (std::size_t frame = 0; frame < _frameCount(); ++frame) {
+        auto const count = _offsets[frame + 1] - _offsets[frame];
+        auto const ids = _identity_registry->ensureIds(_identity_data_key, EntityKind::PointEntity, _frameTime(frame), static_cast<int>(count));
+        std::copy(ids.begin(), ids.end(), _entity_ids.begin() + static_cast<std::ptrdiff_t>(_offsets[frame]));
+    }
+}
+
+std::span<EntityId const> PointData::getEntityIdsAtTime(TimeFrameIndex time) const {
+    auto const frame = _findFrame(time);
+    if (frame == _frameCount()) {
+        return {};
+    }
+    return std::span<EntityId const>(_entity_ids).subspan(_offsets[frame], _offsets[frame + 1] - _offsets[frame]);
+}
+
+std::vector<EntityId> PointData::getAllEntityIds() const {
+    return _entity_ids;
+}
+
+// ========== Flat storage ==========
+
+std::size_t PointData::_lowerFrame(TimeFrameIndex const time) const {
+    if (_dense) {
+        auto const relative = time.getValue() - _dense_origin;
+        return static_cast<std::size_t>(std::clamp<int64_t>(relative, 0, static_cast<int64_t>(_frameCount())));
+    }
+    return static_cast<std::size_t>(std::lower_bound(_times.begin(), _times.end(), time) - _times.begin());
+}
+
+std::size_t PointData::_findFrame(TimeFrameIndex const time) const {
+    auto const frame = _lowerFrame(time);
+    if (frame < _frameCount() && _frameTime(frame) == time) {
+        return frame;
+    }
+    return _frameCount();
+}
+
+std::size_t PointData::_ensureFrame(TimeFrameIndex const time) {
+    auto const frame = _lowerFrame(time);
+    auto const count = _frameCount();
+    if (frame < count && _frameTime(frame) == time) {
+        return frame;
+    }
+
+    if (_dense) {
+        auto const value = time.getValue();
+        if (count == 0 || value == _dense_origin - 1) {
+            _dense_origin = value;
+        } else if (value != _dense_origin + static_cast<int64_t>(count)) {
+            _materializeTimes();
         }
+    }
+    if (!_dense) {
+        _times.insert(_times.begin() + static_cast<std::ptrdiff_t>(frame), time);
+    }
+
+    // The new frame starts empty where the following frame begins
+    auto const offset = _offsets[frame];
+    _offsets.insert(_offsets.begin() + static_cast<std::ptrdiff_t>(frame), offset);
+
+    _updateStorageMode();
+    return frame;
+}
+
+void PointData::_eraseFrames(std::vector<std::size_t> const & frames) {
+    if (frames.empty()) {
         return;
     }
-    for (auto & [t, pts] : _data) {
-        auto & ids = _entity_ids_by_time[t];
-        ids.clear();
-        ids.reserve(pts.size());
-        for (int i = 0; i < static_cast<int>(pts.size()); ++i) {
-            ids.push_back(_identity_registry->ensureId(_identity_data_key, EntityKind::PointEntity, t, i));
+    if (_dense) {
+        _materializeTimes();
+    }
+
+    // Compact the surviving frames towards the front; writes never overtake reads
+    auto next_erased = frames.begin();
+    std::size_t write_frame = 0;
+    std::size_t write_point = 0;
+    auto const count = _frameCount();
+    for (std::size_t frame = 0; frame < count; ++frame) {
+        auto const begin = _offsets[frame];
+        auto const end = _offsets[frame + 1];
+        if (next_erased != frames.end() && *next_erased == frame) {
+            ++next_erased;
+            continue;
+        }
+        if (write_point != begin) {
+            std::copy(_points.begin() + static_cast<std::ptrdiff_t>(begin),
+                      _points.begin() + static_cast<std::ptrdiff_t>(end),
+                      _points.begin() + static_cast<std::ptrdiff_t>(write_point));
+            std::copy(_entity_ids.begin() + static_cast<std::ptrdiff_t>(begin),
+                      _entity_ids.begin() + static_cast<std::ptrdiff_t>(end),
+                      _entity_ids.begin() + static_cast<std::ptrdiff_t>(write_point));
         }
+        _times[write_frame] = _times[frame];
+        _offsets[write_frame] = write_point;
+        write_point += end - begin;
+        ++write_frame;
     }
+    _offsets[write_frame] = write_point;
+
+    _offsets.resize(write_frame + 1);
+    _times.resize(write_frame, TimeFrameIndex(0));
+    _points.resize(write_point);
+    _entity_ids.resize(write_point);
+
+    _updateStorageMode();
 }
 
-std::vector<EntityId> const & PointData::getEntityIdsAtTime(TimeFrameIndex time) const {
-    auto it = _entity_ids_by_time.find(time);
-    if (it == _entity_ids_by_time.end()) {
-        static const std::vector<EntityId> kEmpty;
-        return kEmpty;
+void PointData::_replacePoints(std::size_t const frame,
+                               std::size_t const begin,
+                               std::size_t const end,
+                               std::span<Point2D<float> const> points,
+                               std::span<EntityId const> ids) {
+    auto const point_begin = _points.begin() + static_cast<std::ptrdiff_t>(begin);
+    _points.erase(point_begin, _points.begin() + static_cast<std::ptrdiff_t>(end));
+    _points.insert(_points.begin() + static_cast<std::ptrdiff_t>(begin), points.begin(), points.end());
+
+    auto const id_begin = _entity_ids.begin() + static_cast<std::ptrdiff_t>(begin);
+    _entity_ids.erase(id_begin, _entity_ids.begin() + static_cast<std::ptrdiff_t>(end));
+    _entity_ids.insert(_entity_ids.begin() + static_cast<std::ptrdiff_t>(begin), ids.begin(), ids.end());
+
+    for (std::size_t i = frame + 1; i < _offsets.size(); ++i) {
+        _offsets[i] = _offsets[i] + points.size() - (end - begin);
     }
-    return it->second;
 }
 
-std::vector<EntityId> PointData::getAllEntityIds() const {
-    std::vector<EntityId> out;
-    for (auto const & [t, ids] : _entity_ids_by_time) {
-        out.insert(out.end(), ids.begin(), ids.end());
+void PointData::_appendPoints(TimeFrameIndex const time, std::span<Point2D<float> const> points) {
+    auto const frame = _ensureFrame(time);
+    auto const end = _offsets[frame + 1];
+    auto const start_index = static_cast<int>(end - _offsets[frame]);
+
+    auto const ids = _identity_registry
+                             ? _identity_registry->ensureIds(_identity_data_key, EntityKind::PointEntity, time, static_cast<int>(points.size()), start_index)
+                             : std::vector<EntityId>(points.size(), 0);
+    _replacePoints(frame, end, end, points, ids);
+}
+
+void PointData::_overwritePoints(TimeFrameIndex const time, std::span<Point2D<float> const> points) {
+    auto const frame = _ensureFrame(time);
+
+    auto const ids = _identity_registry
+                             ? _identity_registry->ensureIds(_identity_data_key, EntityKind::PointEntity, time, static_cast<int>(points.size()))
+                             : std::vector<EntityId>(points.size(), 0);
+    _replacePoints(frame, _offsets[frame], _offsets[frame + 1], points, ids);
+}
+
+void PointData::_materializeTimes() {
+    auto const count = _frameCount();
+    _times.clear();
+    _times.reserve(count + 1);
+    for (std::size_t frame = 0; frame < count; ++frame) {
+        _times.emplace_back(_dense_origin + static_cast<int64_t>(frame));
+    }
+    _dense = false;
+}
+
+void PointData::_updateStorageMode() {
+    if (_dense) {
+        return;
+    }
+    if (_times.empty()) {
+        _dense_origin = 0;
+    } else if (_times.back().getValue() - _times.front().getValue() + 1 == static_cast<int64_t>(_times.size())) {
+        _dense_origin = _times.front().getValue();
+    } else {
+        return;
     }
-    return out;
+    _times.clear();
+    _times.shrink_to_fit();
+    _dense = true;
 }
@@ -8,8 +8,11 @@
 #include "TimeFrame/interval_data.hpp"
 #include "Entity/EntityTypes.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <map>
 #include <ranges>
+#include <span>
 #include <vector>
 
 
@@ -24,10 +27,33 @@ class EntityRegistry;
  * multiple features or keypoints over time.
  *
  * For example, keypoints for multiple body points could be a PointData object
+ *
+ * Points are stored flat: all points live in one contiguous array ordered by
+ * time, and an offset table marks where each frame begins. Frame times are
+ * kept in a sorted array (sparse mode) and looked up by binary search. When
+ * the frames cover a contiguous run of times, the time array is dropped and
+ * frames are indexed directly from the first time (dense mode). The mode is
+ * chosen automatically as data is added and removed.
  */
 class PointData : public ObserverData {
 public:
 
+    /**
+     * @brief How frame times are stored
+     */
+    enum class StorageMode {
+        Dense, ///< Frames cover a contiguous run of times; lookup is O(1)
+        Sparse ///< Frame times are stored in a sorted array; lookup is O(log n)
+    };
+
+    /**
+     * @brief Points at one time, as returned by the range accessors
+     */
+    struct TimePointsPair {
+        TimeFrameIndex time;
+        std::span<Point2D<float> const> points;
+    };
+
     // ========== Constructors ==========
     /**
      * @brief Default constructor
@@ -71,6 +97,18 @@ public:
      */
     [[nodiscard]] bool clearAtTime(TimeFrameIndex time, size_t index, bool notify = true);
 
+    /**
+     * @brief Clear the points at several times in one pass
+     *
+     * Equivalent to calling clearAtTime for each time, but the storage is
+     * compacted once rather than once per time.
+     *
+     * @param times The times to clear; missing and repeated times are ignored
+     * @param notify If true, the observers will be notified once if anything was cleared
+     * @return The number of points removed
+     */
+    std::size_t clearAtTimes(std::span<TimeFrameIndex const> times, bool notify = true);
+
     /**
      * @brief Add a point at a specific time
      * 
@@ -170,39 +208,41 @@ public:
     /**
      * @brief Get all times with data
      * 
-     * Returns a view over the keys of the data map for zero-copy iteration.
+     * Returns a view over the stored frame times, in increasing order, for zero-copy iteration.
      * 
      * @return A view of TimeFrameIndex keys
      */
     [[nodiscard]] auto getTimesWithData() const {
-        return _data | std::views::keys;
+        return std::views::iota(size_t{0}, _frameCount())
+               | std::views::transform([this](size_t frame) { return _frameTime(frame); });
     }
 
     /**
      * @brief Get the points at a specific time
      * 
-     * If the time does not exist, an empty vector will be returned.
+     * If the time does not exist, an empty span will be returned. The span is
+     * invalidated by any modification of this PointData.
      * 
      * @param time The time to get the points at
-     * @return A vector of Point2D<float>
+     * @return A span of Point2D<float>
      */
-    [[nodiscard]] std::vector<Point2D<float>> const & getAtTime(TimeFrameIndex time) const;
+    [[nodiscard]] std::span<Point2D<float> const> getAtTime(TimeFrameIndex time) const;
 
     /**
      * @brief Get the points at a specific time with timeframe conversion
      * 
      * Converts the time index from the source timeframe to the target timeframe (this point data's timeframe)
      * and returns the points at the converted time. If the timeframes are the same, no conversion is performed.
-     * If the converted time does not exist, an empty vector will be returned.
+     * If the converted time does not exist, an empty span will be returned.
      * 
      * @param time The time index in the source timeframe
      * @param source_timeframe The timeframe that the time index is expressed in
      * @param target_timeframe The timeframe that this point data uses
-     * @return A vector of Point2D<float> at the converted time
+     * @return A span of Point2D<float> at the converted time
      */
-    [[nodiscard]] std::vector<Point2D<float>> const & getAtTime(TimeFrameIndex time, 
-                                                                TimeFrame const * source_timeframe,
-                                                                TimeFrame const * target_timeframe) const;
+    [[nodiscard]] std::span<Point2D<float> const> getAtTime(TimeFrameIndex time,
+                                                           TimeFrame const * source_timeframe,
+                                                           TimeFrame const * target_timeframe) const;
 
     /**
      * @brief Get the maximum number of points at any time
@@ -211,43 +251,45 @@ public:
      */
     [[nodiscard]] std::size_t getMaxPoints() const;
 
+    /**
+     * @brief Get the total number of points across all times
+     */
+    [[nodiscard]] std::size_t getTotalPointCount() const { return _points.size(); }
+
+    /**
+     * @brief Get how frame times are currently stored
+     */
+    [[nodiscard]] StorageMode getStorageMode() const { return _dense ? StorageMode::Dense : StorageMode::Sparse; }
+
     /**
     * @brief Get all points with their associated times as a range
     *
     * @return A view of time-points pairs for all times
     */
     [[nodiscard]] auto GetAllPointsAsRange() const {
-        struct TimePointsPair {
-            TimeFrameIndex time;
-            std::vector<Point2D<float>> const & points;
-        };
-
-        return _data | std::views::transform([](auto const & pair) {
-                   return TimePointsPair{TimeFrameIndex(pair.first), pair.second};
-               });
+        return std::views::iota(size_t{0}, _frameCount())
+               | std::views::transform([this](size_t frame) {
+                     return TimePointsPair{_frameTime(frame), _framePoints(frame)};
+                 });
     }
 
     /**
     * @brief Get points with their associated times as a range within a TimeFrameInterval
     *
-    * Returns a filtered view of time-points pairs for times within the specified interval [start, end] (inclusive).
+    * Returns a view of time-points pairs for times within the specified interval [start, end] (inclusive).
+    * The bounds of the interval are found by binary search.
     *
     * @param interval The TimeFrameInterval specifying the range [start, end] (inclusive)
     * @return A view of time-points pairs for times within the specified interval
     */
     [[nodiscard]] auto GetPointsInRange(TimeFrameInterval const & interval) const {
-        struct TimePointsPair {
-            TimeFrameIndex time;
-            std::vector<Point2D<float>> const & points;
-        };
-
-        return _data 
-            | std::views::filter([interval](auto const & pair) {
-                return pair.first >= interval.start && pair.first <= interval.end;
-              })
-            | std::views::transform([](auto const & pair) {
-                return TimePointsPair{pair.first, pair.second};
-              });
+        size_t const first = _lowerFrame(interval.start);
+        size_t const last = std::max(first, _lowerFrame(TimeFrameIndex(interval.end.getValue() + 1)));
+
+        return std::views::iota(first, last)
+               | std::views::transform([this](size_t frame) {
+                     return TimePointsPair{_frameTime(frame), _framePoints(frame)};
+                 });
     }
 
     /**
@@ -281,8 +323,8 @@ public:
         auto end_time_value = source_timeframe->getTimeAtIndex(interval.end);
 
         // 2. Convert those time values to indices in the point timeframe
-        auto target_start_index = point_timeframe->getIndexAtTime(static_cast<float>(start_time_value), false);
-        auto target_end_index = point_timeframe->getIndexAtTime(static_cast<float>(end_time_value));
+        auto target_start_index = point_timeframe->getIndexAtTime(static_cast<double>(start_time_value), false);
+        auto target_end_index = point_timeframe->getIndexAtTime(static_cast<double>(end_time_value));
 
         // 3. Create converted interval and use the original function
         TimeFrameInterval target_interval{target_start_index, target_end_index};
@@ -370,7 +412,7 @@ public:
     /**
      * @brief Get EntityIds aligned with points at a specific time.
      */
-    [[nodiscard]] std::vector<EntityId> const & getEntityIdsAtTime(TimeFrameIndex time) const;
+    [[nodiscard]] std::span<EntityId const> getEntityIdsAtTime(TimeFrameIndex time) const;
 
     /**
      * @brief Get flattened EntityIds for all points across all times.
@@ -379,15 +421,58 @@ public:
 
 protected:
 private:
-    std::map<TimeFrameIndex, std::vector<Point2D<float>>> _data;
-    std::vector<Point2D<float>> _empty{};
+    // Frame i holds _points[_offsets[i], _offsets[i + 1]) at time _frameTime(i)
+    std::vector<TimeFrameIndex> _times;///< Sorted frame times; empty in dense mode
+    std::vector<std::size_t> _offsets{0};
+    std::vector<Point2D<float>> _points;
+    std::vector<EntityId> _entity_ids;///< Aligned with _points
+    bool _dense{true};
+    int64_t _dense_origin{0};///< Time of frame 0 in dense mode
+
     ImageSize _image_size;
     std::shared_ptr<TimeFrame> _time_frame {nullptr};
 
     // Identity management
     std::string _identity_data_key;
     EntityRegistry * _identity_registry {nullptr};
-    std::map<TimeFrameIndex, std::vector<EntityId>> _entity_ids_by_time;
+
+    [[nodiscard]] std::size_t _frameCount() const { return _offsets.size() - 1; }
+
+    [[nodiscard]] TimeFrameIndex _frameTime(std::size_t frame) const {
+        return _dense ? TimeFrameIndex(_dense_origin + static_cast<int64_t>(frame)) : _times[frame];
+    }
+
+    [[nodiscard]] std::span<Point2D<float> const> _framePoints(std::size_t frame) const {
+        return std::span<Point2D<float> const>(_points).subspan(_offsets[frame], _offsets[frame + 1] - _offsets[frame]);
+    }
+
+    /// Index of the first frame whose time is not less than @p time
+    [[nodiscard]] std::size_t _lowerFrame(TimeFrameIndex time) const;
+
+    /// Index of the frame at @p time, or _frameCount() if there is none
+    [[nodiscard]] std::size_t _findFrame(TimeFrameIndex time) const;
+
+    /// Index of the frame at @p time, inserting an empty frame if there is none
+    std::size_t _ensureFrame(TimeFrameIndex time);
+
+    /// Remove the given frames (sorted, unique) and their points in one pass
+    void _eraseFrames(std::vector<std::size_t> const & frames);
+
+    /// Replace points [begin, end) of the flat arrays, shifting the offsets of later frames
+    void _replacePoints(std::size_t frame,
+                        std::size_t begin,
+                        std::size_t end,
+                        std::span<Point2D<float> const> points,
+                        std::span<EntityId const> ids);
+
+    void _appendPoints(TimeFrameIndex time, std::span<Point2D<float> const> points);
+    void _overwritePoints(TimeFrameIndex time, std::span<Point2D<float> const> points);
+
+    /// Leave dense mode by storing the frame times explicitly
+    void _materializeTimes();
+
+    /// Switch to dense mode if the sparse frame times have become contiguous
+    void _updateStorageMode();
 };
 
 #endif// POINT_DATA_HPP
@@ -69,6 +69,32 @@ TEST_CASE("DM - PointData - Core functionality", "[points][data][core]") {
         REQUIRE(points_at_20.size() == 1);
     }
 
+    SECTION("Clearing points at several times") {
+        for (int t = 0; t < 10; ++t) {
+            point_data.addPointsAtTime(TimeFrameIndex(t * 10), points);
+        }
+
+        // Missing and repeated times are ignored
+        std::vector<TimeFrameIndex> const times{TimeFrameIndex(70), TimeFrameIndex(10), TimeFrameIndex(15),
+                                                TimeFrameIndex(40), TimeFrameIndex(10)};
+        REQUIRE(point_data.clearAtTimes(times) == 6);
+
+        std::vector<TimeFrameIndex> remaining_times;
+        for (auto const time: point_data.getTimesWithData()) {
+            remaining_times.push_back(time);
+        }
+        REQUIRE(remaining_times == std::vector<TimeFrameIndex>{TimeFrameIndex(0), TimeFrameIndex(20), TimeFrameIndex(30),
+                                                               TimeFrameIndex(50), TimeFrameIndex(60), TimeFrameIndex(80),
+                                                               TimeFrameIndex(90)});
+        for (auto const time: remaining_times) {
+            auto const points_at_time = point_data.getAtTime(time);
+            REQUIRE(points_at_time.size() == 2);
+            REQUIRE(points_at_time[1].x == Catch::Approx(3.0f));
+        }
+
+        REQUIRE(point_data.clearAtTimes(times) == 0);
+    }
+
     SECTION("GetAllPointsAsRange functionality") {
         point_data.addPointsAtTime(TimeFrameIndex(10), points);
         point_data.addPointsAtTime(TimeFrameIndex(20), more_points);
@@ -802,3 +828,89 @@ TEST_CASE("PointData - Timeframe conversion", "[points][data][timeframe]") {
         // The exact behavior would depend on the TimeFrame implementation
     }
 }
+
+TEST_CASE("DM - PointData - Flat storage modes", "[points][data][storage]") {
+    PointData point_data;
+
+    SECTION("Contiguous times use dense storage") {
+        for (int64_t t = 100; t < 110; ++t) {
+            point_data.addAtTime(TimeFrameIndex(t), Point2D<float>{static_cast<float>(t), 0.0f}, false);
+        }
+        // Prepending directly before the first time stays dense
+        point_data.addAtTime(TimeFrameIndex(99), Point2D<float>{99.0f, 0.0f}, false);
+
+        REQUIRE(point_data.getStorageMode() == PointData::StorageMode::Dense);
+        REQUIRE(point_data.getTimesWithData().size() == 11);
+        REQUIRE(point_data.getAtTime(TimeFrameIndex(99))[0].x == Catch::Approx(99.0f));
+        REQUIRE(point_data.getAtTime(TimeFrameIndex(105))[0].x == Catch::Approx(105.0f));
+        REQUIRE(point_data.getAtTime(TimeFrameIndex(98)).empty());
+        REQUIRE(point_data.getAtTime(TimeFrameIndex(110)).empty());
+    }
+
+    SECTION("Gaps switch to sparse storage and filling them switches back") {
+        point_data.addAtTime(TimeFrameIndex(10), Point2D<float>{1.0f, 1.0f}, false);
+        point_data.addAtTime(TimeFrameIndex(12), Point2D<float>{3.0f, 3.0f}, false);
+        REQUIRE(point_data.getStorageMode() == PointData::StorageMode::Sparse);
+
+        point_data.addAtTime(TimeFrameIndex(11), Point2D<float>{2.0f, 2.0f}, false);
+        REQUIRE(point_data.getStorageMode() == PointData::StorageMode::Dense);
+
+        static_cast<void>(point_data.clearAtTime(TimeFrameIndex(11), false));
+        REQUIRE(point_data.getStorageMode() == PointData::StorageMode::Sparse);
+        REQUIRE(point_data.getAtTime(TimeFrameIndex(12))[0].x == Catch::Approx(3.0f));
+
+        static_cast<void>(point_data.clearAtTime(TimeFrameIndex(12), false));
+        REQUIRE(point_data.getStorageMode() == PointData::StorageMode::Dense);
+        REQUIRE(point_data.getTimesWithData().size() == 1);
+    }
+
+    SECTION("Out of order inserts keep frames sorted by time") {
+        point_data.addPointsAtTime(TimeFrameIndex(50), {{5.0f, 0.0f}}, false);
+        point_data.addPointsAtTime(TimeFrameIndex(10), {{1.0f, 0.0f}, {1.5f, 0.0f}}, false);
+        point_data.addPointsAtTime(TimeFrameIndex(30), {{3.0f, 0.0f}}, false);
+        point_data.addAtTime(TimeFrameIndex(10), Point2D<float>{1.75f, 0.0f}, false);
+
+        std::vector<int64_t> times;
+        std::vector<float> xs;
+        for (auto const & [time, points]: point_data.GetAllPointsAsRange()) {
+            times.push_back(time.getValue());
+            for (auto const & point: points) {
+                xs.push_back(point.x);
+            }
+        }
+
+        REQUIRE(times == std::vector<int64_t>{10, 30, 50});
+        REQUIRE(xs == std::vector<float>{1.0f, 1.5f, 1.75f, 3.0f, 5.0f});
+        REQUIRE(point_data.getTotalPointCount() == 5);
+        REQUIRE(point_data.getMaxPoints() == 3);
+    }
+
+    SECTION("Range queries on sparse storage include both ends") {
+        for (int64_t t = 0; t < 100; t += 10) {
+            point_data.addAtTime(TimeFrameIndex(t), Point2D<float>{static_cast<float>(t), 0.0f}, false);
+        }
+
+        std::vector<int64_t> times;
+        for (auto const & pair: point_data.GetPointsInRange(TimeFrameInterval(TimeFrameIndex(15), TimeFrameIndex(50)))) {
+            times.push_back(pair.time.getValue());
+        }
+        REQUIRE(times == std::vector<int64_t>{20, 30, 40, 50});
+
+        auto empty_range = point_data.GetPointsInRange(TimeFrameInterval(TimeFrameIndex(41), TimeFrameIndex(49)));
+        REQUIRE(empty_range.empty());
+    }
+
+    SECTION("Overwriting and clearing by index keep entity ids aligned") {
+        point_data.addPointsAtTime(TimeFrameIndex(1), {{1.0f, 0.0f}, {2.0f, 0.0f}}, false);
+        point_data.addPointsAtTime(TimeFrameIndex(2), {{3.0f, 0.0f}}, false);
+        point_data.overwritePointsAtTime(TimeFrameIndex(1), {{4.0f, 0.0f}, {5.0f, 0.0f}, {6.0f, 0.0f}}, false);
+        static_cast<void>(point_data.clearAtTime(TimeFrameIndex(1), 0, false));
+
+        auto const points = point_data.getAtTime(TimeFrameIndex(1));
+        REQUIRE(points.size() == 2);
+        REQUIRE(points[0].x == Catch::Approx(5.0f));
+        REQUIRE(point_data.getEntityIdsAtTime(TimeFrameIndex(1)).size() == 2);
+        REQUIRE(point_data.getAtTime(TimeFrameIndex(2))[0].x == Catch::Approx(3.0f));
+        REQUIRE(point_data.getAllEntityIds().size() == 3);
+    }
+}
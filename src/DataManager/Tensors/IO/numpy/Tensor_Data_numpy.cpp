@@ -1,47 +1,78 @@
 
 #include "Tensor_Data_numpy.hpp"
 #include "../../Tensor_Data.hpp"
-#include "npy.hpp"
+#include "Tracing/Tracing.hpp"
+#include "loaders/Npy_Reader.hpp"
 
+#include <bit>
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <functional>
 #include <iostream>
-#include <algorithm>
+#include <numeric>
 
-#if defined(_WIN32) || defined(__APPLE__)
-std::vector<long long> convertShape(const std::vector<unsigned long>& shape) {
-    std::vector<long long> convertedShape(shape.size());
-    std::transform(shape.begin(), shape.end(), convertedShape.begin(), [](unsigned long i) { return static_cast<long long>(i); });
-    return convertedShape;
+namespace {
+
+/**
+ * @brief Path of the optional frame-time file next to a tensor .npy file
+ *
+ * "features.npy" keeps its frame times in "features.times.npy" when they are
+ * not simply 0..T-1.
+ */
+std::filesystem::path times_path_for(std::string const & filepath) {
+    std::filesystem::path path(filepath);
+    path.replace_extension(".times.npy");
+    return path;
 }
-#else
-std::vector<long> convertShape(const std::vector<unsigned long>& shape) {
-    std::vector<long> convertedShape(shape.size());
-    std::transform(shape.begin(), shape.end(), convertedShape.begin(), [](unsigned long i) { return static_cast<long>(i); });
-    return convertedShape;
+
+/**
+ * @brief Write a version 1.0 .npy header
+ *
+ * The header is padded so that the data starts on a 64-byte boundary, which
+ * lets the file be memory-mapped and the data viewed in place.
+ */
+void write_npy_header(std::ostream & out, std::string const & descr, std::vector<std::size_t> const & shape) {
+    std::string header = "{'descr': '" + descr + "', 'fortran_order': False, 'shape': (";
+    for (std::size_t const dim : shape) {
+        header += std::to_string(dim) + ", ";
+    }
+    header += "), }";
+
+    std::size_t const preamble = 10;// magic string, version and header length
+    std::size_t const unpadded = preamble + header.size() + 1;
+    std::size_t const padded = (unpadded + 63) / 64 * 64;
+    header.append(padded - unpadded, ' ');
+    header += '\n';
+
+    auto const header_length = static_cast<uint16_t>(header.size());
+    out.write("\x93NUMPY", 6);
+    out.put(1);
+    out.put(0);
+    out.put(static_cast<char>(header_length & 0xFF));
+    out.put(static_cast<char>(header_length >> 8));
+    out.write(header.data(), static_cast<std::streamsize>(header.size()));
 }
-#endif
 
-void loadNpyToTensorData(const std::string& filepath, TensorData& tensor_data) {
+std::string native_descr(char kind, std::size_t size) {
+    char const byte_order = std::endian::native == std::endian::little ? '<' : '>';
+    return std::string{byte_order, kind} + std::to_string(size);
+}
+
+}// namespace
+
+void loadNpyToTensorData(std::string const & filepath, TensorData & tensor_data, std::string const & array_name) {
+    TRACE_ZONE_NAMED(zone, "load numpy tensor", "loader", filepath);
+
     if (!std::filesystem::exists(filepath)) {
         std::cout << "File does not exist: " << filepath << std::endl;
         return;
     }
 
     try {
-        auto npy_data = npy::read_npy<float>(filepath);
-
-        std::cout << "Loaded numpy tensor with shape: ";
-        for (size_t i = 0; i < npy_data.shape.size(); ++i) {
-            std::cout << npy_data.shape[i];
-            if (i < npy_data.shape.size() - 1) std::cout << "x";
-        }
-        std::cout << std::endl;
-
-        // Convert shape to size_t vector
-        std::vector<std::size_t> full_shape;
-        for (unsigned long dim : npy_data.shape) {
-            full_shape.push_back(static_cast<std::size_t>(dim));
-        }
+        // Only the header is read here; the data stays in the mapped file
+        auto const array = Loader::NpyArray::open(filepath, array_name);
+        auto const & full_shape = array.shape();
 
         if (full_shape.empty()) {
             std::cout << "Empty tensor shape" << std::endl;
@@ -50,43 +81,101 @@ void loadNpyToTensorData(const std::string& filepath, TensorData& tensor_data) {
 
         // Assuming the tensor is a multi-dimensional tensor where the first dimension is time
         auto const time_steps = full_shape[0];
-        
-        // Calculate the size of each time slice
-        std::size_t slice_size = 1;
-        std::vector<std::size_t> feature_shape;
-        for (std::size_t i = 1; i < full_shape.size(); ++i) {
-            slice_size *= full_shape[i];
-            feature_shape.push_back(full_shape[i]);
-        }
+        std::vector<std::size_t> const feature_shape(full_shape.begin() + 1, full_shape.end());
 
-        // Set the feature shape
-        tensor_data.setFeatureShape(feature_shape);
-
-        // Extract data for each time step
-        for (std::size_t t = 0; t < time_steps; ++t) {
-            // Extract slice data for this time step
-            std::vector<float> slice_data;
-            slice_data.reserve(slice_size);
-            
-            std::size_t start_idx = t * slice_size;
-            std::size_t end_idx = start_idx + slice_size;
-            
-            for (std::size_t i = start_idx; i < end_idx && i < npy_data.data.size(); ++i) {
-                slice_data.push_back(npy_data.data[i]);
+        // Frame t is at time t unless a frame-time file says otherwise
+        std::vector<TimeFrameIndex> times;
+        times.reserve(time_steps);
+        auto const times_path = times_path_for(filepath);
+        if (std::filesystem::exists(times_path)) {
+            auto const npy_times = Loader::NpyArray::openNpy(times_path.string()).toVector<int64_t>();
+            if (npy_times.size() == time_steps) {
+                for (int64_t const time : npy_times) {
+                    times.emplace_back(time);
+                }
+            } else {
+                std::cout << "Ignoring " << times_path << ": expected " << time_steps << " frame times" << std::endl;
+            }
+        }
+        if (times.empty()) {
+            for (std::size_t t = 0; t < time_steps; ++t) {
+                times.emplace_back(static_cast<int64_t>(t));
             }
-
-            // Add the slice to tensor data
-            tensor_data.addTensorAtTime(TimeFrameIndex(t), slice_data, feature_shape);
         }
 
-        std::cout << "Loaded " << time_steps << " timestamps of tensors with feature shape: ";
-        for (std::size_t i = 0; i < feature_shape.size(); ++i) {
-            std::cout << feature_shape[i];
-            if (i < feature_shape.size() - 1) std::cout << "x";
+        // Native float32 in C order is viewed in place; anything else is converted once
+        if (array.hasNativeType<float>() && (!array.fortranOrder() || full_shape.size() < 2)) {
+            tensor_data.setContiguousData(std::move(times), array.view<float>(), array.owner(), feature_shape);
+        } else {
+            std::cout << "Converting numpy tensor to float32 C order" << std::endl;
+            tensor_data.setContiguousData(std::move(times), array.toVector<float>(), feature_shape);
         }
-        std::cout << std::endl;
+
+        TRACE_ZONE_VALUE(zone, "timestamps", time_steps);
+        TRACE_ZONE_VALUE(zone, "features", std::accumulate(feature_shape.begin(), feature_shape.end(), std::size_t{1}, std::multiplies<>()));
 
     } catch (const std::exception& e) {
         std::cout << "Error loading tensor from file: " << e.what() << std::endl;
     }
 }
+
+bool saveTensorDataToNpy(std::string const & filepath, TensorData const & tensor_data) {
+    auto const feature_shape = tensor_data.getFeatureShape();
+    std::size_t const frame_size = std::accumulate(feature_shape.begin(), feature_shape.end(),
+                                                   std::size_t{1}, std::multiplies<>());
+    auto const times = tensor_data.getTimesWithTensors();
+
+    std::ofstream out(filepath, std::ios::binary);
+    if (!out) {
+        std::cout << "Could not open " << filepath << " for writing" << std::endl;
+        return false;
+    }
+
+    std::vector<std::size_t> full_shape{times.size()};
+    full_shape.insert(full_shape.end(), feature_shape.begin(), feature_shape.end());
+    write_npy_header(out, native_descr('f', sizeof(float)), full_shape);
+
+    if (tensor_data.isContiguous() && !times.empty()) {
+        auto const range = tensor_data.getTensorRange(times.front(), times.back());
+        out.write(reinterpret_cast<char const *>(range.values.data()),
+                  static_cast<std::streamsize>(range.values.size_bytes()));
+    } else {
+        for (auto const time : times) {
+            auto const frame = tensor_data.getTensorDataAtTime(time);
+            if (frame.size() != frame_size) {
+                std::cout << "Tensor at time " << time.getValue() << " does not match the feature shape" << std::endl;
+                return false;
+            }
+            out.write(reinterpret_cast<char const *>(frame.data()),
+                      static_cast<std::streamsize>(frame.size() * sizeof(float)));
+        }
+    }
+    if (!out) {
+        std::cout << "Error writing " << filepath << std::endl;
+        return false;
+    }
+
+    // Frame times only need a file of their own when they are not 0..T-1
+    bool dense_times = true;
+    for (std::size_t t = 0; t < times.size() && dense_times; ++t) {
+        dense_times = times[t].getValue() == static_cast<int64_t>(t);
+    }
+    auto const times_path = times_path_for(filepath);
+    if (dense_times) {
+        std::error_code ignored;
+        std::filesystem::remove(times_path, ignored);// a stale one would override the dense times
+        return true;
+    }
+
+    std::ofstream times_out(times_path, std::ios::binary);
+    write_npy_header(times_out, native_descr('i', sizeof(int64_t)), {times.size()});
+    for (auto const time : times) {
+        int64_t const value = time.getValue();
+        times_out.write(reinterpret_cast<char const *>(&value), sizeof(value));
+    }
+    if (!times_out) {
+        std::cout << "Error writing " << times_path << std::endl;
+        return false;
+    }
+    return true;
+}
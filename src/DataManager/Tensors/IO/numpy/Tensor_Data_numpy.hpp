@@ -7,9 +7,28 @@ class TensorData;
 
 /**
  * @brief Load numpy data into TensorData
- * @param filepath Path to the .npy file
+ *
+ * The file is memory-mapped. A float32 array in native byte order and C order
+ * is viewed in place, so opening it does not read the data; other dtypes and
+ * Fortran-ordered arrays are converted to float32 once.
+ *
+ * @param filepath Path to the .npy file, or to an .npz archive written by numpy.savez
  * @param tensor_data TensorData instance to load into
+ * @param array_name Array to load from an .npz archive; empty for its first array
  */
-void loadNpyToTensorData(std::string const & filepath, TensorData & tensor_data);
+void loadNpyToTensorData(std::string const & filepath, TensorData & tensor_data, std::string const & array_name = "");
+
+/**
+ * @brief Save TensorData as a [T, ...feature_shape] float32 .npy file
+ *
+ * The data starts on a 64-byte boundary, so the file can be memory-mapped and
+ * viewed in place. If the frame times are not 0..T-1 they are written to
+ * "<name>.times.npy" next to it, which loadNpyToTensorData() picks up.
+ *
+ * @param filepath Path of the .npy file to write
+ * @param tensor_data Tensors to save; every frame must match the feature shape
+ * @return True on success
+ */
+bool saveTensorDataToNpy(std::string const & filepath, TensorData const & tensor_data);
 
 #endif//WHISKERTOOLBOX_TENSOR_DATA_NUMPY_HPP
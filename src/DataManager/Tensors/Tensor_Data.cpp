@@ -1,57 +1,95 @@
 #include "Tensor_Data.hpp"
 
-#include <filesystem>
-
-// ========== Setters ==========
-
-void TensorData::addTensorAtTime(TimeFrameIndex time, torch::Tensor const & tensor) {
-    _data[time] = tensor;
-    notifyObservers();
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+
+// Backend-independent part of TensorData: the contiguous storage mode.
+// Per-frame storage lives in Tensor_Data_Armadillo.cpp / Tensor_Data_LibTorch.cpp.
+
+// ========== Contiguous Setters ==========
+
+void TensorData::setContiguousData(std::vector<TimeFrameIndex> times,
+                                   std::vector<float> values,
+                                   std::vector<std::size_t> const & feature_shape) {
+    auto owned = std::make_shared<std::vector<float> const>(std::move(values));
+    std::span<float const> const view(*owned);
+    setContiguousData(std::move(times), view, std::move(owned), feature_shape);
 }
 
-void TensorData::overwriteTensorAtTime(TimeFrameIndex time, torch::Tensor const & tensor) {
-    _data[time] = tensor;
+void TensorData::setContiguousData(std::vector<TimeFrameIndex> times,
+                                   std::span<float const> values,
+                                   std::shared_ptr<void const> owner,
+                                   std::vector<std::size_t> const & feature_shape) {
+    std::size_t const frame_size = std::accumulate(feature_shape.begin(), feature_shape.end(),
+                                                   std::size_t{1}, std::multiplies<>());
+    if (values.size() != times.size() * frame_size) {
+        throw std::invalid_argument("Contiguous tensor data size does not match the times and feature shape");
+    }
+    if (std::adjacent_find(times.begin(), times.end(), std::greater_equal<>()) != times.end()) {
+        throw std::invalid_argument("Contiguous tensor times must be strictly increasing");
+    }
+
+    _data.clear();
+    _feature_shape = feature_shape;
+    _contiguous = true;
+    _contiguous_times = std::move(times);
+    _contiguous_values = values;
+    _contiguous_owner = std::move(owner);
     notifyObservers();
 }
 
-// ========== Getters ==========
+// ========== Contiguous Getters ==========
 
-torch::Tensor TensorData::getTensorAtTime(TimeFrameIndex time) const {
-    if (_data.find(time) != _data.end()) {
-        return _data.at(time);
+std::span<float const> TensorData::getTensorViewAtTime(TimeFrameIndex time) const {
+    auto const frame = _findContiguousFrame(time);
+    if (!frame.has_value()) {
+        return {};
     }
-    return torch::Tensor{};
+    return _contiguousFrame(frame.value());
 }
 
-std::vector<TimeFrameIndex> TensorData::getTimesWithTensors() const {
-    std::vector<TimeFrameIndex> times;
-    times.reserve(_data.size());
-    for (const auto& [time, tensor] : _data) {
-        times.push_back(time);
+TensorData::TensorRange TensorData::getTensorRange(TimeFrameIndex start, TimeFrameIndex end) const {
+    if (!_contiguous || end < start) {
+        return {};
     }
-    return times;
+    auto const first = std::lower_bound(_contiguous_times.begin(), _contiguous_times.end(), start);
+    auto const last = std::upper_bound(first, _contiguous_times.end(), end);
+
+    auto const first_frame = static_cast<std::size_t>(first - _contiguous_times.begin());
+    auto const n_frames = static_cast<std::size_t>(last - first);
+    auto const frame_size = _frameSize();
+    return TensorRange{
+            .times = std::span<TimeFrameIndex const>(_contiguous_times).subspan(first_frame, n_frames),
+            .values = _contiguous_values.subspan(first_frame * frame_size, n_frames * frame_size)};
 }
 
-std::vector<float> TensorData::getChannelSlice(TimeFrameIndex time, int channel) const
-{
-
-    torch::Tensor const tensor = getTensorAtTime(time);
-
-    //std::cout << "Tensor at time " << time << " with " << tensor.numel() << " elements" << std::endl;
+// ========== Private Helper Methods ==========
 
-    auto sub_tensor = tensor.index({
-                                    torch::indexing::Slice(),
-                                    torch::indexing::Slice(),
-                                    channel});
-
-    // Apply sigmoid
-    sub_tensor = torch::sigmoid(sub_tensor);
-
-    //std::cout << "Sub tensor with" << sub_tensor.numel() << " elements " << std::endl;
+std::size_t TensorData::_frameSize() const {
+    return std::accumulate(_feature_shape.begin(), _feature_shape.end(), std::size_t{1}, std::multiplies<>());
+}
 
-    std::vector<float> vec(sub_tensor.data_ptr<float>(), sub_tensor.data_ptr<float>() + sub_tensor.numel());
+std::span<float const> TensorData::_contiguousFrame(std::size_t frame) const {
+    auto const frame_size = _frameSize();
+    return _contiguous_values.subspan(frame * frame_size, frame_size);
+}
 
-    //std::cout << "Tensor data has " << vec.size() << " elements" << std::endl;
+std::optional<std::size_t> TensorData::_findContiguousFrame(TimeFrameIndex time) const {
+    if (!_contiguous) {
+        return std::nullopt;
+    }
+    auto const it = std::lower_bound(_contiguous_times.begin(), _contiguous_times.end(), time);
+    if (it == _contiguous_times.end() || *it != time) {
+        return std::nullopt;
+    }
+    return static_cast<std::size_t>(it - _contiguous_times.begin());
+}
 
-    return vec;
-}
\ No newline at end of file
+void TensorData::_clearContiguous() {
+    _contiguous = false;
+    _contiguous_times.clear();
+    _contiguous_values = {};
+    _contiguous_owner.reset();
+}
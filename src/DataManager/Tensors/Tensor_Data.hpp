@@ -11,14 +11,23 @@
 #endif
 
 #include <map>
-#include <vector>
 #include <memory>
+#include <optional>
+#include <span>
+#include <vector>
 
 /**
  * @brief TensorData class with configurable backend implementations
  * 
  * This class provides tensor storage and operations with different backends
  * selected at compile time (LibTorch or Armadillo).
+ *
+ * Tensors are stored either one per frame in a map, or as one contiguous
+ * [T, ...feature_shape] block with a sorted time index (see
+ * setContiguousData()). The contiguous mode gives zero-copy per-frame views
+ * and range slices, and can view memory owned elsewhere, such as a
+ * memory-mapped .npy file. Adding or overwriting a single tensor converts
+ * contiguous storage back to per-frame storage.
  */
 class TensorData : public ObserverData {
 public:
@@ -72,8 +81,72 @@ public:
      */
     void overwriteTensorAtTime(TimeFrameIndex time, const std::vector<float>& data, const std::vector<std::size_t>& shape);
 
+    /**
+     * @brief Replace all tensors with one contiguous block
+     *
+     * Frame i occupies values [i * frame_size, (i + 1) * frame_size), where
+     * frame_size is the product of @p feature_shape, and belongs to times[i].
+     * Each frame is laid out in the same order as the flat vectors taken by
+     * addTensorAtTime().
+     *
+     * @param times Strictly increasing time of each frame
+     * @param values times.size() * frame_size values
+     * @param feature_shape Shape of one frame
+     * @throws std::invalid_argument if the sizes do not match or the times are not increasing
+     */
+    void setContiguousData(std::vector<TimeFrameIndex> times,
+                           std::vector<float> values,
+                           std::vector<std::size_t> const & feature_shape);
+
+    /**
+     * @brief Replace all tensors with a contiguous block owned elsewhere
+     *
+     * Same as above, but @p values is viewed in place. @p owner keeps the
+     * memory alive for as long as this object (or a tensor view handed out by
+     * it) uses it.
+     */
+    void setContiguousData(std::vector<TimeFrameIndex> times,
+                           std::span<float const> values,
+                           std::shared_ptr<void const> owner,
+                           std::vector<std::size_t> const & feature_shape);
+
     // ========== Getters ==========
 
+    /**
+     * @brief Whether tensors are stored as one contiguous block
+     */
+    [[nodiscard]] bool isContiguous() const { return _contiguous; }
+
+    /**
+     * @brief Zero-copy view of the tensor at a specific time
+     *
+     * Only available in contiguous mode. The view stays valid until the
+     * tensors are modified.
+     *
+     * @param time The time to get the tensor at
+     * @return Flat view of the frame, empty if there is no frame at @p time or the storage is per-frame
+     */
+    [[nodiscard]] std::span<float const> getTensorViewAtTime(TimeFrameIndex time) const;
+
+    /**
+     * @brief Frames in a time range of contiguous storage
+     */
+    struct TensorRange {
+        std::span<TimeFrameIndex const> times; ///< Time of each frame in the range
+        std::span<float const> values;         ///< times.size() frames, back to back
+    };
+
+    /**
+     * @brief Zero-copy view of every frame with a time in [start, end]
+     *
+     * Frames are sorted by time, so the range is a single block. Only
+     * available in contiguous mode.
+     *
+     * @return The frames in range; empty if none or the storage is per-frame
+     */
+    [[nodiscard]] TensorRange getTensorRange(TimeFrameIndex start, TimeFrameIndex end) const;
+
+
 #ifdef TENSOR_BACKEND_LIBTORCH
     /**
      * @brief Get tensor at a specific time (LibTorch version)
@@ -82,9 +155,19 @@ public:
      */
     [[nodiscard]] torch::Tensor getTensorAtTime(TimeFrameIndex time) const;
 
+    /**
+     * @brief Frames with a time in [start, end] as one [n, ...feature_shape] tensor
+     *
+     * In contiguous mode this is a view of the storage without copying; the
+     * view must not be written to. Per-frame storage is stacked into a new tensor.
+     *
+     * @return The stacked frames, undefined if there are none
+     */
+    [[nodiscard]] torch::Tensor getTensorsInRange(TimeFrameIndex start, TimeFrameIndex end) const;
+
     /**
      * @brief Get direct access to internal data (LibTorch version)
-     * @return Reference to internal tensor map
+     * @return Reference to internal tensor map; empty in contiguous mode
      */
     [[nodiscard]] std::map<TimeFrameIndex, torch::Tensor> const & getData() const;
 #endif
@@ -158,6 +241,19 @@ private:
     std::vector<std::size_t> _feature_shape;
     std::shared_ptr<TimeFrame> _time_frame {nullptr};
 
+    // Contiguous storage: frame i is _contiguous_values[i * _frameSize(), (i + 1) * _frameSize())
+    bool _contiguous{false};
+    std::vector<TimeFrameIndex> _contiguous_times;
+    std::span<float const> _contiguous_values;
+    std::shared_ptr<void const> _contiguous_owner;
+
+    [[nodiscard]] std::size_t _frameSize() const;
+    [[nodiscard]] std::span<float const> _contiguousFrame(std::size_t frame) const;
+    [[nodiscard]] std::optional<std::size_t> _findContiguousFrame(TimeFrameIndex time) const;
+    void _clearContiguous();
+    // Moves contiguous frames into the per-frame map so single tensors can be modified
+    void _convertToFrameStorage();
+
 #ifndef TENSOR_BACKEND_LIBTORCH
     // Helper methods for Armadillo backend
     arma::fcube vectorToCube(const std::vector<float>& data, const std::vector<std::size_t>& shape) const;
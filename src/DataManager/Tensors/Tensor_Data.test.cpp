@@ -0,0 +1,132 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "Tensors/Tensor_Data.hpp"
+#include "Tensors/IO/numpy/Tensor_Data_numpy.hpp"
+
+#include <cmath>
+#include <filesystem>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+// Three 2x2x2 frames at times 10, 20 and 30 holding 0..23
+TensorData make_contiguous_tensor_data() {
+    std::vector<float> values(24);
+    std::iota(values.begin(), values.end(), 0.0f);
+
+    TensorData tensor_data;
+    tensor_data.setContiguousData({TimeFrameIndex(10), TimeFrameIndex(20), TimeFrameIndex(30)},
+                                  std::move(values), {2, 2, 2});
+    return tensor_data;
+}
+
+}// namespace
+
+TEST_CASE("TensorData - Contiguous storage", "[DataManager][TensorData]") {
+    auto tensor_data = make_contiguous_tensor_data();
+
+    SECTION("Frames are viewed in place") {
+        REQUIRE(tensor_data.isContiguous());
+        REQUIRE(tensor_data.size() == 3);
+        REQUIRE(tensor_data.getTimesWithTensors() == std::vector<TimeFrameIndex>{TimeFrameIndex(10), TimeFrameIndex(20), TimeFrameIndex(30)});
+
+        auto const first = tensor_data.getTensorViewAtTime(TimeFrameIndex(10));
+        auto const second = tensor_data.getTensorViewAtTime(TimeFrameIndex(20));
+        REQUIRE(first.size() == 8);
+        REQUIRE(second.data() == first.data() + 8);
+        REQUIRE(second[0] == 8.0f);
+
+        REQUIRE(tensor_data.getTensorViewAtTime(TimeFrameIndex(15)).empty());
+        REQUIRE(tensor_data.getTensorDataAtTime(TimeFrameIndex(30)) == std::vector<float>{16, 17, 18, 19, 20, 21, 22, 23});
+        REQUIRE(tensor_data.getTensorShapeAtTime(TimeFrameIndex(20)) == std::vector<std::size_t>{2, 2, 2});
+        REQUIRE(tensor_data.getTensorShapeAtTime(TimeFrameIndex(21)).empty());
+    }
+
+    SECTION("Time ranges are a single block") {
+        auto const range = tensor_data.getTensorRange(TimeFrameIndex(15), TimeFrameIndex(30));
+        REQUIRE(range.times.size() == 2);
+        REQUIRE(range.times[0] == TimeFrameIndex(20));
+        REQUIRE(range.values.size() == 16);
+        REQUIRE(range.values.front() == 8.0f);
+        REQUIRE(range.values.back() == 23.0f);
+
+        REQUIRE(tensor_data.getTensorRange(TimeFrameIndex(31), TimeFrameIndex(40)).times.empty());
+        REQUIRE(tensor_data.getTensorRange(TimeFrameIndex(30), TimeFrameIndex(10)).values.empty());
+    }
+
+    SECTION("Channel slices match per-frame storage") {
+        TensorData per_frame;
+        per_frame.setFeatureShape({2, 2, 2});
+        for (auto const time: tensor_data.getTimesWithTensors()) {
+            per_frame.addTensorAtTime(time, tensor_data.getTensorDataAtTime(time), {2, 2, 2});
+        }
+        REQUIRE_FALSE(per_frame.isContiguous());
+
+        for (int channel = 0; channel < 2; ++channel) {
+            auto const expected = per_frame.getChannelSlice(TimeFrameIndex(20), channel);
+            auto const actual = tensor_data.getChannelSlice(TimeFrameIndex(20), channel);
+            REQUIRE(actual.size() == expected.size());
+            for (std::size_t i = 0; i < actual.size(); ++i) {
+                REQUIRE_THAT(actual[i], Catch::Matchers::WithinRel(expected[i], 1e-6f));
+            }
+        }
+        REQUIRE(tensor_data.getChannelSlice(TimeFrameIndex(20), 2).empty());
+    }
+
+    SECTION("Adding a tensor converts to per-frame storage") {
+        tensor_data.addTensorAtTime(TimeFrameIndex(25), std::vector<float>(8, -1.0f), {2, 2, 2});
+
+        REQUIRE_FALSE(tensor_data.isContiguous());
+        REQUIRE(tensor_data.size() == 4);
+        REQUIRE(tensor_data.getTensorViewAtTime(TimeFrameIndex(20)).empty());
+        REQUIRE(tensor_data.getTensorDataAtTime(TimeFrameIndex(20))[0] == 8.0f);
+        REQUIRE(tensor_data.getTensorDataAtTime(TimeFrameIndex(25))[0] == -1.0f);
+    }
+
+    SECTION("Mismatched sizes and unsorted times are rejected") {
+        TensorData bad;
+        REQUIRE_THROWS_AS(bad.setContiguousData({TimeFrameIndex(0)}, std::vector<float>(7), {2, 2, 2}), std::invalid_argument);
+        REQUIRE_THROWS_AS(bad.setContiguousData({TimeFrameIndex(1), TimeFrameIndex(0)}, std::vector<float>(16), {2, 2, 2}), std::invalid_argument);
+    }
+}
+
+TEST_CASE("TensorData - numpy round trip", "[DataManager][TensorData]") {
+    auto const directory = std::filesystem::temp_directory_path() / "whiskertoolbox_tensor_npy_test";
+    std::filesystem::create_directories(directory);
+    auto const path = (directory / "features.npy").string();
+
+    SECTION("Sparse frame times are kept next to the data") {
+        auto const original = make_contiguous_tensor_data();
+        REQUIRE(saveTensorDataToNpy(path, original));
+        REQUIRE(std::filesystem::exists(directory / "features.times.npy"));
+
+        // The data starts on a 64-byte boundary so the file can be mapped
+        auto const data_bytes = 24 * sizeof(float);
+        REQUIRE((std::filesystem::file_size(path) - data_bytes) % 64 == 0);
+
+        TensorData loaded;
+        loadNpyToTensorData(path, loaded);
+        REQUIRE(loaded.isContiguous());
+        REQUIRE(loaded.getFeatureShape() == std::vector<std::size_t>{2, 2, 2});
+        REQUIRE(loaded.getTimesWithTensors() == original.getTimesWithTensors());
+        REQUIRE(loaded.getTensorDataAtTime(TimeFrameIndex(30)) == original.getTensorDataAtTime(TimeFrameIndex(30)));
+    }
+
+    SECTION("Dense frame times need no extra file") {
+        TensorData per_frame;
+        per_frame.setFeatureShape({1, 2, 1});
+        per_frame.addTensorAtTime(TimeFrameIndex(0), {1.0f, 2.0f}, {1, 2, 1});
+        per_frame.addTensorAtTime(TimeFrameIndex(1), {3.0f, 4.0f}, {1, 2, 1});
+        REQUIRE(saveTensorDataToNpy(path, per_frame));
+        REQUIRE_FALSE(std::filesystem::exists(directory / "features.times.npy"));
+
+        TensorData loaded;
+        loadNpyToTensorData(path, loaded);
+        REQUIRE(loaded.size() == 2);
+        REQUIRE(loaded.getTensorDataAtTime(TimeFrameIndex(1)) == std::vector<float>{3.0f, 4.0f});
+    }
+
+    std::filesystem::remove_all(directory);
+}
@@ -8,12 +8,14 @@
 // ========== Generic Setters ==========
 
 void TensorData::addTensorAtTime(TimeFrameIndex time, const std::vector<float>& data, const std::vector<std::size_t>& shape) {
+    _convertToFrameStorage();
     arma::fcube cube = vectorToCube(data, shape);
     _data[time] = cube;
     notifyObservers();
 }
 
 void TensorData::overwriteTensorAtTime(TimeFrameIndex time, const std::vector<float>& data, const std::vector<std::size_t>& shape) {
+    _convertToFrameStorage();
     arma::fcube cube = vectorToCube(data, shape);
     _data[time] = cube;
     notifyObservers();
@@ -22,6 +24,10 @@ void TensorData::overwriteTensorAtTime(TimeFrameIndex time, const std::vector<fl
 // ========== Generic Getters ==========
 
 std::vector<float> TensorData::getTensorDataAtTime(TimeFrameIndex time) const {
+    if (_contiguous) {
+        auto const view = getTensorViewAtTime(time);
+        return {view.begin(), view.end()};
+    }
     if (_data.find(time) != _data.end()) {
         return cubeToVector(_data.at(time));
     }
@@ -29,6 +35,9 @@ std::vector<float> TensorData::getTensorDataAtTime(TimeFrameIndex time) const {
 }
 
 std::vector<std::size_t> TensorData::getTensorShapeAtTime(TimeFrameIndex time) const {
+    if (_contiguous) {
+        return _findContiguousFrame(time).has_value() ? _feature_shape : std::vector<std::size_t>{};
+    }
     if (_data.find(time) != _data.end()) {
         const auto& cube = _data.at(time);
         return {cube.n_rows, cube.n_cols, cube.n_slices};
@@ -37,6 +46,9 @@ std::vector<std::size_t> TensorData::getTensorShapeAtTime(TimeFrameIndex time) c
 }
 
 std::vector<TimeFrameIndex> TensorData::getTimesWithTensors() const {
+    if (_contiguous) {
+        return _contiguous_times;
+    }
     std::vector<TimeFrameIndex> times;
     times.reserve(_data.size());
     for (const auto& [time, cube] : _data) {
@@ -46,6 +58,23 @@ std::vector<TimeFrameIndex> TensorData::getTimesWithTensors() const {
 }
 
 std::vector<float> TensorData::getChannelSlice(TimeFrameIndex time, int channel) const {
+    if (_contiguous) {
+        // A frame is laid out like a cube, so each channel (slice) is one contiguous block
+        auto const view = getTensorViewAtTime(time);
+        if (view.empty() || _feature_shape.size() != 3 || channel < 0 ||
+            static_cast<std::size_t>(channel) >= _feature_shape[2]) {
+            return {};
+        }
+        std::size_t const slice_size = _feature_shape[0] * _feature_shape[1];
+        auto const slice = view.subspan(static_cast<std::size_t>(channel) * slice_size, slice_size);
+
+        std::vector<float> vec(slice_size);
+        std::transform(slice.begin(), slice.end(), vec.begin(), [](float value) {
+            return 1.0f / (1.0f + std::exp(-value));
+        });
+        return vec;
+    }
+
     if (_data.find(time) == _data.end()) {
         return {};
     }
@@ -69,6 +98,9 @@ std::vector<float> TensorData::getChannelSlice(TimeFrameIndex time, int channel)
 }
 
 std::size_t TensorData::size() const {
+    if (_contiguous) {
+        return _contiguous_times.size();
+    }
     return _data.size();
 }
 
@@ -82,6 +114,19 @@ void TensorData::setFeatureShape(const std::vector<std::size_t>& shape) {
 
 // ========== Private Helper Methods ==========
 
+void TensorData::_convertToFrameStorage() {
+    if (!_contiguous) {
+        return;
+    }
+    std::map<TimeFrameIndex, arma::fcube> frames;
+    for (std::size_t frame = 0; frame < _contiguous_times.size(); ++frame) {
+        auto const view = _contiguousFrame(frame);
+        frames[_contiguous_times[frame]] = vectorToCube(std::vector<float>(view.begin(), view.end()), _feature_shape);
+    }
+    _data = std::move(frames);
+    _clearContiguous();
+}
+
 arma::fcube TensorData::vectorToCube(const std::vector<float>& data, const std::vector<std::size_t>& shape) const {
     if (shape.size() != 3) {
         throw std::invalid_argument("Armadillo backend currently supports only 3D tensors (cubes)");
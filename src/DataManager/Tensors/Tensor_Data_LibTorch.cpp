@@ -1,8 +1,38 @@
 #include "Tensor_Data.hpp"
 #include <algorithm>
+#include <cmath>
 
 #ifdef TENSOR_BACKEND_LIBTORCH
 
+namespace {
+
+std::vector<int64_t> to_torch_shape(std::vector<std::size_t> const & shape) {
+    std::vector<int64_t> torch_shape;
+    torch_shape.reserve(shape.size() + 1);
+    for (std::size_t dim : shape) {
+        torch_shape.push_back(static_cast<int64_t>(dim));
+    }
+    return torch_shape;
+}
+
+/**
+ * @brief Tensor viewing contiguous storage in place
+ *
+ * The deleter holds a reference to the storage owner, so the view stays valid
+ * even if the TensorData is modified or destroyed.
+ */
+torch::Tensor view_as_tensor(std::span<float const> values,
+                             std::vector<int64_t> const & shape,
+                             std::shared_ptr<void const> owner) {
+    return torch::from_blob(
+        const_cast<float*>(values.data()),
+        shape,
+        [owner = std::move(owner)](void *) {},
+        torch::TensorOptions().dtype(torch::kFloat32));
+}
+
+}// namespace
+
 // ========== Template Constructor Implementation ==========
 template<typename T>
 TensorData::TensorData(std::map<TimeFrameIndex, torch::Tensor> data, std::vector<T> shape)
@@ -20,11 +50,13 @@ template TensorData::TensorData(std::map<TimeFrameIndex, torch::Tensor>, std::ve
 // ========== LibTorch-specific Setters ==========
 
 void TensorData::addTensorAtTime(TimeFrameIndex time, torch::Tensor const & tensor) {
+    _convertToFrameStorage();
     _data[time] = tensor;
     notifyObservers();
 }
 
 void TensorData::overwriteTensorAtTime(TimeFrameIndex time, torch::Tensor const & tensor) {
+    _convertToFrameStorage();
     _data[time] = tensor;
     notifyObservers();
 }
@@ -32,12 +64,14 @@ void TensorData::overwriteTensorAtTime(TimeFrameIndex time, torch::Tensor const
 // ========== Generic Setters ==========
 
 void TensorData::addTensorAtTime(TimeFrameIndex time, const std::vector<float>& data, const std::vector<std::size_t>& shape) {
+    _convertToFrameStorage();
     torch::Tensor tensor = vectorToTensor(data, shape);
     _data[time] = tensor;
     notifyObservers();
 }
 
 void TensorData::overwriteTensorAtTime(TimeFrameIndex time, const std::vector<float>& data, const std::vector<std::size_t>& shape) {
+    _convertToFrameStorage();
     torch::Tensor tensor = vectorToTensor(data, shape);
     _data[time] = tensor;
     notifyObservers();
@@ -46,12 +80,40 @@ void TensorData::overwriteTensorAtTime(TimeFrameIndex time, const std::vector<fl
 // ========== LibTorch-specific Getters ==========
 
 torch::Tensor TensorData::getTensorAtTime(TimeFrameIndex time) const {
+    if (_contiguous) {
+        auto const view = getTensorViewAtTime(time);
+        if (view.empty()) {
+            return torch::Tensor{};
+        }
+        return view_as_tensor(view, to_torch_shape(_feature_shape), _contiguous_owner);
+    }
     if (_data.find(time) != _data.end()) {
         return _data.at(time);
     }
     return torch::Tensor{};
 }
 
+torch::Tensor TensorData::getTensorsInRange(TimeFrameIndex start, TimeFrameIndex end) const {
+    if (_contiguous) {
+        auto const range = getTensorRange(start, end);
+        if (range.times.empty()) {
+            return torch::Tensor{};
+        }
+        auto shape = to_torch_shape(_feature_shape);
+        shape.insert(shape.begin(), static_cast<int64_t>(range.times.size()));
+        return view_as_tensor(range.values, shape, _contiguous_owner);
+    }
+
+    std::vector<torch::Tensor> frames;
+    for (auto it = _data.lower_bound(start); it != _data.end() && it->first <= end; ++it) {
+        frames.push_back(it->second);
+    }
+    if (frames.empty()) {
+        return torch::Tensor{};
+    }
+    return torch::stack(frames);
+}
+
 std::map<TimeFrameIndex, torch::Tensor> const & TensorData::getData() const {
     return _data;
 }
@@ -59,6 +121,10 @@ std::map<TimeFrameIndex, torch::Tensor> const & TensorData::getData() const {
 // ========== Generic Getters ==========
 
 std::vector<float> TensorData::getTensorDataAtTime(TimeFrameIndex time) const {
+    if (_contiguous) {
+        auto const view = getTensorViewAtTime(time);
+        return {view.begin(), view.end()};
+    }
     if (_data.find(time) != _data.end()) {
         return tensorToVector(_data.at(time));
     }
@@ -66,6 +132,9 @@ std::vector<float> TensorData::getTensorDataAtTime(TimeFrameIndex time) const {
 }
 
 std::vector<std::size_t> TensorData::getTensorShapeAtTime(TimeFrameIndex time) const {
+    if (_contiguous) {
+        return _findContiguousFrame(time).has_value() ? _feature_shape : std::vector<std::size_t>{};
+    }
     if (_data.find(time) != _data.end()) {
         const auto& tensor = _data.at(time);
         std::vector<std::size_t> shape;
@@ -78,6 +147,9 @@ std::vector<std::size_t> TensorData::getTensorShapeAtTime(TimeFrameIndex time) c
 }
 
 std::vector<TimeFrameIndex> TensorData::getTimesWithTensors() const {
+    if (_contiguous) {
+        return _contiguous_times;
+    }
     std::vector<TimeFrameIndex> times;
     times.reserve(_data.size());
     for (const auto& [time, tensor] : _data) {
@@ -87,6 +159,22 @@ std::vector<TimeFrameIndex> TensorData::getTimesWithTensors() const {
 }
 
 std::vector<float> TensorData::getChannelSlice(TimeFrameIndex time, int channel) const {
+    if (_contiguous) {
+        // Frames are row-major [height, width, channels]; read the channel straight from the view
+        auto const view = getTensorViewAtTime(time);
+        if (view.empty() || _feature_shape.size() != 3 || channel < 0 ||
+            static_cast<std::size_t>(channel) >= _feature_shape[2]) {
+            return {};
+        }
+        std::size_t const n_channels = _feature_shape[2];
+        std::vector<float> vec(_feature_shape[0] * _feature_shape[1]);
+        for (std::size_t i = 0; i < vec.size(); ++i) {
+            float const value = view[i * n_channels + static_cast<std::size_t>(channel)];
+            vec[i] = 1.0f / (1.0f + std::exp(-value));
+        }
+        return vec;
+    }
+
     torch::Tensor const tensor = getTensorAtTime(time);
     
     if (!tensor.defined() || tensor.numel() == 0) {
@@ -109,6 +197,9 @@ std::vector<float> TensorData::getChannelSlice(TimeFrameIndex time, int channel)
 }
 
 std::size_t TensorData::size() const {
+    if (_contiguous) {
+        return _contiguous_times.size();
+    }
     return _data.size();
 }
 
@@ -122,6 +213,19 @@ void TensorData::setFeatureShape(const std::vector<std::size_t>& shape) {
 
 // ========== Private Helper Methods ==========
 
+void TensorData::_convertToFrameStorage() {
+    if (!_contiguous) {
+        return;
+    }
+    auto const shape = to_torch_shape(_feature_shape);
+    std::map<TimeFrameIndex, torch::Tensor> frames;
+    for (std::size_t frame = 0; frame < _contiguous_times.size(); ++frame) {
+        frames[_contiguous_times[frame]] = view_as_tensor(_contiguousFrame(frame), shape, _contiguous_owner).clone();
+    }
+    _data = std::move(frames);
+    _clearContiguous();
+}
+
 torch::Tensor TensorData::vectorToTensor(const std::vector<float>& data, const std::vector<std::size_t>& shape) const {
     // Convert shape to torch IntArrayRef
     std::vector<int64_t> torch_shape;
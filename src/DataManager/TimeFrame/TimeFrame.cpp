@@ -1,61 +1,307 @@
 #include "TimeFrame.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <mutex>
 #include <cstdint>// For int64_t
+#include <stdexcept>
+
+namespace {
 
-TimeFrame::TimeFrame(std::vector<int> const & times) {
-    _times = times;
-    _total_frame_count = static_cast<int>(times.size());
+/// Compress only if the segments take a small fraction of the per-tick storage
+constexpr size_t kMaxSegmentsPerTick = 16;
+
+/**
+ * @brief Split a strictly increasing clock into regularly sampled runs
+ *
+ * @return The runs, or an empty vector if the clock is not strictly
+ *         increasing or has too many runs to be worth storing implicitly
+ */
+std::vector<AffineClockSegment> findAffineSegments(std::vector<int64_t> const & times) {
+    std::vector<AffineClockSegment> segments;
+    if (times.size() < 2) {
+        return segments;
+    }
+
+    size_t const max_segments = std::max<size_t>(1, times.size() / kMaxSegmentsPerTick);
+    size_t i = 0;
+    while (i < times.size()) {
+        int64_t const period = i + 1 < times.size() ? times[i + 1] - times[i] : 1;
+        if (period <= 0) {
+            return {};
+        }
+        segments.push_back({static_cast<int64_t>(i), times[i], period});
+        if (segments.size() > max_segments) {
+            return {};
+        }
+
+        size_t j = i + 1;
+        while (j + 1 < times.size() && times[j + 1] - times[j] == period) {
+            ++j;
+        }
+        i = j + 1;
+    }
+    return segments;
 }
 
-int TimeFrame::getTimeAtIndex(TimeFrameIndex index) const {
-    if (index < TimeFrameIndex(0) || static_cast<size_t>(index.getValue()) >= _times.size()) {
-        std::cout << "Index " << index.getValue() << " out of range" << " for time frame of size " << _times.size() << std::endl;
+}// namespace
+
+/**
+ * @brief Conversion maps from one clock to others, keyed by destination id
+ *
+ * Clocks never change after construction, so a map stays valid for as long as
+ * both clocks exist; ids are never reused.
+ */
+struct TimeFrameConversionCache {
+    static constexpr size_t kCapacity = 4;
+
+    std::mutex mutex;
+    std::vector<std::pair<uint64_t, std::shared_ptr<std::vector<TimeFrameIndex> const>>> maps;///< Most recent last
+};
+
+namespace {
+
+uint64_t nextTimeFrameId() {
+    static std::atomic<uint64_t> next_id{1};
+    return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+}// namespace
+
+TimeFrame::TimeFrame()
+    : _id(nextTimeFrameId()),
+      _conversion_cache(std::make_shared<TimeFrameConversionCache>()) {}
+
+TimeFrame::TimeFrame(std::vector<int> const & times)
+    : TimeFrame(std::vector<int64_t>(times.begin(), times.end())) {}
+
+TimeFrame::TimeFrame(std::vector<int64_t> times)
+    : _total_frame_count(static_cast<int64_t>(times.size())),
+      _id(nextTimeFrameId()),
+      _conversion_cache(std::make_shared<TimeFrameConversionCache>()) {
+    _segments = findAffineSegments(times);
+    if (_segments.empty()) {
+        _times = std::move(times);
+    }
+}
+
+TimeFrame::TimeFrame(std::vector<AffineClockSegment> segments, int64_t frame_count)
+    : _segments(std::move(segments)),
+      _total_frame_count(frame_count),
+      _id(nextTimeFrameId()),
+      _conversion_cache(std::make_shared<TimeFrameConversionCache>()) {
+    if (frame_count < 0) {
+        throw std::invalid_argument("TimeFrame frame count must not be negative");
+    }
+    if (_segments.empty()) {
+        if (frame_count > 0) {
+            throw std::invalid_argument("An implicit TimeFrame needs at least one segment");
+        }
+        return;
+    }
+    if (_segments.front().first_index != 0) {
+        throw std::invalid_argument("The first TimeFrame segment must start at index 0");
+    }
+    for (size_t i = 0; i < _segments.size(); ++i) {
+        auto const & segment = _segments[i];
+        if (segment.period <= 0) {
+            throw std::invalid_argument("TimeFrame segment periods must be positive");
+        }
+        if (i > 0) {
+            auto const & previous = _segments[i - 1];
+            if (segment.first_index <= previous.first_index || segment.first_index >= frame_count) {
+                throw std::invalid_argument("TimeFrame segments must be ordered and within the frame count");
+            }
+            int64_t const previous_last_time = previous.start_time + (segment.first_index - 1 - previous.first_index) * previous.period;
+            if (segment.start_time <= previous_last_time) {
+                throw std::invalid_argument("TimeFrame segments must produce strictly increasing times");
+            }
+        }
+    }
+}
+
+std::shared_ptr<TimeFrame> TimeFrame::createRegular(int64_t frame_count, int64_t start_time, int64_t period) {
+    if (frame_count == 0) {
+        return std::make_shared<TimeFrame>();
+    }
+    return std::make_shared<TimeFrame>(std::vector<AffineClockSegment>{{0, start_time, period}}, frame_count);
+}
+
+int64_t TimeFrame::getTimeAtIndex(TimeFrameIndex index) const {
+    if (index < TimeFrameIndex(0) || index.getValue() >= _total_frame_count) {
+        std::cout << "Index " << index.getValue() << " out of range" << " for time frame of size " << _total_frame_count << std::endl;
         return 0;
     }
-    return _times[static_cast<size_t>(index.getValue())];
+    return _timeAt(index.getValue());
+}
+
+int64_t TimeFrame::_timeAt(int64_t index) const {
+    if (_segments.empty()) {
+        return _times[static_cast<size_t>(index)];
+    }
+    if (_segments.size() == 1) {
+        return _segments.front().start_time + index * _segments.front().period;
+    }
+    auto it = std::upper_bound(_segments.begin(), _segments.end(), index, [](int64_t value, AffineClockSegment const & segment) {
+        return value < segment.first_index;
+    });
+    --it;
+    return it->start_time + (index - it->first_index) * it->period;
 }
 
-TimeFrameIndex TimeFrame::getIndexAtTime(float time, bool preceding) const {
-    // Binary search to find the index closest to the given time
-    auto it = std::lower_bound(_times.begin(), _times.end(), time);
+int64_t TimeFrame::_lowerBound(double time) const {
+    if (_segments.empty()) {
+        auto it = std::lower_bound(_times.begin(), _times.end(), time, [](int64_t value, double t) {
+            return static_cast<double>(value) < t;
+        });
+        return std::distance(_times.begin(), it);
+    }
+
+    // Find the first segment whose last time reaches the requested time
+    auto segment_end = [this](size_t s) {
+        return s + 1 < _segments.size() ? _segments[s + 1].first_index : _total_frame_count;
+    };
+    size_t low = 0;
+    size_t high = _segments.size();
+    while (low < high) {
+        size_t const mid = low + (high - low) / 2;
+        auto const & segment = _segments[mid];
+        auto const last_time = segment.start_time + (segment_end(mid) - 1 - segment.first_index) * segment.period;
+        if (static_cast<double>(last_time) < time) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low == _segments.size()) {
+        return _total_frame_count;
+    }
+
+    auto const & segment = _segments[low];
+    double const offset = std::ceil((time - static_cast<double>(segment.start_time)) / static_cast<double>(segment.period));
+    return segment.first_index + std::max<int64_t>(0, static_cast<int64_t>(offset));
+}
 
+TimeFrameIndex TimeFrame::getIndexAtTime(double time, bool preceding) const {
+    // Index of the first time point not before the given time
+    return _nearestIndex(time, _lowerBound(time), preceding);
+}
+
+TimeFrameIndex TimeFrame::_nearestIndex(double time, int64_t index, bool preceding) const {
     // If exact match found
-    if (it != _times.end() && static_cast<float>(*it) == time) {
-        return TimeFrameIndex(std::distance(_times.begin(), it));
+    if (index < _total_frame_count && static_cast<double>(_timeAt(index)) == time) {
+        return TimeFrameIndex(index);
     }
 
     // If time is beyond the last time point
-    if (it == _times.end()) {
-        return TimeFrameIndex(static_cast<int64_t>(_times.size() - 1));
+    if (index == _total_frame_count) {
+        return TimeFrameIndex(_total_frame_count - 1);
     }
 
     // If time is before the first time point
-    if (it == _times.begin()) {
+    if (index == 0) {
         return TimeFrameIndex(0);
     }
 
     // Find the closest time point, preceding by default
     // If preceding is false, we would return the next time point
     if (preceding) {
-        auto prev = it - 1;
-        if (std::abs(static_cast<float>(*prev) - time) <= std::abs(static_cast<float>(*it) - time)) {
-            return TimeFrameIndex(std::distance(_times.begin(), prev));
+        auto const previous_time = static_cast<double>(_timeAt(index - 1));
+        auto const next_time = static_cast<double>(_timeAt(index));
+        if (std::abs(previous_time - time) <= std::abs(next_time - time)) {
+            return TimeFrameIndex(index - 1);
         } else {
-            return TimeFrameIndex(std::distance(_times.begin(), it));
+            return TimeFrameIndex(index);
         }
     } else {
         // If not preceding, return the next time point
-        return TimeFrameIndex(std::distance(_times.begin(), it));
+        return TimeFrameIndex(index);
+    }
+}
+
+std::vector<TimeFrameIndex> TimeFrame::getIndicesAtTimes(std::span<int64_t const> times, bool preceding) const {
+    std::vector<TimeFrameIndex> indices;
+    indices.reserve(times.size());
+
+    if (!_segments.empty()) {
+        // Implicit clocks resolve each time directly
+        for (auto const time: times) {
+            indices.push_back(getIndexAtTime(static_cast<double>(time), preceding));
+        }
+        return indices;
+    }
+
+    auto const begin = _times.begin();
+    auto const end = _times.end();
+    auto cursor = begin;
+    int64_t previous_time = std::numeric_limits<int64_t>::min();
+
+    for (auto const time: times) {
+        auto const not_before = [time](int64_t value) { return value < time; };
+        if (time < previous_time) {
+            // Out of order input: restart from the beginning
+            cursor = std::partition_point(begin, end, not_before);
+        } else {
+            // Gallop forward from the previous lower bound
+            std::ptrdiff_t step = 1;
+            auto first = cursor;
+            while (true) {
+                auto const remaining = std::distance(first, end);
+                if (remaining <= step) {
+                    cursor = std::partition_point(first, end, not_before);
+                    break;
+                }
+                auto const probe = first + step;
+                if (!not_before(*probe)) {
+                    cursor = std::partition_point(first, probe, not_before);
+                    break;
+                }
+                first = probe + 1;
+                step *= 2;
+            }
+        }
+        previous_time = time;
+        indices.push_back(_nearestIndex(static_cast<double>(time), std::distance(begin, cursor), preceding));
+    }
+    return indices;
+}
+
+std::shared_ptr<std::vector<TimeFrameIndex> const> TimeFrame::getConversionMap(TimeFrame const & destination) const {
+    if (_total_frame_count > kMaxConversionMapFrames) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> const lock(_conversion_cache->mutex);
+    auto & maps = _conversion_cache->maps;
+    for (auto it = maps.begin(); it != maps.end(); ++it) {
+        if (it->first == destination._id) {
+            auto map = it->second;
+            std::rotate(it, it + 1, maps.end());
+            return map;
+        }
+    }
+
+    // Every time of this clock, in order, resolved against the destination in one pass
+    std::vector<int64_t> times(static_cast<size_t>(_total_frame_count));
+    for (int64_t i = 0; i < _total_frame_count; ++i) {
+        times[static_cast<size_t>(i)] = _timeAt(i);
+    }
+    auto map = std::make_shared<std::vector<TimeFrameIndex> const>(destination.getIndicesAtTimes(times));
+
+    if (maps.size() >= TimeFrameConversionCache::kCapacity) {
+        maps.erase(maps.begin());
     }
+    maps.emplace_back(destination._id, map);
+    return map;
 }
 
 int TimeFrame::checkFrameInbounds(int frame_id) const {
 
     if (frame_id < 0) {
         frame_id = 0;
-    } else if (frame_id >= _total_frame_count) {
-        frame_id = _total_frame_count;
+    } else if (frame_id >= getTotalFrameCount()) {
+        frame_id = getTotalFrameCount();
     }
     return frame_id;
 }
@@ -67,11 +313,61 @@ TimeFrameIndex getTimeIndexForSeries(TimeFrameIndex source_index,
         // Frames are the same. The time value can be used directly.
         return source_index;
     } else {
-        auto destination_index = destination_time_frame->getIndexAtTime(static_cast<float>(source_index.getValue()));
+        auto destination_index = destination_time_frame->getIndexAtTime(static_cast<double>(source_index.getValue()));
         return destination_index;
     }
 }
 
+TimeFrameIndex convertTimeFrameIndex(TimeFrameIndex source_index,
+                                     TimeFrame const * source_time_frame,
+                                     TimeFrame const * destination_time_frame,
+                                     bool preceding) {
+    if (source_time_frame == destination_time_frame || !source_time_frame || !destination_time_frame) {
+        return source_index;
+    }
+
+    auto const value = source_index.getValue();
+    if (preceding && value >= 0 && value < source_time_frame->getFrameCount()) {
+        if (auto map = source_time_frame->getConversionMap(*destination_time_frame)) {
+            return (*map)[static_cast<size_t>(value)];
+        }
+    }
+
+    auto const time_value = source_time_frame->getTimeAtIndex(source_index);
+    return destination_time_frame->getIndexAtTime(static_cast<double>(time_value), preceding);
+}
+
+std::vector<TimeFrameIndex> convertTimeFrameIndices(std::span<TimeFrameIndex const> source_indices,
+                                                    TimeFrame const * source_time_frame,
+                                                    TimeFrame const * destination_time_frame,
+                                                    bool preceding) {
+    if (source_time_frame == destination_time_frame || !source_time_frame || !destination_time_frame) {
+        return {source_indices.begin(), source_indices.end()};
+    }
+
+    // Indices inside the source clock are read from the cached map when there is one
+    if (preceding) {
+        if (auto map = source_time_frame->getConversionMap(*destination_time_frame)) {
+            std::vector<TimeFrameIndex> result;
+            result.reserve(source_indices.size());
+            for (auto const index: source_indices) {
+                auto const value = index.getValue();
+                result.push_back(value >= 0 && value < source_time_frame->getFrameCount()
+                                         ? (*map)[static_cast<size_t>(value)]
+                                         : convertTimeFrameIndex(index, source_time_frame, destination_time_frame, preceding));
+            }
+            return result;
+        }
+    }
+
+    std::vector<int64_t> times;
+    times.reserve(source_indices.size());
+    for (auto const index: source_indices) {
+        times.push_back(source_time_frame->getTimeAtIndex(index));
+    }
+    return destination_time_frame->getIndicesAtTimes(times, preceding);
+}
+
 // ========== Filename-based TimeFrame Creation Implementation ==========
 
 #include <algorithm>
@@ -156,40 +452,31 @@ std::shared_ptr<TimeFrame> createTimeFrameFromFilenames(FilenameTimeFrameOptions
         }
 
         // Create TimeFrame based on mode
-        std::vector<int> time_values;
-
         switch (options.mode) {
             case FilenameTimeFrameMode::FOUND_VALUES: {
                 // Use only the extracted values
-                time_values.reserve(extracted_values.size());
-                for (int64_t val: extracted_values) {
-                    time_values.push_back(static_cast<int>(val));
-                }
-                break;
+                std::cout << "Created TimeFrame from " << extracted_values.size()
+                          << " filenames with " << extracted_values.size() << " time points" << std::endl;
+                return std::make_shared<TimeFrame>(std::move(extracted_values));
             }
             case FilenameTimeFrameMode::ZERO_TO_MAX: {
                 // Create range from 0 to maximum value
                 auto max_val = *std::max_element(extracted_values.begin(), extracted_values.end());
-                time_values.resize(static_cast<size_t>(max_val + 1));
-                std::iota(time_values.begin(), time_values.end(), 0);
-                break;
+                std::cout << "Created TimeFrame from " << extracted_values.size()
+                          << " filenames with " << max_val + 1 << " time points" << std::endl;
+                return TimeFrame::createRegular(max_val + 1, 0);
             }
             case FilenameTimeFrameMode::MIN_TO_MAX: {
                 // Create range from minimum to maximum value
                 auto [min_it, max_it] = std::minmax_element(extracted_values.begin(), extracted_values.end());
                 int64_t const min_val = *min_it;
                 int64_t const max_val = *max_it;
-                auto const range_size = static_cast<size_t>(max_val - min_val + 1);
-                time_values.resize(range_size);
-                std::iota(time_values.begin(), time_values.end(), static_cast<int>(min_val));
-                break;
+                std::cout << "Created TimeFrame from " << extracted_values.size()
+                          << " filenames with " << max_val - min_val + 1 << " time points" << std::endl;
+                return TimeFrame::createRegular(max_val - min_val + 1, min_val);
             }
         }
-
-        std::cout << "Created TimeFrame from " << extracted_values.size()
-                  << " filenames with " << time_values.size() << " time points" << std::endl;
-
-        return std::make_shared<TimeFrame>(time_values);
+        return nullptr;
 
     } catch (std::exception const & e) {
         std::cerr << "Error creating TimeFrame from filenames: " << e.what() << std::endl;
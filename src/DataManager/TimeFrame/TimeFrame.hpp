@@ -1,9 +1,13 @@
 #ifndef TIMEFRAME_HPP
 #define TIMEFRAME_HPP
 
+#include <algorithm>
 #include <concepts>
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <span>
 #include <vector>
 
 
@@ -64,23 +68,107 @@ private:
     int64_t value;
 };
 
+/**
+ * @brief One piece of a piecewise-affine clock
+ *
+ * Indices from first_index up to the next segment's first_index (or the end
+ * of the clock) have time start_time + (index - first_index) * period.
+ */
+struct AffineClockSegment {
+    int64_t first_index{0};
+    int64_t start_time{0};
+    int64_t period{1};
+
+    bool operator==(AffineClockSegment const & other) const = default;
+};
+
+struct TimeFrameConversionCache;
+
 class TimeFrame {
 public:
-    TimeFrame() = default;
+    TimeFrame();
     explicit TimeFrame(std::vector<int> const & times);
 
-    [[nodiscard]] int getTotalFrameCount() const { return _total_frame_count; };
-
-    [[nodiscard]] int getTimeAtIndex(TimeFrameIndex index) const;
-
-    [[nodiscard]] TimeFrameIndex getIndexAtTime(float time, bool preceding=true) const;
+    /**
+     * @brief Create a clock from explicit 64-bit time values
+     *
+     * Strictly increasing clocks made of a few regularly sampled runs are
+     * stored implicitly as affine segments instead of one value per tick.
+     */
+    explicit TimeFrame(std::vector<int64_t> times);
+
+    /**
+     * @brief Create an implicit, piecewise-affine clock
+     *
+     * Time lookups are O(1) for a single segment and O(log segments) otherwise;
+     * no per-tick storage is used. Segments must start at index 0, be ordered
+     * by first_index, have positive periods and produce strictly increasing
+     * times (e.g. resynchronization after dropped samples).
+     *
+     * @throws std::invalid_argument if the segments do not describe such a clock
+     */
+    TimeFrame(std::vector<AffineClockSegment> segments, int64_t frame_count);
+
+    /**
+     * @brief Regularly sampled clock: time(i) = start_time + i * period
+     */
+    [[nodiscard]] static std::shared_ptr<TimeFrame> createRegular(int64_t frame_count, int64_t start_time = 0, int64_t period = 1);
+
+    [[nodiscard]] int getTotalFrameCount() const { return static_cast<int>(std::min<int64_t>(_total_frame_count, std::numeric_limits<int>::max())); };
+
+    /**
+     * @brief Number of ticks, without the int limit of getTotalFrameCount
+     */
+    [[nodiscard]] int64_t getFrameCount() const { return _total_frame_count; }
+
+    /**
+     * @brief True if the clock is stored as affine segments rather than per-tick values
+     */
+    [[nodiscard]] bool isImplicit() const { return !_segments.empty(); }
+
+    [[nodiscard]] std::vector<AffineClockSegment> const & getSegments() const { return _segments; }
+
+    [[nodiscard]] int64_t getTimeAtIndex(TimeFrameIndex index) const;
+
+    [[nodiscard]] TimeFrameIndex getIndexAtTime(double time, bool preceding=true) const;
+
+    /**
+     * @brief getIndexAtTime for a sequence of times
+     *
+     * Explicit clocks are searched by galloping forward from the previous
+     * answer, so non-decreasing @p times are resolved in a single merge-like
+     * pass instead of one binary search each. Unsorted input is still correct.
+     */
+    [[nodiscard]] std::vector<TimeFrameIndex> getIndicesAtTimes(std::span<int64_t const> times, bool preceding=true) const;
+
+    /**
+     * @brief Lookup table from every index of this clock to the nearest index of @p destination
+     *
+     * Entry i equals destination.getIndexAtTime(getTimeAtIndex(i)). The table is
+     * built with one merge pass on first use and cached for the most recently
+     * used destinations, so clocks that are converted between repeatedly pay
+     * for the conversion once.
+     *
+     * @return nullptr if this clock has more than kMaxConversionMapFrames ticks
+     */
+    [[nodiscard]] std::shared_ptr<std::vector<TimeFrameIndex> const> getConversionMap(TimeFrame const & destination) const;
+
+    static constexpr int64_t kMaxConversionMapFrames = int64_t{1} << 22;
 
     [[nodiscard]] int checkFrameInbounds(int frame_id) const;
 
 protected:
 private:
-    std::vector<int> _times;
-    int _total_frame_count{0};
+    [[nodiscard]] int64_t _timeAt(int64_t index) const;
+    [[nodiscard]] int64_t _lowerBound(double time) const;
+    [[nodiscard]] TimeFrameIndex _nearestIndex(double time, int64_t lower_bound, bool preceding) const;
+
+    std::vector<int64_t> _times;
+    std::vector<AffineClockSegment> _segments;
+    int64_t _total_frame_count{0};
+
+    uint64_t _id{0};///< Identifies this clock in other clocks' conversion caches
+    std::shared_ptr<TimeFrameConversionCache> _conversion_cache;
 };
 
 //TimeFrameIndex and TimeFrame struct
@@ -111,6 +199,30 @@ TimeFrameIndex getTimeIndexForSeries(TimeFrameIndex source_index,
                               TimeFrame const * source_time_frame,
                               TimeFrame const * destination_time_frame);
 
+/**
+ * @brief Converts an index of one TimeFrame to the nearest index of another.
+ *
+ * Equivalent to destination_time_frame->getIndexAtTime(source_time_frame->getTimeAtIndex(source_index), preceding).
+ * With preceding == true, the cached conversion map between the two clocks is used when available.
+ * The index is returned unchanged if the frames are the same object or either is null.
+ */
+TimeFrameIndex convertTimeFrameIndex(TimeFrameIndex source_index,
+                                     TimeFrame const * source_time_frame,
+                                     TimeFrame const * destination_time_frame,
+                                     bool preceding = true);
+
+/**
+ * @brief Converts many indices of one TimeFrame to the nearest indices of another.
+ *
+ * Same result as calling convertTimeFrameIndex for every element. With
+ * preceding == true the cached conversion map is used when available;
+ * otherwise sorted @p source_indices are converted by walking both clocks once.
+ */
+std::vector<TimeFrameIndex> convertTimeFrameIndices(std::span<TimeFrameIndex const> source_indices,
+                                                    TimeFrame const * source_time_frame,
+                                                    TimeFrame const * destination_time_frame,
+                                                    bool preceding = true);
+
 // ========== Filename-based TimeFrame Creation ==========
 
 /**
@@ -0,0 +1,256 @@
+#include "Tracing.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+namespace Tracing {
+
+namespace {
+
+// Small sequential ids read better in trace viewers than hashed std::thread::ids
+std::uint32_t current_thread_id() {
+    static std::atomic<std::uint32_t> next_id{1};
+    thread_local std::uint32_t const id = next_id.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+}// namespace
+
+Tracer & Tracer::instance() {
+    static Tracer tracer;
+    return tracer;
+}
+
+Tracer::Tracer()
+    : _epoch(Clock::now()) {
+    if (char const * capacity = std::getenv("WHISKERTOOLBOX_TRACE_CAPACITY"); capacity != nullptr && *capacity != '\0') {
+        char * end = nullptr;
+        auto const value = std::strtoull(capacity, &end, 10);
+        if (*end == '\0' && value > 0) {
+            _capacity = static_cast<std::size_t>(value);
+        } else {
+            std::cerr << "Ignoring invalid WHISKERTOOLBOX_TRACE_CAPACITY: " << capacity << std::endl;
+        }
+    }
+    if (char const * path = std::getenv("WHISKERTOOLBOX_TRACE_FILE"); path != nullptr && *path != '\0') {
+        _exit_trace_path = path;
+        setEnabled(true);
+    }
+}
+
+Tracer::~Tracer() {
+    if (!_exit_trace_path.empty()) {
+        writeChromeTrace(_exit_trace_path);
+    }
+}
+
+std::int64_t Tracer::_sinceEpoch(Clock::time_point const time) const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time - _epoch).count();
+}
+
+void Tracer::_push(TraceEvent event) {
+    std::lock_guard<std::mutex> const lock(_mutex);
+    _pushLocked(std::move(event));
+}
+
+void Tracer::_pushLocked(TraceEvent event) {
+    if (_events.size() < _capacity) {
+        _events.push_back(std::move(event));
+        return;
+    }
+    _events[_oldest] = std::move(event);
+    _oldest = (_oldest + 1) % _events.size();
+    ++_dropped;
+}
+
+std::vector<TraceEvent> Tracer::_orderedEventsLocked() const {
+    std::vector<TraceEvent> ordered;
+    ordered.reserve(_events.size());
+    auto const oldest = _events.begin() + static_cast<std::ptrdiff_t>(_oldest);
+    ordered.insert(ordered.end(), oldest, _events.end());
+    ordered.insert(ordered.end(), _events.begin(), oldest);
+    return ordered;
+}
+
+void Tracer::recordZone(std::string_view const name,
+                        std::string_view const category,
+                        Clock::time_point const start,
+                        Clock::time_point const end,
+                        std::string_view const detail,
+                        std::vector<std::pair<std::string, double>> values) {
+    TraceEvent event;
+    event.name = name;
+    event.category = category;
+    event.phase = EventPhase::Complete;
+    event.timestamp_ns = _sinceEpoch(start);
+    event.duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    event.thread_id = current_thread_id();
+    event.detail = detail;
+    event.values = std::move(values);
+    _push(std::move(event));
+}
+
+void Tracer::recordCounter(std::string_view const name, std::string_view const category, double const value) {
+    TraceEvent event;
+    event.name = name;
+    event.category = category;
+    event.phase = EventPhase::Counter;
+    event.timestamp_ns = _sinceEpoch(Clock::now());
+    event.thread_id = current_thread_id();
+    event.values.emplace_back(std::string(name), value);
+    _push(std::move(event));
+}
+
+void Tracer::recordInstant(std::string_view const name, std::string_view const category, std::string_view const detail) {
+    TraceEvent event;
+    event.name = name;
+    event.category = category;
+    event.phase = EventPhase::Instant;
+    event.timestamp_ns = _sinceEpoch(Clock::now());
+    event.thread_id = current_thread_id();
+    event.detail = detail;
+    _push(std::move(event));
+}
+
+void Tracer::recordAllocation(std::string_view const category, std::size_t const bytes) {
+    TraceEvent event;
+    event.name = std::string(category) + " bytes allocated";
+    event.category = category;
+    event.phase = EventPhase::Counter;
+    event.timestamp_ns = _sinceEpoch(Clock::now());
+    event.thread_id = current_thread_id();
+
+    std::lock_guard<std::mutex> const lock(_mutex);
+    auto it = _allocations.find(category);
+    if (it == _allocations.end()) {
+        it = _allocations.emplace(std::string(category), AllocationTally{}).first;
+    }
+    it->second.count += 1;
+    it->second.bytes += bytes;
+
+    event.values.emplace_back("bytes", static_cast<double>(it->second.bytes));
+    _pushLocked(std::move(event));
+}
+
+std::size_t Tracer::capacity() const {
+    std::lock_guard<std::mutex> const lock(_mutex);
+    return _capacity;
+}
+
+void Tracer::setCapacity(std::size_t const capacity) {
+    std::lock_guard<std::mutex> const lock(_mutex);
+    auto ordered = _orderedEventsLocked();
+    _capacity = std::max<std::size_t>(capacity, 1);
+    if (ordered.size() > _capacity) {
+        auto const excess = ordered.size() - _capacity;
+        ordered.erase(ordered.begin(), ordered.begin() + static_cast<std::ptrdiff_t>(excess));
+        _dropped += excess;
+    }
+    _events = std::move(ordered);
+    _oldest = 0;
+}
+
+std::size_t Tracer::droppedEvents() const {
+    std::lock_guard<std::mutex> const lock(_mutex);
+    return _dropped;
+}
+
+std::vector<TraceEvent> Tracer::events() const {
+    std::lock_guard<std::mutex> const lock(_mutex);
+    return _orderedEventsLocked();
+}
+
+std::map<std::string, AllocationTally> Tracer::allocationTallies() const {
+    std::lock_guard<std::mutex> const lock(_mutex);
+    return {_allocations.begin(), _allocations.end()};
+}
+
+void Tracer::clear() {
+    std::lock_guard<std::mutex> const lock(_mutex);
+    _events.clear();
+    _oldest = 0;
+    _dropped = 0;
+    _allocations.clear();
+}
+
+void Tracer::writeChromeTrace(std::ostream & out) const {
+    auto trace_events = nlohmann::json::array();
+    std::size_t dropped = 0;
+    {
+        std::lock_guard<std::mutex> const lock(_mutex);
+        dropped = _dropped;
+        for (std::size_t i = 0; i < _events.size(); ++i) {
+            auto const & event = _events[(_oldest + i) % _events.size()];
+            nlohmann::json json_event = {
+                    {"name", event.name},
+                    {"cat", event.category},
+                    {"ph", std::string(1, static_cast<char>(event.phase))},
+                    {"ts", static_cast<double>(event.timestamp_ns) / 1000.0},
+                    {"pid", 1},
+                    {"tid", event.thread_id}};
+
+            if (event.phase == EventPhase::Complete) {
+                json_event["dur"] = static_cast<double>(event.duration_ns) / 1000.0;
+            } else if (event.phase == EventPhase::Instant) {
+                json_event["s"] = "t";
+            }
+
+            auto args = nlohmann::json::object();
+            if (!event.detail.empty()) {
+                args["detail"] = event.detail;
+            }
+            for (auto const & [key, value]: event.values) {
+                args[key] = value;
+            }
+            if (!args.empty()) {
+                json_event["args"] = std::move(args);
+            }
+
+            trace_events.push_back(std::move(json_event));
+        }
+    }
+
+    nlohmann::json trace{{"traceEvents", std::move(trace_events)}, {"displayTimeUnit", "ms"}};
+    if (dropped > 0) {
+        trace["otherData"] = {{"dropped_events", dropped}};
+    }
+    out << trace.dump() << '\n';
+}
+
+bool Tracer::writeChromeTrace(std::filesystem::path const & path) const {
+    std::ofstream out(path);
+    if (!out) {
+        std::cerr << "Could not open trace file: " << path << std::endl;
+        return false;
+    }
+    writeChromeTrace(out);
+    return static_cast<bool>(out);
+}
+
+ScopedZone::ScopedZone(std::string_view const name, std::string_view const category, std::string_view const detail)
+    : _active(Tracer::instance().isEnabled()),
+      _name(name),
+      _category(category) {
+    if (_active) {
+        _detail = detail;
+        _start = Tracer::Clock::now();
+    }
+}
+
+ScopedZone::~ScopedZone() {
+    if (_active) {
+        Tracer::instance().recordZone(_name, _category, _start, Tracer::Clock::now(), _detail, std::move(_values));
+    }
+}
+
+void ScopedZone::addValue(std::string_view const key, double const value) {
+    if (_active) {
+        _values.emplace_back(std::string(key), value);
+    }
+}
+
+}// namespace Tracing
@@ -0,0 +1,216 @@
+#ifndef TRACING_HPP
+#define TRACING_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Lightweight hot-path tracing with Chrome trace-event export
+ *
+ * Loaders, transforms, pipelines and TableView columns record scoped zones,
+ * counters and allocation tallies through the TRACE_* macros below. The macros
+ * compile to nothing unless the build defines ENABLE_TRACING (CMake option
+ * ENABLE_TRACING), so instrumented code costs nothing in default builds.
+ *
+ * When compiled in, recording is still off until Tracer::setEnabled(true) is
+ * called, or the WHISKERTOOLBOX_TRACE_FILE environment variable names a file;
+ * in that case tracing starts with the process and the trace is written to that
+ * file when it exits. Traces open in chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Events are kept in a ring buffer of Tracer::capacity() entries, so a long
+ * session keeps its most recent events and memory stays bounded.
+ */
+namespace Tracing {
+
+/**
+ * @brief Chrome trace-event phase of a recorded event
+ */
+enum class EventPhase : char {
+    Complete = 'X',///< A zone with a start time and duration
+    Counter = 'C', ///< A sampled value plotted over time
+    Instant = 'i'  ///< A point in time, such as a warning
+};
+
+struct TraceEvent {
+    std::string name;
+    std::string category;
+    EventPhase phase = EventPhase::Complete;
+    std::int64_t timestamp_ns = 0;///< Since the tracer was created
+    std::int64_t duration_ns = 0; ///< Complete events only
+    std::uint32_t thread_id = 0;
+    std::string detail;                                ///< Free text, such as the file being loaded
+    std::vector<std::pair<std::string, double>> values;///< Numeric arguments or counter series
+};
+
+struct AllocationTally {
+    std::size_t count = 0;
+    std::size_t bytes = 0;
+};
+
+class Tracer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t default_capacity = 1'000'000;
+
+    static Tracer & instance();
+
+    ~Tracer();
+
+    Tracer(Tracer const &) = delete;
+    Tracer & operator=(Tracer const &) = delete;
+
+    [[nodiscard]] bool isEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+    void setEnabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+
+    void recordZone(std::string_view name,
+                    std::string_view category,
+                    Clock::time_point start,
+                    Clock::time_point end,
+                    std::string_view detail = {},
+                    std::vector<std::pair<std::string, double>> values = {});
+
+    void recordCounter(std::string_view name, std::string_view category, double value);
+
+    void recordInstant(std::string_view name, std::string_view category, std::string_view detail = {});
+
+    /**
+     * @brief Tallies a large buffer allocated under a category
+     *
+     * Also records a counter of the running byte total, so allocation growth
+     * shows up on the trace timeline next to the zones that caused it.
+     */
+    void recordAllocation(std::string_view category, std::size_t bytes);
+
+    /**
+     * @brief Maximum number of events kept; once full, the oldest are overwritten
+     *
+     * Shrinking the capacity keeps the most recent events. The default can be
+     * changed with the WHISKERTOOLBOX_TRACE_CAPACITY environment variable.
+     */
+    [[nodiscard]] std::size_t capacity() const;
+    void setCapacity(std::size_t capacity);
+
+    /**
+     * @brief Number of events overwritten since the last clear()
+     */
+    [[nodiscard]] std::size_t droppedEvents() const;
+
+    /**
+     * @brief Recorded events, oldest first
+     */
+    [[nodiscard]] std::vector<TraceEvent> events() const;
+    [[nodiscard]] std::map<std::string, AllocationTally> allocationTallies() const;
+
+    void clear();
+
+    /**
+     * @brief Writes all recorded events as a Chrome trace-event JSON object
+     *
+     * If events were dropped, their count is written under otherData.
+     */
+    void writeChromeTrace(std::ostream & out) const;
+    bool writeChromeTrace(std::filesystem::path const & path) const;
+
+private:
+    Tracer();
+
+    [[nodiscard]] std::int64_t _sinceEpoch(Clock::time_point time) const;
+    void _push(TraceEvent event);
+    void _pushLocked(TraceEvent event);
+    [[nodiscard]] std::vector<TraceEvent> _orderedEventsLocked() const;
+
+    Clock::time_point const _epoch;
+    std::atomic<bool> _enabled{false};
+    std::filesystem::path _exit_trace_path;
+
+    mutable std::mutex _mutex;
+    std::vector<TraceEvent> _events;
+    std::size_t _capacity = default_capacity;
+    std::size_t _oldest = 0;///< Index of the oldest event once the buffer has wrapped
+    std::size_t _dropped = 0;
+    std::map<std::string, AllocationTally, std::less<>> _allocations;
+};
+
+/**
+ * @brief Records a Complete event spanning its own lifetime
+ *
+ * Nothing is recorded if tracing was disabled when the zone was opened.
+ */
+class ScopedZone {
+public:
+    ScopedZone(std::string_view name, std::string_view category, std::string_view detail = {});
+    ~ScopedZone();
+
+    ScopedZone(ScopedZone const &) = delete;
+    ScopedZone & operator=(ScopedZone const &) = delete;
+
+    void addValue(std::string_view key, double value);
+
+private:
+    bool _active;
+    std::string_view _name;
+    std::string_view _category;
+    std::string _detail;
+    std::vector<std::pair<std::string, double>> _values;
+    Tracer::Clock::time_point _start;
+};
+
+}// namespace Tracing
+
+#define TRACING_CONCAT_IMPL(a, b) a##b
+#define TRACING_CONCAT(a, b) TRACING_CONCAT_IMPL(a, b)
+
+#ifdef ENABLE_TRACING
+
+// Zone names and categories are not copied until the zone closes, so they must outlive it
+#define TRACE_ZONE(name, category) \
+    ::Tracing::ScopedZone TRACING_CONCAT(tracing_zone_, __LINE__)(name, category)
+#define TRACE_ZONE_DETAIL(name, category, detail) \
+    ::Tracing::ScopedZone TRACING_CONCAT(tracing_zone_, __LINE__)(name, category, detail)
+#define TRACE_ZONE_NAMED(variable, name, category, detail) \
+    ::Tracing::ScopedZone variable(name, category, detail)
+#define TRACE_ZONE_VALUE(variable, key, value) \
+    variable.addValue(key, static_cast<double>(value))
+#define TRACE_COUNTER(name, category, value)                                                         \
+    do {                                                                                             \
+        if (::Tracing::Tracer::instance().isEnabled()) {                                             \
+            ::Tracing::Tracer::instance().recordCounter(name, category, static_cast<double>(value)); \
+        }                                                                                            \
+    } while (false)
+#define TRACE_INSTANT(name, category, detail)                                    \
+    do {                                                                         \
+        if (::Tracing::Tracer::instance().isEnabled()) {                         \
+            ::Tracing::Tracer::instance().recordInstant(name, category, detail); \
+        }                                                                        \
+    } while (false)
+#define TRACE_ALLOCATION(category, bytes)                                     \
+    do {                                                                      \
+        if (::Tracing::Tracer::instance().isEnabled()) {                      \
+            ::Tracing::Tracer::instance().recordAllocation(category, bytes); \
+        }                                                                     \
+    } while (false)
+
+#else
+
+#define TRACE_ZONE(name, category) static_cast<void>(0)
+#define TRACE_ZONE_DETAIL(name, category, detail) static_cast<void>(0)
+#define TRACE_ZONE_NAMED(variable, name, category, detail) static_cast<void>(0)
+#define TRACE_ZONE_VALUE(variable, key, value) static_cast<void>(0)
+#define TRACE_COUNTER(name, category, value) static_cast<void>(0)
+#define TRACE_INSTANT(name, category, detail) static_cast<void>(0)
+#define TRACE_ALLOCATION(category, bytes) static_cast<void>(0)
+
+#endif// ENABLE_TRACING
+
+#endif// TRACING_HPP
@@ -0,0 +1,148 @@
+#include "Tracing.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <nlohmann/json.hpp>
+
+#include <sstream>
+#include <thread>
+
+using namespace Tracing;
+
+namespace {
+
+// The tracer is process-wide; each test starts from an empty, enabled tracer
+// and leaves it as it was found.
+struct TracerFixture {
+    bool const was_enabled = Tracer::instance().isEnabled();
+    std::size_t const old_capacity = Tracer::instance().capacity();
+
+    TracerFixture() {
+        Tracer::instance().clear();
+        Tracer::instance().setEnabled(true);
+    }
+
+    ~TracerFixture() {
+        Tracer::instance().clear();
+        Tracer::instance().setCapacity(old_capacity);
+        Tracer::instance().setEnabled(was_enabled);
+    }
+};
+
+}// namespace
+
+TEST_CASE_METHOD(TracerFixture, "Tracing - scoped zones record complete events", "[tracing]") {
+    {
+        ScopedZone zone("load", "loader", "session.bin");
+        zone.addValue("bytes", 4096.0);
+    }
+
+    auto const events = Tracer::instance().events();
+    REQUIRE(events.size() == 1);
+    REQUIRE(events[0].name == "load");
+    REQUIRE(events[0].category == "loader");
+    REQUIRE(events[0].phase == EventPhase::Complete);
+    REQUIRE(events[0].detail == "session.bin");
+    REQUIRE(events[0].duration_ns >= 0);
+    REQUIRE(events[0].values.size() == 1);
+    REQUIRE(events[0].values[0].first == "bytes");
+    REQUIRE(events[0].values[0].second == 4096.0);
+}
+
+TEST_CASE_METHOD(TracerFixture, "Tracing - nothing is recorded while disabled", "[tracing]") {
+    Tracer::instance().setEnabled(false);
+    {
+        ScopedZone zone("load", "loader");
+        zone.addValue("bytes", 1.0);
+    }
+    Tracer::instance().setEnabled(true);
+
+    REQUIRE(Tracer::instance().events().empty());
+}
+
+TEST_CASE_METHOD(TracerFixture, "Tracing - allocation tallies accumulate per category", "[tracing]") {
+    Tracer::instance().recordAllocation("analog", 100);
+    Tracer::instance().recordAllocation("analog", 50);
+    Tracer::instance().recordAllocation("lines", 10);
+
+    auto const tallies = Tracer::instance().allocationTallies();
+    REQUIRE(tallies.size() == 2);
+    REQUIRE(tallies.at("analog").count == 2);
+    REQUIRE(tallies.at("analog").bytes == 150);
+    REQUIRE(tallies.at("lines").bytes == 10);
+
+    // Each allocation is also a counter of the running total
+    auto const events = Tracer::instance().events();
+    REQUIRE(events.size() == 3);
+    REQUIRE(events[1].phase == EventPhase::Counter);
+    REQUIRE(events[1].values[0].second == 150.0);
+}
+
+TEST_CASE_METHOD(TracerFixture, "Tracing - threads get distinct ids", "[tracing]") {
+    { ScopedZone zone("main", "test"); }
+    std::thread worker([] { ScopedZone zone("worker", "test"); });
+    worker.join();
+
+    auto const events = Tracer::instance().events();
+    REQUIRE(events.size() == 2);
+    REQUIRE(events[0].thread_id != events[1].thread_id);
+}
+
+TEST_CASE_METHOD(TracerFixture, "Tracing - Chrome trace-event export", "[tracing]") {
+    {
+        ScopedZone zone("compute", "tableview", "column \"a\"");
+    }
+    Tracer::instance().recordCounter("rows", "tableview", 42.0);
+    Tracer::instance().recordInstant("missing source", "tableview");
+
+    std::ostringstream out;
+    Tracer::instance().writeChromeTrace(out);
+    auto const trace = nlohmann::json::parse(out.str());
+
+    REQUIRE(trace.contains("traceEvents"));
+    auto const & events = trace["traceEvents"];
+    REQUIRE(events.size() == 3);
+
+    REQUIRE(events[0]["ph"] == "X");
+    REQUIRE(events[0]["name"] == "compute");
+    REQUIRE(events[0]["cat"] == "tableview");
+    REQUIRE(events[0].contains("dur"));
+    REQUIRE(events[0]["args"]["detail"] == "column \"a\"");
+
+    REQUIRE(events[1]["ph"] == "C");
+    REQUIRE(events[1]["args"]["rows"] == 42.0);
+
+    REQUIRE(events[2]["ph"] == "i");
+    REQUIRE_FALSE(events[2].contains("args"));
+}
+
+TEST_CASE_METHOD(TracerFixture, "Tracing - a full buffer keeps the most recent events", "[tracing]") {
+    Tracer::instance().setCapacity(3);
+    for (int i = 0; i < 5; ++i) {
+        Tracer::instance().recordCounter("step", "test", static_cast<double>(i));
+    }
+
+    auto const events = Tracer::instance().events();
+    REQUIRE(events.size() == 3);
+    REQUIRE(events[0].values[0].second == 2.0);
+    REQUIRE(events[2].values[0].second == 4.0);
+    REQUIRE(Tracer::instance().droppedEvents() == 2);
+
+    SECTION("Export is oldest first and reports the dropped count") {
+        std::ostringstream out;
+        Tracer::instance().writeChromeTrace(out);
+        auto const trace = nlohmann::json::parse(out.str());
+
+        REQUIRE(trace["traceEvents"].size() == 3);
+        REQUIRE(trace["traceEvents"][0]["args"]["step"] == 2.0);
+        REQUIRE(trace["traceEvents"][2]["args"]["step"] == 4.0);
+        REQUIRE(trace["otherData"]["dropped_events"] == 2);
+    }
+
+    SECTION("Shrinking the buffer keeps the newest events") {
+        Tracer::instance().setCapacity(1);
+        auto const kept = Tracer::instance().events();
+        REQUIRE(kept.size() == 1);
+        REQUIRE(kept[0].values[0].second == 4.0);
+        REQUIRE(Tracer::instance().droppedEvents() == 4);
+    }
+}
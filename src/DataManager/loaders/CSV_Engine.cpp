@@ -0,0 +1,31 @@
+#include "CSV_Engine.hpp"
+
+namespace Loader {
+
+std::string_view skipLines(std::string_view text, size_t count, char line_delimiter) {
+    for (size_t i = 0; i < count && !text.empty(); ++i) {
+        size_t const eol = text.find(line_delimiter);
+        text.remove_prefix(eol == std::string_view::npos ? text.size() : eol + 1);
+    }
+    return text;
+}
+
+std::vector<std::string_view> splitIntoLineChunks(std::string_view text, size_t target_size, char line_delimiter) {
+    std::vector<std::string_view> chunks;
+    target_size = std::max<size_t>(target_size, 1);
+
+    while (!text.empty()) {
+        if (text.size() <= target_size) {
+            chunks.push_back(text);
+            break;
+        }
+        size_t const eol = text.find(line_delimiter, target_size - 1);
+        size_t const length = eol == std::string_view::npos ? text.size() : eol + 1;
+        chunks.push_back(text.substr(0, length));
+        text.remove_prefix(length);
+    }
+
+    return chunks;
+}
+
+}// namespace Loader
@@ -0,0 +1,167 @@
+#ifndef CSV_ENGINE_HPP
+#define CSV_ENGINE_HPP
+
+#include "loaders/Mapped_File.hpp"
+#include "utils/parallel_for.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdlib>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace Loader {
+
+/**
+ * @brief Trim spaces, tabs and carriage returns from both ends of a field
+ */
+inline std::string_view trimField(std::string_view field) {
+    auto const is_space = [](char c) { return c == ' ' || c == '\t' || c == '\r'; };
+    while (!field.empty() && is_space(field.front())) {
+        field.remove_prefix(1);
+    }
+    while (!field.empty() && is_space(field.back())) {
+        field.remove_suffix(1);
+    }
+    return field;
+}
+
+/**
+ * @brief Parse the leading number of a field
+ *
+ * Like std::stof, surrounding whitespace and a leading '+' are accepted and
+ * trailing characters after the number are ignored.
+ *
+ * @return True if a number was found
+ */
+inline bool parseFloat(std::string_view field, float & value) {
+    field = trimField(field);
+    if (!field.empty() && field.front() == '+') {
+        field.remove_prefix(1);
+    }
+    if (field.empty()) {
+        return false;
+    }
+#if defined(__cpp_lib_to_chars)
+    auto const result = std::from_chars(field.data(), field.data() + field.size(), value);
+    return result.ec == std::errc();
+#else
+    // Floating point from_chars is not available on every standard library
+    std::string const buffer(field);
+    char * end = nullptr;
+    value = std::strtof(buffer.c_str(), &end);
+    return end != buffer.c_str();
+#endif
+}
+
+/**
+ * @brief Parse the leading integer of a field
+ *
+ * @return True if an integer was found
+ */
+template<typename T>
+inline bool parseInteger(std::string_view field, T & value) {
+    field = trimField(field);
+    if (!field.empty() && field.front() == '+') {
+        field.remove_prefix(1);
+    }
+    auto const result = std::from_chars(field.data(), field.data() + field.size(), value);
+    return result.ec == std::errc();
+}
+
+/**
+ * @brief Call fn(index, field) for every delimited field in a line
+ *
+ * Fields are views into @p line. Iteration stops early if fn returns false.
+ */
+template<typename Fn>
+inline void forEachField(std::string_view line, char delimiter, Fn && fn) {
+    size_t index = 0;
+    size_t begin = 0;
+    while (true) {
+        size_t const end = line.find(delimiter, begin);
+        auto const field = line.substr(begin, end == std::string_view::npos ? std::string_view::npos : end - begin);
+        if (!fn(index, field) || end == std::string_view::npos) {
+            return;
+        }
+        begin = end + 1;
+        ++index;
+    }
+}
+
+/**
+ * @brief Remove the first @p count lines from @p text
+ */
+std::string_view skipLines(std::string_view text, size_t count, char line_delimiter = '\n');
+
+/**
+ * @brief Split @p text into contiguous pieces that each end on a line boundary
+ *
+ * @param text Text to split
+ * @param target_size Preferred size of each piece in bytes
+ * @param line_delimiter Line terminator
+ */
+std::vector<std::string_view> splitIntoLineChunks(std::string_view text, size_t target_size, char line_delimiter = '\n');
+
+/**
+ * @brief Parse every line of @p text in parallel, preserving line order
+ *
+ * The text is split into line-aligned chunks that are parsed concurrently.
+ * parse_line(line, rows) is called for every line (with any trailing '\r'
+ * removed) and may append any number of rows. Rows from each chunk are
+ * concatenated in file order. parse_line must be safe to call concurrently.
+ *
+ * @param text Text to parse, typically MappedFile::view()
+ * @param line_delimiter Line terminator
+ * @param parse_line Callable taking (std::string_view, std::vector<Row> &)
+ * @return All rows in file order
+ */
+template<typename Row, typename ParseLine>
+std::vector<Row> parseLines(std::string_view text, char line_delimiter, ParseLine && parse_line) {
+    constexpr size_t min_chunk_bytes = size_t{1} << 20;
+
+    size_t const target_size = std::max(min_chunk_bytes, text.size() / (parallel_worker_count() * 4) + 1);
+    auto const chunks = splitIntoLineChunks(text, target_size, line_delimiter);
+
+    std::vector<std::vector<Row>> partial(chunks.size());
+    parallel_for_chunks(chunks.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t c = begin; c < end; ++c) {
+            auto chunk = chunks[c];
+            auto & rows = partial[c];
+            while (!chunk.empty()) {
+                size_t const eol = chunk.find(line_delimiter);
+                auto line = chunk.substr(0, eol);
+                chunk.remove_prefix(eol == std::string_view::npos ? chunk.size() : eol + 1);
+                if (!line.empty() && line.back() == '\r') {
+                    line.remove_suffix(1);
+                }
+                parse_line(line, rows);
+            }
+        }
+    });
+
+    if (partial.size() == 1) {
+        return std::move(partial.front());
+    }
+
+    size_t total = 0;
+    for (auto const & rows: partial) {
+        total += rows.size();
+    }
+
+    std::vector<Row> result;
+    result.reserve(total);
+    for (auto & rows: partial) {
+        std::move(rows.begin(), rows.end(), std::back_inserter(result));
+    }
+    return result;
+}
+
+}// namespace Loader
+
+#endif// CSV_ENGINE_HPP
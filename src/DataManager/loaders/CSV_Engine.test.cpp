@@ -0,0 +1,131 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "loaders/CSV_Engine.hpp"
+#include "loaders/CSV_Loaders.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("DM - CSV Engine - Number parsing", "[DataManager][CSV]") {
+
+    float value = 0.0f;
+    REQUIRE(Loader::parseFloat(" 1.5\r", value));
+    REQUIRE(value == 1.5f);
+
+    REQUIRE(Loader::parseFloat("+2.25abc", value));
+    REQUIRE(value == 2.25f);
+
+    REQUIRE(Loader::parseFloat("-3e2", value));
+    REQUIRE(value == -300.0f);
+
+    REQUIRE_FALSE(Loader::parseFloat("", value));
+    REQUIRE_FALSE(Loader::parseFloat("x", value));
+
+    int integer = 0;
+    REQUIRE(Loader::parseInteger("42", integer));
+    REQUIRE(integer == 42);
+    REQUIRE_FALSE(Loader::parseInteger("frame", integer));
+}
+
+TEST_CASE("DM - CSV Engine - Field splitting", "[DataManager][CSV]") {
+
+    std::vector<std::string> fields;
+    Loader::forEachField("a,,b,c", ',', [&fields](size_t, std::string_view field) {
+        fields.emplace_back(field);
+        return true;
+    });
+    REQUIRE(fields == std::vector<std::string>{"a", "", "b", "c"});
+
+    fields.clear();
+    Loader::forEachField("a,b,c", ',', [&fields](size_t index, std::string_view field) {
+        fields.emplace_back(field);
+        return index < 1;
+    });
+    REQUIRE(fields == std::vector<std::string>{"a", "b"});
+}
+
+TEST_CASE("DM - CSV Engine - Line chunks", "[DataManager][CSV]") {
+
+    std::string text;
+    for (int i = 0; i < 1000; ++i) {
+        text += std::to_string(i) + "\n";
+    }
+
+    SECTION("Chunks cover the text and end on line boundaries") {
+        auto const chunks = Loader::splitIntoLineChunks(text, 64);
+        REQUIRE(chunks.size() > 1);
+
+        size_t total = 0;
+        for (auto const & chunk: chunks) {
+            REQUIRE(chunk.back() == '\n');
+            total += chunk.size();
+        }
+        REQUIRE(total == text.size());
+    }
+
+    SECTION("Rows are returned in file order") {
+        // Large enough to be split across several chunks
+        std::string large_text;
+        for (int i = 0; i < 300000; ++i) {
+            large_text += std::to_string(i) + "\n";
+        }
+
+        auto const rows = Loader::parseLines<int>(large_text, '\n', [](std::string_view line, std::vector<int> & out) {
+            int value = 0;
+            if (Loader::parseInteger(line, value)) {
+                out.push_back(value);
+            }
+        });
+
+        REQUIRE(rows.size() == 300000);
+        bool in_order = true;
+        for (size_t i = 0; i < rows.size(); ++i) {
+            in_order = in_order && rows[i] == static_cast<int>(i);
+        }
+        REQUIRE(in_order);
+    }
+
+    SECTION("Header lines can be skipped") {
+        auto const rest = Loader::skipLines(text, 2);
+        REQUIRE(rest.substr(0, 2) == "2\n");
+    }
+}
+
+TEST_CASE("DM - CSV Loaders - Multi column", "[DataManager][CSV]") {
+
+    auto const path = std::filesystem::temp_directory_path() / "csv_engine_multi_column_test.csv";
+
+    auto write_file = [&path](std::string const & contents) {
+        std::ofstream file(path);
+        file << contents;
+    };
+
+    Loader::CSVMultiColumnOptions opts;
+    opts.filename = path.string();
+
+    SECTION("Header line is skipped when requested") {
+        write_file("frame,value\n1,0.5\n1,1.5\n2,2.5\n");
+        opts.skip_header = true;
+
+        auto const data = Loader::loadMultiColumnCSV(opts);
+        REQUIRE(data.size() == 2);
+        REQUIRE(data.at(1) == std::vector<float>{0.5f, 1.5f});
+        REQUIRE(data.at(2) == std::vector<float>{2.5f});
+    }
+
+    SECTION("Trailing delimiters are tolerated") {
+        write_file("1,0.5,\n2,2.5,\n3,\n");
+
+        auto const data = Loader::loadMultiColumnCSV(opts);
+
+        // "3," has a single field, so it is skipped like any short row
+        REQUIRE(data.size() == 2);
+        REQUIRE(data.at(1) == std::vector<float>{0.5f});
+        REQUIRE(data.at(2) == std::vector<float>{2.5f});
+    }
+
+    std::filesystem::remove(path);
+}
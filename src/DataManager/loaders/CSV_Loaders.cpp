@@ -1,98 +1,125 @@
 
 #include "CSV_Loaders.hpp"
 
-#include <fstream>
+#include "CSV_Engine.hpp"
+
 #include <iostream>
-#include <sstream>
+#include <stdexcept>
 
 namespace Loader {
 
 std::vector<float> loadSingleColumnCSV(CSVSingleColumnOptions const & opts) {
-    std::vector<float> data;
-    std::ifstream file(opts.filename);
-    std::string line;
+    MappedFile const file(opts.filename);
+    char const delimiter = opts.delimiter.empty() ? '\n' : opts.delimiter[0];
+
+    auto text = file.view();
 
     // Skip header if specified
     if (opts.skip_header) {
-        std::getline(file, line, opts.delimiter[0]);
-    }
-
-    while (std::getline(file, line, opts.delimiter[0])) {
-        std::stringstream ss(line);
-        float value;
-        ss >> value;
-        data.push_back(value);
+        text = skipLines(text, 1, delimiter);
     }
 
-    return data;
+    return parseLines<float>(text, delimiter, [](std::string_view line, std::vector<float> & rows) {
+        // Unparseable lines read as 0, as with stream extraction
+        float value = 0.0f;
+        if (!parseFloat(line, value)) {
+            value = 0.0f;
+        }
+        rows.push_back(value);
+    });
 }
 
 std::vector<std::pair<float, float>> loadPairColumnCSV(CSVPairColumnOptions const & opts) {
-    std::vector<std::pair<float, float>> data;
-    std::ifstream file(opts.filename);
-    std::string line;
-    bool first_line = true;
-
-    while (std::getline(file, line)) {
-        // Skip header if requested
-        if (first_line && opts.skip_header) {
-            first_line = false;
-            continue;
-        }
-        first_line = false;
-        
+    MappedFile const file(opts.filename);
+    char const col_delimiter = opts.col_delimiter.empty() ? ',' : opts.col_delimiter[0];
+
+    auto text = file.view();
+
+    // Skip header if requested
+    if (opts.skip_header) {
+        text = skipLines(text, 1);
+    }
+
+    return parseLines<std::pair<float, float>>(text, '\n', [&opts, col_delimiter](std::string_view line, std::vector<std::pair<float, float>> & rows) {
         // Skip empty lines
         if (line.empty()) {
-            continue;
-        }
-        
-        std::stringstream ss(line);
-        std::string item;
-        std::vector<std::string> tokens;
-
-        while (std::getline(ss, item, opts.col_delimiter[0])) {
-            tokens.push_back(item);
+            return;
         }
 
-        if (tokens.size() >= 2) {
-            try {
-                float first = std::stof(tokens[0]);
-                float second = std::stof(tokens[1]);
-                if (opts.flip_column_order) {
-                    std::swap(first, second);
-                }
-                data.emplace_back(first, second);
-            } catch (std::exception const & e) {
-                std::cerr << "Warning: Could not parse line: " << line << " - " << e.what() << std::endl;
-                continue;
+        std::string_view fields[2];
+        size_t num_fields = 0;
+        forEachField(line, col_delimiter, [&](size_t index, std::string_view field) {
+            if (index < 2) {
+                fields[index] = field;
             }
+            num_fields = index + 1;
+            return true;
+        });
+
+        if (num_fields < 2 || fields[1].empty()) {
+            return;
         }
-    }
 
-    return data;
+        float first = 0.0f;
+        float second = 0.0f;
+        if (!parseFloat(fields[0], first) || !parseFloat(fields[1], second)) {
+            std::cerr << "Warning: Could not parse line: " << line << std::endl;
+            return;
+        }
+        if (opts.flip_column_order) {
+            std::swap(first, second);
+        }
+        rows.emplace_back(first, second);
+    });
 }
 
 std::map<int, std::vector<float>> loadMultiColumnCSV(CSVMultiColumnOptions const & opts) {
     std::map<int, std::vector<float>> data;
 
-    std::ifstream file(opts.filename);
-    std::string line;
+    MappedFile const file(opts.filename);
+    char const col_delimiter = opts.col_delimiter.empty() ? ',' : opts.col_delimiter[0];
 
-    while (std::getline(file, line)) {
-        std::stringstream ss(line);
-        std::string item;
-        std::vector<std::string> tokens;
+    auto text = file.view();
+    if (opts.skip_header) {
+        text = skipLines(text, 1);
+    }
 
-        while (std::getline(ss, item, opts.col_delimiter[0])) {
-            tokens.push_back(item);
+    size_t const last_column = std::max(opts.key_column, opts.value_column);
+
+    auto const rows = parseLines<std::pair<int, float>>(text, '\n', [&opts, col_delimiter, last_column](std::string_view line, std::vector<std::pair<int, float>> & out) {
+        // A trailing delimiter does not start another field, as with std::getline
+        if (!line.empty() && line.back() == col_delimiter) {
+            line.remove_suffix(1);
         }
 
-        if (tokens.size() >= 2) {
-            int const key = std::stoi(tokens[opts.key_column]);
-            float const value = std::stof(tokens[opts.value_column]);
+        std::string_view key_field;
+        std::string_view value_field;
+        size_t num_fields = 0;
+        forEachField(line, col_delimiter, [&](size_t index, std::string_view field) {
+            if (index == opts.key_column) {
+                key_field = field;
+            }
+            if (index == opts.value_column) {
+                value_field = field;
+            }
+            num_fields = index + 1;
+            return index < last_column;
+        });
+
+        if (num_fields < 2 || num_fields <= last_column) {
+            return;
+        }
 
-            data[key].push_back(value);
+        int key = 0;
+        float value = 0.0f;
+        if (!parseInteger(key_field, key) || !parseFloat(value_field, value)) {
+            throw std::invalid_argument("Could not parse line: " + std::string(line));
         }
+        out.emplace_back(key, value);
+    });
+
+    for (auto const & [key, value]: rows) {
+        data[key].push_back(value);
     }
 
     return data;
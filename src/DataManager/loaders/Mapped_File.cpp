@@ -0,0 +1,69 @@
+#include "Mapped_File.hpp"
+
+#include <fstream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Loader {
+
+MappedFile::MappedFile(std::string const & path, FileAccess access) {
+#if !defined(_WIN32)
+    int const fd = ::open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat st {};
+        if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+            _size = static_cast<size_t>(st.st_size);
+            _open = true;
+            if (_size > 0) {
+                void * addr = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (addr != MAP_FAILED) {
+                    if (access == FileAccess::Sequential) {
+                        ::madvise(addr, _size, MADV_SEQUENTIAL);
+                    }
+                    _data = static_cast<char const *>(addr);
+                    _mapped = true;
+                }
+            }
+        }
+        ::close(fd);
+        if (_mapped || (_open && _size == 0)) {
+            return;
+        }
+        _open = false;
+        _size = 0;
+    }
+#else
+    static_cast<void>(access);
+#endif
+
+    // Fall back to reading the whole file
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return;
+    }
+    auto const file_size = file.tellg();
+    if (file_size < 0) {
+        return;
+    }
+    _buffer.resize(static_cast<size_t>(file_size));
+    file.seekg(0, std::ios::beg);
+    file.read(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+    _data = _buffer.data();
+    _size = static_cast<size_t>(file.gcount());
+    _open = true;
+}
+
+MappedFile::~MappedFile() {
+#if !defined(_WIN32)
+    if (_mapped) {
+        ::munmap(const_cast<char *>(_data), _size);
+    }
+#endif
+}
+
+}// namespace Loader
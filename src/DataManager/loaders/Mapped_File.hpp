@@ -0,0 +1,48 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Loader {
+
+/**
+ * @brief How a mapped file is expected to be read
+ *
+ * Only a hint to the operating system's read-ahead; any access pattern works.
+ */
+enum class FileAccess {
+    Sequential,///< Read once from start to end (text parsers)
+    Default    ///< Read in pieces on demand (arrays viewed in place)
+};
+
+/**
+ * @brief Read-only view of a whole file
+ *
+ * On POSIX systems the file is memory-mapped; elsewhere it is read into memory.
+ * A file that cannot be opened yields an empty view and isOpen() == false.
+ */
+class MappedFile {
+public:
+    explicit MappedFile(std::string const & path, FileAccess access = FileAccess::Sequential);
+    ~MappedFile();
+
+    MappedFile(MappedFile const &) = delete;
+    MappedFile & operator=(MappedFile const &) = delete;
+
+    [[nodiscard]] bool isOpen() const { return _open; }
+    [[nodiscard]] std::string_view view() const { return {_data, _size}; }
+
+private:
+    char const * _data = nullptr;
+    size_t _size = 0;
+    bool _open = false;
+    bool _mapped = false;
+    std::vector<char> _buffer;
+};
+
+}// namespace Loader
+
+#endif// MAPPED_FILE_HPP
@@ -0,0 +1,414 @@
+#include "Npy_Reader.hpp"
+
+#include "utils/parallel_for.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <numeric>
+
+namespace Loader {
+
+namespace {
+
+// Elements converted per task; smaller ranges are not worth a thread
+constexpr size_t min_chunk_elements = size_t{1} << 16;
+
+std::string_view const npy_magic{"\x93NUMPY", 6};
+
+void require_bytes(std::string_view bytes, size_t offset, size_t count, std::string const & source) {
+    if (offset > bytes.size() || bytes.size() - offset < count) {
+        throw std::runtime_error(source + ": unexpected end of file");
+    }
+}
+
+/**
+ * @brief Read an unsigned little-endian integer from unaligned bytes
+ */
+template<typename T>
+T read_le(std::string_view bytes, size_t offset) {
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        auto const byte = static_cast<T>(static_cast<unsigned char>(bytes[offset + i]));
+        value = static_cast<T>(value | static_cast<T>(byte << (8 * i)));
+    }
+    return value;
+}
+
+// ========== .npy Header ==========
+
+/**
+ * @brief Text following "'key':" in a header dictionary, with leading spaces removed
+ */
+std::string_view header_value(std::string_view header, std::string_view key, std::string const & source) {
+    std::string const quoted = "'" + std::string(key) + "'";
+    auto pos = header.find(quoted);
+    if (pos != std::string_view::npos) {
+        pos = header.find(':', pos + quoted.size());
+    }
+    if (pos == std::string_view::npos) {
+        throw std::runtime_error(source + ": header has no '" + std::string(key) + "' entry");
+    }
+    auto value = header.substr(pos + 1);
+    value.remove_prefix(std::min(value.find_first_not_of(' '), value.size()));
+    return value;
+}
+
+NpyDtype parse_descr(std::string_view value, std::string const & source) {
+    if (value.empty() || value.front() != '\'') {
+        throw std::runtime_error(source + ": structured dtypes are not supported");
+    }
+    auto const descr = value.substr(1, value.find('\'', 1) - 1);
+    if (descr.size() < 3) {
+        throw std::runtime_error(source + ": malformed dtype '" + std::string(descr) + "'");
+    }
+
+    NpyDtype dtype;
+    dtype.kind = descr[1];
+    auto const [end, error] = std::from_chars(descr.data() + 2, descr.data() + descr.size(), dtype.item_size);
+    if (error != std::errc() || end != descr.data() + descr.size()) {
+        throw std::runtime_error(source + ": malformed dtype '" + std::string(descr) + "'");
+    }
+
+    char const byte_order = descr[0];
+    bool const little = std::endian::native == std::endian::little;
+    dtype.byte_swapped = dtype.item_size > 1 && ((byte_order == '<' && !little) || (byte_order == '>' && little));
+
+    bool const supported = (dtype.kind == 'f' && (dtype.item_size == 4 || dtype.item_size == 8)) ||
+                           ((dtype.kind == 'i' || dtype.kind == 'u') && std::has_single_bit(dtype.item_size) && dtype.item_size <= 8) ||
+                           (dtype.kind == 'b' && dtype.item_size == 1);
+    if (!supported) {
+        throw std::runtime_error(source + ": unsupported dtype '" + std::string(descr) + "'");
+    }
+    return dtype;
+}
+
+std::vector<size_t> parse_shape(std::string_view value, std::string const & source) {
+    auto const close = value.find(')');
+    if (value.empty() || value.front() != '(' || close == std::string_view::npos) {
+        throw std::runtime_error(source + ": malformed shape");
+    }
+
+    std::vector<size_t> shape;
+    auto dims = value.substr(1, close - 1);
+    while (!dims.empty()) {
+        dims.remove_prefix(std::min(dims.find_first_not_of(", "), dims.size()));
+        if (dims.empty()) {
+            break;
+        }
+        size_t dim = 0;
+        auto const [end, error] = std::from_chars(dims.data(), dims.data() + dims.size(), dim);
+        if (error != std::errc()) {
+            throw std::runtime_error(source + ": malformed shape");
+        }
+        shape.push_back(dim);
+        dims.remove_prefix(static_cast<size_t>(end - dims.data()));
+    }
+    return shape;
+}
+
+// ========== Conversion ==========
+
+/**
+ * @brief Call fn(Src{}) with the C++ type stored for @p dtype
+ */
+template<typename Fn>
+void visit_dtype(NpyDtype const & dtype, Fn && fn) {
+    switch (dtype.kind) {
+        case 'f':
+            dtype.item_size == 4 ? fn(float{}) : fn(double{});
+            break;
+        case 'i':
+            switch (dtype.item_size) {
+                case 1: fn(int8_t{}); break;
+                case 2: fn(int16_t{}); break;
+                case 4: fn(int32_t{}); break;
+                default: fn(int64_t{}); break;
+            }
+            break;
+        case 'u':
+            switch (dtype.item_size) {
+                case 1: fn(uint8_t{}); break;
+                case 2: fn(uint16_t{}); break;
+                case 4: fn(uint32_t{}); break;
+                default: fn(uint64_t{}); break;
+            }
+            break;
+        default:// 'b'
+            fn(uint8_t{});
+            break;
+    }
+}
+
+template<typename Src, typename T>
+void convert_from(char const * src, size_t stride_bytes, bool byte_swapped, std::span<T> out) {
+    std::array<char, sizeof(Src)> bytes{};
+    for (auto & value: out) {
+        std::memcpy(bytes.data(), src, sizeof(Src));
+        if (byte_swapped) {
+            std::reverse(bytes.begin(), bytes.end());
+        }
+        Src stored;
+        std::memcpy(&stored, bytes.data(), sizeof(Src));
+        if constexpr (std::is_same_v<Src, T>) {
+            value = stored;
+        } else {
+            value = static_cast<T>(stored);
+        }
+        src += stride_bytes;
+    }
+}
+
+// ========== .npz Archive ==========
+
+struct ZipEntry {
+    std::string name;
+    uint16_t method = 0;
+    uint64_t compressed_size = 0;
+    uint64_t local_header_offset = 0;
+};
+
+std::vector<ZipEntry> read_zip_directory(std::string_view bytes, std::string const & source) {
+    // End of central directory record: 22 bytes plus a comment of up to 64 KiB
+    size_t constexpr eocd_size = 22;
+    if (bytes.size() < eocd_size) {
+        throw std::runtime_error(source + ": not a zip archive");
+    }
+    size_t const search_start = bytes.size() - std::min(bytes.size(), eocd_size + 0xFFFF);
+    auto const eocd = bytes.rfind(std::string_view("PK\x05\x06", 4));
+    if (eocd == std::string_view::npos || eocd < search_start) {
+        throw std::runtime_error(source + ": not a zip archive");
+    }
+    require_bytes(bytes, eocd, eocd_size, source);
+
+    uint64_t entry_count = read_le<uint16_t>(bytes, eocd + 10);
+    uint64_t directory_offset = read_le<uint32_t>(bytes, eocd + 16);
+
+    // Large archives keep the real values in the zip64 end of central directory record
+    if (entry_count == 0xFFFF || directory_offset == 0xFFFFFFFF) {
+        size_t const locator = eocd - std::min<size_t>(eocd, 20);
+        if (eocd < 20 || bytes.substr(locator, 4) != std::string_view("PK\x06\x07", 4)) {
+            throw std::runtime_error(source + ": missing zip64 locator");
+        }
+        size_t const record = read_le<uint64_t>(bytes, locator + 8);
+        require_bytes(bytes, record, 56, source);
+        if (bytes.substr(record, 4) != std::string_view("PK\x06\x06", 4)) {
+            throw std::runtime_error(source + ": malformed zip64 record");
+        }
+        entry_count = read_le<uint64_t>(bytes, record + 32);
+        directory_offset = read_le<uint64_t>(bytes, record + 48);
+    }
+
+    std::vector<ZipEntry> entries;
+    size_t offset = directory_offset;
+    for (uint64_t i = 0; i < entry_count; ++i) {
+        require_bytes(bytes, offset, 46, source);
+        if (bytes.substr(offset, 4) != std::string_view("PK\x01\x02", 4)) {
+            throw std::runtime_error(source + ": malformed central directory");
+        }
+        size_t const name_length = read_le<uint16_t>(bytes, offset + 28);
+        size_t const extra_length = read_le<uint16_t>(bytes, offset + 30);
+        size_t const comment_length = read_le<uint16_t>(bytes, offset + 32);
+        require_bytes(bytes, offset + 46, name_length + extra_length, source);
+
+        ZipEntry entry;
+        entry.name = std::string(bytes.substr(offset + 46, name_length));
+        entry.method = read_le<uint16_t>(bytes, offset + 10);
+        entry.compressed_size = read_le<uint32_t>(bytes, offset + 20);
+        uint64_t uncompressed_size = read_le<uint32_t>(bytes, offset + 24);
+        entry.local_header_offset = read_le<uint32_t>(bytes, offset + 42);
+
+        // The zip64 extra field holds, in order, each of these that overflowed 32 bits
+        auto extra = bytes.substr(offset + 46 + name_length, extra_length);
+        while (extra.size() >= 4) {
+            auto const id = read_le<uint16_t>(extra, 0);
+            size_t const size = std::min<size_t>(read_le<uint16_t>(extra, 2), extra.size() - 4);
+            if (id == 0x0001) {
+                size_t field = 4;
+                for (uint64_t * value: {&uncompressed_size, &entry.compressed_size, &entry.local_header_offset}) {
+                    if (*value == 0xFFFFFFFF && field + 8 <= size + 4) {
+                        *value = read_le<uint64_t>(extra, field);
+                        field += 8;
+                    }
+                }
+            }
+            extra.remove_prefix(4 + size);
+        }
+
+        entries.push_back(std::move(entry));
+        offset += 46 + name_length + extra_length + comment_length;
+    }
+    return entries;
+}
+
+std::string array_name_of(std::string const & entry_name) {
+    std::filesystem::path const path(entry_name);
+    return path.extension() == ".npy" ? path.stem().string() : entry_name;
+}
+
+}// namespace
+
+// ========== Opening Arrays ==========
+
+NpyArray NpyArray::open(std::string const & path, std::string const & array_name) {
+    if (std::filesystem::path(path).extension() == ".npz") {
+        return openNpz(path, array_name);
+    }
+    return openNpy(path);
+}
+
+NpyArray NpyArray::openNpy(std::string const & path) {
+    auto file = std::make_shared<MappedFile const>(path, FileAccess::Default);
+    if (!file->isOpen()) {
+        throw std::runtime_error("Could not open " + path);
+    }
+    auto const bytes = file->view();
+    return _fromBytes(std::move(file), bytes, path);
+}
+
+NpyArray NpyArray::openNpz(std::string const & path, std::string const & array_name) {
+    auto file = std::make_shared<MappedFile const>(path, FileAccess::Default);
+    if (!file->isOpen()) {
+        throw std::runtime_error("Could not open " + path);
+    }
+    auto const bytes = file->view();
+
+    auto const entries = read_zip_directory(bytes, path);
+    auto const entry = std::find_if(entries.begin(), entries.end(), [&](ZipEntry const & e) {
+        return array_name.empty() || array_name_of(e.name) == array_name;
+    });
+    if (entry == entries.end()) {
+        throw std::runtime_error(path + ": no array named '" + array_name + "'");
+    }
+
+    std::string const source = path + ":" + entry->name;
+    if (entry->method != 0) {
+        throw std::runtime_error(source + " is compressed; save it with numpy.savez to load it in place");
+    }
+
+    size_t const local = entry->local_header_offset;
+    require_bytes(bytes, local, 30, source);
+    if (bytes.substr(local, 4) != std::string_view("PK\x03\x04", 4)) {
+        throw std::runtime_error(source + ": malformed local header");
+    }
+    size_t const data_offset = local + 30 + read_le<uint16_t>(bytes, local + 26) + read_le<uint16_t>(bytes, local + 28);
+    size_t const data_size = entry->compressed_size;
+    require_bytes(bytes, data_offset, data_size, source);
+
+    return _fromBytes(std::move(file), bytes.substr(data_offset, data_size), source);
+}
+
+std::vector<std::string> listNpzArrays(std::string const & path) {
+    MappedFile const file(path, FileAccess::Default);
+    if (!file.isOpen()) {
+        throw std::runtime_error("Could not open " + path);
+    }
+    std::vector<std::string> names;
+    for (auto const & entry: read_zip_directory(file.view(), path)) {
+        names.push_back(array_name_of(entry.name));
+    }
+    return names;
+}
+
+NpyArray NpyArray::_fromBytes(std::shared_ptr<MappedFile const> file,
+                              std::string_view bytes,
+                              std::string const & source) {
+    require_bytes(bytes, 0, 10, source);
+    if (bytes.substr(0, npy_magic.size()) != npy_magic) {
+        throw std::runtime_error(source + " is not a .npy file");
+    }
+
+    // Version 1.0 has a 2-byte header length, versions 2.0 and 3.0 a 4-byte one
+    auto const major_version = static_cast<unsigned char>(bytes[6]);
+    size_t preamble = 0;
+    size_t header_length = 0;
+    if (major_version == 1) {
+        preamble = 10;
+        header_length = read_le<uint16_t>(bytes, 8);
+    } else if (major_version == 2 || major_version == 3) {
+        require_bytes(bytes, 0, 12, source);
+        preamble = 12;
+        header_length = read_le<uint32_t>(bytes, 8);
+    } else {
+        throw std::runtime_error(source + ": unsupported .npy version " + std::to_string(major_version));
+    }
+    require_bytes(bytes, preamble, header_length, source);
+    auto const header = bytes.substr(preamble, header_length);
+
+    NpyArray array;
+    array._dtype = parse_descr(header_value(header, "descr", source), source);
+    array._fortran_order = header_value(header, "fortran_order", source).starts_with("True");
+    array._shape = parse_shape(header_value(header, "shape", source), source);
+    array._size = std::accumulate(array._shape.begin(), array._shape.end(), size_t{1}, std::multiplies<>());
+
+    size_t const data_offset = preamble + header_length;
+    if ((bytes.size() - data_offset) / array._dtype.item_size < array._size) {
+        throw std::runtime_error(source + ": file is shorter than its header says");
+    }
+    array._data = bytes.data() + data_offset;
+    array._file = std::move(file);
+    return array;
+}
+
+// ========== Conversion ==========
+
+template<typename T>
+void NpyArray::convert(size_t first, size_t stride, std::span<T> out) const {
+    if (out.empty()) {
+        return;
+    }
+    if (first >= _size || (out.size() - 1) * stride >= _size - first) {
+        throw std::out_of_range("numpy array element range is out of bounds");
+    }
+    char const * src = _data + first * _dtype.item_size;
+    size_t const stride_bytes = stride * _dtype.item_size;
+    visit_dtype(_dtype, [&]<typename Src>(Src) {
+        convert_from<Src>(src, stride_bytes, _dtype.byte_swapped, out);
+    });
+}
+
+template<typename T>
+std::vector<T> NpyArray::toVector() const {
+    std::vector<T> result(_size);
+    if (_size == 0) {
+        return result;
+    }
+
+    if (!_fortran_order || _shape.size() < 2) {
+        parallel_for_chunks(_size, min_chunk_elements, [&](size_t begin, size_t end) {
+            convert<T>(begin, 1, std::span<T>(result).subspan(begin, end - begin));
+        });
+        return result;
+    }
+
+    // Each C-order row along the last axis is a strided run in Fortran storage
+    size_t const row_length = _shape.back();
+    size_t const n_rows = _size / row_length;
+    parallel_for_chunks(n_rows, std::max<size_t>(1, min_chunk_elements / row_length), [&](size_t begin, size_t end) {
+        for (size_t row = begin; row < end; ++row) {
+            size_t remaining = row;
+            size_t offset = 0;
+            size_t axis_stride = n_rows;
+            for (size_t axis = _shape.size() - 1; axis-- > 0;) {
+                axis_stride /= _shape[axis];
+                offset += (remaining % _shape[axis]) * axis_stride;
+                remaining /= _shape[axis];
+            }
+            convert<T>(offset, n_rows, std::span<T>(result).subspan(row * row_length, row_length));
+        }
+    });
+    return result;
+}
+
+template void NpyArray::convert<float>(size_t, size_t, std::span<float>) const;
+template void NpyArray::convert<double>(size_t, size_t, std::span<double>) const;
+template void NpyArray::convert<int64_t>(size_t, size_t, std::span<int64_t>) const;
+template std::vector<float> NpyArray::toVector<float>() const;
+template std::vector<double> NpyArray::toVector<double>() const;
+template std::vector<int64_t> NpyArray::toVector<int64_t>() const;
+
+}// namespace Loader
@@ -0,0 +1,149 @@
+#ifndef NPY_READER_HPP
+#define NPY_READER_HPP
+
+#include "loaders/Mapped_File.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Loader {
+
+/**
+ * @brief Element type of a numpy array, from the 'descr' field of its header
+ */
+struct NpyDtype {
+    char kind = 'f';          ///< 'f' float, 'i' signed integer, 'u' unsigned integer, 'b' bool
+    size_t item_size = 4;     ///< Bytes per element
+    bool byte_swapped = false;///< Stored in the opposite byte order to this machine
+};
+
+/**
+ * @brief A numpy array read in place from a memory-mapped .npy or .npz file
+ *
+ * Opening an array only parses its header, so it takes the same time for any
+ * file size. When the stored element type is already T in this machine's byte
+ * order, view<T>() hands out the mapped bytes directly; owner() keeps the
+ * mapping alive for as long as such a view is in use. Other element types are
+ * converted on request with convert() or toVector(), a chunk at a time.
+ *
+ * Arrays inside an .npz archive can only be mapped if the archive was written
+ * with numpy.savez (stored); numpy.savez_compressed archives are rejected.
+ *
+ * Errors (missing file, malformed header, unsupported dtype) throw std::runtime_error.
+ */
+class NpyArray {
+public:
+    NpyArray() = default;
+
+    /**
+     * @brief Open a .npy file, or an array of an .npz archive
+     *
+     * @param path Path to the file; the .npz extension selects the archive reader
+     * @param array_name Array to open in an .npz archive; empty for its first array
+     */
+    static NpyArray open(std::string const & path, std::string const & array_name = "");
+
+    static NpyArray openNpy(std::string const & path);
+    static NpyArray openNpz(std::string const & path, std::string const & array_name = "");
+
+    [[nodiscard]] std::vector<size_t> const & shape() const { return _shape; }
+    [[nodiscard]] size_t size() const { return _size; }
+    [[nodiscard]] NpyDtype const & dtype() const { return _dtype; }
+
+    /**
+     * @brief True if the first axis varies fastest in storage (column-major)
+     */
+    [[nodiscard]] bool fortranOrder() const { return _fortran_order; }
+
+    /**
+     * @brief True if view<T>() can be used: the elements are stored as aligned, native-order T
+     */
+    template<typename T>
+    [[nodiscard]] bool hasNativeType() const {
+        return _dtype.kind == _kindOf<T>() &&
+               _dtype.item_size == sizeof(T) &&
+               !_dtype.byte_swapped &&
+               reinterpret_cast<std::uintptr_t>(_data) % alignof(T) == 0;
+    }
+
+    /**
+     * @brief Zero-copy view of all elements in storage order
+     *
+     * @throws std::runtime_error if hasNativeType<T>() is false
+     */
+    template<typename T>
+    [[nodiscard]] std::span<T const> view() const {
+        if (!hasNativeType<T>()) {
+            throw std::runtime_error("numpy array cannot be viewed as the requested type without conversion");
+        }
+        return {reinterpret_cast<T const *>(_data), _size};
+    }
+
+    /**
+     * @brief Convert elements first, first + stride, ... (in storage order) into @p out
+     *
+     * Handles any supported dtype and byte order. Only the pages holding the
+     * requested elements are read, so this can be used to convert a large array
+     * lazily in chunks.
+     *
+     * @throws std::out_of_range if the last requested element is past the end
+     */
+    template<typename T>
+    void convert(size_t first, size_t stride, std::span<T> out) const;
+
+    /**
+     * @brief Convert the whole array to T in C (row-major) order
+     *
+     * Fortran-ordered arrays are transposed. The work is split into chunks
+     * across threads, reading straight from the mapping.
+     */
+    template<typename T>
+    [[nodiscard]] std::vector<T> toVector() const;
+
+    /**
+     * @brief Handle that keeps the mapped file, and so every view<T>(), alive
+     */
+    [[nodiscard]] std::shared_ptr<void const> owner() const { return _file; }
+
+private:
+    std::shared_ptr<MappedFile const> _file;
+    char const * _data = nullptr;
+    std::vector<size_t> _shape;
+    size_t _size = 0;
+    NpyDtype _dtype;
+    bool _fortran_order = false;
+
+    static NpyArray _fromBytes(std::shared_ptr<MappedFile const> file,
+                               std::string_view bytes,
+                               std::string const & source);
+
+    template<typename T>
+    static constexpr char _kindOf() {
+        if constexpr (std::is_same_v<T, bool>) {
+            return 'b';
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return 'f';
+        } else if constexpr (std::is_signed_v<T>) {
+            return 'i';
+        } else {
+            return 'u';
+        }
+    }
+};
+
+/**
+ * @brief Names of the arrays in an .npz archive, in archive order
+ *
+ * @throws std::runtime_error if the file is missing or is not a zip archive
+ */
+std::vector<std::string> listNpzArrays(std::string const & path);
+
+}// namespace Loader
+
+#endif// NPY_READER_HPP
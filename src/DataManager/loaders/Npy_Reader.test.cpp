@@ -0,0 +1,190 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "loaders/Npy_Reader.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Bytes of a version 1.0 .npy file with the data 16-byte aligned, as older numpy versions write it
+std::string npy_bytes(std::string const & descr, bool fortran_order, std::string const & shape, std::string const & data) {
+    std::string header = "{'descr': '" + descr + "', 'fortran_order': " + (fortran_order ? "True" : "False") +
+                         ", 'shape': " + shape + ", }";
+    header.append(15 - (10 + header.size()) % 16, ' ');
+    header += '\n';
+    std::string bytes("\x93NUMPY\x01\x00", 8);
+    bytes += static_cast<char>(header.size() & 0xFF);
+    bytes += static_cast<char>(header.size() >> 8);
+    return bytes + header + data;
+}
+
+template<typename T>
+std::string raw_bytes(std::vector<T> const & values, bool swap = false) {
+    std::string bytes(values.size() * sizeof(T), '\0');
+    std::memcpy(bytes.data(), values.data(), bytes.size());
+    if (swap) {
+        for (size_t i = 0; i < bytes.size(); i += sizeof(T)) {
+            std::reverse(bytes.begin() + static_cast<std::ptrdiff_t>(i),
+                         bytes.begin() + static_cast<std::ptrdiff_t>(i + sizeof(T)));
+        }
+    }
+    return bytes;
+}
+
+void append_le(std::string & out, uint64_t value, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        out += static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+// A zip archive of uncompressed (method 0) or nominally deflated (method 8) entries, as numpy.savez writes
+std::string zip_bytes(std::vector<std::pair<std::string, std::string>> const & entries, uint16_t method = 0) {
+    std::string archive;
+    std::string directory;
+    for (auto const & [name, data]: entries) {
+        size_t const local_offset = archive.size();
+        archive += std::string("PK\x03\x04", 4);
+        append_le(archive, 20, 2);    // version needed
+        append_le(archive, 0, 2);     // flags
+        append_le(archive, method, 2);
+        append_le(archive, 0, 8);     // time, date, crc (not checked)
+        append_le(archive, data.size(), 4);
+        append_le(archive, data.size(), 4);
+        append_le(archive, name.size(), 2);
+        append_le(archive, 0, 2);
+        archive += name + data;
+
+        directory += std::string("PK\x01\x02", 4);
+        append_le(directory, 20, 2);// version made by
+        append_le(directory, 20, 2);
+        append_le(directory, 0, 2);
+        append_le(directory, method, 2);
+        append_le(directory, 0, 8);
+        append_le(directory, data.size(), 4);
+        append_le(directory, data.size(), 4);
+        append_le(directory, name.size(), 2);
+        append_le(directory, 0, 2);   // extra
+        append_le(directory, 0, 2);   // comment
+        append_le(directory, 0, 2);   // disk
+        append_le(directory, 0, 2);   // internal attributes
+        append_le(directory, 0, 4);   // external attributes
+        append_le(directory, local_offset, 4);
+        directory += name;
+    }
+    size_t const directory_offset = archive.size();
+    archive += directory;
+    archive += std::string("PK\x05\x06", 4);
+    append_le(archive, 0, 4);
+    append_le(archive, entries.size(), 2);
+    append_le(archive, entries.size(), 2);
+    append_le(archive, directory.size(), 4);
+    append_le(archive, directory_offset, 4);
+    append_le(archive, 0, 2);
+    return archive;
+}
+
+void write_file(std::filesystem::path const & path, std::string const & bytes) {
+    std::ofstream out(path, std::ios::binary);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+char const native_order = std::endian::native == std::endian::little ? '<' : '>';
+char const swapped_order = std::endian::native == std::endian::little ? '>' : '<';
+
+}// namespace
+
+TEST_CASE("DM - Npy Reader - .npy files", "[DataManager][numpy]") {
+    auto const directory = std::filesystem::temp_directory_path() / "whiskertoolbox_npy_reader_test";
+    std::filesystem::create_directories(directory);
+    auto const path = directory / "array.npy";
+
+    SECTION("Native float32 is viewed in place") {
+        std::string const descr = std::string{native_order} + "f4";
+        write_file(path, npy_bytes(descr, false, "(2, 3)", raw_bytes(std::vector<float>{0, 1, 2, 3, 4, 5})));
+
+        auto const array = Loader::NpyArray::open(path.string());
+        REQUIRE(array.shape() == std::vector<size_t>{2, 3});
+        REQUIRE(array.size() == 6);
+        REQUIRE(array.hasNativeType<float>());
+        REQUIRE_FALSE(array.hasNativeType<double>());
+
+        auto const view = array.view<float>();
+        REQUIRE(view.size() == 6);
+        REQUIRE(view[4] == 4.0f);
+        REQUIRE(array.owner() != nullptr);
+        REQUIRE_THROWS_AS(array.view<double>(), std::runtime_error);
+    }
+
+    SECTION("Other dtypes and byte orders are converted") {
+        std::string const descr = std::string{swapped_order} + "i2";
+        write_file(path, npy_bytes(descr, false, "(4,)", raw_bytes(std::vector<int16_t>{-2, 300, 7, -32768}, true)));
+
+        auto const array = Loader::NpyArray::open(path.string());
+        REQUIRE(array.dtype().kind == 'i');
+        REQUIRE(array.dtype().byte_swapped);
+        REQUIRE_FALSE(array.hasNativeType<int16_t>());
+        REQUIRE(array.toVector<float>() == std::vector<float>{-2, 300, 7, -32768});
+
+        std::vector<double> every_other(2);
+        array.convert<double>(1, 2, every_other);
+        REQUIRE(every_other == std::vector<double>{300, -32768});
+        REQUIRE_THROWS_AS(array.convert<double>(2, 2, every_other), std::out_of_range);
+    }
+
+    SECTION("Fortran order is transposed to C order") {
+        // 2x3 array [[0, 1, 2], [3, 4, 5]] stored column by column
+        std::string const descr = std::string{native_order} + "f8";
+        write_file(path, npy_bytes(descr, true, "(2, 3)", raw_bytes(std::vector<double>{0, 3, 1, 4, 2, 5})));
+
+        auto const array = Loader::NpyArray::open(path.string());
+        REQUIRE(array.fortranOrder());
+        REQUIRE(array.toVector<float>() == std::vector<float>{0, 1, 2, 3, 4, 5});
+    }
+
+    SECTION("Malformed files are rejected") {
+        write_file(path, npy_bytes("<c8", false, "(1,)", std::string(8, '\0')));
+        REQUIRE_THROWS_AS(Loader::NpyArray::open(path.string()), std::runtime_error);
+
+        write_file(path, npy_bytes("<f4", false, "(10,)", std::string(8, '\0')));
+        REQUIRE_THROWS_AS(Loader::NpyArray::open(path.string()), std::runtime_error);
+
+        write_file(path, "not numpy");
+        REQUIRE_THROWS_AS(Loader::NpyArray::open(path.string()), std::runtime_error);
+
+        REQUIRE_THROWS_AS(Loader::NpyArray::open((directory / "missing.npy").string()), std::runtime_error);
+    }
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("DM - Npy Reader - .npz archives", "[DataManager][numpy]") {
+    auto const directory = std::filesystem::temp_directory_path() / "whiskertoolbox_npz_reader_test";
+    std::filesystem::create_directories(directory);
+    auto const path = directory / "arrays.npz";
+
+    auto const first = npy_bytes("|u1", false, "(3,)", raw_bytes(std::vector<uint8_t>{1, 2, 3}));
+    auto const second = npy_bytes("<i8", false, "(2,)", raw_bytes(std::vector<int64_t>{-5, 9}, std::endian::native != std::endian::little));
+
+    SECTION("Stored arrays are opened by name") {
+        write_file(path, zip_bytes({{"first.npy", first}, {"second.npy", second}}));
+
+        REQUIRE(Loader::listNpzArrays(path.string()) == std::vector<std::string>{"first", "second"});
+        REQUIRE(Loader::NpyArray::open(path.string()).toVector<float>() == std::vector<float>{1, 2, 3});
+        REQUIRE(Loader::NpyArray::open(path.string(), "second").toVector<int64_t>() == std::vector<int64_t>{-5, 9});
+        REQUIRE_THROWS_AS(Loader::NpyArray::open(path.string(), "third"), std::runtime_error);
+    }
+
+    SECTION("Compressed arrays are rejected") {
+        write_file(path, zip_bytes({{"first.npy", first}}, 8));
+        REQUIRE_THROWS_AS(Loader::NpyArray::open(path.string()), std::runtime_error);
+    }
+
+    std::filesystem::remove_all(directory);
+}
@@ -1,7 +1,8 @@
 #ifndef BINARY_LOADERS_HPP
 #define BINARY_LOADERS_HPP
 
-#include <chrono>
+#include "Tracing/Tracing.hpp"
+
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -28,8 +29,7 @@ struct BinaryAnalogOptions {
  */
 template<typename T>
 inline std::vector<T> readBinaryFile(BinaryAnalogOptions const & options) {
-
-    auto t1 = std::chrono::steady_clock::now();
+    TRACE_ZONE_NAMED(zone, "readBinaryFile", "loader", options.file_path);
 
     std::ifstream file(options.file_path, std::ios::binary | std::ios::ate);// seeks to end
 
@@ -48,19 +48,15 @@ inline std::vector<T> readBinaryFile(BinaryAnalogOptions const & options) {
     file.seekg(static_cast<std::ios::off_type>(options.header_size_bytes), std::ios::beg);
     file.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data_size_bytes));
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1);
-
-    std::cout << "Total time to load " << options.file_path << ": " << elapsed.count() << std::endl;
+    TRACE_ZONE_VALUE(zone, "bytes", data_size_bytes);
+    TRACE_ALLOCATION("loader", num_samples * sizeof(T));
 
     return data;
 }
 
 template<typename T>
 inline std::vector<std::vector<T>> readBinaryFileMultiChannel(BinaryAnalogOptions const & options) {
-
-    auto t1 = std::chrono::steady_clock::now();
+    TRACE_ZONE_NAMED(zone, "readBinaryFileMultiChannel", "loader", options.file_path);
 
     if (options.num_channels <= 0) {
         std::cout << "Channels cannot be less than 1" << std::endl;
@@ -110,11 +106,10 @@ inline std::vector<std::vector<T>> readBinaryFileMultiChannel(BinaryAnalogOption
         current_time_index++;
     }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1);
+    TRACE_ZONE_VALUE(zone, "bytes", data_size_bytes);
+    TRACE_ZONE_VALUE(zone, "channels", options.num_channels);
+    TRACE_ALLOCATION("loader", num_samples_per_channel * options.num_channels * sizeof(T));
 
-    std::cout << "Total time to load " << elapsed.count() << std::endl;
     return data;
 }
 
@@ -71,7 +71,7 @@ std::shared_ptr<AnalogTimeSeries> filter_analog(
         throw std::runtime_error("Failed to create filter");
     }
 
-    auto & data_span = analog_time_series->getAnalogTimeSeries();
+    auto const data_span = analog_time_series->getAnalogTimeSeriesSpan();
     auto time_series = analog_time_series->getTimeSeries();
 
     if (data_span.empty()) {
@@ -1,6 +1,7 @@
 #include "analog_hilbert_phase.hpp"
 
 #include "AnalogTimeSeries/Analog_Time_Series.hpp"
+#include "Tracing/Tracing.hpp"
 #include "utils/armadillo_wrap/analog_armadillo.hpp"
 
 #include <armadillo>
@@ -34,7 +35,7 @@ std::vector<DataChunk> detectChunks(AnalogTimeSeries const * analog_time_series,
     std::vector<DataChunk> chunks;
 
     auto const & timestamps = analog_time_series->getTimeSeries();
-    auto const & values = analog_time_series->getAnalogTimeSeries();
+    auto const values = analog_time_series->getAnalogTimeSeriesSpan();
 
     if (timestamps.empty()) {
         return chunks;
@@ -106,7 +107,8 @@ std::vector<float> processChunk(DataChunk const & chunk, HilbertPhaseParams cons
         return {};
     }
 
-    std::cout << "Processing chunk with " << chunk.values.size() << " values" << std::endl;
+    TRACE_ZONE_NAMED(zone, "hilbert_phase chunk", "transform", {});
+    TRACE_ZONE_VALUE(zone, "samples", chunk.values.size());
 
     // First check for NaN values and remove them
     std::vector<float> clean_values;
@@ -243,6 +245,7 @@ std::shared_ptr<AnalogTimeSeries> hilbert_phase(
         AnalogTimeSeries const * analog_time_series,
         HilbertPhaseParams const & phaseParams,
         ProgressCallback progressCallback) {
+    TRACE_ZONE("hilbert_phase", "transform");
 
     // Input validation
     if (!analog_time_series) {
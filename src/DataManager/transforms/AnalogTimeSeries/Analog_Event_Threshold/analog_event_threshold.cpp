@@ -43,7 +43,7 @@ std::shared_ptr<DigitalEventSeries> event_threshold(
     float const threshold = static_cast<float>(thresholdParams.thresholdValue);
     std::vector<float> events;
 
-    auto const & values = analog_time_series->getAnalogTimeSeries();
+    auto const values = analog_time_series->getAnalogTimeSeriesSpan();
     auto const & time_storage = analog_time_series->getTimeStorage();
 
     if (values.empty()) {
@@ -28,7 +28,7 @@ std::shared_ptr<DigitalIntervalSeries> interval_threshold(
     }
 
     auto const & timestamps = analog_time_series->getTimeSeries();
-    auto const & values = analog_time_series->getAnalogTimeSeries();
+    auto const values = analog_time_series->getAnalogTimeSeriesSpan();
 
     if (timestamps.empty()) {
         std::cerr << "interval_threshold: Input time series is empty" << std::endl;
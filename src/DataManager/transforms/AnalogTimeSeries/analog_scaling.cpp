@@ -4,50 +4,57 @@
 #include "AnalogTimeSeries/utils/statistics.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <iostream>
+#include <span>
 #include <vector>
 
-AnalogStatistics calculate_analog_statistics(AnalogTimeSeries const * analog_time_series) {
+namespace {
+
+std::vector<float> calculate_quantiles(AnalogTimeSeries const & series,
+                                       std::span<double const> quantiles,
+                                       bool exact) {
+    if (exact) {
+        return calculate_quantiles_exact(series.getAnalogTimeSeriesSpan(), quantiles);
+    }
+    std::vector<float> values;
+    values.reserve(quantiles.size());
+    for (double const q: quantiles) {
+        values.push_back(calculate_quantile_approximate(series, q));
+    }
+    return values;
+}
+
+}// namespace
+
+AnalogStatistics calculate_analog_statistics(AnalogTimeSeries const * analog_time_series,
+                                             bool exact_quantiles) {
     AnalogStatistics stats;
     
     if (!analog_time_series) {
         return stats;
     }
     
-    auto const & data = analog_time_series->getAnalogTimeSeries();
-    if (data.empty()) {
+    auto const & summary = analog_time_series->getSummaryStatistics();
+    if (summary.count == 0) {
         return stats;
     }
     
-    stats.sample_count = data.size();
+    stats.sample_count = summary.count;
     
     // Calculate basic statistics
-    stats.mean = calculate_mean(*analog_time_series);
-    stats.std_dev = calculate_std_dev(*analog_time_series);
-    stats.min_val = calculate_min(*analog_time_series);
-    stats.max_val = calculate_max(*analog_time_series);
+    stats.mean = summary.mean;
+    stats.std_dev = std::sqrt(summary.populationVariance());
+    stats.min_val = summary.min;
+    stats.max_val = summary.max;
     
     // Calculate median and quartiles
-    std::vector<float> sorted_data = data;
-    std::sort(sorted_data.begin(), sorted_data.end());
-    
-    size_t n = sorted_data.size();
-    if (n % 2 == 0) {
-        stats.median = (sorted_data[n/2 - 1] + sorted_data[n/2]) / 2.0;
-    } else {
-        stats.median = sorted_data[n/2];
-    }
-    
-    // Calculate quartiles
-    size_t q1_idx = n / 4;
-    size_t q3_idx = 3 * n / 4;
-    
-    if (q1_idx < n) {
-        stats.q1 = sorted_data[q1_idx];
-    }
-    if (q3_idx < n) {
-        stats.q3 = sorted_data[q3_idx];
-    }
+    std::array<double, 3> const quantiles{0.5, 0.25, 0.75};
+    auto const values = calculate_quantiles(*analog_time_series, quantiles, exact_quantiles);
+    stats.median = values[0];
+    stats.q1 = values[1];
+    stats.q3 = values[2];
     
     stats.iqr = stats.q3 - stats.q1;
     
@@ -64,15 +71,22 @@ std::shared_ptr<AnalogTimeSeries> scale_analog_time_series(
         return nullptr;
     }
     
-    auto const & original_data = analog_time_series->getAnalogTimeSeries();
+    auto const original_data = analog_time_series->getAnalogTimeSeriesSpan();
     auto const & time_data = analog_time_series->getTimeSeries();
     
     if (original_data.empty()) {
         return std::make_shared<AnalogTimeSeries>();
     }
     
-    std::vector<float> scaled_data = original_data;
-    AnalogStatistics stats = calculate_analog_statistics(analog_time_series);
+    std::vector<float> scaled_data(original_data.begin(), original_data.end());
+
+    // Moments come from the series' cached summary; quantiles are only needed for robust scaling
+    auto const & summary = analog_time_series->getSummaryStatistics();
+    AnalogStatistics stats;
+    stats.mean = summary.mean;
+    stats.std_dev = std::sqrt(summary.populationVariance());
+    stats.min_val = summary.min;
+    stats.max_val = summary.max;
     
     switch (params.method) {
         case ScalingMethod::FixedGain: {
@@ -115,9 +129,13 @@ std::shared_ptr<AnalogTimeSeries> scale_analog_time_series(
         }
         
         case ScalingMethod::RobustScaling: {
-            if (stats.iqr > 0) {
+            std::array<double, 3> const quantiles{0.5, params.quantile_low, params.quantile_high};
+            auto const values = calculate_quantiles(*analog_time_series, quantiles, params.exact_quantiles);
+            double const median = values[0];
+            double const spread = static_cast<double>(values[2]) - static_cast<double>(values[1]);
+            if (spread > 0) {
                 for (auto & value : scaled_data) {
-                    value = static_cast<float>((value - stats.median) / stats.iqr);
+                    value = static_cast<float>((value - median) / spread);
                 }
             }
             break;
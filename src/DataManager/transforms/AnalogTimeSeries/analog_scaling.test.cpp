@@ -0,0 +1,66 @@
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include "AnalogTimeSeries/Analog_Time_Series.hpp"
+#include "transforms/AnalogTimeSeries/analog_scaling.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+// 1..1001 in shuffled order, so the median is 501 and the quartiles 251 and 751
+AnalogTimeSeries make_shuffled_ramp() {
+    std::vector<float> values;
+    for (int i = 1; i <= 1001; ++i) {
+        values.push_back(static_cast<float>(i));
+    }
+    std::shuffle(values.begin(), values.end(), std::mt19937{42});
+    auto const num_samples = values.size();
+    return AnalogTimeSeries(std::move(values), num_samples);
+}
+
+}// namespace
+
+TEST_CASE("Analog scaling - statistics use exact quantiles by default", "[analog_scaling]") {
+    auto const series = make_shuffled_ramp();
+
+    auto const stats = calculate_analog_statistics(&series);
+
+    REQUIRE(stats.sample_count == 1001);
+    REQUIRE(stats.median == 501.0);
+    REQUIRE(stats.q1 == 251.0);
+    REQUIRE(stats.q3 == 751.0);
+    REQUIRE(stats.iqr == 500.0);
+    REQUIRE(stats.mean == Catch::Approx(501.0));
+}
+
+TEST_CASE("Analog scaling - sketched quantiles stay close to exact", "[analog_scaling]") {
+    auto const series = make_shuffled_ramp();
+
+    auto const stats = calculate_analog_statistics(&series, false);
+
+    // The sketch guarantees about 1% rank error, which is 10 ranks here
+    REQUIRE(stats.median == Catch::Approx(501.0).margin(10.0));
+    REQUIRE(stats.q1 == Catch::Approx(251.0).margin(10.0));
+    REQUIRE(stats.q3 == Catch::Approx(751.0).margin(10.0));
+}
+
+TEST_CASE("Analog scaling - robust scaling centers on the exact median", "[analog_scaling]") {
+    std::vector<float> const values{1.0f, 2.0f, 3.0f, 4.0f, 100.0f};
+    AnalogTimeSeries const series(values, values.size());
+
+    AnalogScalingParams params;
+    params.method = ScalingMethod::RobustScaling;
+
+    auto const scaled = scale_analog_time_series(&series, params);
+    REQUIRE(scaled != nullptr);
+
+    // Median 3 and quartiles 2 and 4 give (x - 3) / 2
+    auto const scaled_values = scaled->getAnalogTimeSeriesSpan();
+    REQUIRE(scaled_values.size() == values.size());
+    REQUIRE(scaled_values[0] == Catch::Approx(-1.0f));
+    REQUIRE(scaled_values[2] == Catch::Approx(0.0f));
+    REQUIRE(scaled_values[4] == Catch::Approx(48.5f));
+}
@@ -468,7 +468,7 @@ std::shared_ptr<LineData> line_alignment(LineData const * line_data,
     // Process each time that has line data
     for (auto time : line_times) {
         // Get lines at this time
-        auto const & lines = line_data->getAtTime(time);
+        auto const lines = line_data->getLineViewsAtTime(time);
         if (lines.empty()) {
             continue;
         }
@@ -489,7 +489,8 @@ std::shared_ptr<LineData> line_alignment(LineData const * line_data,
 
         // Process each line
         std::vector<Line2D> aligned_lines;
-        for (auto const & line : lines) {
+        for (auto const line_view : lines) {
+            Line2D const line(std::vector<Point2D<float>>(line_view.begin(), line_view.end()));
             if (line.size() < 3) {
                 // Skip lines with fewer than 3 vertices
                 aligned_lines.push_back(line);
@@ -5,8 +5,6 @@
 #include "CoreGeometry/line_geometry.hpp"
 #include "utils/polynomial/polynomial_fit.hpp"
 
-#include <armadillo>
-
 #include <cmath>
 #include <map>
 #include <numbers>
@@ -75,14 +73,8 @@ float calculate_polynomial_angle(Line2D const & line,
         return calculate_direct_angle(line, position, reference_x, reference_y);
     }
 
-    // Extract x and y coordinates
-    std::vector<double> x_coords;
-    std::vector<double> y_coords;
-
     auto length = calc_length(line);
 
-    x_coords.reserve(line.size());
-    y_coords.reserve(line.size());
     auto t_values_f = calc_cumulative_length_vector(line);
     for (size_t i = 0; i < line.size(); ++i) {
         // Normalize t_values to [0, 1]
@@ -91,24 +83,18 @@ float calculate_polynomial_angle(Line2D const & line,
 
     std::vector<double> t_values(t_values_f.begin(), t_values_f.end());
 
-    for (size_t i = 0; i < line.size(); ++i) {
-        x_coords.push_back(static_cast<double>(line[i].x));
-        y_coords.push_back(static_cast<double>(line[i].y));
-    }
-
     // Fit polynomials to x(t) and y(t)
-    std::vector<double> x_coeffs = fit_polynomial(t_values, x_coords, polynomial_order);
-    std::vector<double> y_coeffs = fit_polynomial(t_values, y_coords, polynomial_order);
+    auto const fit = fit_parametric_polynomial(t_values, std::span<Point2D<float> const>(line.begin(), line.end()), polynomial_order);
 
-    if (x_coeffs.empty() || y_coeffs.empty()) {
+    if (!fit.success) {
         // Fall back to direct method if fitting failed
         return calculate_direct_angle(line, position, reference_x, reference_y);
     }
 
     // Evaluate derivatives at the specified position
     double t = static_cast<double>(position);
-    double dx_dt = evaluate_polynomial_derivative(x_coeffs, t);
-    double dy_dt = evaluate_polynomial_derivative(y_coeffs, t);
+    double dx_dt = evaluate_polynomial_derivative(fit.x_coeffs, t);
+    double dy_dt = evaluate_polynomial_derivative(fit.y_coeffs, t);
 
     // Calculate angle using the derivatives
     double raw_angle = std::atan2(dy_dt, dx_dt);
@@ -162,16 +148,14 @@ std::shared_ptr<AnalogTimeSeries> line_angle(LineData const * line_data,
         reference_y = 0.0f;
     }
 
-    for (auto const & line_and_time: line_data->GetAllLinesAsRange()) {
-        if (line_and_time.lines.empty()) {
+    for (auto const & line_and_time: line_data->GetAllLineViewsAsRange()) {
+        if (line_and_time.lines.empty() || line_and_time.lines[0].size() < 2) {
             continue;
         }
 
-        Line2D const & line = line_and_time.lines[0];
-
-        if (line.size() < 2) {
-            continue;
-        }
+        // Only the first line is measured, so only it is copied out of the pool
+        auto const first_line = line_and_time.lines[0];
+        Line2D const line(std::vector<Point2D<float>>(first_line.begin(), first_line.end()));
 
         float angle = 0.0f;
 
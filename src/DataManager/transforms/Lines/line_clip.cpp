@@ -135,7 +135,7 @@ std::shared_ptr<LineData> clip_lines(
     result_line_data->setImageSize(line_data->getImageSize());
     
     // Get reference line from the specified frame
-    auto const & reference_lines = params->reference_line_data->getAtTime(TimeFrameIndex(params->reference_frame));
+    auto const reference_lines = params->reference_line_data->getLineViewsAtTime(TimeFrameIndex(params->reference_frame));
     if (reference_lines.empty()) {
         std::cerr << "LineClip: No reference line found at frame " << params->reference_frame << std::endl;
         progressCallback(100);
@@ -143,7 +143,7 @@ std::shared_ptr<LineData> clip_lines(
     }
     
     // Use the first line from the reference frame
-    Line2D const & reference_line = reference_lines[0];
+    Line2D const reference_line(std::vector<Point2D<float>>(reference_lines[0].begin(), reference_lines[0].end()));
     
     // Get all times with data for progress calculation
     auto times_with_data = line_data->getTimesWithData();
@@ -157,12 +157,13 @@ std::shared_ptr<LineData> clip_lines(
     size_t processed_times = 0;
     
     for (auto time : times_with_data) {
-        auto const & lines_at_time = line_data->getAtTime(time);
+        auto const lines_at_time = line_data->getLineViewsAtTime(time);
         
-        for (auto const & line : lines_at_time) {
-            if (line.size() < 2) {
+        for (auto const line_view : lines_at_time) {
+            if (line_view.size() < 2) {
                 continue; // Skip lines that are too short
             }
+            Line2D const line(std::vector<Point2D<float>>(line_view.begin(), line_view.end()));
             
             // Clip the line using the reference line
             Line2D clipped_line = clip_line_at_intersection(line, reference_line, params->clip_side);
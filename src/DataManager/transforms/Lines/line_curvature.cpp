@@ -21,24 +21,9 @@ std::optional<float> calculate_polynomial_curvature(
         return std::nullopt;
     }
 
-    std::vector<double> t_values_full_line = compute_t_values(line);
-    if (t_values_full_line.empty()) {
-        std::cerr << "LineCurvature: Failed to compute t-values for the full line." << std::endl;
-        return std::nullopt;
-    }
-
-    std::vector<double> x_coords, y_coords;
-    x_coords.reserve(line.size());
-    y_coords.reserve(line.size());
-    for (auto const & p: line) {
-        x_coords.push_back(static_cast<double>(p.x));
-        y_coords.push_back(static_cast<double>(p.y));
-    }
+    auto const fit = fit_parametric_polynomial(std::span<Point2D<float> const>(line.begin(), line.end()), polynomial_order);
 
-    std::vector<double> x_coeffs = fit_single_dimension_polynomial_internal(x_coords, t_values_full_line, polynomial_order);
-    std::vector<double> y_coeffs = fit_single_dimension_polynomial_internal(y_coords, t_values_full_line, polynomial_order);
-
-    if (x_coeffs.empty() || y_coeffs.empty()) {
+    if (!fit.success) {
         std::cerr << "LineCurvature: Polynomial fitting failed for X or Y coefficients on the full line." << std::endl;
         return std::nullopt;
     }
@@ -61,12 +46,12 @@ std::optional<float> calculate_polynomial_curvature(
     double t_plus_h = std::min(1.0, t_eval + h);
 
     // Evaluate polynomial at t_eval, t_eval-h, and t_eval+h
-    double x_t = evaluate_polynomial(x_coeffs, t_eval);
-    double y_t = evaluate_polynomial(y_coeffs, t_eval);
-    double x_t_minus_h = evaluate_polynomial(x_coeffs, t_minus_h);
-    double y_t_minus_h = evaluate_polynomial(y_coeffs, t_minus_h);
-    double x_t_plus_h = evaluate_polynomial(x_coeffs, t_plus_h);
-    double y_t_plus_h = evaluate_polynomial(y_coeffs, t_plus_h);
+    double x_t = evaluate_polynomial(fit.x_coeffs, t_eval);
+    double y_t = evaluate_polynomial(fit.y_coeffs, t_eval);
+    double x_t_minus_h = evaluate_polynomial(fit.x_coeffs, t_minus_h);
+    double y_t_minus_h = evaluate_polynomial(fit.y_coeffs, t_minus_h);
+    double x_t_plus_h = evaluate_polynomial(fit.x_coeffs, t_plus_h);
+    double y_t_plus_h = evaluate_polynomial(fit.y_coeffs, t_plus_h);
 
     // Calculate derivatives using central differences
     // Note: The effective h for points that hit the boundary (0 or 1) will be smaller.
@@ -151,11 +136,7 @@ std::shared_ptr<AnalogTimeSeries> line_curvature(
     }
 
     // Determine total number of time points for progress calculation
-    size_t total_time_points = 0;
-    for (auto const & time_lines_pair: line_data->GetAllLinesAsRange()) {
-        (void)time_lines_pair;
-        total_time_points++;
-    }
+    size_t const total_time_points = line_data->getTimesWithData().size();
     if (total_time_points == 0) {
         progressCallback(100);
         return std::make_shared<AnalogTimeSeries>();
@@ -168,7 +149,7 @@ std::shared_ptr<AnalogTimeSeries> line_curvature(
     int polynomial_order = params->polynomial_order;
     float fitting_window = params->fitting_window_percentage;// Get fitting_window again
 
-    for (auto const & time_lines_pair: line_data->GetAllLinesAsRange()) {
+    for (auto const & time_lines_pair: line_data->GetAllLineViewsAsRange()) {
         if (time_lines_pair.lines.empty()) {
             processed_time_points++;
             int current_progress = static_cast<int>(std::round(static_cast<double>(processed_time_points) / static_cast<double>(total_time_points) * 100.0));
@@ -177,15 +158,17 @@ std::shared_ptr<AnalogTimeSeries> line_curvature(
         }
 
         // Process only the first line at each time point, similar to LineAngle
-        Line2D const & line = time_lines_pair.lines[0];
+        auto const first_line = time_lines_pair.lines[0];
 
-        if (line.size() < 2) {// Need at least two points to define a direction/curvature
+        if (first_line.size() < 2) {// Need at least two points to define a direction/curvature
             processed_time_points++;
             int current_progress = static_cast<int>(std::round(static_cast<double>(processed_time_points) / static_cast<double>(total_time_points) * 100.0));
             progressCallback(current_progress);
             continue;
         }
 
+        Line2D const line(std::vector<Point2D<float>>(first_line.begin(), first_line.end()));
+
         std::optional<float> curvature_val;
         if (params->method == CurvatureCalculationMethod::PolynomialFit) {
             curvature_val = calculate_polynomial_curvature(line, position, polynomial_order, fitting_window);// Pass fitting_window
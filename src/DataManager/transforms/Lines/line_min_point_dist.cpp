@@ -161,7 +161,7 @@ std::shared_ptr<AnalogTimeSeries> line_min_point_dist(LineData const * line_data
     // Process each time that has line data
     for (auto time: line_times) {
         // Get lines at this time
-        auto const & lines = line_data->getAtTime(time);
+        auto const lines = line_data->getLineViewsAtTime(time);
         if (lines.empty()) {
             continue;// Skip if no lines at this time
         }
@@ -173,7 +173,7 @@ std::shared_ptr<AnalogTimeSeries> line_min_point_dist(LineData const * line_data
         }
 
         // Use only the first line for simplicity
-        Line2D const & line = lines[0];
+        Line2D const line(std::vector<Point2D<float>>(lines[0].begin(), lines[0].end()));
 
         // Find minimum distance from any point to the line
         float min_distance_squared = std::numeric_limits<float>::max();
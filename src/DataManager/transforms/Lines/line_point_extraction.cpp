@@ -50,35 +50,18 @@ std::optional<Point2D<float>> extract_parametric_point(
         return extract_direct_point(line, position, true);
     }
     
-    // Compute t-values for the entire line
-    std::vector<double> t_values = compute_t_values(line);
-    if (t_values.empty()) {
-        return extract_direct_point(line, position, true);
-    }
-    
-    // Extract coordinates
-    std::vector<double> x_coords, y_coords;
-    x_coords.reserve(line.size());
-    y_coords.reserve(line.size());
-    
-    for (auto const & point : line) {
-        x_coords.push_back(static_cast<double>(point.x));
-        y_coords.push_back(static_cast<double>(point.y));
-    }
-    
-    // Fit parametric polynomials
-    std::vector<double> x_coeffs = fit_single_dimension_polynomial_internal(x_coords, t_values, polynomial_order);
-    std::vector<double> y_coeffs = fit_single_dimension_polynomial_internal(y_coords, t_values, polynomial_order);
+    // Fit parametric polynomials over the arc length of the entire line
+    auto const fit = fit_parametric_polynomial(std::span<Point2D<float> const>(line.begin(), line.end()), polynomial_order);
     
-    if (x_coeffs.empty() || y_coeffs.empty()) {
+    if (!fit.success) {
         // Fall back to direct method if fitting failed
         return extract_direct_point(line, position, true);
     }
     
     // Evaluate polynomials at the specified position
     double t_eval = static_cast<double>(position);
-    double x = evaluate_polynomial(x_coeffs, t_eval);
-    double y = evaluate_polynomial(y_coeffs, t_eval);
+    double x = evaluate_polynomial(fit.x_coeffs, t_eval);
+    double y = evaluate_polynomial(fit.y_coeffs, t_eval);
     
     return Point2D<float>{static_cast<float>(x), static_cast<float>(y)};
 }
@@ -117,13 +100,14 @@ std::shared_ptr<PointData> extract_line_point(
     
     size_t processed_times = 0;
     for (auto time : times_with_data) {
-        auto const & lines_at_time = line_data->getAtTime(time);
+        auto const lines_at_time = line_data->getLineViewsAtTime(time);
         
         // Process only the first line at each time point (similar to other line operations)
         if (!lines_at_time.empty()) {
-            auto const & line = lines_at_time[0];
+            auto const first_line = lines_at_time[0];
             
-            if (!line.empty()) {
+            if (!first_line.empty()) {
+                Line2D const line(std::vector<Point2D<float>>(first_line.begin(), first_line.end()));
                 std::optional<Point2D<float>> extracted_point;
                 
                 if (params.method == PointExtractionMethod::Direct) {
@@ -68,10 +68,7 @@ DataTypeVariant LineResampleOperation::execute(DataTypeVariant const & dataVaria
               << ", epsilon = " << params->epsilon << std::endl;
 
     auto resampled_line_map = std::map<TimeFrameIndex, std::vector<Line2D>>();
-    int total_lines = 0;
-    for (auto const & time_lines_pair: input_line_data->GetAllLinesAsRange()) {
-        total_lines += static_cast<int>(time_lines_pair.lines.size());
-    }
+    auto const total_lines = static_cast<int>(input_line_data->getTotalLineCount());
     if (total_lines == 0) {
         progressCallback(100);
         auto empty_result = std::make_shared<LineData>();
@@ -82,12 +79,13 @@ DataTypeVariant LineResampleOperation::execute(DataTypeVariant const & dataVaria
     int processed_lines = 0;
     progressCallback(0);
 
-    for (auto const & time_lines_pair: input_line_data->GetAllLinesAsRange()) {
+    for (auto const & time_lines_pair: input_line_data->GetAllLineViewsAsRange()) {
         TimeFrameIndex time = time_lines_pair.time;
         std::vector<Line2D> new_lines_at_time;
         new_lines_at_time.reserve(time_lines_pair.lines.size());
 
-        for (auto const & single_line: time_lines_pair.lines) {
+        for (auto const line_view: time_lines_pair.lines) {
+            Line2D const single_line(std::vector<Point2D<float>>(line_view.begin(), line_view.end()));
             if (single_line.empty()) {
                 new_lines_at_time.push_back(Line2D());// Keep empty lines as empty
             } else {
@@ -107,13 +105,10 @@ DataTypeVariant LineResampleOperation::execute(DataTypeVariant const & dataVaria
                 progressCallback(static_cast<int>((static_cast<double>(processed_lines) / total_lines) * 100.0));
             }
         }
-        if (!new_lines_at_time.empty() || input_line_data->getAtTime(time).empty()) {
-            // Add to map if there are new lines OR if the original time had lines (even if all became empty)
-            // This ensures that times that previously had data but now have all empty lines are still represented.
-            // However, if a time originally had no lines, we don't add an empty entry for it.
-            if (!input_line_data->getAtTime(time).empty() || !new_lines_at_time.empty()) {
-                resampled_line_map[time] = std::move(new_lines_at_time);
-            }
+        // Times that had lines are kept even if every line became empty;
+        // times that originally had no lines get no entry.
+        if (!time_lines_pair.lines.empty()) {
+            resampled_line_map[time] = std::move(new_lines_at_time);
         }
     }
 
@@ -2,7 +2,6 @@
 
 #include "Lines/Line_Data.hpp"
 #include "CoreGeometry/line_geometry.hpp"
-#include "utils/polynomial/parametric_polynomial_utils.hpp"
 #include "utils/polynomial/polynomial_fit.hpp"
 
 #include <algorithm>
@@ -75,21 +74,10 @@ std::vector<Point2D<float>> extract_parametric_subsegment(
         t_values.push_back(static_cast<double>(distance / total_length));
     }
     
-    // Extract coordinates
-    std::vector<double> x_coords, y_coords;
-    x_coords.reserve(line.size());
-    y_coords.reserve(line.size());
-    
-    for (auto const & point : line) {
-        x_coords.push_back(static_cast<double>(point.x));
-        y_coords.push_back(static_cast<double>(point.y));
-    }
-    
     // Fit parametric polynomials
-    std::vector<double> x_coeffs = fit_single_dimension_polynomial_internal(x_coords, t_values, polynomial_order);
-    std::vector<double> y_coeffs = fit_single_dimension_polynomial_internal(y_coords, t_values, polynomial_order);
+    auto const fit = fit_parametric_polynomial(t_values, std::span<Point2D<float> const>(line.begin(), line.end()), polynomial_order);
     
-    if (x_coeffs.empty() || y_coeffs.empty()) {
+    if (!fit.success) {
         // Fall back to direct method if fitting failed
         return extract_direct_subsegment(line, start_pos, end_pos, false);
     }
@@ -104,8 +92,8 @@ std::vector<Point2D<float>> extract_parametric_subsegment(
         float t_global = start_pos + t_local * (end_pos - start_pos);
         
         // Evaluate polynomials at this t-value
-        double x = evaluate_polynomial(x_coeffs, static_cast<double>(t_global));
-        double y = evaluate_polynomial(y_coeffs, static_cast<double>(t_global));
+        double x = evaluate_polynomial(fit.x_coeffs, static_cast<double>(t_global));
+        double y = evaluate_polynomial(fit.y_coeffs, static_cast<double>(t_global));
         
         subsegment.push_back({static_cast<float>(x), static_cast<float>(y)});
     }
@@ -147,12 +135,13 @@ std::shared_ptr<LineData> extract_line_subsegment(
     
     size_t processed_times = 0;
     for (auto time : times_with_data) {
-        auto const & lines_at_time = line_data->getAtTime(time);
+        auto const lines_at_time = line_data->getLineViewsAtTime(time);
         
-        for (auto const & line : lines_at_time) {
-            if (line.empty()) {
+        for (auto const line_view : lines_at_time) {
+            if (line_view.empty()) {
                 continue;
             }
+            Line2D const line(std::vector<Point2D<float>>(line_view.begin(), line_view.end()));
             
             std::vector<Point2D<float>> subsegment;
             
@@ -56,7 +56,7 @@ TEST_CASE("Mask centroid calculation - Core functionality", "[mask][centroid][tr
         REQUIRE(points.size() == 2);// Two masks = two centroids
 
         // Sort points by x coordinate for consistent testing
-        auto sorted_points = points;
+        std::vector<Point2D<float>> sorted_points(points.begin(), points.end());
         std::sort(sorted_points.begin(), sorted_points.end(),
                   [](auto const & a, auto const & b) { return a.x < b.x; });
 
@@ -178,7 +178,7 @@ TEST_CASE("Mask centroid calculation - Edge cases and error handling", "[mask][c
         REQUIRE(points.size() == 2);
 
         // Sort points by x coordinate for consistent testing
-        auto sorted_points = points;
+        std::vector<Point2D<float>> sorted_points(points.begin(), points.end());
         std::sort(sorted_points.begin(), sorted_points.end(),
                   [](auto const & a, auto const & b) { return a.x < b.x; });
 
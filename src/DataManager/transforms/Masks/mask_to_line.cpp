@@ -6,15 +6,12 @@
 #include "CoreGeometry/line_resampling.hpp"
 #include "CoreGeometry/order_line.hpp"
 #include "Masks/utils/skeletonize.hpp"
+#include "Tracing/Tracing.hpp"
 #include "utils/polynomial/parametric_polynomial_utils.hpp"
 #include "utils/polynomial/polynomial_fit.hpp"
 
-#include <armadillo>
-
-#include <chrono>
 #include <cmath>
 #include <iostream>
-#include <numeric>// for std::accumulate
 #include <vector>
 
 
@@ -30,40 +27,13 @@ std::vector<double> fit_polynomial_to_points(Line2D const & points, int order) {
         return {};
     }
 
-    // Extract x and y coordinates
-    std::vector<double> x_coords;
     std::vector<double> y_coords;
-
-    x_coords.reserve(points.size());
     y_coords.reserve(points.size());
-
     for (auto const & point: points) {
-        x_coords.push_back(static_cast<double>(point.x));
         y_coords.push_back(static_cast<double>(point.y));
     }
 
-    // Create Armadillo matrix for Vandermonde matrix
-    arma::mat X(t_values.size(), static_cast<arma::uword>(order) + 1);
-    arma::vec Y(y_coords.data(), y_coords.size());
-
-    // Build Vandermonde matrix
-    for (size_t i = 0; i < t_values.size(); ++i) {
-        for (int j = 0; j <= order; ++j) {
-            X(i, static_cast<arma::uword>(j)) = std::pow(t_values[i], static_cast<double>(j));
-        }
-    }
-
-    // Solve least squares problem
-    arma::vec coeffs;
-    bool success = arma::solve(coeffs, X, Y);
-
-    if (!success) {
-        return {};// Failed to solve
-    }
-
-    // Convert Armadillo vector to std::vector
-    std::vector<double> result(coeffs.begin(), coeffs.end());
-    return result;
+    return fit_polynomial(t_values, y_coords, order);
 }
 
 ParametricCoefficients fit_parametric_polynomials(Line2D const & points, int order) {
@@ -71,29 +41,12 @@ ParametricCoefficients fit_parametric_polynomials(Line2D const & points, int ord
         return {{}, {}, false};
     }
 
-    std::vector<double> t_values = compute_t_values(points);
-    if (t_values.empty()) {
-        return {{}, {}, false};
-    }
-
-    std::vector<double> x_coords;
-    std::vector<double> y_coords;
-    x_coords.reserve(points.size());
-    y_coords.reserve(points.size());
-
-    for (auto const & point: points) {
-        x_coords.push_back(static_cast<double>(point.x));
-        y_coords.push_back(static_cast<double>(point.y));
-    }
-
-    std::vector<double> x_coeffs_fit = fit_single_dimension_polynomial_internal(x_coords, t_values, order);
-    std::vector<double> y_coeffs_fit = fit_single_dimension_polynomial_internal(y_coords, t_values, order);
-
-    if (x_coeffs_fit.empty() || y_coeffs_fit.empty()) {
+    auto fit = fit_parametric_polynomial(std::span<Point2D<float> const>(points.begin(), points.end()), order);
+    if (!fit.success) {
         return {{}, {}, false};
     }
 
-    return {x_coeffs_fit, y_coeffs_fit, true};
+    return {std::move(fit.x_coeffs), std::move(fit.y_coeffs), true};
 }
 
 // Helper function to generate a smoothed line from parametric polynomial coefficients
@@ -169,12 +122,11 @@ std::vector<float> calculate_fitting_errors(std::vector<Point2D<float>> const &
     errors.reserve(points.size());
 
     for (size_t i = 0; i < points.size(); ++i) {
-        double fitted_x = evaluate_polynomial(x_coeffs, t_values[i]);
-        double fitted_y = evaluate_polynomial(y_coeffs, t_values[i]);
+        double const dx = static_cast<double>(points[i].x) - evaluate_polynomial(x_coeffs, t_values[i]);
+        double const dy = static_cast<double>(points[i].y) - evaluate_polynomial(y_coeffs, t_values[i]);
 
         // Use squared error directly (no square root)
-        float error_squared = static_cast<float>(std::pow(static_cast<double>(points[i].x) - fitted_x, 2) +
-                              std::pow(static_cast<double>(points[i].y) - fitted_y, 2));
+        auto const error_squared = static_cast<float>(dx * dx + dy * dy);
         errors.push_back(error_squared);
     }
 
@@ -196,37 +148,12 @@ Line2D remove_outliers_recursive(Line2D const & points,
         return points;
     }
 
-    // Extract x and y coordinates
-    std::vector<double> x_coords_recursive;
-    std::vector<double> y_coords_recursive;
-
-    x_coords_recursive.reserve(points.size());
-    y_coords_recursive.reserve(points.size());
-
-    for (auto const & point: points) {
-        x_coords_recursive.push_back(static_cast<double>(point.x));
-        y_coords_recursive.push_back(static_cast<double>(point.y));
-    }
-
-    // Create Armadillo matrices
-    arma::mat X(t_values_recursive.size(), static_cast<arma::uword>(polynomial_order) + 1);
-    arma::vec X_vec(x_coords_recursive.data(), x_coords_recursive.size());
-    arma::vec Y_vec(y_coords_recursive.data(), y_coords_recursive.size());
+    // Fit x(t) and y(t) jointly
+    auto const fit = fit_parametric_polynomial(t_values_recursive,
+                                               std::span<Point2D<float> const>(points.begin(), points.end()),
+                                               polynomial_order);
 
-    // Build Vandermonde matrix
-    for (size_t i = 0; i < t_values_recursive.size(); ++i) {
-        for (int j = 0; j <= polynomial_order; ++j) {
-            X(i, static_cast<arma::uword>(j)) = std::pow(t_values_recursive[i], static_cast<double>(j));
-        }
-    }
-
-    // Solve least squares problems
-    arma::vec x_coeffs_recursive;
-    arma::vec y_coeffs_recursive;
-    bool success_x = arma::solve(x_coeffs_recursive, X, X_vec);
-    bool success_y = arma::solve(y_coeffs_recursive, X, Y_vec);
-
-    if (!success_x || !success_y) {
+    if (!fit.success) {
         return points;// Failed to fit, return original points
     }
 
@@ -236,17 +163,11 @@ Line2D remove_outliers_recursive(Line2D const & points,
     bool any_points_removed = false;
 
     for (size_t i = 0; i < points.size(); ++i) {
-        double fitted_x = 0.0;
-        double fitted_y = 0.0;
-
-        for (int j = 0; j <= polynomial_order; ++j) {
-            fitted_x += x_coeffs_recursive(static_cast<arma::uword>(j)) * std::pow(t_values_recursive[i], static_cast<double>(j));
-            fitted_y += y_coeffs_recursive(static_cast<arma::uword>(j)) * std::pow(t_values_recursive[i], static_cast<double>(j));
-        }
+        double const dx = static_cast<double>(points[i].x) - evaluate_polynomial(fit.x_coeffs, t_values_recursive[i]);
+        double const dy = static_cast<double>(points[i].y) - evaluate_polynomial(fit.y_coeffs, t_values_recursive[i]);
 
         // Use squared error directly (no square root)
-        float error_squared = static_cast<float>(std::pow(static_cast<double>(points[i].x) - fitted_x, 2) +
-                              std::pow(static_cast<double>(points[i].y) - fitted_y, 2));
+        auto const error_squared = static_cast<float>(dx * dx + dy * dy);
 
         // Keep point if error is below threshold
         if (error_squared <= error_threshold_squared) {
@@ -294,6 +215,7 @@ std::shared_ptr<LineData> mask_to_line(MaskData const * mask_data, MaskToLinePar
 std::shared_ptr<LineData> mask_to_line(MaskData const * mask_data,
                                        MaskToLineParameters const * params,
                                        ProgressCallback progressCallback) {
+    TRACE_ZONE_NAMED(zone, "mask_to_line", "transform", {});
 
     auto line_map = std::map<TimeFrameIndex, std::vector<Line2D>>();
 
@@ -308,16 +230,6 @@ std::shared_ptr<LineData> mask_to_line(MaskData const * mask_data,
     bool should_smooth_line = params ? params->should_smooth_line : false;
     float output_resolution = params ? params->output_resolution : 5.0f;
 
-    std::cout << "reference_x: " << reference_x << std::endl;
-    std::cout << "reference_y: " << reference_y << std::endl;
-    std::cout << "method: " << static_cast<int>(method) << std::endl;
-    std::cout << "polynomial_order: " << polynomial_order << std::endl;
-    std::cout << "error_threshold: " << error_threshold << std::endl;
-    std::cout << "should_remove_outliers: " << should_remove_outliers << std::endl;
-    std::cout << "input_point_subsample_factor: " << input_point_subsample_factor << std::endl;
-    std::cout << "should_smooth_line: " << should_smooth_line << std::endl;
-    std::cout << "output_resolution: " << output_resolution << std::endl;
-
     Point2D<float> reference_point{reference_x, reference_y};
 
     // Initial progress
@@ -325,6 +237,7 @@ std::shared_ptr<LineData> mask_to_line(MaskData const * mask_data,
 
     // Count total masks to process for progress calculation
     size_t const total_masks = mask_data->size();
+    TRACE_ZONE_VALUE(zone, "masks", total_masks);
 
     if (total_masks == 0) {
         progressCallback(100);
@@ -341,13 +254,6 @@ std::shared_ptr<LineData> mask_to_line(MaskData const * mask_data,
 
     std::vector<uint8_t> binary_image(static_cast<size_t>(image_size.width * image_size.height), 0);
 
-    // Timing variables
-    std::vector<long long> skeletonize_times;
-    std::vector<long long> order_line_times;
-    std::vector<long long> outlier_removal_times;
-    std::vector<long long> map_insertion_times;
-    std::vector<long long> smoothing_times;
-
     size_t processed_masks = 0;
     for (auto const & mask_time_pair: mask_data->getAllAsRange()) {
         auto time = mask_time_pair.time;
@@ -380,49 +286,27 @@ std::shared_ptr<LineData> mask_to_line(MaskData const * mask_data,
                 }
             }
 
-            // Time skeletonization
-            auto skeletonize_start = std::chrono::high_resolution_clock::now();
-            auto skeleton = fast_skeletonize(binary_image, static_cast<size_t>(image_size.height), static_cast<size_t>(image_size.width));
-            auto skeletonize_end = std::chrono::high_resolution_clock::now();
-            skeletonize_times.push_back(
-                    std::chrono::duration_cast<std::chrono::microseconds>(
-                            skeletonize_end - skeletonize_start)
-                            .count());
-
-            // Time ordering step
-            auto order_start = std::chrono::high_resolution_clock::now();
+            std::vector<uint8_t> skeleton;
+            {
+                TRACE_ZONE("skeletonize", "transform");
+                skeleton = fast_skeletonize(binary_image, static_cast<size_t>(image_size.height), static_cast<size_t>(image_size.width));
+            }
+
+            TRACE_ZONE("order_line", "transform");
             line_points = order_line(skeleton, image_size, reference_point, input_point_subsample_factor);
-            auto order_end = std::chrono::high_resolution_clock::now();
-            order_line_times.push_back(
-                    std::chrono::duration_cast<std::chrono::microseconds>(
-                            order_end - order_start)
-                            .count());
         } else {
-
-            // Time ordering step for this method
-            auto order_start = std::chrono::high_resolution_clock::now();
+            TRACE_ZONE("order_line", "transform");
             line_points = order_line(mask, reference_point, input_point_subsample_factor);
-            auto order_end = std::chrono::high_resolution_clock::now();
-            order_line_times.push_back(
-                    std::chrono::duration_cast<std::chrono::microseconds>(
-                            order_end - order_start)
-                            .count());
         }
 
         if (should_remove_outliers && line_points.size() > static_cast<size_t>(polynomial_order + 2)) {
-            // Time outlier removal
-            auto outlier_start = std::chrono::high_resolution_clock::now();
+            TRACE_ZONE("remove_outliers", "transform");
             line_points = remove_outliers(line_points, error_threshold, polynomial_order);
-            auto outlier_end = std::chrono::high_resolution_clock::now();
-            outlier_removal_times.push_back(
-                    std::chrono::duration_cast<std::chrono::microseconds>(
-                            outlier_end - outlier_start)
-                            .count());
         }
 
         // Apply smoothing if requested and enough points exist
         if (should_smooth_line && line_points.size() > static_cast<size_t>(polynomial_order)) {// Need at least order+1 points
-            auto smoothing_start = std::chrono::high_resolution_clock::now();
+            TRACE_ZONE("smooth line", "transform");
             ParametricCoefficients coeffs = fit_parametric_polynomials(line_points, polynomial_order);
             if (coeffs.success) {
                 line_points = generate_smoothed_line(line_points, coeffs.x_coeffs, coeffs.y_coeffs, polynomial_order, output_resolution);
@@ -432,71 +316,17 @@ std::shared_ptr<LineData> mask_to_line(MaskData const * mask_data,
                     line_points = resample_line_points(line_points, output_resolution);
                 }
             }
-            auto smoothing_end = std::chrono::high_resolution_clock::now();
-            smoothing_times.push_back(
-                    std::chrono::duration_cast<std::chrono::microseconds>(
-                            smoothing_end - smoothing_start)
-                            .count());
         } else if (!line_points.empty()) {
             // If not smoothing (or not enough points for smoothing), apply resampling directly
             line_points = resample_line_points(line_points, output_resolution);
         }
 
         if (!line_points.empty()) {
-            // Time map insertion
-            auto insertion_start = std::chrono::high_resolution_clock::now();
             line_map[time].push_back(std::move(line_points));
-            auto insertion_end = std::chrono::high_resolution_clock::now();
-            map_insertion_times.push_back(
-                    std::chrono::duration_cast<std::chrono::microseconds>(
-                            insertion_end - insertion_start)
-                            .count());
         }
 
         processed_masks++;
 
-        // Print timing statistics every 1000 iterations or on the last iteration
-        if (processed_masks % 1000 == 0 || processed_masks == total_masks) {
-            if (!skeletonize_times.empty()) {
-                double skeletonize_avg = std::accumulate(skeletonize_times.begin(), skeletonize_times.end(), 0.0) /
-                                         static_cast<double>(skeletonize_times.size());
-                std::cout << "Average skeletonization time: " << skeletonize_avg << " μs" << std::endl;
-            }
-
-            if (!order_line_times.empty()) {
-                double order_avg = std::accumulate(order_line_times.begin(), order_line_times.end(), 0.0) /
-                                   static_cast<double>(order_line_times.size());
-                std::cout << "Average order_line time: " << order_avg << " μs" << std::endl;
-            }
-
-            if (!outlier_removal_times.empty()) {
-                double outlier_avg = std::accumulate(outlier_removal_times.begin(), outlier_removal_times.end(), 0.0) /
-                                     static_cast<double>(outlier_removal_times.size());
-                std::cout << "Average outlier removal time: " << outlier_avg << " μs" << std::endl;
-            }
-
-            if (!map_insertion_times.empty()) {
-                double insertion_avg = std::accumulate(map_insertion_times.begin(), map_insertion_times.end(), 0.0) /
-                                       static_cast<double>(map_insertion_times.size());
-                std::cout << "Average map insertion time: " << insertion_avg << " μs" << std::endl;
-            }
-
-            if (!smoothing_times.empty()) {
-                double smoothing_avg = std::accumulate(smoothing_times.begin(), smoothing_times.end(), 0.0) /
-                                       static_cast<double>(smoothing_times.size());
-                std::cout << "Average smoothing time: " << smoothing_avg << " μs" << std::endl;
-            }
-
-            // Clear the vectors to only keep the last 1000 measurements
-            if (processed_masks % 1000 == 0 && processed_masks < total_masks) {
-                skeletonize_times.clear();
-                order_line_times.clear();
-                outlier_removal_times.clear();
-                map_insertion_times.clear();
-                smoothing_times.clear();
-            }
-        }
-
         int progress = static_cast<int>(std::round((static_cast<double>(processed_masks) / static_cast<double>(total_masks)) * 100.0));
         progressCallback(progress);
     }
@@ -2,11 +2,63 @@
 
 #include "whiskertracker.hpp"
 
+#ifdef ENABLE_OPENCV
+#include "Media/Image_Data.hpp"
+#endif
+
 #include <algorithm>
 #include <iostream>
 #include <memory>
 #include <vector>
 
+namespace {
+
+/**
+ * @brief Decode the raw frames of an image sequence for one batch concurrently
+ *
+ * @return false if @p media is not an image sequence, in which case the
+ * frames must be loaded one by one
+ */
+bool decode_image_batch(MediaData & media,
+                        int first_frame,
+                        int count,
+                        std::vector<std::vector<uint8_t>> & images,
+                        std::vector<int> & times) {
+#ifdef ENABLE_OPENCV
+    auto * image_data = dynamic_cast<ImageData *>(&media);
+    if (!image_data) {
+        return false;
+    }
+
+    // Frames decoded at a different size than the media reports cannot be traced with its size
+    auto const frame_bytes = image_data->decodedFrameBytes();
+    if (frame_bytes == 0 || image_data->decodedFrameSize() != image_data->getImageSize()) {
+        return false;
+    }
+
+    std::vector<uint8_t> frames(frame_bytes * static_cast<size_t>(count));
+    image_data->decodeFrameRange(first_frame, count, frames);
+
+    images.reserve(static_cast<size_t>(count));
+    times.reserve(static_cast<size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        auto const frame_begin = frames.begin() + static_cast<std::ptrdiff_t>(static_cast<size_t>(i) * frame_bytes);
+        images.emplace_back(frame_begin, frame_begin + static_cast<std::ptrdiff_t>(frame_bytes));
+        times.push_back(first_frame + i);
+    }
+    return true;
+#else
+    static_cast<void>(media);
+    static_cast<void>(first_frame);
+    static_cast<void>(count);
+    static_cast<void>(images);
+    static_cast<void>(times);
+    return false;
+#endif
+}
+
+}// namespace
+
 // Convert whisker::Line2D to Line2D
 Line2D WhiskerTracingOperation::convert_to_Line2D(whisker::Line2D const & whisker_line) {
     Line2D line;
@@ -152,8 +204,14 @@ DataTypeVariant WhiskerTracingOperation::execute(DataTypeVariant const & dataVar
             std::vector<std::vector<uint8_t>> batch_images;
             std::vector<int> batch_times;
 
+            size_t const batch_count = std::min(static_cast<size_t>(typed_params->batch_size), total_time_points - i);
+
+            // Raw image sequences are decoded for the whole batch at once across threads
+            bool const batch_decoded = !typed_params->use_processed_data &&
+                                       decode_image_batch(*media_data, static_cast<int>(i), static_cast<int>(batch_count), batch_images, batch_times);
+
             // Collect images for this batch
-            for (size_t j = 0; j < static_cast<size_t>(typed_params->batch_size) && (i + j) < total_time_points; ++j) {
+            for (size_t j = 0; !batch_decoded && j < batch_count; ++j) {
                 auto time = i + j;
                 std::vector<uint8_t> image_data;
 
@@ -3,6 +3,7 @@
 #include "DataManager.hpp"
 #include "ParameterFactory.hpp"
 #include "TransformRegistry.hpp"
+#include "Tracing/Tracing.hpp"
 
 #include <algorithm>
 #include <chrono>
@@ -84,6 +85,8 @@ bool TransformPipeline::loadFromJsonFile(std::string const& json_file_path) {
 }
 
 PipelineResult TransformPipeline::execute(PipelineProgressCallback progress_callback) {
+    TRACE_ZONE_NAMED(zone, "TransformPipeline::execute", "pipeline", {});
+    TRACE_ZONE_VALUE(zone, "steps", steps_.size());
     auto start_time = std::chrono::high_resolution_clock::now();
     
     PipelineResult result;
@@ -148,6 +151,7 @@ PipelineResult TransformPipeline::execute(PipelineProgressCallback progress_call
 }
 
 StepResult TransformPipeline::executeStep(PipelineStep const& step, ProgressCallback progress_callback) {
+    TRACE_ZONE_DETAIL("TransformPipeline::executeStep", "pipeline", step.step_id);
     auto start_time = std::chrono::high_resolution_clock::now();
     
     StepResult result;
@@ -185,10 +189,13 @@ StepResult TransformPipeline::executeStep(PipelineStep const& step, ProgressCall
         
         // Execute the transform
         DataTypeVariant output_data;
-        if (progress_callback) {
-            output_data = operation->execute(input_data, parameters.get(), progress_callback);
-        } else {
-            output_data = operation->execute(input_data, parameters.get());
+        {
+            TRACE_ZONE(step.transform_name, "transform");
+            if (progress_callback) {
+                output_data = operation->execute(input_data, parameters.get(), progress_callback);
+            } else {
+                output_data = operation->execute(input_data, parameters.get());
+            }
         }
         
         // Check if execution was successful (assuming empty variant means failure)
@@ -35,13 +35,28 @@ std::vector<float> AnalogDataAdapter::getDataInRange(TimeFrameIndex start,
     return std::vector<float>(data_span.begin(), data_span.end());
 }
 
+AnalogSliceBatch AnalogDataAdapter::getDataInRanges(std::vector<TimeFrameInterval> const & intervals,
+                                                    TimeFrame const * target_timeFrame) {
+    auto const bounds = m_analogData->findDataArrayBoundsInTimeFrameIndexRanges(intervals,
+                                                                                target_timeFrame,
+                                                                                m_timeFrame.get());
+
+    AnalogSliceBatch batch;
+    batch.view = m_analogData->getAnalogTimeSeriesSpan();
+    batch.bounds.reserve(bounds.size());
+    for (auto const & [first, last]: bounds) {
+        batch.bounds.emplace_back(first.getValue(), last.getValue());
+    }
+    return batch;
+}
+
 void AnalogDataAdapter::materializeData() {
     if (m_isMaterialized) {
         return;
     }
 
     // Get the float data from AnalogTimeSeries
-    auto const & floatData = m_analogData->getAnalogTimeSeries();
+    auto const floatData = m_analogData->getAnalogTimeSeriesSpan();
 
     // Convert to double
     m_materializedData.clear();
@@ -67,6 +67,19 @@ public:
                                       TimeFrameIndex end,
                                       TimeFrame const * target_timeFrame) override;
 
+    /**
+     * @brief Gets the data for a batch of intervals without copying.
+     * 
+     * Boundaries for all intervals are resolved in one sweep over the time storage
+     * and the returned batch views the AnalogTimeSeries samples directly.
+     * 
+     * @param intervals The [start, end] (inclusive) ranges, in the target time frame.
+     * @param target_timeFrame The target time frame (from the caller) for the data.
+     * @return The slices for each interval, in the same order as @p intervals.
+     */
+    AnalogSliceBatch getDataInRanges(std::vector<TimeFrameInterval> const & intervals,
+                                     TimeFrame const * target_timeFrame) override;
+
 private:
     /**
      * @brief Materializes the analog data if not already done.
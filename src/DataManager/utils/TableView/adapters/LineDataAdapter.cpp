@@ -25,19 +25,18 @@ auto LineDataAdapter::getTimeFrame() const -> std::shared_ptr<TimeFrame> {
 
 auto LineDataAdapter::size() const -> size_t {
     // Count total number of lines across all time frames
-    size_t totalLines = 0;
-    for (auto const & [time, lines]: m_lineData->GetAllLinesAsRange()) {
-        totalLines += lines.size();
-    }
-    return totalLines;
+    return m_lineData->getTotalLineCount();
 }
 
 auto LineDataAdapter::getLines() -> std::vector<Line2D> {
     std::vector<Line2D> allLines;
+    allLines.reserve(m_lineData->getTotalLineCount());
     
     // Collect all lines from all time frames
-    for (auto const & [time, lines]: m_lineData->GetAllLinesAsRange()) {
-        allLines.insert(allLines.end(), lines.begin(), lines.end());
+    for (auto const & [time, lines]: m_lineData->GetAllLineViewsAsRange()) {
+        for (auto const line: lines) {
+            allLines.emplace_back(std::vector<Point2D<float>>(line.begin(), line.end()));
+        }
     }
     
     return allLines;
@@ -49,8 +48,7 @@ auto LineDataAdapter::getLinesInRange(TimeFrameIndex start,
     // Fast path: when start == end, avoid constructing a ranges pipeline.
     // Directly fetch the lines at the single time index using timeframe conversion.
     if (start == end) {
-        auto const & lines_ref = m_lineData->getAtTime(start, target_timeFrame, m_timeFrame.get());
-        return {lines_ref.begin(), lines_ref.end()};
+        return m_lineData->getAtTime(start, target_timeFrame, m_timeFrame.get());
     }
 
     // Use the LineData's built-in method to get lines in the time range.
@@ -70,7 +68,7 @@ auto LineDataAdapter::getLinesInRange(TimeFrameIndex start,
 
 bool LineDataAdapter::hasMultiSamples() const {
     // Check if any timestamp has more than one line
-    for (auto const & [time, lines]: m_lineData->GetAllLinesAsRange()) {
+    for (auto const & [time, lines]: m_lineData->GetAllLineViewsAsRange()) {
         if (lines.size() > 1) {
             return true;
         }
@@ -79,20 +77,23 @@ bool LineDataAdapter::hasMultiSamples() const {
 }
 
 auto LineDataAdapter::getEntityCountAt(TimeFrameIndex t) const -> size_t {
-    auto const& lines_ref = m_lineData->getAtTime(t, m_timeFrame.get(), m_timeFrame.get());
-    return lines_ref.size();
+    return m_lineData->getLineViewsAtTime(t).size();
 }
 
 auto LineDataAdapter::getLineAt(TimeFrameIndex t, int entityIndex) const -> Line2D const* {
-    auto const& lines_ref = m_lineData->getAtTime(t, m_timeFrame.get(), m_timeFrame.get());
-    if (entityIndex < 0 || static_cast<size_t>(entityIndex) >= lines_ref.size()) {
+    auto const lines = m_lineData->getLineViewsAtTime(t);
+    if (entityIndex < 0 || static_cast<size_t>(entityIndex) >= lines.size()) {
         return nullptr;
     }
-    return &lines_ref[static_cast<size_t>(entityIndex)];
+    // Lines live in LineData's shared vertex pool, so hand out a copy that stays valid until the next call
+    auto const line = lines[static_cast<size_t>(entityIndex)];
+    static thread_local Line2D copiedLine;
+    copiedLine = Line2D(std::vector<Point2D<float>>(line.begin(), line.end()));
+    return &copiedLine;
 }
 
 EntityId LineDataAdapter::getEntityIdAt(TimeFrameIndex t, int entityIndex) const {
-    auto const & ids = m_lineData->getEntityIdsAtTime(t);
+    auto const ids = m_lineData->getEntityIdsAtTime(t);
     if (entityIndex < 0 || static_cast<size_t>(entityIndex) >= ids.size()) return 0;
     return ids[static_cast<size_t>(entityIndex)];
 }
\ No newline at end of file
@@ -29,11 +29,7 @@ std::shared_ptr<TimeFrame> PointComponentAdapter::getTimeFrame() const {
 size_t PointComponentAdapter::size() const {
     if (!m_isMaterialized) {
         // Calculate size without materializing
-        size_t totalPoints = 0;
-        for (auto const & [time, points]: m_pointData->GetAllPointsAsRange()) {
-            totalPoints += points.size();
-        }
-        return totalPoints;
+        return m_pointData->getTotalPointCount();
     }
     return m_materializedData.size();
 }
@@ -95,22 +91,9 @@ void PointComponentAdapter::materializeData() {
     m_materializedData.clear();
     m_materializedData.reserve(size());
 
-    // Collect all points in time order and extract the specified component
-    std::vector<std::pair<TimeFrameIndex, std::vector<Point2D<float>> const *>> timePointPairs;
-
+    // Points are stored in time order, so they can be streamed straight out
     for (auto const & [time, points]: m_pointData->GetAllPointsAsRange()) {
-        timePointPairs.emplace_back(time, &points);
-    }
-
-    // Sort by time to ensure consistent ordering
-    std::sort(timePointPairs.begin(), timePointPairs.end(),
-              [](auto const & a, auto const & b) {
-                  return a.first < b.first;
-              });
-
-    // Extract the component values
-    for (auto const & [time, points]: timePointPairs) {
-        for (auto const & point: *points) {
+        for (auto const & point: points) {
             double componentValue = (m_component == Component::X) ? static_cast<double>(point.x) : static_cast<double>(point.y);
             m_materializedData.push_back(componentValue);
         }
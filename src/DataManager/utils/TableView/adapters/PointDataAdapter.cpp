@@ -24,11 +24,7 @@ std::shared_ptr<TimeFrame> PointDataAdapter::getTimeFrame() const {
 }
 
 size_t PointDataAdapter::size() const {
-    size_t totalPoints = 0;
-    for (auto const & [time, points] : m_pointData->GetAllPointsAsRange()) {
-        totalPoints += points.size();
-    }
-    return totalPoints;
+    return m_pointData->getTotalPointCount();
 }
 
 std::vector<Point2D<float>> PointDataAdapter::getPoints() {
@@ -63,11 +59,9 @@ std::vector<Point2D<float>> PointDataAdapter::getPointsInRange(TimeFrameIndex st
         sourceEnd = end;
     }
     
-    for (auto const & [time, points] : m_pointData->GetAllPointsAsRange()) {
-        if (time >= sourceStart && time <= sourceEnd) {
-            for (auto const & point : points) {
-                rangePoints.emplace_back(point.x, point.y);
-            }
+    for (auto const & [time, points] : m_pointData->GetPointsInRange(TimeFrameInterval(sourceStart, sourceEnd))) {
+        for (auto const & point : points) {
+            rangePoints.emplace_back(point.x, point.y);
         }
     }
     
@@ -84,26 +78,17 @@ bool PointDataAdapter::hasMultiSamples() const {
 }
 
 size_t PointDataAdapter::getEntityCountAt(TimeFrameIndex t) const {
-    for (auto const & [time, points] : m_pointData->GetAllPointsAsRange()) {
-        if (time == t) {
-            return points.size();
-        }
-    }
-    return 0;
+    return m_pointData->getAtTime(t).size();
 }
 
 Point2D<float> const* PointDataAdapter::getPointAt(TimeFrameIndex t, int entityIndex) const {
-    for (auto const & [time, points] : m_pointData->GetAllPointsAsRange()) {
-        if (time == t) {
-            if (entityIndex >= 0 && static_cast<size_t>(entityIndex) < points.size()) {
-                // Convert from internal point format to Point2D
-                static thread_local Point2D<float> convertedPoint;
-                convertedPoint.x = points[static_cast<size_t>(entityIndex)].x;
-                convertedPoint.y = points[static_cast<size_t>(entityIndex)].y;
-                return &convertedPoint;
-            }
-            break;
-        }
+    auto const points = m_pointData->getAtTime(t);
+    if (entityIndex >= 0 && static_cast<size_t>(entityIndex) < points.size()) {
+        // Convert from internal point format to Point2D
+        static thread_local Point2D<float> convertedPoint;
+        convertedPoint.x = points[static_cast<size_t>(entityIndex)].x;
+        convertedPoint.y = points[static_cast<size_t>(entityIndex)].y;
+        return &convertedPoint;
     }
     return nullptr;
 }
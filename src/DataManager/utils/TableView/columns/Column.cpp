@@ -1,8 +1,11 @@
 #include "Column.h"
 
+#include "Tracing/Tracing.hpp"
 #include "utils/TableView/interfaces/IColumnComputer.h"
 #include "utils/TableView/core/TableView.h"
 
+#include <algorithm>
+
 template<SupportedColumnType T>
 Column<T>::Column(std::string name, std::unique_ptr<IColumnComputer<T>> computer)
     : m_name(std::move(name)),
@@ -16,16 +19,45 @@ auto Column<T>::getValues(TableView * table) -> std::vector<T> const & {
     return std::get<std::vector<T>>(m_cache);
 }
 
+template<SupportedColumnType T>
+auto Column<T>::getValuesInRange(TableView * table, size_t begin, size_t end) -> std::vector<T> {
+    if (begin >= end) {
+        return {};
+    }
+
+    if (!isMaterialized()) {
+        ExecutionPlan const & plan = table->getExecutionPlanFor(getSourceDependency());
+
+        // Entity-expanded plans and columns built from other columns need the whole table
+        if (m_computer->isRowLocal() && m_computer->getDependencies().empty() && plan.getRows().empty()) {
+            TRACE_ZONE_NAMED(zone, "Column::computeRange", "tableview", m_name);
+            TRACE_ZONE_VALUE(zone, "rows", end - begin);
+            return m_computer->computeRange(plan, begin, end);
+        }
+
+        materialize(table);
+    }
+
+    auto const & values = std::get<std::vector<T>>(m_cache);
+    size_t const first = std::min(begin, values.size());
+    size_t const last = std::min(end, values.size());
+    return std::vector<T>(values.begin() + static_cast<std::ptrdiff_t>(first),
+                          values.begin() + static_cast<std::ptrdiff_t>(last));
+}
+
 template<SupportedColumnType T>
 void Column<T>::materialize(TableView * table) {
     if (isMaterialized()) {
         return;
     }
+    TRACE_ZONE_NAMED(zone, "Column::materialize", "tableview", m_name);
 
     ExecutionPlan const & plan = table->getExecutionPlanFor(getSourceDependency());
 
     // Compute the column values using the computer
     auto computed = m_computer->compute(plan);
+    TRACE_ZONE_VALUE(zone, "rows", computed.size());
+    TRACE_ALLOCATION("tableview", computed.size() * sizeof(T));
 
     // Store the computed values in the cache
     m_cache = std::move(computed);
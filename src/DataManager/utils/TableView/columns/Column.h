@@ -39,6 +39,21 @@ public:
      */
     [[nodiscard]] auto getValues(TableView * table) -> std::vector<T> const &;
 
+    /**
+     * @brief Gets the values of rows [begin, end) without caching them.
+     * 
+     * Row-local columns that are not yet materialized are computed for the
+     * requested rows only, so a caller can stream a large table in blocks
+     * without holding every column in memory. Other columns are materialized
+     * in full and the requested rows are copied out.
+     * 
+     * @param table Pointer to the TableView that owns this column.
+     * @param begin First row to return.
+     * @param end One past the last row to return.
+     * @return The column values for the requested rows.
+     */
+    [[nodiscard]] auto getValuesInRange(TableView * table, size_t begin, size_t end) -> std::vector<T>;
+
     /**
      * @brief Triggers computation of the column data without exposing the type.
      * 
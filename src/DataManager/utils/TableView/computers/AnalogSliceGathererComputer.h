@@ -4,6 +4,7 @@
 #include "utils/TableView/interfaces/IColumnComputer.h"
 #include "utils/TableView/core/ExecutionPlan.h"
 #include "utils/TableView/interfaces/IAnalogSource.h"
+#include "utils/parallel_for.hpp"
 
 #include <memory>
 #include <span>
@@ -19,7 +20,8 @@
  * 
  * This computer strategy is responsible for iterating through an ExecutionPlan
  * of interval index pairs and, for each pair, copying the corresponding slice
- * of data from an IAnalogSource into a new vector. The result is a column where
+ * of data from an IAnalogSource into a new vector. Slices are requested from
+ * the source as a single batch and the cells are filled in parallel chunks. The result is a column where
  * each cell contains a std::vector<T> of the analog data within that interval.
  * 
  * @tparam T The numeric type for the gathered data (typically double or float).
@@ -71,24 +73,26 @@ public:
         auto const & intervals = plan.getIntervals();
         auto destinationTimeFrame = plan.getTimeFrame();
 
-        // This is our final result: a vector of vectors
-        std::vector<T> results;
-        results.reserve(intervals.size());
+        // Resolve every interval's slice up front so boundary searches are shared
+        auto const slices = m_source->getDataInRanges(intervals, destinationTimeFrame.get());
 
-        for (auto const & interval: intervals) {
-            
-            auto sliceView = m_source->getDataInRange(
-                interval.start, 
-                interval.end, 
-                destinationTimeFrame.get()
-            );
+        // This is our final result: a vector of vectors
+        std::vector<T> results(intervals.size());
 
-            // This constructs the vector for the cell
-            results.emplace_back(sliceView.begin(), sliceView.end());
-        }
+        // Each cell is an independent copy, so fill them in parallel chunks
+        constexpr size_t min_intervals_per_chunk = 1024;
+        parallel_for_chunks(slices.size(), min_intervals_per_chunk, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                auto const sliceView = slices.slice(i);
+                // This constructs the vector for the cell
+                results[i] = T(sliceView.begin(), sliceView.end());
+            }
+        });
         return results;
     }
 
+    [[nodiscard]] auto isRowLocal() const -> bool override { return true; }
+
     [[nodiscard]] auto getSourceDependency() const -> std::string override {
         return m_sourceName.empty() ? m_source->getName() : m_sourceName;
     }
@@ -49,6 +49,8 @@ public:
      */
     [[nodiscard]] auto getOutputNames() const -> std::vector<std::string> override;
 
+    [[nodiscard]] bool isRowLocal() const override { return true; }
+
     /**
      * @brief Source dependency name for this computation.
      */
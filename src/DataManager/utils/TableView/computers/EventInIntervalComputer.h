@@ -140,6 +140,8 @@ public:
      */
     [[nodiscard]] std::vector<T> compute(ExecutionPlan const & plan) const override;
 
+    [[nodiscard]] bool isRowLocal() const override { return true; }
+
     /**
      * @brief Returns the name of the data source this computer depends on.
      * 
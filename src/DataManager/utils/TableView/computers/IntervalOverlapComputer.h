@@ -121,11 +121,11 @@ public:
 
                         if (m_operation == IntervalOverlapOperation::AssignID_Start) {
                             // Convert into row time frame
-                            auto source_start_index = destinationTimeFrame->getIndexAtTime(static_cast<float>(source_start));
+                            auto source_start_index = destinationTimeFrame->getIndexAtTime(static_cast<double>(source_start));
                             results.push_back(static_cast<T>(source_start_index.getValue()));
                         } else if (m_operation == IntervalOverlapOperation::AssignID_End) {
                             // Convert into row time frame
-                            auto source_end_index = destinationTimeFrame->getIndexAtTime(static_cast<float>(source_end));
+                            auto source_end_index = destinationTimeFrame->getIndexAtTime(static_cast<double>(source_end));
                             results.push_back(static_cast<T>(source_end_index.getValue()));
                         } else {
                             results.push_back(static_cast<T>(columnIntervals.size() - 1));
@@ -148,6 +148,8 @@ public:
         return results;
     }
 
+    [[nodiscard]] auto isRowLocal() const -> bool override { return true; }
+
     [[nodiscard]] auto getSourceDependency() const -> std::string override {
         return m_sourceName;
     }
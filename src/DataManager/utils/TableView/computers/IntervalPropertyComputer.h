@@ -82,6 +82,8 @@ public:
         return results;
     }
 
+    [[nodiscard]] auto isRowLocal() const -> bool override { return true; }
+
     [[nodiscard]] auto getSourceDependency() const -> std::string override {
         return m_sourceName;
     }
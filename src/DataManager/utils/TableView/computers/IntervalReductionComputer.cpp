@@ -1,11 +1,11 @@
 #include "IntervalReductionComputer.h"
 
 #include "utils/TableView/interfaces/IAnalogSource.h"
+#include "utils/parallel_for.hpp"
 
 #include <algorithm>
 #include <cmath>
 #include <limits>
-#include <numeric>
 #include <stdexcept>
 
 IntervalReductionComputer::IntervalReductionComputer(std::shared_ptr<IAnalogSource> source, 
@@ -44,21 +44,18 @@ std::vector<double> IntervalReductionComputer::compute(const ExecutionPlan& plan
     auto const & intervals = plan.getIntervals();
     auto destinationTimeFrame = plan.getTimeFrame();
 
-    std::vector<double> results;
-    results.reserve(intervals.size());
+    // Resolve every interval's slice up front so boundary searches are shared
+    auto const slices = m_source->getDataInRanges(intervals, destinationTimeFrame.get());
 
-    for (auto const & interval: intervals) {
-            
-        auto sliceView = m_source->getDataInRange(
-            interval.start, 
-            interval.end, 
-            destinationTimeFrame.get()
-        );
+    std::vector<double> results(intervals.size());
 
-         const float result = computeReduction(sliceView);
-
-        results.emplace_back(result);
-    }
+    // Each interval is independent, so reduce them in parallel chunks
+    constexpr size_t min_intervals_per_chunk = 1024;
+    parallel_for_chunks(slices.size(), min_intervals_per_chunk, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            results[i] = computeReduction(slices.slice(i));
+        }
+    });
 
     return results;
 
@@ -68,83 +65,38 @@ std::string IntervalReductionComputer::getSourceDependency() const {
     return m_sourceName;
 }
 
-float IntervalReductionComputer::computeReduction(std::span<const float> data) const {
+double IntervalReductionComputer::computeReduction(std::span<const float> data) const {
     if (data.empty()) {
-        return std::numeric_limits<float>::quiet_NaN();
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    // Count does not need to look at the samples
+    if (m_reduction == ReductionType::Count) {
+        return static_cast<double>(data.size());
+    }
+
+    return reduceSummary(calculate_summary(data));
+}
+
+double IntervalReductionComputer::reduceSummary(SummaryStatistics const & summary) const {
+    if (summary.count == 0) {
+        return std::numeric_limits<double>::quiet_NaN();
     }
 
     switch (m_reduction) {
         case ReductionType::Mean:
-            return computeMean(data);
+            return summary.mean;
         case ReductionType::Max:
-            return computeMax(data);
+            return static_cast<double>(summary.max);
         case ReductionType::Min:
-            return computeMin(data);
+            return static_cast<double>(summary.min);
         case ReductionType::StdDev:
-            return computeStdDev(data);
+            return std::sqrt(summary.sampleVariance()); // Sample standard deviation
         case ReductionType::Sum:
-            return computeSum(data);
+            return summary.sum;
         case ReductionType::Count:
-            return computeCount(data);
+            return static_cast<double>(summary.count);
         default:
             throw std::invalid_argument("Unknown reduction type");
     }
 }
-
-float IntervalReductionComputer::computeMean(std::span<const float> data) const {
-    if (data.empty()) {
-        return std::numeric_limits<float>::quiet_NaN();
-    }
-
-    const float sum = std::accumulate(data.begin(), data.end(), 0.0f);
-    return sum / static_cast<float>(data.size());
-}
-
-float IntervalReductionComputer::computeMax(std::span<const float> data) const {
-    if (data.empty()) {
-        return std::numeric_limits<float>::quiet_NaN();
-    }
-
-    return *std::max_element(data.begin(), data.end());
-}
-
-float IntervalReductionComputer::computeMin(std::span<const float> data) const {
-    if (data.empty()) {
-        return std::numeric_limits<float>::quiet_NaN();
-    }
-
-    return *std::min_element(data.begin(), data.end());
-}
-
-float IntervalReductionComputer::computeStdDev(std::span<const float> data) const {
-    if (data.empty()) {
-        return std::numeric_limits<float>::quiet_NaN();
-    }
-
-    if (data.size() == 1) {
-        return 0.0;
-    }
-
-    const float mean = computeMean(data);
-    float variance = 0.0;
-
-    for (const float value : data) {
-        const float diff = value - mean;
-        variance += diff * diff;
-    }
-
-    variance /= static_cast<float>(data.size() - 1); // Sample standard deviation
-    return std::sqrt(variance);
-}
-
-float IntervalReductionComputer::computeSum(std::span<const float> data) const {
-    if (data.empty()) {
-        return 0.0f;
-    }
-
-    return std::accumulate(data.begin(), data.end(), 0.0f);
-}
-
-float IntervalReductionComputer::computeCount(std::span<const float> data) const {
-    return static_cast<float>(data.size());
-}
@@ -1,6 +1,7 @@
 #ifndef INTERVAL_REDUCTION_COMPUTER_H
 #define INTERVAL_REDUCTION_COMPUTER_H
 
+#include "AnalogTimeSeries/utils/statistics.hpp"
 #include "utils/TableView/interfaces/IColumnComputer.h"
 
 #include <cstdint>
@@ -31,8 +32,9 @@ enum class ReductionType : std::uint8_t {
  * 
  * This computer takes an analog source and performs reduction operations
  * (mean, max, min, std dev, etc.) over specified intervals. It uses the
- * ExecutionPlan to get interval pairs and computes the reduction for each
- * interval using efficient span-based data access.
+ * ExecutionPlan to get interval pairs, fetches all slices from the source in
+ * one batch, and reduces each slice with a single fused pass
+ * (see calculate_summary). Intervals are reduced in parallel chunks.
  */
 class IntervalReductionComputer : public IColumnComputer<double> {
 public:
@@ -58,6 +60,7 @@ public:
 
     // IColumnComputer interface implementation
     [[nodiscard]] auto compute(const ExecutionPlan& plan) const -> std::vector<double> override;
+    [[nodiscard]] auto isRowLocal() const -> bool override { return true; }
     [[nodiscard]] auto getSourceDependency() const -> std::string override;
 
 private:
@@ -67,55 +70,15 @@ private:
      * @param data Span over the data for the interval.
      * @return The computed reduction value.
      */
-    [[nodiscard]] auto computeReduction(std::span<const float> data) const -> float;
+    [[nodiscard]] auto computeReduction(std::span<const float> data) const -> double;
 
     /**
-     * @brief Computes the mean of the data span.
+     * @brief Extracts the requested reduction from precomputed summary statistics.
      * 
-     * @param data Span over the data.
-     * @return The mean value.
+     * @param summary Single-pass summary of the interval's data.
+     * @return The computed reduction value, or NaN if the summary is empty.
      */
-    [[nodiscard]] auto computeMean(std::span<const float> data) const -> float;
-
-    /**
-     * @brief Computes the maximum of the data span.
-     * 
-     * @param data Span over the data.
-     * @return The maximum value.
-     */
-    [[nodiscard]] auto computeMax(std::span<const float> data) const -> float;
-
-    /**
-     * @brief Computes the minimum of the data span.
-     * 
-     * @param data Span over the data.
-     * @return The minimum value.
-     */
-    [[nodiscard]] auto computeMin(std::span<const float> data) const -> float;
-
-    /**
-     * @brief Computes the standard deviation of the data span.
-     * 
-     * @param data Span over the data.
-     * @return The standard deviation value.
-     */
-    [[nodiscard]] auto computeStdDev(std::span<const float> data) const -> float;
-
-    /**
-     * @brief Computes the sum of the data span.
-     * 
-     * @param data Span over the data.
-     * @return The sum value.
-     */
-    [[nodiscard]] auto computeSum(std::span<const float> data) const -> float;
-
-    /**
-     * @brief Returns the count of values in the data span.
-     * 
-     * @param data Span over the data.
-     * @return The count as a float.
-     */
-    [[nodiscard]] auto computeCount(std::span<const float> data) const -> float;
+    [[nodiscard]] auto reduceSummary(SummaryStatistics const & summary) const -> double;
 
     std::shared_ptr<IAnalogSource> m_source;
     ReductionType m_reduction;
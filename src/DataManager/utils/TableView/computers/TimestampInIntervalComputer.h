@@ -38,6 +38,8 @@ public:
      */
     [[nodiscard]] auto compute(ExecutionPlan const & plan) const -> std::vector<bool> override;
 
+    [[nodiscard]] auto isRowLocal() const -> bool override { return true; }
+
     [[nodiscard]] auto getSourceDependency() const -> std::string override { return m_sourceName; }
 
 private:
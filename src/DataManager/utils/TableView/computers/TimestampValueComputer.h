@@ -59,6 +59,8 @@ public:
      */
     [[nodiscard]] auto compute(const ExecutionPlan& plan) const -> std::vector<double> override;
 
+    [[nodiscard]] auto isRowLocal() const -> bool override { return true; }
+
     /**
      * @brief Returns the source dependency name.
      * @return The name of the analog source this computer depends on.
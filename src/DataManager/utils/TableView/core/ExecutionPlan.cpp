@@ -1,5 +1,7 @@
 #include "ExecutionPlan.h"
 
+#include <algorithm>
+
 ExecutionPlan::ExecutionPlan(std::vector<TimeFrameIndex> indices, std::shared_ptr<TimeFrame> timeFrame)
     : m_indices(std::move(indices)),
       m_timeFrame(std::move(timeFrame)) {
@@ -37,3 +39,21 @@ void ExecutionPlan::setIntervals(std::vector<TimeFrameInterval> intervals) {
     // Clear indices to maintain consistency
     m_indices.clear();
 }
+
+ExecutionPlan ExecutionPlan::sliceRows(size_t begin, size_t end) const {
+    auto slice = [begin, end](auto const & values) {
+        using Values = std::decay_t<decltype(values)>;
+        size_t const first = std::min(begin, values.size());
+        size_t const last = std::min(std::max(end, first), values.size());
+        return Values(values.begin() + static_cast<std::ptrdiff_t>(first),
+                      values.begin() + static_cast<std::ptrdiff_t>(last));
+    };
+
+    ExecutionPlan plan;
+    plan.m_indices = slice(m_indices);
+    plan.m_intervals = slice(m_intervals);
+    plan.m_timeFrame = m_timeFrame;
+    plan.m_sourceId = m_sourceId;
+    plan.m_sourceKind = m_sourceKind;
+    return plan;
+}
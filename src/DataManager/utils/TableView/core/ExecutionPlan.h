@@ -75,6 +75,19 @@ public:
      */
     void setIntervals(std::vector<TimeFrameInterval> intervals);
 
+    /**
+     * @brief Creates a plan covering only rows [begin, end) of this plan.
+     *
+     * Indices and intervals are sliced; the TimeFrame and source identity are kept.
+     * Entity-expanded rows are not sliced, so callers should only slice plans
+     * where getRows() is empty.
+     *
+     * @param begin First row to keep.
+     * @param end One past the last row to keep.
+     * @return The sliced plan.
+     */
+    [[nodiscard]] ExecutionPlan sliceRows(size_t begin, size_t end) const;
+
     /**
      * @brief Gets the TimeFrame associated with this execution plan.
      * @return Shared pointer to the TimeFrame.
@@ -1,5 +1,6 @@
 #include "TableView.h"
 
+#include "Tracing/Tracing.hpp"
 #include "utils/TableView/adapters/DataManagerExtension.h"
 #include "utils/TableView/columns/IColumn.h"
 #include "utils/TableView/interfaces/ILineSource.h"
@@ -126,8 +127,30 @@ ColumnDataVariant TableView::getColumnDataVariant(std::string const & name) {
     return result.value();
 }
 
+ColumnDataVariant TableView::getColumnDataVariantInRange(std::string const & name, size_t begin, size_t end) {
+    auto type_index = getColumnTypeIndex(name);
+
+    std::optional<ColumnDataVariant> result;
+
+    for_each_type<SupportedColumnElementTypes>([&](auto, auto type_instance) {
+        using ElementType = std::decay_t<decltype(type_instance)>;
+
+        if (!result.has_value() && type_index == std::type_index(typeid(ElementType))) {
+            result = getColumnValuesInRange<ElementType>(name, begin, end);
+        }
+    });
+
+    if (!result.has_value()) {
+        throw std::runtime_error("Unsupported column type: " + std::string(type_index.name()) +
+                                " for column: " + name);
+    }
+
+    return std::move(result.value());
+}
 
 void TableView::materializeAll() {
+    TRACE_ZONE_NAMED(zone, "TableView::materializeAll", "tableview", {});
+    TRACE_ZONE_VALUE(zone, "columns", m_columns.size());
     std::set<std::string> materializing;
 
     for (auto const & column: m_columns) {
@@ -221,6 +244,7 @@ void TableView::materializeColumn(std::string const & columnName, std::set<std::
 }
 
 ExecutionPlan TableView::generateExecutionPlan(std::string const & sourceName) {
+    TRACE_ZONE_DETAIL("TableView::generateExecutionPlan", "tableview", sourceName);
     // Try to get the data source to understand its structure
     // First try as analog source
 
@@ -63,6 +63,22 @@ public:
     template<SupportedColumnType T>
     [[nodiscard]] auto getColumnValues(std::string const & name) -> std::vector<T> const &;
 
+    /**
+     * @brief Gets the values of rows [begin, end) of a column without caching them.
+     * 
+     * Row-local columns are computed for the requested block only; see
+     * Column::getValuesInRange. This is the building block for streaming exports.
+     * 
+     * @tparam T The expected type of the column data.
+     * @param name The name of the column to retrieve.
+     * @param begin First row to return.
+     * @param end One past the last row to return.
+     * @return The column values for the requested rows.
+     * @throws std::runtime_error if the column is not found or type mismatch.
+     */
+    template<SupportedColumnType T>
+    [[nodiscard]] auto getColumnValuesInRange(std::string const & name, size_t begin, size_t end) -> std::vector<T>;
+
     /**
      * @brief Gets the names of all columns in the table.
      * @return Vector of column names.
@@ -116,6 +132,16 @@ public:
     template<typename Visitor>
     auto visitColumnData(std::string const & name, Visitor&& visitor) -> decltype(auto);
 
+    /**
+     * @brief Gets rows [begin, end) of a column as a variant without caching them.
+     * @param name The column name.
+     * @param begin First row to return.
+     * @param end One past the last row to return.
+     * @return ColumnDataVariant containing the requested rows.
+     * @throws std::runtime_error if the column is not found or type not supported.
+     */
+    [[nodiscard]] auto getColumnDataVariantInRange(std::string const & name, size_t begin, size_t end) -> ColumnDataVariant;
+
     /**
      * @brief Materializes all columns in the table.
      * 
@@ -248,6 +274,22 @@ auto TableView::getColumnValues(std::string const & name) -> std::vector<T> cons
     return typedColumn->getValues(this);
 }
 
+// Template method implementation for getColumnValuesInRange
+template<SupportedColumnType T>
+auto TableView::getColumnValuesInRange(std::string const & name, size_t begin, size_t end) -> std::vector<T> {
+    auto it = m_colNameToIndex.find(name);
+    if (it == m_colNameToIndex.end()) {
+        throw std::runtime_error("Column '" + name + "' not found in table");
+    }
+
+    auto * typedColumn = dynamic_cast<Column<T> *>(m_columns[it->second].get());
+    if (!typedColumn) {
+        throw std::runtime_error("Column '" + name + "' is not of the requested type");
+    }
+
+    return typedColumn->getValuesInRange(this, begin, end);
+}
+
 // Template method implementation for visitColumnData
 template<typename Visitor>
 auto TableView::visitColumnData(std::string const & name, Visitor&& visitor) -> decltype(auto) {
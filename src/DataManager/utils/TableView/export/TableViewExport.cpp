@@ -0,0 +1,261 @@
+#include "TableViewExport.h"
+
+#include "utils/TableView/core/TableView.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace {
+
+template<typename T>
+void appendNumber(std::string & buffer, T value, int precision) {
+    std::array<char, 512> chars{};
+    std::to_chars_result result{};
+    if constexpr (std::is_floating_point_v<T>) {
+        result = std::to_chars(chars.data(), chars.data() + chars.size(), value, std::chars_format::fixed, precision);
+        if (result.ec != std::errc()) {
+            result = std::to_chars(chars.data(), chars.data() + chars.size(), value);
+        }
+    } else {
+        result = std::to_chars(chars.data(), chars.data() + chars.size(), value);
+    }
+    buffer.append(chars.data(), result.ptr);
+}
+
+template<typename T>
+void appendElement(std::string & buffer, T const & value, int precision) {
+    if constexpr (std::is_same_v<T, bool>) {
+        buffer.push_back(value ? '1' : '0');
+    } else if constexpr (std::is_same_v<T, TimeFrameIndex>) {
+        appendNumber(buffer, value.getValue(), precision);
+    } else {
+        appendNumber(buffer, value, precision);
+    }
+}
+
+/**
+ * @brief Appends row @p row of a block of column values to @p buffer.
+ */
+void appendCell(std::string & buffer, ColumnDataVariant const & block, size_t row, TableCsvExportOptions const & options) {
+    std::visit([&](auto const & values) {
+        if (row >= values.size()) {
+            buffer.append("NaN");
+            return;
+        }
+
+        using Element = typename std::decay_t<decltype(values)>::value_type;
+        if constexpr (std::is_same_v<Element, bool>) {
+            appendElement(buffer, static_cast<bool>(values[row]), options.precision);
+        } else if constexpr (requires { typename Element::value_type; }) {
+            auto const & list = values[row];
+            if (list.empty()) {
+                return;
+            }
+            buffer.push_back('"');
+            for (size_t i = 0; i < list.size(); ++i) {
+                if (i > 0) buffer.append(options.list_delimiter);
+                appendElement(buffer, list[i], options.precision);
+            }
+            buffer.push_back('"');
+        } else {
+            appendElement(buffer, values[row], options.precision);
+        }
+    },
+               block);
+}
+
+/**
+ * @brief NumPy dtype descriptor for a scalar column element type, if it has one.
+ */
+std::optional<std::string> npyDescriptor(std::type_index const & type) {
+    char const byte_order = std::endian::native == std::endian::little ? '<' : '>';
+    auto with_order = [byte_order](char kind, size_t size) {
+        return std::string(1, byte_order) + kind + std::to_string(size);
+    };
+
+    if (type == typeid(float)) return with_order('f', sizeof(float));
+    if (type == typeid(double)) return with_order('f', sizeof(double));
+    if (type == typeid(int)) return with_order('i', sizeof(int));
+    if (type == typeid(int64_t)) return with_order('i', sizeof(int64_t));
+    if (type == typeid(bool)) return std::string("|b1");
+    return std::nullopt;
+}
+
+/**
+ * @brief Writes a NumPy format 1.0 header for a 1-D array.
+ */
+void writeNpyHeader(std::ostream & out, std::string const & descriptor, size_t rows) {
+    std::string header = "{'descr': '" + descriptor + "', 'fortran_order': False, 'shape': (" + std::to_string(rows) + ",), }";
+
+    // Magic (6) + version (2) + header length (2) + header, padded to a multiple of 64 and ending in '\n'
+    size_t const preamble = 10;
+    size_t const total = ((preamble + header.size() + 1 + 63) / 64) * 64;
+    header.append(total - preamble - header.size() - 1, ' ');
+    header.push_back('\n');
+
+    auto const header_length = static_cast<uint16_t>(header.size());
+    std::array<char, 10> const magic = {'\x93', 'N', 'U', 'M', 'P', 'Y', '\x01', '\x00',
+                                        static_cast<char>(header_length & 0xFF),
+                                        static_cast<char>((header_length >> 8) & 0xFF)};
+    out.write(magic.data(), static_cast<std::streamsize>(magic.size()));
+    out.write(header.data(), static_cast<std::streamsize>(header.size()));
+}
+
+template<typename T>
+void writeNpyBlock(std::ostream & out, std::vector<T> const & values, size_t expected_rows) {
+    if constexpr (std::is_same_v<T, bool>) {
+        std::vector<uint8_t> bytes(expected_rows, 0);
+        for (size_t i = 0; i < std::min(values.size(), expected_rows); ++i) {
+            bytes[i] = values[i] ? 1 : 0;
+        }
+        out.write(reinterpret_cast<char const *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    } else {
+        size_t const available = std::min(values.size(), expected_rows);
+        out.write(reinterpret_cast<char const *>(values.data()), static_cast<std::streamsize>(available * sizeof(T)));
+
+        // Pad short blocks so the file always matches the declared shape
+        if (available < expected_rows) {
+            T fill{};
+            if constexpr (std::is_floating_point_v<T>) {
+                fill = std::numeric_limits<T>::quiet_NaN();
+            }
+            std::vector<T> const padding(expected_rows - available, fill);
+            out.write(reinterpret_cast<char const *>(padding.data()), static_cast<std::streamsize>(padding.size() * sizeof(T)));
+        }
+    }
+}
+
+std::string sanitizeFileName(std::string name) {
+    for (auto & c: name) {
+        bool const safe = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+                          c == '.' || c == '_' || c == '-';
+        if (!safe) c = '_';
+    }
+    return name.empty() ? std::string("column") : name;
+}
+
+}// namespace
+
+void exportTableToCsv(TableView & table, std::ostream & out, TableCsvExportOptions const & options) {
+    auto const names = table.getColumnNames();
+    size_t const rows = table.getRowCount();
+    size_t const block_rows = std::max<size_t>(options.block_rows, 1);
+
+    std::string buffer;
+
+    if (options.include_header) {
+        for (size_t c = 0; c < names.size(); ++c) {
+            if (c > 0) buffer.append(options.delimiter);
+            buffer.append(names[c]);
+        }
+        buffer.append(options.line_ending);
+    }
+
+    std::vector<ColumnDataVariant> blocks(names.size());
+    for (size_t begin = 0; begin < rows; begin += block_rows) {
+        size_t const end = std::min(begin + block_rows, rows);
+
+        for (size_t c = 0; c < names.size(); ++c) {
+            blocks[c] = table.getColumnDataVariantInRange(names[c], begin, end);
+        }
+
+        for (size_t r = 0; r < end - begin; ++r) {
+            for (size_t c = 0; c < names.size(); ++c) {
+                if (c > 0) buffer.append(options.delimiter);
+                appendCell(buffer, blocks[c], r, options);
+            }
+            buffer.append(options.line_ending);
+        }
+
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (!out) {
+            throw std::runtime_error("Failed while writing table to CSV");
+        }
+        buffer.clear();
+    }
+
+    if (!buffer.empty()) {
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+    out.flush();
+    if (!out) {
+        throw std::runtime_error("Failed while writing table to CSV");
+    }
+}
+
+void exportTableToCsv(TableView & table, std::filesystem::path const & filepath, TableCsvExportOptions const & options) {
+    std::ofstream file(filepath, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open file for writing: " + filepath.string());
+    }
+    exportTableToCsv(table, file, options);
+}
+
+auto exportTableToNpy(TableView & table, std::filesystem::path const & directory, TableNpyExportOptions const & options)
+        -> std::vector<std::filesystem::path> {
+    if (!directory.empty() && !std::filesystem::exists(directory)) {
+        std::filesystem::create_directories(directory);
+    }
+
+    size_t const rows = table.getRowCount();
+    size_t const block_rows = std::max<size_t>(options.block_rows, 1);
+
+    struct OpenColumn {
+        std::string name;
+        std::filesystem::path path;
+        std::ofstream file;
+    };
+    std::vector<OpenColumn> columns;
+
+    for (auto const & name: table.getColumnNames()) {
+        auto const descriptor = npyDescriptor(table.getColumnTypeIndex(name));
+        if (!descriptor) {
+            std::cerr << "Skipping vector-valued column in .npy export: " << name << std::endl;
+            continue;
+        }
+
+        OpenColumn column{name, directory / (sanitizeFileName(name) + ".npy"), {}};
+        column.file.open(column.path, std::ios::binary);
+        if (!column.file.is_open()) {
+            throw std::runtime_error("Could not open file for writing: " + column.path.string());
+        }
+        writeNpyHeader(column.file, *descriptor, rows);
+        columns.push_back(std::move(column));
+    }
+
+    for (size_t begin = 0; begin < rows; begin += block_rows) {
+        size_t const end = std::min(begin + block_rows, rows);
+
+        for (auto & column: columns) {
+            auto const block = table.getColumnDataVariantInRange(column.name, begin, end);
+            std::visit([&](auto const & values) {
+                using Element = typename std::decay_t<decltype(values)>::value_type;
+                if constexpr (std::is_arithmetic_v<Element>) {
+                    writeNpyBlock(column.file, values, end - begin);
+                }
+            },
+                       block);
+
+            if (!column.file) {
+                throw std::runtime_error("Failed while writing " + column.path.string());
+            }
+        }
+    }
+
+    std::vector<std::filesystem::path> written;
+    written.reserve(columns.size());
+    for (auto & column: columns) {
+        column.file.close();
+        written.push_back(column.path);
+    }
+    return written;
+}
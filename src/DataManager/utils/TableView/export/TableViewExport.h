@@ -0,0 +1,70 @@
+#ifndef TABLE_VIEW_EXPORT_H
+#define TABLE_VIEW_EXPORT_H
+
+#include <cstddef>
+#include <filesystem>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class TableView;
+
+/**
+ * @brief Options for streaming a TableView to CSV.
+ */
+struct TableCsvExportOptions {
+    std::string delimiter = ",";
+    std::string line_ending = "\n";
+    int precision = 3;              ///< Digits after the decimal point for floating point cells
+    bool include_header = true;
+    std::string list_delimiter = " ";///< Separator between elements of vector-valued cells
+    size_t block_rows = 65536;      ///< Rows materialized and written at a time
+};
+
+/**
+ * @brief Options for exporting a TableView as one NumPy .npy file per column.
+ */
+struct TableNpyExportOptions {
+    size_t block_rows = 65536;///< Rows materialized and written at a time
+};
+
+/**
+ * @brief Streams a table to CSV in blocks of rows.
+ *
+ * Each block is computed with TableView::getColumnDataVariantInRange and
+ * formatted with std::to_chars, so peak memory is bounded by one block of
+ * every column rather than the whole table. Vector-valued cells are quoted
+ * and their elements separated by list_delimiter. Rows missing from a
+ * column are written as NaN.
+ *
+ * @param table The table to export.
+ * @param out Destination stream.
+ * @param options Formatting options.
+ * @throws std::runtime_error if writing to the stream fails.
+ */
+void exportTableToCsv(TableView & table, std::ostream & out, TableCsvExportOptions const & options = {});
+
+/**
+ * @brief Streams a table to a CSV file.
+ * @throws std::runtime_error if the file cannot be opened or written.
+ */
+void exportTableToCsv(TableView & table, std::filesystem::path const & filepath, TableCsvExportOptions const & options = {});
+
+/**
+ * @brief Writes each scalar column of a table to `<directory>/<column>.npy`.
+ *
+ * Files are 1-D NumPy arrays (format version 1.0) of the column's native
+ * type and are filled in blocks of rows. Vector-valued columns have no
+ * fixed shape and are skipped. Characters that are unsafe in file names are
+ * replaced with '_'.
+ *
+ * @param table The table to export.
+ * @param directory Output directory; created if missing.
+ * @param options Export options.
+ * @return Paths of the files written, in column order.
+ * @throws std::runtime_error if a file cannot be opened or written.
+ */
+auto exportTableToNpy(TableView & table, std::filesystem::path const & directory, TableNpyExportOptions const & options = {})
+        -> std::vector<std::filesystem::path>;
+
+#endif// TABLE_VIEW_EXPORT_H
@@ -0,0 +1,151 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "TableViewExport.h"
+
+#include "AnalogTimeSeries/Analog_Time_Series.hpp"
+#include "DataManager.hpp"
+#include "TimeFrame/TimeFrame.hpp"
+#include "utils/TableView/adapters/DataManagerExtension.h"
+#include "utils/TableView/computers/AnalogSliceGathererComputer.h"
+#include "utils/TableView/computers/IntervalReductionComputer.h"
+#include "utils/TableView/core/TableView.h"
+#include "utils/TableView/core/TableViewBuilder.h"
+#include "utils/TableView/interfaces/IRowSelector.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Builds a table with one row per 10-sample interval of a ramp signal.
+ */
+TableView buildRampTable(DataManager & dm, size_t num_rows) {
+    std::vector<int> times(num_rows * 10);
+    std::iota(times.begin(), times.end(), 0);
+    auto time_frame = std::make_shared<TimeFrame>(times);
+    dm.setTime(TimeKey("export_time"), time_frame, true);
+
+    std::vector<float> ramp(times.size());
+    std::iota(ramp.begin(), ramp.end(), 0.0f);
+    auto const num_samples = ramp.size();
+    dm.setData<AnalogTimeSeries>("Ramp", std::make_shared<AnalogTimeSeries>(std::move(ramp), num_samples), TimeKey("export_time"));
+
+    std::vector<TimeFrameInterval> intervals;
+    for (size_t i = 0; i < num_rows; ++i) {
+        intervals.emplace_back(TimeFrameIndex(static_cast<int64_t>(i * 10)), TimeFrameIndex(static_cast<int64_t>(i * 10 + 9)));
+    }
+
+    auto dme = std::make_shared<DataManagerExtension>(dm);
+    auto source = dme->getAnalogSource("Ramp");
+
+    TableViewBuilder builder(dme);
+    builder.setRowSelector(std::make_unique<IntervalSelector>(intervals, time_frame));
+    builder.addColumn<double>("Mean", std::make_unique<IntervalReductionComputer>(source, ReductionType::Mean));
+    builder.addColumn<double>("Max", std::make_unique<IntervalReductionComputer>(source, ReductionType::Max));
+    builder.addColumn<std::vector<double>>("Slice", std::make_unique<AnalogSliceGathererComputer<std::vector<double>>>(source));
+    return builder.build();
+}
+
+std::vector<std::string> splitLines(std::string const & text) {
+    std::vector<std::string> lines;
+    std::istringstream ss(text);
+    std::string line;
+    while (std::getline(ss, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+}// namespace
+
+TEST_CASE("DM - TV - TableView row blocks match full columns", "[TableView][Export]") {
+    DataManager dm;
+    auto table = buildRampTable(dm, 25);
+
+    auto const block = table.getColumnValuesInRange<double>("Mean", 5, 12);
+    REQUIRE(block.size() == 7);
+
+    auto const & full = table.getColumnValues<double>("Mean");
+    REQUIRE(full.size() == 25);
+    for (size_t i = 0; i < block.size(); ++i) {
+        REQUIRE_THAT(block[i], Catch::Matchers::WithinAbs(full[5 + i], 1e-9));
+    }
+
+    REQUIRE(table.getColumnValuesInRange<double>("Mean", 10, 10).empty());
+}
+
+TEST_CASE("DM - TV - Streaming CSV export", "[TableView][Export]") {
+    DataManager dm;
+    auto table = buildRampTable(dm, 25);
+
+    TableCsvExportOptions options;
+    options.precision = 2;
+    options.block_rows = 4;// Several blocks, the last one partial
+
+    std::ostringstream out;
+    exportTableToCsv(table, out, options);
+
+    auto const lines = splitLines(out.str());
+    REQUIRE(lines.size() == 26);
+    REQUIRE(lines[0] == "Mean,Max,Slice");
+
+    // Interval i covers samples 10i..10i+9 of a ramp
+    REQUIRE(lines[1] == "4.50,9.00,\"0.00 1.00 2.00 3.00 4.00 5.00 6.00 7.00 8.00 9.00\"");
+    REQUIRE(lines[25].rfind("244.50,249.00,", 0) == 0);
+
+    SECTION("Header and delimiter options") {
+        options.include_header = false;
+        options.delimiter = "\t";
+
+        std::ostringstream tsv;
+        exportTableToCsv(table, tsv, options);
+
+        auto const tsv_lines = splitLines(tsv.str());
+        REQUIRE(tsv_lines.size() == 25);
+        REQUIRE(tsv_lines[0].rfind("4.50\t9.00\t", 0) == 0);
+    }
+}
+
+TEST_CASE("DM - TV - NumPy column export", "[TableView][Export]") {
+    DataManager dm;
+    auto table = buildRampTable(dm, 25);
+
+    auto const directory = std::filesystem::temp_directory_path() / "tableview_npy_export_test";
+    std::filesystem::remove_all(directory);
+
+    TableNpyExportOptions options;
+    options.block_rows = 4;
+    auto const written = exportTableToNpy(table, directory, options);
+
+    // The vector-valued Slice column has no fixed shape and is skipped
+    REQUIRE(written.size() == 2);
+    REQUIRE(written[0].filename() == "Mean.npy");
+
+    std::ifstream file(written[0], std::ios::binary);
+    std::vector<char> const bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    REQUIRE(bytes.size() > 10);
+    REQUIRE(std::string(bytes.data() + 1, 5) == "NUMPY");
+
+    size_t const header_length = static_cast<unsigned char>(bytes[8]) | (static_cast<size_t>(static_cast<unsigned char>(bytes[9])) << 8);
+    size_t const data_offset = 10 + header_length;
+    REQUIRE(data_offset % 64 == 0);
+    REQUIRE(bytes.size() == data_offset + 25 * sizeof(double));
+
+    std::string const header(bytes.data() + 10, header_length);
+    REQUIRE(header.find("'shape': (25,)") != std::string::npos);
+
+    double last = 0.0;
+    std::memcpy(&last, bytes.data() + data_offset + 24 * sizeof(double), sizeof(double));
+    REQUIRE_THAT(last, Catch::Matchers::WithinAbs(244.5, 1e-9));
+
+    std::filesystem::remove_all(directory);
+}
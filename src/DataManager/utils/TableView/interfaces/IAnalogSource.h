@@ -2,13 +2,36 @@
 #define IANALOG_SOURCE_H
 
 #include "TimeFrame/TimeFrame.hpp"
+#include "TimeFrame/interval_data.hpp"
 
 #include <cstddef>
 #include <memory>
 #include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
+/**
+ * @brief Data slices for a batch of intervals gathered from an IAnalogSource.
+ * 
+ * Slice i is the half-open range bounds[i] into the backing samples. Sources that
+ * keep their samples contiguously in memory expose them directly through
+ * `view`; other sources copy the slices back-to-back into `owned`.
+ */
+struct AnalogSliceBatch {
+    std::span<float const> view;                  ///< Zero-copy backing samples (if provided by the source)
+    std::vector<float> owned;                     ///< Gathered samples (used when view is empty)
+    std::vector<std::pair<size_t, size_t>> bounds;///< [begin, end) into the backing samples, one per interval
+
+    [[nodiscard]] size_t size() const { return bounds.size(); }
+
+    [[nodiscard]] std::span<float const> slice(size_t i) const {
+        auto const [begin, end] = bounds[i];
+        std::span<float const> const samples = owned.empty() ? view : std::span<float const>(owned);
+        return samples.subspan(begin, end - begin);
+    }
+};
+
 /**
  * @brief Interface for any data source that can be viewed as an analog signal.
  * 
@@ -55,6 +78,30 @@ public:
     virtual std::vector<float> getDataInRange(TimeFrameIndex start,
                                               TimeFrameIndex end,
                                               TimeFrame const * target_timeFrame) = 0;
+
+    /**
+     * @brief Gets the data for a batch of intervals.
+     * 
+     * Equivalent to calling getDataInRange() for every interval, but lets the
+     * source resolve all boundaries together and avoid a copy per interval.
+     * The default implementation gathers getDataInRange() results into one buffer.
+     * 
+     * @param intervals The [start, end] (inclusive) ranges, in the target time frame.
+     * @param target_timeFrame The target time frame (from the caller) for the data.
+     * @return The slices for each interval, in the same order as @p intervals.
+     */
+    virtual AnalogSliceBatch getDataInRanges(std::vector<TimeFrameInterval> const & intervals,
+                                             TimeFrame const * target_timeFrame) {
+        AnalogSliceBatch batch;
+        batch.bounds.reserve(intervals.size());
+        for (auto const & interval: intervals) {
+            auto const slice = getDataInRange(interval.start, interval.end, target_timeFrame);
+            size_t const begin = batch.owned.size();
+            batch.owned.insert(batch.owned.end(), slice.begin(), slice.end());
+            batch.bounds.emplace_back(begin, batch.owned.size());
+        }
+        return batch;
+    }
 };
 
 #endif// IANALOG_SOURCE_H
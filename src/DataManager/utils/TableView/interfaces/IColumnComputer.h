@@ -60,6 +60,34 @@ public:
      */
     [[nodiscard]] virtual auto getSourceDependency() const -> std::string = 0;
 
+    /**
+     * @brief Declares whether each output row depends only on its own plan entry.
+     *
+     * Row-local computers can be evaluated on a block of rows through
+     * computeRange() without materializing the whole column. Computers that fit
+     * a model across the table or read other columns must return false.
+     *
+     * @return True if the computer is row-local.
+     */
+    [[nodiscard]] virtual auto isRowLocal() const -> bool {
+        return false;
+    }
+
+    /**
+     * @brief Computes the values for rows [begin, end) only.
+     *
+     * Only valid for row-local computers. The default implementation evaluates
+     * compute() on a sliced copy of the plan.
+     *
+     * @param plan The full execution plan for the column's source.
+     * @param begin First row to compute.
+     * @param end One past the last row to compute.
+     * @return Vector of computed values for the requested rows.
+     */
+    [[nodiscard]] virtual auto computeRange(ExecutionPlan const & plan, size_t begin, size_t end) const -> std::vector<T> {
+        return compute(plan.sliceRows(begin, end));
+    }
+
 protected:
     // Protected constructor to allow derived classes to construct
     IColumnComputer() = default;
@@ -50,6 +50,12 @@ public:
      */
     [[nodiscard]] virtual auto getSourceDependency() const -> std::string = 0;
 
+    /**
+     * @brief Declares whether each output row depends only on its own plan entry.
+     * @see IColumnComputer::isRowLocal
+     */
+    [[nodiscard]] virtual auto isRowLocal() const -> bool { return false; }
+
 protected:
     IMultiColumnComputer() = default;
 };
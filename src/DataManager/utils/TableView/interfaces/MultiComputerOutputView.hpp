@@ -4,6 +4,8 @@
 #include "utils/TableView/interfaces/IColumnComputer.h"
 #include "utils/TableView/interfaces/IMultiColumnComputer.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -18,6 +20,12 @@ public:
     struct SharedBatchCache {
         mutable std::mutex mutex;
         mutable std::unordered_map<ExecutionPlan const *, std::vector<std::vector<T>>> cache;
+
+        // Most recent row block computed through computeRange; only one block is kept
+        mutable ExecutionPlan const * blockPlan = nullptr;
+        mutable size_t blockBegin = 0;
+        mutable size_t blockEnd = 0;
+        mutable std::vector<std::vector<T>> block;
     };
 
     explicit MultiComputerOutputView(std::shared_ptr<IMultiColumnComputer<T>> multiComputer,
@@ -54,6 +62,41 @@ public:
         return result;
     }
 
+    [[nodiscard]] auto computeRange(ExecutionPlan const & plan, size_t begin, size_t end) const -> std::vector<T> override {
+        std::lock_guard<std::mutex> lock(m_sharedCache->mutex);
+
+        // Full batch already computed for this plan: copy the requested rows
+        auto it = m_sharedCache->cache.find(&plan);
+        if (it != m_sharedCache->cache.end()) {
+            auto const & batch = it->second;
+            if (m_outputIndex >= batch.size()) {
+                return {};
+            }
+            auto const & values = batch[m_outputIndex];
+            size_t const first = std::min(begin, values.size());
+            size_t const last = std::min(std::max(end, first), values.size());
+            return std::vector<T>(values.begin() + static_cast<std::ptrdiff_t>(first),
+                                  values.begin() + static_cast<std::ptrdiff_t>(last));
+        }
+
+        // Sibling outputs of the same block share one batch computation
+        if (m_sharedCache->blockPlan != &plan || m_sharedCache->blockBegin != begin || m_sharedCache->blockEnd != end) {
+            m_sharedCache->block = m_multiComputer->computeBatch(plan.sliceRows(begin, end));
+            m_sharedCache->blockPlan = &plan;
+            m_sharedCache->blockBegin = begin;
+            m_sharedCache->blockEnd = end;
+        }
+
+        if (m_outputIndex < m_sharedCache->block.size()) {
+            return m_sharedCache->block[m_outputIndex];
+        }
+        return {};
+    }
+
+    [[nodiscard]] auto isRowLocal() const -> bool override {
+        return m_multiComputer->isRowLocal();
+    }
+
     [[nodiscard]] auto getDependencies() const -> std::vector<std::string> override {
         return m_multiComputer->getDependencies();
     }
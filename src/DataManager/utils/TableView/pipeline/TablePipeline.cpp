@@ -2,6 +2,7 @@
 
 #include "DataManager.hpp"
 #include "TimeFrame/TimeFrame.hpp"
+#include "Tracing/Tracing.hpp"
 #include "utils/TableView/ComputerRegistry.hpp"
 #include "utils/TableView/ComputerRegistryTypes.hpp"
 #include "utils/TableView/TableRegistry.hpp"
@@ -89,6 +90,8 @@ bool TablePipeline::loadFromJsonFile(std::string const & json_file_path) {
 }
 
 TablePipelineResult TablePipeline::execute(TablePipelineProgressCallback progress_callback) {
+    TRACE_ZONE_NAMED(zone, "TablePipeline::execute", "pipeline", {});
+    TRACE_ZONE_VALUE(zone, "tables", tables_.size());
     auto start_time = std::chrono::high_resolution_clock::now();
 
     TablePipelineResult result;
@@ -147,6 +150,7 @@ TablePipelineResult TablePipeline::execute(TablePipelineProgressCallback progres
 
 TableBuildResult TablePipeline::buildTable(TableConfiguration const & config,
                                            std::function<void(int, int)> progress_callback) {
+    TRACE_ZONE_DETAIL("TablePipeline::buildTable", "tableview", config.table_id);
     auto start_time = std::chrono::high_resolution_clock::now();
 
     TableBuildResult result;
@@ -10,7 +10,7 @@ arma::Row<double> convertAnalogTimeSeriesToMlpackArray(
     auto length = timestamps.size();
     arma::Row<double> result(length, arma::fill::zeros);
 
-    auto const & data = analogTimeSeries->getAnalogTimeSeries();
+    auto const data = analogTimeSeries->getAnalogTimeSeriesSpan();
     auto const & time = analogTimeSeries->getTimeSeries();
 
     for (std::size_t i = 0; i < length; ++i) {
@@ -62,12 +62,9 @@ template<typename T, typename M>
         return get_at_time(time, data, empty);
     }
 
-    // Convert the time index from source timeframe to target timeframe
-    // 1. Get the time value from the source timeframe
-    auto time_value = source_timeframe->getTimeAtIndex(time);
-    
-    // 2. Convert that time value to an index in the target timeframe  
-    auto target_index = target_timeframe->getIndexAtTime(static_cast<float>(time_value));
+    // Convert the time index from source timeframe to target timeframe.
+    // Repeated lookups between the same pair of clocks use the cached conversion map.
+    auto target_index = convertTimeFrameIndex(time, source_timeframe, target_timeframe);
 
     return get_at_time(target_index, data, empty);
 }
@@ -0,0 +1,200 @@
+#ifndef ORDERED_PIPELINE_HPP
+#define ORDERED_PIPELINE_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Producer -> worker pool -> ordered consumer pipeline with bounded memory
+ *
+ * Items pushed by a producer thread are transformed concurrently by a pool of
+ * worker threads, and the results are handed to a single sink thread in the
+ * order they were pushed. At most @p capacity items are in flight between
+ * push and the sink, so push blocks when the downstream stages fall behind.
+ *
+ * If the transform or the sink throws, the pipeline stops accepting items and
+ * finish() rethrows the first exception on the producer thread.
+ *
+ * @tparam Input Item type handed to the transform
+ * @tparam Output Item type handed to the sink
+ */
+template<typename Input, typename Output>
+class OrderedPipeline {
+public:
+    using Transform = std::function<Output(Input &)>;
+    using Sink = std::function<void(Output &)>;
+
+    /**
+     * @param workers Number of transform threads (at least one is started)
+     * @param capacity Maximum number of items between push and the sink (at least workers)
+     * @param transform Called concurrently on worker threads
+     * @param sink Called on a single thread, in push order
+     */
+    OrderedPipeline(size_t workers, size_t capacity, Transform transform, Sink sink)
+        : _transform(std::move(transform)),
+          _sink(std::move(sink)) {
+        workers = std::max<size_t>(workers, 1);
+        _capacity = std::max(capacity, workers);
+
+        _workers.reserve(workers);
+        for (size_t i = 0; i < workers; ++i) {
+            _workers.emplace_back([this]() { _workerLoop(); });
+        }
+        _sink_thread = std::thread([this]() { _sinkLoop(); });
+    }
+
+    ~OrderedPipeline() {
+        _close();
+        _join();
+    }
+
+    OrderedPipeline(OrderedPipeline const &) = delete;
+    OrderedPipeline & operator=(OrderedPipeline const &) = delete;
+
+    /**
+     * @brief Queue an item, blocking while the pipeline is full
+     *
+     * @return false if a stage has failed; the item is dropped
+     */
+    bool push(Input item) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _space_ready.wait(lock, [this]() { return _error || _next_push - _next_sink < _capacity; });
+        if (_error || _closed) {
+            return false;
+        }
+
+        _inputs.emplace_back(_next_push++, std::move(item));
+        _input_ready.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Wait until every pushed item has reached the sink and stop the threads
+     *
+     * Rethrows the first exception thrown by the transform or the sink.
+     */
+    void finish() {
+        _close();
+        _join();
+
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            std::swap(error, _error);
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    void _workerLoop() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (;;) {
+            _input_ready.wait(lock, [this]() { return _error || _closed || !_inputs.empty(); });
+            if (_error || _inputs.empty()) {
+                return;
+            }
+
+            auto [index, item] = std::move(_inputs.front());
+            _inputs.pop_front();
+            lock.unlock();
+
+            try {
+                Output output = _transform(item);
+                lock.lock();
+                _outputs.emplace(index, std::move(output));
+                _output_ready.notify_one();
+            } catch (...) {
+                lock.lock();
+                _fail(std::current_exception());
+            }
+        }
+    }
+
+    void _sinkLoop() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (;;) {
+            _output_ready.wait(lock, [this]() {
+                return _error || _outputs.contains(_next_sink) || (_closed && _next_sink == _next_push);
+            });
+            auto it = _outputs.find(_next_sink);
+            if (_error || it == _outputs.end()) {
+                return;
+            }
+
+            auto node = _outputs.extract(it);
+            lock.unlock();
+
+            try {
+                _sink(node.mapped());
+            } catch (...) {
+                lock.lock();
+                _fail(std::current_exception());
+                return;
+            }
+
+            lock.lock();
+            ++_next_sink;
+            _space_ready.notify_one();
+        }
+    }
+
+    /// Record the first error and wake every stage. Requires _mutex.
+    void _fail(std::exception_ptr error) {
+        if (!_error) {
+            _error = std::move(error);
+        }
+        _input_ready.notify_all();
+        _output_ready.notify_all();
+        _space_ready.notify_all();
+    }
+
+    void _close() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _closed = true;
+        _input_ready.notify_all();
+        _output_ready.notify_all();
+    }
+
+    void _join() {
+        for (auto & worker: _workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+        if (_sink_thread.joinable()) {
+            _sink_thread.join();
+        }
+    }
+
+    Transform _transform;
+    Sink _sink;
+    size_t _capacity{1};
+
+    std::mutex _mutex;
+    std::condition_variable _input_ready;
+    std::condition_variable _output_ready;
+    std::condition_variable _space_ready;
+
+    std::deque<std::pair<size_t, Input>> _inputs;
+    std::map<size_t, Output> _outputs;///< Transformed items waiting for their turn at the sink
+    size_t _next_push{0};
+    size_t _next_sink{0};
+    bool _closed{false};
+    std::exception_ptr _error;
+
+    std::vector<std::thread> _workers;
+    std::thread _sink_thread;
+};
+
+#endif// ORDERED_PIPELINE_HPP
@@ -0,0 +1,80 @@
+#include "ordered_pipeline.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_CASE("OrderedPipeline delivers transformed items in push order", "[ordered_pipeline]") {
+    std::vector<int> received;
+
+    auto transform = [](int & value) {
+        // Later items finish first so the sink has to reorder them
+        std::this_thread::sleep_for(std::chrono::microseconds((64 - value % 64) * 10));
+        return value * 2;
+    };
+    auto sink = [&received](int & value) { received.push_back(value); };
+
+    OrderedPipeline<int, int> pipeline(4, 8, transform, sink);
+
+    for (int i = 0; i < 200; ++i) {
+        REQUIRE(pipeline.push(i));
+    }
+    pipeline.finish();
+
+    REQUIRE(received.size() == 200);
+    for (int i = 0; i < 200; ++i) {
+        REQUIRE(received[static_cast<size_t>(i)] == i * 2);
+    }
+}
+
+TEST_CASE("OrderedPipeline bounds the number of items in flight", "[ordered_pipeline]") {
+    std::atomic<int> in_flight{0};
+    std::atomic<int> max_in_flight{0};
+
+    auto transform = [&](int & value) {
+        int const now = ++in_flight;
+        int previous = max_in_flight.load();
+        while (now > previous && !max_in_flight.compare_exchange_weak(previous, now)) {}
+        return value;
+    };
+    auto sink = [&](int &) {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        --in_flight;
+    };
+
+    OrderedPipeline<int, int> pipeline(2, 3, transform, sink);
+
+    for (int i = 0; i < 50; ++i) {
+        REQUIRE(pipeline.push(i));
+    }
+    pipeline.finish();
+
+    REQUIRE(max_in_flight.load() <= 3);
+    REQUIRE(in_flight.load() == 0);
+}
+
+TEST_CASE("OrderedPipeline rethrows stage failures from finish", "[ordered_pipeline]") {
+    auto transform = [](int & value) {
+        if (value == 5) {
+            throw std::runtime_error("transform failed");
+        }
+        return value;
+    };
+
+    OrderedPipeline<int, int> pipeline(2, 4, transform, [](int &) {});
+
+    bool stopped_accepting = false;
+    for (int i = 0; i < 100; ++i) {
+        if (!pipeline.push(i)) {
+            stopped_accepting = true;
+            break;
+        }
+    }
+
+    REQUIRE_THROWS(pipeline.finish());
+    REQUIRE(stopped_accepting);
+}
@@ -0,0 +1,84 @@
+#ifndef PARALLEL_FOR_HPP
+#define PARALLEL_FOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Number of worker threads to use for data-parallel loops
+ *
+ * @return std::thread::hardware_concurrency(), or 1 if it cannot be determined
+ */
+inline size_t parallel_worker_count() {
+    auto const hw = std::thread::hardware_concurrency();
+    return hw == 0 ? 1 : static_cast<size_t>(hw);
+}
+
+/**
+ * @brief Split [0, count) into contiguous chunks and process them concurrently
+ *
+ * @p fn is invoked as fn(begin, end) for each half-open chunk. The calling thread
+ * processes the first chunk itself. If the range is smaller than two chunks of
+ * @p min_chunk_size, or only one hardware thread is available, @p fn is called
+ * once on the whole range without spawning any threads.
+ *
+ * Exceptions thrown by @p fn are rethrown on the calling thread after all
+ * chunks have finished.
+ *
+ * @param count Number of items
+ * @param min_chunk_size Smallest number of items worth handing to a thread
+ * @param fn Callable taking (size_t begin, size_t end)
+ */
+template<typename Fn>
+void parallel_for_chunks(size_t count, size_t min_chunk_size, Fn && fn) {
+    if (count == 0) {
+        return;
+    }
+
+    min_chunk_size = std::max<size_t>(min_chunk_size, 1);
+    size_t const max_chunks = count / min_chunk_size;
+    size_t const num_chunks = std::min(parallel_worker_count(), max_chunks);
+
+    if (num_chunks <= 1) {
+        fn(size_t{0}, count);
+        return;
+    }
+
+    size_t const chunk_size = (count + num_chunks - 1) / num_chunks;
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(num_chunks - 1);
+    for (size_t begin = chunk_size; begin < count; begin += chunk_size) {
+        size_t const end = std::min(begin + chunk_size, count);
+        futures.push_back(std::async(std::launch::async, [&fn, begin, end]() {
+            fn(begin, end);
+        }));
+    }
+
+    std::exception_ptr first_error;
+    try {
+        fn(size_t{0}, std::min(chunk_size, count));
+    } catch (...) {
+        first_error = std::current_exception();
+    }
+
+    for (auto & future: futures) {
+        try {
+            future.get();
+        } catch (...) {
+            if (!first_error) {
+                first_error = std::current_exception();
+            }
+        }
+    }
+
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+}
+
+#endif// PARALLEL_FOR_HPP
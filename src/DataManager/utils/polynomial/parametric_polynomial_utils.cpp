@@ -1,19 +1,24 @@
 #include "parametric_polynomial_utils.hpp"
 
-#include "armadillo" // For arma::mat, arma::vec, arma::solve, arma::conv_to
-
 #include <vector>
-#include <cmath> // For std::sqrt, std::pow
+#include <cmath> // For std::sqrt
 
 // Helper function to compute t-values based on cumulative distance
 std::vector<double> compute_t_values(Line2D const & line) {
+    std::vector<double> t_values;
+    compute_t_values(std::span<Point2D<float> const>(line.begin(), line.end()), t_values);
+    return t_values;
+}
+
+void compute_t_values(std::span<Point2D<float> const> line, std::vector<double> & t_values) {
+    t_values.clear();
     if (line.empty()) {
-        return {};
+        return;
     }
     
-    std::vector<double> distances;
-    distances.reserve(line.size());
-    distances.push_back(0.0);  // First point has distance 0
+    // Cumulative distance first, normalized in place below
+    t_values.reserve(line.size());
+    t_values.push_back(0.0);  // First point has distance 0
     
     double total_distance = 0.0;
     for (size_t i = 1; i < line.size(); ++i) {
@@ -21,27 +26,21 @@ std::vector<double> compute_t_values(Line2D const & line) {
         double dy = line[i].y - line[i-1].y;
         double segment_distance = std::sqrt(dx*dx + dy*dy);
         total_distance += segment_distance;
-        distances.push_back(total_distance);
+        t_values.push_back(total_distance);
     }
     
-    std::vector<double> t_values;
-    t_values.reserve(line.size());
     if (total_distance > 0.0) {
-        for (double d : distances) {
-            t_values.push_back(d / total_distance);
+        for (double & t : t_values) {
+            t /= total_distance;
         }
     } else {
         for (size_t i = 0; i < line.size(); ++i) {
-            t_values.push_back(static_cast<double>(i) / static_cast<double>(line.size() > 1 ? line.size() - 1 : 1));
+            t_values[i] = static_cast<double>(i) / static_cast<double>(line.size() > 1 ? line.size() - 1 : 1);
         }
     }
-    
-    return t_values;
 }
 
 
-
-
 // Helper function to fit a single dimension (x or y) of a parametric polynomial.
 std::vector<double> fit_single_dimension_polynomial_internal(
     const std::vector<double>& dimension_coords,
@@ -52,20 +51,26 @@ std::vector<double> fit_single_dimension_polynomial_internal(
         return {}; // Not enough data or mismatched sizes
     }
 
-    arma::mat X_vandermonde(t_values.size(), static_cast<arma::uword>(order) + 1);
-    arma::vec Y_coords(const_cast<double*>(dimension_coords.data()), dimension_coords.size(), false); // Use const_cast and non-copy for efficiency
+    return fit_polynomial(t_values, dimension_coords, order);
+}
 
-    for (size_t i = 0; i < t_values.size(); ++i) {
-        for (int j = 0; j <= order; ++j) {
-            X_vandermonde(i, static_cast<arma::uword>(j)) = std::pow(t_values[i], j);
-        }
-    }
+ParametricPolynomialFit fit_parametric_polynomial(std::span<Point2D<float> const> line, int order) {
+    std::vector<double> t_values;
+    compute_t_values(line, t_values);
+    return fit_parametric_polynomial(t_values, line, order);
+}
+
+std::vector<ParametricPolynomialFit> fit_parametric_polynomials(
+    std::span<std::span<Point2D<float> const> const> lines,
+    int order) {
 
-    arma::vec coeffs_arma;
-    bool success = arma::solve(coeffs_arma, X_vandermonde, Y_coords);
+    std::vector<ParametricPolynomialFit> fits;
+    fits.reserve(lines.size());
 
-    if (!success) {
-        return {};
+    std::vector<double> t_values;
+    for (auto const line : lines) {
+        compute_t_values(line, t_values);
+        fits.push_back(fit_parametric_polynomial(t_values, line, order));
     }
-    return arma::conv_to<std::vector<double>>::from(coeffs_arma);
-} 
+    return fits;
+}
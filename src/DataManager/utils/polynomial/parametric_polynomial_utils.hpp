@@ -2,17 +2,39 @@
 #define PARAMETRIC_POLYNOMIAL_UTILS_HPP
 
 #include "CoreGeometry/lines.hpp" // For Point2D
+#include "polynomial_fit.hpp"     // For ParametricPolynomialFit
 
+#include <span>
 #include <vector>
 
 
 // Helper function to compute t-values based on cumulative distance
 std::vector<double> compute_t_values(Line2D const & line);
 
+// Same as above, writing into a caller-owned buffer so it can be reused between lines
+void compute_t_values(std::span<Point2D<float> const> line, std::vector<double> & t_values);
+
 // Helper function to fit a single dimension (x or y) of a parametric polynomial.
 std::vector<double> fit_single_dimension_polynomial_internal(
     const std::vector<double>& dimension_coords,
     const std::vector<double>& t_values,
     int order);
 
+/**
+ * @brief Fit x(t) and y(t) to a line parameterized by normalized arc length
+ *
+ * Uses the same t-values as compute_t_values and fits both dimensions jointly.
+ */
+ParametricPolynomialFit fit_parametric_polynomial(std::span<Point2D<float> const> line, int order);
+
+/**
+ * @brief Fit x(t) and y(t) of the same order to many lines
+ *
+ * Equivalent to calling fit_parametric_polynomial on every line, but reuses one
+ * parameter buffer across the whole batch.
+ */
+std::vector<ParametricPolynomialFit> fit_parametric_polynomials(
+    std::span<std::span<Point2D<float> const> const> lines,
+    int order);
+
 #endif // PARAMETRIC_POLYNOMIAL_UTILS_HPP 
@@ -3,22 +3,237 @@
 
 #include <armadillo>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 
-// Helper function to fit a polynomial of the specified order to the given data
-std::vector<double> fit_polynomial(std::vector<double> const &x, std::vector<double> const &y, int order) {
-    if (x.size() != y.size() || x.size() <= static_cast<size_t>(order)) {
-        return {};  // Not enough data points or size mismatch
+namespace {
+
+/// Samples accumulated side by side; each lane has its own partial sums, so the
+/// per-lane loops vectorize without reordering any floating point additions
+constexpr size_t accumulation_lanes = 4;
+
+/// Smallest Cholesky pivot, relative to its diagonal entry, accepted before falling back to QR
+constexpr double cholesky_pivot_tolerance = 1e-10;
+
+/**
+ * @brief Normal equations (V^T V) c = V^T v of a fixed-order fit for several value columns
+ *
+ * V^T V is a Hankel matrix, so only the 2 * Order + 1 sums of powers of the
+ * abscissa are needed to build it.
+ */
+template<int Order, size_t Columns>
+struct NormalEquations {
+    static constexpr size_t coefficients = Order + 1;
+    static constexpr size_t powers = 2 * Order + 1;
+
+    std::array<double, powers> power_sums{};
+    std::array<std::array<double, coefficients>, Columns> moments{};
+};
+
+/**
+ * @brief Accumulate the normal equations of @p count samples in one pass
+ *
+ * @param sample Callable (index, values) -> u that writes the Columns values
+ *               of a sample and returns its abscissa mapped onto [-1, 1]
+ */
+template<int Order, size_t Columns, typename Sample>
+NormalEquations<Order, Columns> accumulate_normal_equations(size_t count, Sample const & sample) {
+    using Equations = NormalEquations<Order, Columns>;
+    using Lanes = std::array<double, accumulation_lanes>;
+
+    std::array<Lanes, Equations::powers> power_sums{};
+    std::array<std::array<Lanes, Equations::coefficients>, Columns> moments{};
+
+    for (size_t first = 0; first < count; first += accumulation_lanes) {
+        Lanes u{};
+        Lanes power{};
+        std::array<Lanes, Columns> values{};
+        for (size_t lane = 0; lane < accumulation_lanes && first + lane < count; ++lane) {
+            std::array<double, Columns> sample_values{};
+            u[lane] = sample(first + lane, sample_values);
+            for (size_t column = 0; column < Columns; ++column) {
+                values[column][lane] = sample_values[column];
+            }
+            power[lane] = 1.0;
+        }
+
+        // Lanes past the last sample keep power == 0 and add nothing
+        for (size_t k = 0; k < Equations::powers; ++k) {
+            for (size_t lane = 0; lane < accumulation_lanes; ++lane) {
+                power_sums[k][lane] += power[lane];
+            }
+            if (k < Equations::coefficients) {
+                for (size_t column = 0; column < Columns; ++column) {
+                    for (size_t lane = 0; lane < accumulation_lanes; ++lane) {
+                        moments[column][k][lane] += power[lane] * values[column][lane];
+                    }
+                }
+            }
+            for (size_t lane = 0; lane < accumulation_lanes; ++lane) {
+                power[lane] *= u[lane];
+            }
+        }
+    }
+
+    Equations equations;
+    for (size_t k = 0; k < Equations::powers; ++k) {
+        for (double const partial: power_sums[k]) {
+            equations.power_sums[k] += partial;
+        }
+    }
+    for (size_t column = 0; column < Columns; ++column) {
+        for (size_t k = 0; k < Equations::coefficients; ++k) {
+            for (double const partial: moments[column][k]) {
+                equations.moments[column][k] += partial;
+            }
+        }
+    }
+    return equations;
+}
+
+/**
+ * @brief Solve the normal equations for every column with one Cholesky factorization
+ *
+ * @return false if the system is too close to singular for the normal equations
+ */
+template<int Order, size_t Columns>
+bool solve_normal_equations(NormalEquations<Order, Columns> const & equations,
+                            std::array<std::array<double, NormalEquations<Order, Columns>::coefficients>, Columns> & solutions) {
+    constexpr size_t n = NormalEquations<Order, Columns>::coefficients;
+
+    std::array<std::array<double, n>, n> lower{};
+    for (size_t j = 0; j < n; ++j) {
+        double diagonal = equations.power_sums[2 * j];
+        for (size_t k = 0; k < j; ++k) {
+            diagonal -= lower[j][k] * lower[j][k];
+        }
+        if (!(diagonal > equations.power_sums[2 * j] * cholesky_pivot_tolerance)) {
+            return false;
+        }
+        lower[j][j] = std::sqrt(diagonal);
+
+        for (size_t i = j + 1; i < n; ++i) {
+            double value = equations.power_sums[i + j];
+            for (size_t k = 0; k < j; ++k) {
+                value -= lower[i][k] * lower[j][k];
+            }
+            lower[i][j] = value / lower[j][j];
+        }
+    }
+
+    for (size_t column = 0; column < Columns; ++column) {
+        auto & solution = solutions[column];
+        for (size_t i = 0; i < n; ++i) {
+            double value = equations.moments[column][i];
+            for (size_t k = 0; k < i; ++k) {
+                value -= lower[i][k] * solution[k];
+            }
+            solution[i] = value / lower[i][i];
+        }
+        for (size_t i = n; i-- > 0;) {
+            double value = solution[i];
+            for (size_t k = i + 1; k < n; ++k) {
+                value -= lower[k][i] * solution[k];
+            }
+            solution[i] = value / lower[i][i];
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Rewrite p(u) = sum a_k u^k with u = scale * t + offset as coefficients in t
+ */
+template<size_t N>
+std::vector<double> to_parameter_coefficients(std::array<double, N> const & scaled, double scale, double offset) {
+    std::array<double, N> coeffs{};
+    coeffs[0] = scaled[N - 1];
+    for (size_t k = N - 1; k-- > 0;) {
+        // coeffs <- coeffs * (scale * t + offset) + scaled[k]
+        for (size_t j = N - 1; j > 0; --j) {
+            coeffs[j] = coeffs[j] * offset + coeffs[j - 1] * scale;
+        }
+        coeffs[0] = coeffs[0] * offset + scaled[k];
+    }
+    return {coeffs.begin(), coeffs.end()};
+}
+
+template<int Order, size_t Columns, typename Sample>
+bool fit_fixed_order(size_t count,
+                     Sample const & sample,
+                     double scale,
+                     double offset,
+                     std::array<std::vector<double> *, Columns> const & results) {
+    auto const equations = accumulate_normal_equations<Order, Columns>(count, sample);
+
+    std::array<std::array<double, NormalEquations<Order, Columns>::coefficients>, Columns> solutions{};
+    if (!solve_normal_equations(equations, solutions)) {
+        return false;
+    }
+
+    for (size_t column = 0; column < Columns; ++column) {
+        *results[column] = to_parameter_coefficients(solutions[column], scale, offset);
+    }
+    return true;
+}
+
+/**
+ * @brief Fit every column through the specialized solver for @p order
+ *
+ * @return false if @p order has no specialization or the system is ill-conditioned
+ */
+template<size_t Columns, typename Sample>
+bool fit_normal_equations(int order,
+                          size_t count,
+                          Sample const & sample,
+                          double scale,
+                          double offset,
+                          std::array<std::vector<double> *, Columns> const & results) {
+    switch (order) {
+        case 1:
+            return fit_fixed_order<1, Columns>(count, sample, scale, offset, results);
+        case 2:
+            return fit_fixed_order<2, Columns>(count, sample, scale, offset, results);
+        case 3:
+            return fit_fixed_order<3, Columns>(count, sample, scale, offset, results);
+        case 4:
+            return fit_fixed_order<4, Columns>(count, sample, scale, offset, results);
+        case 5:
+            return fit_fixed_order<5, Columns>(count, sample, scale, offset, results);
+        default:
+            return false;
     }
+}
+
+/**
+ * @brief Find the affine map u = scale * t + offset taking [min(t), max(t)] onto [-1, 1]
+ *
+ * @return false if all parameter values are equal or not finite
+ */
+bool unit_interval_map(std::span<double const> t, double & scale, double & offset) {
+    auto const [min_it, max_it] = std::minmax_element(t.begin(), t.end());
+    double const range = *max_it - *min_it;
+    if (!(range > 0.0) || !std::isfinite(range)) {
+        return false;
+    }
+    scale = 2.0 / range;
+    offset = -(*max_it + *min_it) / range;
+    return true;
+}
 
+// Least squares on the Vandermonde matrix, used for orders without a specialized solver
+std::vector<double> fit_polynomial_vandermonde(std::span<double const> x, std::span<double const> y, int order) {
     // Create Armadillo matrix for Vandermonde matrix
     arma::mat X(x.size(), static_cast<arma::uword>(order) + 1);
     arma::vec Y(y.data(), y.size());
 
     // Build Vandermonde matrix
     for (size_t i = 0; i < x.size(); ++i) {
+        double power = 1.0;
         for (int j = 0; j <= order; ++j) {
-            X(i, static_cast<arma::uword>(j)) = std::pow(x[i], j);
+            X(i, static_cast<arma::uword>(j)) = power;
+            power *= x[i];
         }
     }
 
@@ -35,11 +250,98 @@ std::vector<double> fit_polynomial(std::vector<double> const &x, std::vector<dou
     return result;
 }
 
+}// namespace
+
+// Helper function to fit a polynomial of the specified order to the given data
+std::vector<double> fit_polynomial(std::vector<double> const &x, std::vector<double> const &y, int order) {
+    if (x.size() != y.size() || x.size() <= static_cast<size_t>(order)) {
+        return {};  // Not enough data points or size mismatch
+    }
+
+    double scale = 1.0;
+    double offset = 0.0;
+    std::vector<double> coeffs;
+    if (unit_interval_map(x, scale, offset)) {
+        auto const sample = [&](size_t i, std::array<double, 1> & values) {
+            values[0] = y[i];
+            return scale * x[i] + offset;
+        };
+        if (fit_normal_equations<1>(order, x.size(), sample, scale, offset, {&coeffs})) {
+            return coeffs;
+        }
+    }
+
+    return fit_polynomial_vandermonde(x, y, order);
+}
+
+ParametricPolynomialFit fit_parametric_polynomial(std::span<double const> t,
+                                                  std::span<double const> x,
+                                                  std::span<double const> y,
+                                                  int order) {
+    if (t.size() != x.size() || t.size() != y.size() || t.size() <= static_cast<size_t>(order)) {
+        return {};
+    }
+
+    ParametricPolynomialFit fit;
+    double scale = 1.0;
+    double offset = 0.0;
+    if (unit_interval_map(t, scale, offset)) {
+        auto const sample = [&](size_t i, std::array<double, 2> & values) {
+            values[0] = x[i];
+            values[1] = y[i];
+            return scale * t[i] + offset;
+        };
+        fit.success = fit_normal_equations<2>(order, t.size(), sample, scale, offset, {&fit.x_coeffs, &fit.y_coeffs});
+    }
+
+    if (!fit.success) {
+        fit.x_coeffs = fit_polynomial_vandermonde(t, x, order);
+        fit.y_coeffs = fit_polynomial_vandermonde(t, y, order);
+        fit.success = !fit.x_coeffs.empty() && !fit.y_coeffs.empty();
+    }
+    return fit;
+}
+
+ParametricPolynomialFit fit_parametric_polynomial(std::span<double const> t,
+                                                  std::span<Point2D<float> const> points,
+                                                  int order) {
+    if (t.size() != points.size() || t.size() <= static_cast<size_t>(order)) {
+        return {};
+    }
+
+    ParametricPolynomialFit fit;
+    double scale = 1.0;
+    double offset = 0.0;
+    if (unit_interval_map(t, scale, offset)) {
+        auto const sample = [&](size_t i, std::array<double, 2> & values) {
+            values[0] = static_cast<double>(points[i].x);
+            values[1] = static_cast<double>(points[i].y);
+            return scale * t[i] + offset;
+        };
+        fit.success = fit_normal_equations<2>(order, t.size(), sample, scale, offset, {&fit.x_coeffs, &fit.y_coeffs});
+    }
+
+    if (!fit.success) {
+        std::vector<double> x_coords;
+        std::vector<double> y_coords;
+        x_coords.reserve(points.size());
+        y_coords.reserve(points.size());
+        for (auto const & point: points) {
+            x_coords.push_back(static_cast<double>(point.x));
+            y_coords.push_back(static_cast<double>(point.y));
+        }
+        fit.x_coeffs = fit_polynomial_vandermonde(t, x_coords, order);
+        fit.y_coeffs = fit_polynomial_vandermonde(t, y_coords, order);
+        fit.success = !fit.x_coeffs.empty() && !fit.y_coeffs.empty();
+    }
+    return fit;
+}
+
 // Helper function to evaluate polynomial derivative at a given point
 double evaluate_polynomial_derivative(std::vector<double> const &coeffs, double x) {
     double result = 0.0;
-    for (size_t i = 1; i < coeffs.size(); ++i) {
-        result += static_cast<double>(i) * coeffs[i] * std::pow(x, static_cast<double>(i) - 1.0);
+    for (size_t i = coeffs.size(); i-- > 1;) {
+        result = result * x + static_cast<double>(i) * coeffs[i];
     }
     return result;
 }
@@ -47,8 +349,8 @@ double evaluate_polynomial_derivative(std::vector<double> const &coeffs, double
 // Add the evaluate_polynomial function definition
 double evaluate_polynomial(std::vector<double> const &coeffs, double x) {
     double result = 0.0;
-    for (size_t i = 0; i < coeffs.size(); ++i) {
-        result += coeffs[i] * std::pow(x, i);
+    for (size_t i = coeffs.size(); i-- > 0;) {
+        result = result * x + coeffs[i];
     }
     return result;
 }
@@ -56,10 +358,8 @@ double evaluate_polynomial(std::vector<double> const &coeffs, double x) {
 // Helper function to compute 2nd derivative of a polynomial
 double evaluate_polynomial_second_derivative(const std::vector<double>& coeffs, double t) {
     double result = 0.0;
-    if (coeffs.size() >= 3) { // Need at least a quadratic for a non-zero 2nd derivative
-        for (size_t i = 2; i < coeffs.size(); ++i) {
-            result += static_cast<double>(i) * static_cast<double>(i - 1) * coeffs[i] * std::pow(t, static_cast<double>(i) - 2.0);
-        }
+    for (size_t i = coeffs.size(); i-- > 2;) { // Need at least a quadratic for a non-zero 2nd derivative
+        result = result * t + static_cast<double>(i) * static_cast<double>(i - 1) * coeffs[i];
     }
     return result;
 }
@@ -1,11 +1,30 @@
 #ifndef POLYNOMIAL_FIT_HPP
 #define POLYNOMIAL_FIT_HPP
 
+#include "CoreGeometry/points.hpp"
+
+#include <span>
 #include <vector>
 
+/**
+ * @brief Coefficients of a parametric polynomial curve (x(t), y(t))
+ *
+ * Coefficients are stored lowest order first, as for fit_polynomial.
+ */
+struct ParametricPolynomialFit {
+    std::vector<double> x_coeffs;
+    std::vector<double> y_coeffs;
+    bool success = false;
+};
+
 /**
  * @brief Fit a polynomial of the specified order to the given data
  *
+ * Orders 1 to 5 are solved through normal equations accumulated in a single
+ * pass over the data, with the abscissa mapped onto [-1, 1] to keep the
+ * system well conditioned. Other orders, and systems too ill-conditioned for
+ * the normal equations, are solved by least squares on the Vandermonde matrix.
+ *
  * @param x X-coordinates of the data points
  * @param y Y-coordinates of the data points
  * @param order The polynomial order to fit
@@ -13,6 +32,32 @@
  */
 std::vector<double> fit_polynomial(std::vector<double> const &x, std::vector<double> const &y, int order);
 
+/**
+ * @brief Fit x(t) and y(t) polynomials of the same order in one pass
+ *
+ * Both fits share the powers of t and a single factorization of the normal
+ * equations, so this costs little more than one call to fit_polynomial.
+ *
+ * @param t Parameter value of each sample
+ * @param x X-coordinate of each sample
+ * @param y Y-coordinate of each sample
+ * @param order The polynomial order to fit
+ */
+ParametricPolynomialFit fit_parametric_polynomial(std::span<double const> t,
+                                                  std::span<double const> x,
+                                                  std::span<double const> y,
+                                                  int order);
+
+/**
+ * @brief Fit x(t) and y(t) polynomials to points with the given parameter values
+ *
+ * Reads the coordinates straight from @p points without splitting them into
+ * separate x and y arrays.
+ */
+ParametricPolynomialFit fit_parametric_polynomial(std::span<double const> t,
+                                                  std::span<Point2D<float> const> points,
+                                                  int order);
+
 /**
  * @brief Evaluate polynomial at a given point
  *
@@ -0,0 +1,136 @@
+#include "polynomial_fit.hpp"
+#include "parametric_polynomial_utils.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <span>
+#include <vector>
+
+namespace {
+
+std::vector<double> sample_polynomial(std::vector<double> const & coeffs, std::vector<double> const & x) {
+    std::vector<double> y;
+    y.reserve(x.size());
+    for (double const value: x) {
+        y.push_back(evaluate_polynomial(coeffs, value));
+    }
+    return y;
+}
+
+std::vector<double> linspace(double first, double last, size_t count) {
+    std::vector<double> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = first + (last - first) * static_cast<double>(i) / static_cast<double>(count - 1);
+    }
+    return values;
+}
+
+}// namespace
+
+TEST_CASE("Polynomial fit - Recovers exact polynomials", "[polynomial][fit]") {
+
+    SECTION("Every specialized order recovers its own coefficients") {
+        std::vector<double> const all_coeffs = {1.5, -2.0, 0.75, 3.0, -1.25, 0.5};
+        auto const t = linspace(0.0, 1.0, 25);
+
+        for (int order = 1; order <= 5; ++order) {
+            std::vector<double> const coeffs(all_coeffs.begin(), all_coeffs.begin() + order + 1);
+            auto const fitted = fit_polynomial(t, sample_polynomial(coeffs, t), order);
+
+            REQUIRE(fitted.size() == coeffs.size());
+            for (size_t i = 0; i < coeffs.size(); ++i) {
+                REQUIRE_THAT(fitted[i], Catch::Matchers::WithinAbs(coeffs[i], 1e-8));
+            }
+        }
+    }
+
+    SECTION("Abscissa far from the origin is rescaled before solving") {
+        std::vector<double> const coeffs = {3.0, 0.5, -0.01};
+        auto const x = linspace(1000.0, 1100.0, 40);
+        auto const fitted = fit_polynomial(x, sample_polynomial(coeffs, x), 2);
+
+        REQUIRE(fitted.size() == 3);
+        for (double const value: {1000.0, 1033.3, 1100.0}) {
+            REQUIRE_THAT(evaluate_polynomial(fitted, value), Catch::Matchers::WithinAbs(evaluate_polynomial(coeffs, value), 1e-6));
+        }
+    }
+
+    SECTION("Orders without a specialized solver still fit") {
+        std::vector<double> const coeffs = {0.5, 1.0, -1.0, 0.25, 2.0, -0.5, 1.0};
+        auto const t = linspace(-1.0, 1.0, 30);
+        auto const fitted = fit_polynomial(t, sample_polynomial(coeffs, t), 6);
+
+        REQUIRE(fitted.size() == coeffs.size());
+        REQUIRE_THAT(evaluate_polynomial(fitted, 0.3), Catch::Matchers::WithinAbs(evaluate_polynomial(coeffs, 0.3), 1e-8));
+    }
+
+    SECTION("Too few points or mismatched sizes return no coefficients") {
+        REQUIRE(fit_polynomial({0.0, 1.0, 2.0}, {1.0, 2.0, 3.0}, 3).empty());
+        REQUIRE(fit_polynomial({0.0, 1.0, 2.0}, {1.0, 2.0}, 1).empty());
+    }
+}
+
+TEST_CASE("Polynomial fit - Parametric fits", "[polynomial][fit][parametric]") {
+    std::vector<Point2D<float>> points;
+    for (int i = 0; i < 20; ++i) {
+        auto const x = static_cast<float>(i);
+        points.push_back({x, 0.05f * x * x + std::sin(x * 0.3f)});
+    }
+    auto const t = compute_t_values(Line2D(points));
+
+    SECTION("Joint fit matches fitting each dimension on its own") {
+        std::vector<double> x_coords;
+        std::vector<double> y_coords;
+        for (auto const & point: points) {
+            x_coords.push_back(static_cast<double>(point.x));
+            y_coords.push_back(static_cast<double>(point.y));
+        }
+
+        auto const joint = fit_parametric_polynomial(t, x_coords, y_coords, 3);
+        auto const x_only = fit_polynomial(t, x_coords, 3);
+        auto const y_only = fit_polynomial(t, y_coords, 3);
+
+        REQUIRE(joint.success);
+        for (size_t i = 0; i < 4; ++i) {
+            REQUIRE_THAT(joint.x_coeffs[i], Catch::Matchers::WithinAbs(x_only[i], 1e-9));
+            REQUIRE_THAT(joint.y_coeffs[i], Catch::Matchers::WithinAbs(y_only[i], 1e-9));
+        }
+
+        auto const from_points = fit_parametric_polynomial(t, std::span<Point2D<float> const>(points), 3);
+        REQUIRE(from_points.success);
+        REQUIRE(from_points.x_coeffs == joint.x_coeffs);
+        REQUIRE(from_points.y_coeffs == joint.y_coeffs);
+    }
+
+    SECTION("Batch fit matches fitting each line on its own") {
+        std::vector<Point2D<float>> shifted;
+        for (auto const & point: points) {
+            shifted.push_back({point.y, point.x + 5.0f});
+        }
+        std::vector<std::span<Point2D<float> const>> const lines = {points, shifted, std::span<Point2D<float> const>(points.data(), 2)};
+
+        auto const fits = fit_parametric_polynomials(lines, 2);
+
+        REQUIRE(fits.size() == 3);
+        for (size_t i = 0; i < 2; ++i) {
+            auto const single = fit_parametric_polynomial(lines[i], 2);
+            REQUIRE(fits[i].success);
+            REQUIRE(fits[i].x_coeffs == single.x_coeffs);
+            REQUIRE(fits[i].y_coeffs == single.y_coeffs);
+        }
+        // Two points cannot determine a quadratic
+        REQUIRE_FALSE(fits[2].success);
+    }
+}
+
+TEST_CASE("Polynomial fit - Evaluation", "[polynomial][evaluate]") {
+    std::vector<double> const coeffs = {1.0, -2.0, 3.0, 0.5};// 1 - 2x + 3x^2 + 0.5x^3
+
+    REQUIRE_THAT(evaluate_polynomial(coeffs, 2.0), Catch::Matchers::WithinAbs(13.0, 1e-12));
+    REQUIRE_THAT(evaluate_polynomial_derivative(coeffs, 2.0), Catch::Matchers::WithinAbs(16.0, 1e-12));
+    REQUIRE_THAT(evaluate_polynomial_second_derivative(coeffs, 2.0), Catch::Matchers::WithinAbs(12.0, 1e-12));
+    REQUIRE(evaluate_polynomial({}, 2.0) == 0.0);
+    REQUIRE(evaluate_polynomial_second_derivative({1.0, 2.0}, 2.0) == 0.0);
+}
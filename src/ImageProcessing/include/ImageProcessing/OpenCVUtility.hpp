@@ -77,6 +77,33 @@ void bilateral_filter(cv::Mat& mat, BilateralOptions const& options);
  */
 void median_filter(cv::Mat& mat, MedianOptions const& options);
 
+/**
+ * @brief Buffers reused by the filters of one processing step
+ *
+ * Each step of a processing chain owns one scratch object so repeated
+ * frames reuse the same output Mat and CLAHE instance instead of
+ * allocating them for every frame.
+ */
+struct FilterScratch {
+    cv::Mat buffer;
+    cv::Ptr<cv::CLAHE> clahe;
+};
+
+/**
+ * @brief Apply CLAHE, reusing the CLAHE instance held by @p scratch
+ */
+void clahe(cv::Mat & mat, ClaheOptions const& options, FilterScratch & scratch);
+
+/**
+ * @brief Apply bilateral filtering into the scratch buffer and copy back into @p mat
+ */
+void bilateral_filter(cv::Mat& mat, BilateralOptions const& options, FilterScratch & scratch);
+
+/**
+ * @brief Apply median filtering into the scratch buffer and copy back into @p mat
+ */
+void median_filter(cv::Mat& mat, MedianOptions const& options, FilterScratch & scratch);
+
 /**
  * @brief Apply dilation or erosion to a point-based mask
  * @param mask Input mask as vector of 2D points
@@ -135,6 +135,30 @@ void median_filter(cv::Mat & mat, MedianOptions const& options) {
     }
 }
 
+void clahe(cv::Mat & mat, ClaheOptions const& options, FilterScratch & scratch) {
+    cv::Size const grid(options.grid_size, options.grid_size);
+    if (scratch.clahe.empty()) {
+        scratch.clahe = cv::createCLAHE(options.clip_limit, grid);
+    } else {
+        scratch.clahe->setClipLimit(options.clip_limit);
+        scratch.clahe->setTilesGridSize(grid);
+    }
+    scratch.clahe->apply(mat, mat);
+}
+
+void bilateral_filter(cv::Mat & mat, BilateralOptions const& options, FilterScratch & scratch) {
+    // bilateralFilter cannot run in place; the scratch buffer keeps its allocation between frames
+    cv::bilateralFilter(mat, scratch.buffer, options.diameter, options.sigma_color, options.sigma_spatial);
+    scratch.buffer.copyTo(mat);
+}
+
+void median_filter(cv::Mat & mat, MedianOptions const& options, FilterScratch & scratch) {
+    if (options.kernel_size >= 3 && options.kernel_size % 2 == 1) {
+        cv::medianBlur(mat, scratch.buffer, options.kernel_size);
+        scratch.buffer.copyTo(mat);
+    }
+}
+
 std::vector<Point2D<uint32_t>> dilate_mask(std::vector<Point2D<uint32_t>> const& mask, ImageSize image_size, MaskDilationOptions const& options) {
     if (mask.empty() || !options.active) {
         return mask;
@@ -227,7 +227,7 @@ void Analysis_Dashboard::_changeScrollbar(int64_t time_frame_index, std::string
 
         if (video_timeframe.get() != feature_timeframe.get()) {
             time_frame_index = feature_timeframe->getTimeAtIndex(TimeFrameIndex(time_frame_index));
-            time_frame_index = video_timeframe->getIndexAtTime(time_frame_index).getValue();
+            time_frame_index = video_timeframe->getIndexAtTime(static_cast<double>(time_frame_index)).getValue();
         }
     }
 
@@ -69,10 +69,16 @@ void LineDataVisualization::buildVertexData() {
 
     uint32_t line_index = 0;
 
-    for (auto const & [time_frame, lines]: m_line_data_ptr->GetAllLinesAsRange()) {
-        auto const & ids_at_time = m_line_data_ptr->getEntityIdsAtTime(time_frame);
+    // Each interior vertex of a line is emitted twice (end of one segment, start of the next)
+    size_t const max_segment_vertices = 2 * m_line_data_ptr->getAllVertices().size();
+    segment_vertices.reserve(2 * max_segment_vertices);
+    segment_line_ids.reserve(max_segment_vertices);
+    m_entity_id_per_vertex.reserve(max_segment_vertices);
+
+    for (auto const & [time_frame, lines]: m_line_data_ptr->GetAllLineViewsAsRange()) {
+        auto const ids_at_time = m_line_data_ptr->getEntityIdsAtTime(time_frame);
         for (int line_id = 0; line_id < static_cast<int>(lines.size()); ++line_id) {
-            Line2D const & line = lines[line_id];
+            auto const line = lines[static_cast<size_t>(line_id)];
 
             if (line.size() < 2) {
                 continue;
@@ -81,7 +87,7 @@ void LineDataVisualization::buildVertexData() {
             m_line_identifiers.push_back({time_frame.getValue(), line_id});
             // Record line-level EntityId (aligned to identifier index)
             if (line_id < static_cast<int>(ids_at_time.size())) {
-                m_line_entity_ids.push_back(ids_at_time[line_id]);
+                m_line_entity_ids.push_back(ids_at_time[static_cast<size_t>(line_id)]);
             } else {
                 m_line_entity_ids.push_back(0);
             }
@@ -560,20 +566,16 @@ BoundingBox LineDataVisualization::calculateBoundsForLineData(LineData const * l
 
     bool has_data = false;
 
-    for (auto const & [time_frame, lines]: line_data->GetAllLinesAsRange()) {
-        for (Line2D const & line: lines) {
-            for (Point2D<float> const & point: line) {
-                if (!has_data) {
-                    min_x = max_x = point.x;
-                    min_y = max_y = point.y;
-                    has_data = true;
-                } else {
-                    min_x = std::min(min_x, point.x);
-                    max_x = std::max(max_x, point.x);
-                    min_y = std::min(min_y, point.y);
-                    max_y = std::max(max_y, point.y);
-                }
-            }
+    for (Point2D<float> const & point: line_data->getAllVertices()) {
+        if (!has_data) {
+            min_x = max_x = point.x;
+            min_y = max_y = point.y;
+            has_data = true;
+        } else {
+            min_x = std::min(min_x, point.x);
+            max_x = std::max(max_x, point.x);
+            min_y = std::min(min_y, point.y);
+            max_y = std::max(max_y, point.y);
         }
     }
 
@@ -27,7 +27,7 @@ void PointDataVisualization::populateData() {
 
     // Update the spatial index with proper bounds
     m_spatial_index = std::make_unique<QuadTree<int64_t>>(bounds);
-    m_vertex_data.reserve(m_point_data->GetAllPointsAsRange().size() * 3);// Reserve space for x, y, group_id
+    m_vertex_data.reserve(m_point_data->getTotalPointCount() * 3);// Reserve space for x, y, group_id
 
     for (auto const & time_points_pair: m_point_data->GetAllPointsAsRange()) {
         for (auto const & point: time_points_pair.points) {
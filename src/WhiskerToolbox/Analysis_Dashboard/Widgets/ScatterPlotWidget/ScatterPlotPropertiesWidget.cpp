@@ -438,12 +438,8 @@ std::vector<float> ScatterPlotPropertiesWidget::loadDataFromKey(QString const &
         try {
             auto analog_data = _data_manager->getData<AnalogTimeSeries>(analog_key.toStdString());
             if (analog_data) {
-                auto data_vector = analog_data->getAnalogTimeSeries();
-                result.reserve(data_vector.size());
-
-                for (auto value: data_vector) {
-                    result.push_back(static_cast<float>(value));
-                }
+                auto const samples = analog_data->getAnalogTimeSeriesSpan();
+                result.assign(samples.begin(), samples.end());
 
                 qDebug() << "Loaded" << result.size() << "values from analog time series:" << analog_key;
             }
@@ -31,6 +31,8 @@
 #include <QStandardPaths>
 #include <QDebug>
 
+#include <algorithm>
+
 BatchProcessing_Widget::BatchProcessing_Widget(std::shared_ptr<DataManager> dataManager, MainWindow* mainWindow, QWidget *parent)
     : QWidget(parent)
     , ui(new Ui::BatchProcessing_Widget)
@@ -374,18 +376,21 @@ void BatchProcessing_Widget::loadFolderWithJson()
         
         // Load data using the current JSON content and selected folder
         auto dataInfoList = loadDataFromJsonContent(jsonText, selectedFolder);
+        auto const loadedCount = std::count_if(dataInfoList.begin(), dataInfoList.end(),
+                                               [](DataInfo const & info) { return info.error.empty(); });
         
-        if (dataInfoList.empty()) {
+        if (loadedCount == 0) {
             QMessageBox::information(this, "No Data Loaded", 
                                    "No data was loaded. Check your JSON configuration and folder contents.");
         } else {
             // Process the loaded data through MainWindow to update GUI components
+            // (this also reports entries that failed to load)
             if (m_mainWindow) {
                 m_mainWindow->processLoadedData(dataInfoList);
             }
             
             QString message = QString("Successfully loaded %1 data items from folder:\n%2")
-                            .arg(dataInfoList.size())
+                            .arg(loadedCount)
                             .arg(selectedFolder);
             QMessageBox::information(this, "Data Loaded", message);
             
@@ -372,8 +372,8 @@ void DataManager_Widget::_changeScrollbar(int frame_id) {
         auto feature_timeframe = _data_manager->getTime(active_feature_timeframe_key);
 
         if (video_timeframe.get() != feature_timeframe.get()) {
-            frame_id = feature_timeframe->getTimeAtIndex(TimeFrameIndex(frame_id));
-            frame_id = video_timeframe->getIndexAtTime(frame_id).getValue();
+            auto const feature_time = feature_timeframe->getTimeAtIndex(TimeFrameIndex(frame_id));
+            frame_id = static_cast<int>(video_timeframe->getIndexAtTime(static_cast<double>(feature_time)).getValue());
         }
     }
 
@@ -11,10 +11,10 @@ void LineTableModel::setLines(LineData const * lineData) {
     _display_data.clear();
     _line_data_source = lineData;
     if (lineData) {
-        for (auto const & timeLinesPair: lineData->GetAllLinesAsRange()) {
+        for (auto const & timeLinesPair: lineData->GetAllLineViewsAsRange()) {
             auto frame = timeLinesPair.time.getValue();
             int lineIndex = 0;
-            for (auto const & line: timeLinesPair.lines) {
+            for (auto const line: timeLinesPair.lines) {
                 _display_data.push_back({frame, lineIndex, static_cast<int>(line.size())});
                 lineIndex++;
             }
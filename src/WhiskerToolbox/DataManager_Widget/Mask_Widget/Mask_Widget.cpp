@@ -28,6 +28,7 @@
 #include <QStackedWidget>
 #include <QString>
 #include <QTableView>
+#include <QThread>
 #include <filesystem>
 #include <iostream>
 #include <set>
@@ -417,7 +418,7 @@ void Mask_Widget::selectPoint(float const x, float const y) {
 }
 
 void Mask_Widget::_loadSamModel() {
-    _sam_model = std::make_unique<dl::EfficientSAM>();
+    _sam_model = std::make_unique<dl::EfficientSAM>(QThread::idealThreadCount());
     // Assuming load_model handles its own error reporting or exceptions
     _sam_model->load_model();
     // Potentially update UI to indicate model is loaded, e.g., enable/disable buttons
@@ -22,7 +22,7 @@ public:
         _points.clear();// Clear previous data
         if (pointData) {// Check if pointData is not null
             for (auto const & timePointsPair: pointData->GetAllPointsAsRange()) {
-                _points[timePointsPair.time] = timePointsPair.points;
+                _points[timePointsPair.time].assign(timePointsPair.points.begin(), timePointsPair.points.end());
             }
         }
         endResetModel();
@@ -234,23 +234,17 @@ void Point_Widget::_deleteSelectedPoints() {
     std::cout << "Point_Widget: Deleting points from " << selected_frames.size()
               << " frames in '" << _active_key << "'..." << std::endl;
 
-    int frames_with_points = 0;
-    int total_points_deleted = 0;
-
-    // Count points before deletion and batch operations to minimize observer notifications
+    size_t frames_with_points = 0;
     for (auto frame: selected_frames) {
-        auto points_at_frame = point_data_ptr->getAtTime(frame);
-        if (!points_at_frame.empty()) {
+        if (!point_data_ptr->getAtTime(frame).empty()) {
             frames_with_points++;
-            total_points_deleted += static_cast<int>(points_at_frame.size());
-            point_data_ptr->clearAtTime(frame, false);
         }
     }
 
-    // Notify observers only once at the end
-    if (frames_with_points > 0) {
-        point_data_ptr->notifyObservers();
+    // Clear all frames in one pass; observers are notified once
+    auto const total_points_deleted = point_data_ptr->clearAtTimes(selected_frames);
 
+    if (total_points_deleted > 0) {
         // Update the table view to reflect changes
         updateTable();
 
@@ -197,13 +197,27 @@ inline bool export_media_frames(DataManager * data_manager,
 
     media_export_opts.image_save_dir = primary_saved_parent_dir;
 
-    int success_count = 0;
+    std::vector<int> frame_ids;
+    frame_ids.reserve(frame_ids_to_export.size());
     for (size_t frame_id_sz: frame_ids_to_export) {
-        int frame_id = static_cast<int>(frame_id_sz);
-        save_image(media_data.get(), frame_id, media_export_opts);
-        success_count++;
+        frame_ids.push_back(static_cast<int>(frame_id_sz));
     }
-    QMessageBox::information(parent_ptr, "Media Export Complete", QString("Successfully exported %1 of %2 frames.").arg(success_count).arg(frame_ids_to_export.size()));
+
+    auto const result = save_images(media_data.get(), frame_ids, media_export_opts);
+    if (result.failed > 0) {
+        QMessageBox::warning(parent_ptr, "Media Export Incomplete",
+                             QString("Failed to write %1 of %2 frames. Exported %3 (%4 already existed).")
+                                     .arg(result.failed)
+                                     .arg(frame_ids_to_export.size())
+                                     .arg(result.saved + result.skipped)
+                                     .arg(result.skipped));
+        return false;
+    }
+    QMessageBox::information(parent_ptr, "Media Export Complete",
+                             QString("Successfully exported %1 of %2 frames (%3 frames/s).")
+                                     .arg(result.saved + result.skipped)
+                                     .arg(frame_ids_to_export.size())
+                                     .arg(result.framesPerSecond(), 0, 'f', 1));
     return true;
 }
 
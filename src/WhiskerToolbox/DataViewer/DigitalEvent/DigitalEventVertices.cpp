@@ -0,0 +1,30 @@
+#include "DigitalEventVertices.hpp"
+
+#include "DigitalTimeSeries/Digital_Event_Series.hpp"
+#include "TimeFrame/TimeFrame.hpp"
+
+void buildEventVertices(DigitalEventSeries const & series,
+                        TimeFrame const * event_time_frame,
+                        TimeFrame const * master_time_frame,
+                        SeriesViewport const & viewport,
+                        std::vector<float> & vertices) {
+
+    auto const visible_events = series.getEventSpanInRange(TimeFrameIndex(viewport.start_time),
+                                                           TimeFrameIndex(viewport.end_time),
+                                                           master_time_frame,
+                                                           event_time_frame);
+
+    vertices.reserve(vertices.size() + visible_events.size() * 2 * SeriesVertexCache::floats_per_vertex);
+
+    // Events in the master time frame are already in x axis coordinates
+    bool const convert = event_time_frame && event_time_frame != master_time_frame;
+
+    for (float const event: visible_events) {
+        float const x = convert
+                                ? static_cast<float>(event_time_frame->getTimeAtIndex(TimeFrameIndex(static_cast<int64_t>(event))))
+                                : event;
+
+        vertices.insert(vertices.end(), {x, viewport.y_min, 0.0f, 1.0f,
+                                         x, viewport.y_max, 0.0f, 1.0f});
+    }
+}
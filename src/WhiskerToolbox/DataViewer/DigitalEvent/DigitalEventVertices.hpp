@@ -0,0 +1,34 @@
+#ifndef DATAVIEWER_DIGITALEVENTVERTICES_HPP
+#define DATAVIEWER_DIGITALEVENTVERTICES_HPP
+
+#include "../SeriesVertexCache.hpp"
+
+#include <vector>
+
+class DigitalEventSeries;
+class TimeFrame;
+
+/**
+ * @brief Append line vertices for every visible event of a series
+ *
+ * Each event in [viewport.start_time, viewport.end_time] of the master time
+ * frame becomes one vertical line from viewport.y_min to viewport.y_max,
+ * i.e. two (x, y, 0, 1) vertices suitable for a single GL_LINES draw.
+ *
+ * Events are located with a binary search on the sorted series. When the
+ * series uses a different time frame than the master, event indices are
+ * converted to times in one pass over the visible range.
+ *
+ * @param series Event series to draw
+ * @param event_time_frame Time frame of the series
+ * @param master_time_frame Time frame of the x axis
+ * @param viewport Visible region in master time frame coordinates
+ * @param vertices Output array the vertices are appended to
+ */
+void buildEventVertices(DigitalEventSeries const & series,
+                        TimeFrame const * event_time_frame,
+                        TimeFrame const * master_time_frame,
+                        SeriesViewport const & viewport,
+                        std::vector<float> & vertices);
+
+#endif// DATAVIEWER_DIGITALEVENTVERTICES_HPP
@@ -0,0 +1,91 @@
+#include "DigitalEventVertices.hpp"
+
+#include "DigitalTimeSeries/Digital_Event_Series.hpp"
+#include "TimeFrame/TimeFrame.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <vector>
+
+TEST_CASE("Digital Event Vertices", "[digital_event][vertices]") {
+
+    DigitalEventSeries series(std::vector<float>{50.0f, 10.0f, 30.0f, 200.0f, 20.0f});
+
+    SECTION("Visible events become one line each") {
+        std::vector<float> vertices;
+        buildEventVertices(series, nullptr, nullptr, SeriesViewport{15, 60, -2.0f, 3.0f}, vertices);
+
+        // Events 20, 30 and 50, two vertices of four floats each
+        REQUIRE(vertices.size() == 3 * 2 * SeriesVertexCache::floats_per_vertex);
+        REQUIRE(vertices[0] == 20.0f);
+        REQUIRE(vertices[1] == -2.0f);
+        REQUIRE(vertices[3] == 1.0f);
+        REQUIRE(vertices[4] == 20.0f);
+        REQUIRE(vertices[5] == 3.0f);
+        REQUIRE(vertices[16] == 50.0f);
+    }
+
+    SECTION("Range bounds are inclusive and an empty range yields nothing") {
+        std::vector<float> vertices;
+        buildEventVertices(series, nullptr, nullptr, SeriesViewport{10, 20, 0.0f, 1.0f}, vertices);
+        REQUIRE(vertices.size() == 2 * 2 * SeriesVertexCache::floats_per_vertex);
+
+        vertices.clear();
+        buildEventVertices(series, nullptr, nullptr, SeriesViewport{60, 100, 0.0f, 1.0f}, vertices);
+        REQUIRE(vertices.empty());
+    }
+
+    SECTION("Events in another time frame are placed at their master time") {
+        // Master clock ticks every sample, the event clock every 10 samples
+        std::vector<int> master_times(1000);
+        std::vector<int> event_times(100);
+        for (int i = 0; i < 1000; ++i) master_times[static_cast<size_t>(i)] = i;
+        for (int i = 0; i < 100; ++i) event_times[static_cast<size_t>(i)] = i * 10;
+        auto master = std::make_shared<TimeFrame>(master_times);
+        auto event_frame = std::make_shared<TimeFrame>(event_times);
+
+        std::vector<float> vertices;
+        buildEventVertices(series, event_frame.get(), master.get(), SeriesViewport{150, 450, 0.0f, 1.0f}, vertices);
+
+        // Event indices 20 and 30 fall at master times 200 and 300
+        REQUIRE(vertices.size() == 2 * 2 * SeriesVertexCache::floats_per_vertex);
+        REQUIRE(vertices[0] == 200.0f);
+        REQUIRE(vertices[8] == 300.0f);
+    }
+}
+
+TEST_CASE("Series Vertex Cache", "[digital_event][vertices]") {
+
+    DigitalEventSeries series(std::vector<float>{1.0f, 2.0f, 3.0f});
+    SeriesVertexCache cache;
+    int builds = 0;
+
+    auto update = [&](SeriesViewport const & viewport) {
+        return cache.update(viewport, [&](std::vector<float> & vertices) {
+            ++builds;
+            buildEventVertices(series, nullptr, nullptr, viewport, vertices);
+        });
+    };
+
+    REQUIRE(update(SeriesViewport{0, 10, 0.0f, 1.0f}));
+    REQUIRE(cache.vertexCount() == 6);
+    auto const generation = cache.generation();
+
+    // Same viewport and data: nothing to rebuild
+    REQUIRE_FALSE(update(SeriesViewport{0, 10, 0.0f, 1.0f}));
+    REQUIRE(builds == 1);
+    REQUIRE(cache.generation() == generation);
+
+    // Viewport change rebuilds
+    REQUIRE(update(SeriesViewport{0, 2, 0.0f, 1.0f}));
+    REQUIRE(cache.vertexCount() == 4);
+
+    // Data change rebuilds once invalidated
+    series.addEvent(1.5f);
+    cache.invalidate();
+    REQUIRE(update(SeriesViewport{0, 2, 0.0f, 1.0f}));
+    REQUIRE(cache.vertexCount() == 6);
+    REQUIRE(builds == 3);
+    REQUIRE(cache.generation() > generation);
+}
@@ -0,0 +1,44 @@
+#include "DigitalIntervalVertices.hpp"
+
+#include "DigitalTimeSeries/Digital_Interval_Series.hpp"
+#include "TimeFrame/TimeFrame.hpp"
+
+#include <algorithm>
+
+void buildIntervalVertices(DigitalIntervalSeries const & series,
+                           TimeFrame const * interval_time_frame,
+                           TimeFrame const * master_time_frame,
+                           SeriesViewport const & viewport,
+                           std::vector<float> & vertices) {
+
+    auto visible_intervals = series.getIntervalsInRange<DigitalIntervalSeries::RangeMode::OVERLAPPING>(
+            TimeFrameIndex(viewport.start_time),
+            TimeFrameIndex(viewport.end_time),
+            master_time_frame,
+            interval_time_frame);
+
+    auto const visible_start = static_cast<float>(viewport.start_time);
+    auto const visible_end = static_cast<float>(viewport.end_time);
+    float const y_min = viewport.y_min;
+    float const y_max = viewport.y_max;
+
+    auto to_x = [interval_time_frame](int64_t index) {
+        return interval_time_frame
+                       ? static_cast<float>(interval_time_frame->getTimeAtIndex(TimeFrameIndex(index)))
+                       : static_cast<float>(index);
+    };
+
+    for (auto const & interval: visible_intervals) {
+        // Clip the interval to the visible range
+        float const x_start = std::max(to_x(interval.start), visible_start);
+        float const x_end = std::min(to_x(interval.end), visible_end);
+
+        vertices.insert(vertices.end(), {x_start, y_min, 0.0f, 1.0f,
+                                         x_end, y_min, 0.0f, 1.0f,
+                                         x_end, y_max, 0.0f, 1.0f,
+
+                                         x_start, y_min, 0.0f, 1.0f,
+                                         x_end, y_max, 0.0f, 1.0f,
+                                         x_start, y_max, 0.0f, 1.0f});
+    }
+}
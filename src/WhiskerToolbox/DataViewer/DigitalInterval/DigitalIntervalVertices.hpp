@@ -0,0 +1,32 @@
+#ifndef DATAVIEWER_DIGITALINTERVALVERTICES_HPP
+#define DATAVIEWER_DIGITALINTERVALVERTICES_HPP
+
+#include "../SeriesVertexCache.hpp"
+
+#include <vector>
+
+class DigitalIntervalSeries;
+class TimeFrame;
+
+/**
+ * @brief Append rectangle vertices for every visible interval of a series
+ *
+ * Each interval overlapping [viewport.start_time, viewport.end_time] of the
+ * master time frame becomes a rectangle clipped to the visible range and
+ * spanning [viewport.y_min, viewport.y_max]. Rectangles are emitted as two
+ * triangles, i.e. six (x, y, 0, 1) vertices, so the whole series can be
+ * drawn with a single GL_TRIANGLES call.
+ *
+ * @param series Interval series to draw
+ * @param interval_time_frame Time frame of the series
+ * @param master_time_frame Time frame of the x axis
+ * @param viewport Visible region in master time frame coordinates
+ * @param vertices Output array the vertices are appended to
+ */
+void buildIntervalVertices(DigitalIntervalSeries const & series,
+                           TimeFrame const * interval_time_frame,
+                           TimeFrame const * master_time_frame,
+                           SeriesViewport const & viewport,
+                           std::vector<float> & vertices);
+
+#endif// DATAVIEWER_DIGITALINTERVALVERTICES_HPP
@@ -0,0 +1,41 @@
+#include "DigitalIntervalVertices.hpp"
+
+#include "DigitalTimeSeries/Digital_Interval_Series.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <vector>
+
+TEST_CASE("Digital Interval Vertices", "[digital_interval][vertices]") {
+
+    DigitalIntervalSeries series(std::vector<Interval>{{10, 20}, {40, 80}, {200, 300}});
+
+    std::vector<float> vertices;
+    buildIntervalVertices(series, nullptr, nullptr, SeriesViewport{15, 60, -1.0f, 1.0f}, vertices);
+
+    // Two overlapping intervals, each two triangles of four-float vertices
+    constexpr size_t floats_per_interval = 6 * SeriesVertexCache::floats_per_vertex;
+    REQUIRE(vertices.size() == 2 * floats_per_interval);
+
+    SECTION("Rectangles are clipped to the visible range") {
+        // First interval starts before the view
+        REQUIRE(vertices[0] == 15.0f);
+        REQUIRE(vertices[4] == 20.0f);
+
+        // Second interval ends after the view
+        REQUIRE(vertices[floats_per_interval] == 40.0f);
+        REQUIRE(vertices[floats_per_interval + 4] == 60.0f);
+    }
+
+    SECTION("Rectangles span the requested height") {
+        float lowest = vertices[1];
+        float highest = vertices[1];
+        for (size_t i = 1; i < vertices.size(); i += SeriesVertexCache::floats_per_vertex) {
+            lowest = std::min(lowest, vertices[i]);
+            highest = std::max(highest, vertices[i]);
+        }
+        REQUIRE(lowest == -1.0f);
+        REQUIRE(highest == 1.0f);
+    }
+}
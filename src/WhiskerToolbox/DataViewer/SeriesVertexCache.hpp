@@ -0,0 +1,76 @@
+#ifndef DATAVIEWER_SERIESVERTEXCACHE_HPP
+#define DATAVIEWER_SERIESVERTEXCACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Visible region that determines the vertices of a series
+ *
+ * start_time and end_time are in master time frame coordinates (the x axis).
+ */
+struct SeriesViewport {
+    int64_t start_time{0};
+    int64_t end_time{0};
+    float y_min{-1.0f};
+    float y_max{1.0f};
+
+    bool operator==(SeriesViewport const & other) const = default;
+};
+
+/**
+ * @brief CPU-side vertex array for one series, rebuilt only when its inputs change
+ *
+ * Vertices are (x, y, 0, 1) to match the layout expected by the axes shader.
+ * The renderer keeps the generation of the last uploaded array and only
+ * re-uploads when it differs, so an unchanged series costs a single draw call.
+ */
+class SeriesVertexCache {
+public:
+    static constexpr std::size_t floats_per_vertex = 4;
+
+    /**
+     * @brief Mark the underlying data as changed so the next update rebuilds
+     */
+    void invalidate() { _valid = false; }
+
+    /**
+     * @brief Rebuild the vertices if the data or the viewport changed
+     *
+     * @param viewport Visible region the vertices are built for
+     * @param build Callable taking std::vector<float> & that appends the vertices
+     * @return true if the vertices were rebuilt
+     */
+    template<typename Build>
+    bool update(SeriesViewport const & viewport, Build && build) {
+        if (_valid && viewport == _viewport) {
+            return false;
+        }
+
+        _vertices.clear();
+        build(_vertices);
+
+        _viewport = viewport;
+        _valid = true;
+        ++_generation;
+        return true;
+    }
+
+    [[nodiscard]] std::vector<float> const & vertices() const { return _vertices; }
+
+    [[nodiscard]] std::size_t vertexCount() const { return _vertices.size() / floats_per_vertex; }
+
+    /**
+     * @brief Incremented every time the vertices are rebuilt
+     */
+    [[nodiscard]] uint64_t generation() const { return _generation; }
+
+private:
+    std::vector<float> _vertices;
+    SeriesViewport _viewport;
+    uint64_t _generation{0};
+    bool _valid{false};
+};
+
+#endif// DATAVIEWER_SERIESVERTEXCACHE_HPP
@@ -229,9 +229,9 @@ void DataViewer_Widget::resizeEvent(QResizeEvent * event) {
 
 void DataViewer_Widget::_updatePlot(int time) {
     //std::cout << "Time is " << time;
-    time = _data_manager->getTime(TimeKey("time"))->getTimeAtIndex(TimeFrameIndex(time));
+    auto const master_time = _data_manager->getTime(TimeKey("time"))->getTimeAtIndex(TimeFrameIndex(time));
     //std::cout << ""
-    ui->openGLWidget->updateCanvas(time);
+    ui->openGLWidget->updateCanvas(master_time);
 
     _updateLabels();
 }
@@ -597,7 +597,7 @@ void DataViewer_Widget::_handleColorChanged(std::string const & feature_key, std
 void DataViewer_Widget::_updateCoordinateDisplay(float time_coordinate, float canvas_y, QString const & series_info) {
     // Convert time coordinate to actual time using the time frame
     int const time_index = static_cast<int>(std::round(time_coordinate));
-    int const actual_time = _time_frame->getTimeAtIndex(TimeFrameIndex(time_index));
+    int64_t const actual_time = _time_frame->getTimeAtIndex(TimeFrameIndex(time_index));
 
     // Get canvas size for debugging
     auto [canvas_width, canvas_height] = ui->openGLWidget->getCanvasSize();
@@ -5,8 +5,10 @@
 #include "DataViewer/AnalogTimeSeries/AnalogTimeSeriesDisplayOptions.hpp"
 #include "DataViewer/AnalogTimeSeries/MVP_AnalogTimeSeries.hpp"
 #include "DataViewer/DigitalEvent/DigitalEventSeriesDisplayOptions.hpp"
+#include "DataViewer/DigitalEvent/DigitalEventVertices.hpp"
 #include "DataViewer/DigitalEvent/MVP_DigitalEvent.hpp"
 #include "DataViewer/DigitalInterval/DigitalIntervalSeriesDisplayOptions.hpp"
+#include "DataViewer/DigitalInterval/DigitalIntervalVertices.hpp"
 #include "DataViewer/DigitalInterval/MVP_DigitalInterval.hpp"
 #include "DataViewer/PlottingManager/PlottingManager.hpp"
 #include "DataViewer_Widget.hpp"
@@ -25,6 +27,7 @@
 //#include <glm/gtx/transform.hpp>
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstdlib>
 #include <ctime>
@@ -62,10 +65,16 @@ OpenGLWidget::OpenGLWidget(QWidget * parent)
 }
 
 OpenGLWidget::~OpenGLWidget() {
+    for (auto const & [key, event_data]: _digital_event_series) {
+        event_data.series->removeObserver(event_data.observer_id);
+    }
+    for (auto const & [key, interval_data]: _digital_interval_series) {
+        interval_data.series->removeObserver(interval_data.observer_id);
+    }
     cleanup();
 }
 
-void OpenGLWidget::updateCanvas(int time) {
+void OpenGLWidget::updateCanvas(int64_t time) {
     _time = time;
     //std::cout << "Redrawing at " << _time << std::endl;
     update();
@@ -208,6 +217,12 @@ void OpenGLWidget::cleanup() {
     if (m_program == nullptr)
         return;
     makeCurrent();
+    for (auto & [key, event_data]: _digital_event_series) {
+        _releaseSeriesVertexBuffer(event_data.geometry);
+    }
+    for (auto & [key, interval_data]: _digital_interval_series) {
+        _releaseSeriesVertexBuffer(interval_data.geometry);
+    }
     delete m_program;
     delete m_dashedProgram;
     m_program = nullptr;
@@ -316,6 +331,41 @@ void OpenGLWidget::setupVertexAttribs() {
     m_vbo.release();
 }
 
+void OpenGLWidget::_drawSeriesVertexBuffer(SeriesVertexBuffer & geometry, GLenum mode) {
+    auto const vertex_count = geometry.cache.vertexCount();
+    if (vertex_count == 0) {
+        return;
+    }
+
+    if (!geometry.buffer.isCreated()) {
+        geometry.buffer.create();
+        geometry.buffer.setUsagePattern(QOpenGLBuffer::DynamicDraw);
+        geometry.uploaded_generation = 0;
+    }
+
+    geometry.buffer.bind();
+    if (geometry.uploaded_generation != geometry.cache.generation()) {
+        auto const & vertices = geometry.cache.vertices();
+        geometry.buffer.allocate(vertices.data(), static_cast<int>(vertices.size() * sizeof(GLfloat)));
+        geometry.uploaded_generation = geometry.cache.generation();
+    }
+
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, static_cast<GLsizei>(SeriesVertexCache::floats_per_vertex * sizeof(GLfloat)), nullptr);
+    glDrawArrays(mode, 0, static_cast<GLsizei>(vertex_count));
+    geometry.buffer.release();
+
+    // Point the vertex attributes back at the shared buffer used by the other draw calls
+    setupVertexAttribs();
+}
+
+void OpenGLWidget::_releaseSeriesVertexBuffer(SeriesVertexBuffer & geometry) {
+    if (geometry.buffer.isCreated()) {
+        geometry.buffer.destroy();
+    }
+    geometry.uploaded_generation = 0;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /**
@@ -360,7 +410,7 @@ void OpenGLWidget::drawDigitalEventSeries() {
 
     int visible_series_index = 0;
 
-    for (auto const & [key, event_data]: _digital_event_series) {
+    for (auto & [key, event_data]: _digital_event_series) {
         auto const & series = event_data.series;
         auto const & time_frame = event_data.time_frame;
         auto const & display_options = event_data.display_options;
@@ -373,11 +423,6 @@ void OpenGLWidget::drawDigitalEventSeries() {
         float const bNorm = static_cast<float>(b) / 255.0f;
         float const alpha = display_options->alpha;
 
-        auto visible_events = series->getEventsInRange(TimeFrameIndex(start_time),
-                                                       TimeFrameIndex(end_time),
-                                                       time_frame.get(),
-                                                       _master_time_frame.get());
-
         // === MVP MATRIX SETUP ===
 
         // We need to check if we have a PlottingManager reference
@@ -413,29 +458,11 @@ void OpenGLWidget::drawDigitalEventSeries() {
         // Set line thickness from display options
         glLineWidth(static_cast<float>(display_options->line_thickness));
 
-        for (auto const & event: visible_events) {
-            // Calculate X position in master time frame coordinates for consistent rendering
-            float xCanvasPos;
-            if (time_frame.get() == _master_time_frame.get()) {
-                // Same time frame - event is already in correct coordinates
-                xCanvasPos = event;
-            } else {
-                // Different time frames - convert event index to time, then to master time frame
-                float event_time = static_cast<float>(time_frame->getTimeAtIndex(TimeFrameIndex(static_cast<int>(event))));
-                xCanvasPos = event_time;// This should work if both time frames use the same time units
-            }
-
-            std::array<GLfloat, 4> vertices = {
-                    xCanvasPos, min_y,
-                    xCanvasPos, max_y};
-
-            glBindBuffer(GL_ARRAY_BUFFER, m_vbo.bufferId());
-            m_vbo.allocate(vertices.data(), vertices.size() * sizeof(GLfloat));
-
-            GLint const first = 0;  // Starting index of enabled array
-            GLsizei const count = 2;// number of indexes to render
-            glDrawArrays(GL_LINES, first, count);
-        }
+        SeriesViewport const viewport{start_time, end_time, min_y, max_y};
+        event_data.geometry.cache.update(viewport, [&](std::vector<float> & vertices) {
+            buildEventVertices(*series, time_frame.get(), _master_time_frame.get(), viewport, vertices);
+        });
+        _drawSeriesVertexBuffer(event_data.geometry, GL_LINES);
 
         visible_series_index++;
     }
@@ -466,22 +493,13 @@ void OpenGLWidget::drawDigitalIntervalSeries() {
         return;
     }
 
-    for (auto const & [key, interval_data]: _digital_interval_series) {
+    for (auto & [key, interval_data]: _digital_interval_series) {
         auto const & series = interval_data.series;
         auto const & time_frame = interval_data.time_frame;
         auto const & display_options = interval_data.display_options;
 
         if (!display_options->is_visible) continue;
 
-        // Get only the intervals that overlap with the visible range
-        // These will be
-        auto visible_intervals = series->getIntervalsInRange<DigitalIntervalSeries::RangeMode::OVERLAPPING>(
-                TimeFrameIndex(static_cast<int64_t>(start_time)),
-                TimeFrameIndex(static_cast<int64_t>(end_time)),
-                _master_time_frame.get(),
-                time_frame.get()
-                );
-
         hexToRGB(display_options->hex_color, r, g, b);
         float const rNorm = static_cast<float>(r) / 255.0f;
         float const gNorm = static_cast<float>(g) / 255.0f;
@@ -519,40 +537,12 @@ void OpenGLWidget::drawDigitalIntervalSeries() {
         glUniform3f(m_colorLoc, rNorm, gNorm, bNorm);
         glUniform1f(m_alphaLoc, alpha);
 
-        for (auto const & interval: visible_intervals) {
-
-            std::cout << "interval.start:" << interval.start << "interval.end:" << interval.end << std::endl;
-
-            auto start = static_cast<float>(time_frame->getTimeAtIndex(TimeFrameIndex(interval.start)));
-            auto end = static_cast<float>(time_frame->getTimeAtIndex(TimeFrameIndex(interval.end)));
-
-            //Clip the interval to the visible range
-            start = std::max(start, start_time);
-            end = std::min(end, end_time);
-
-            float const xStart = start;
-            float const xEnd = end;
-
-            // Use normalized coordinates for intervals
-            // The Model matrix will handle positioning and scaling
-            float const interval_y_min = -1.0f;// Bottom of interval in local coordinates
-            float const interval_y_max = +1.0f;// Top of interval in local coordinates
-
-            // Create 4D vertices (x, y, 0, 1) to match the shader expectations
-            std::array<GLfloat, 16> vertices = {
-                    xStart, interval_y_min, 0.0f, 1.0f,
-                    xEnd, interval_y_min, 0.0f, 1.0f,
-                    xEnd, interval_y_max, 0.0f, 1.0f,
-                    xStart, interval_y_max, 0.0f, 1.0f};
-
-            m_vbo.bind();
-            m_vbo.allocate(vertices.data(), vertices.size() * sizeof(GLfloat));
-            m_vbo.release();
-
-            GLint const first = 0;  // Starting index of enabled array
-            GLsizei const count = 4;// number of indexes to render
-            glDrawArrays(GL_TRIANGLE_FAN, first, count);
-        }
+        // Rectangles use normalized coordinates; the Model matrix handles positioning and scaling
+        SeriesViewport const viewport{_xAxis.getStart(), _xAxis.getEnd(), -1.0f, 1.0f};
+        interval_data.geometry.cache.update(viewport, [&](std::vector<float> & vertices) {
+            buildIntervalVertices(*series, time_frame.get(), _master_time_frame.get(), viewport, vertices);
+        });
+        _drawSeriesVertexBuffer(interval_data.geometry, GL_TRIANGLES);
 
         // Draw highlighting for selected intervals
         auto selected_interval = getSelectedInterval(key);
@@ -647,7 +637,7 @@ void OpenGLWidget::drawAnalogSeries() {
 
     for (auto const & [key, analog_data]: _analog_series) {
         auto const & series = analog_data.series;
-        auto const & data = series->getAnalogTimeSeries();
+        auto const data = series->getAnalogTimeSeriesSpan();
         //if (!series->hasTimeFrameV2()) {
         //    continue;
         //}
@@ -680,8 +670,11 @@ void OpenGLWidget::drawAnalogSeries() {
 
         m_vertices.clear();
 
-        auto series_start_index = getTimeIndexForSeries(start_time, _master_time_frame.get(), time_frame.get());
-        auto series_end_index = getTimeIndexForSeries(end_time, _master_time_frame.get(), time_frame.get());
+        // Both bounds go through the master-to-series conversion in one batch
+        std::array<TimeFrameIndex, 2> const visible_range{start_time, end_time};
+        auto const series_range = convertTimeFrameIndices(visible_range, _master_time_frame.get(), time_frame.get());
+        auto const series_start_index = series_range[0];
+        auto const series_end_index = series_range[1];
 
         // === MVP MATRIX SETUP ===
 
@@ -715,7 +708,7 @@ void OpenGLWidget::drawAnalogSeries() {
             auto time_begin = analog_range.time_indices.begin();
 
             for (size_t i = 0; i < analog_range.values.size(); i++) {
-                auto const xCanvasPos = time_frame->getTimeAtIndex(**time_begin);
+                auto const xCanvasPos = static_cast<float>(time_frame->getTimeAtIndex(**time_begin));
                 //auto const xCanvasPos = point.time_frame_index.getValue();
                 auto const yCanvasPos = analog_range.values[i];
 
@@ -755,7 +748,7 @@ void OpenGLWidget::drawAnalogSeries() {
     glUseProgram(0);
 }
 
-void OpenGLWidget::_drawAnalogSeriesWithGapDetection(std::vector<float> const & data,
+void OpenGLWidget::_drawAnalogSeriesWithGapDetection(std::span<float const> data,
                                                      std::shared_ptr<TimeFrame> const & time_frame,
                                                      AnalogTimeSeries::TimeValueSpanPair analog_range,
                                                      float gap_threshold) {
@@ -766,7 +759,7 @@ void OpenGLWidget::_drawAnalogSeriesWithGapDetection(std::vector<float> const &
     auto time_begin = analog_range.time_indices.begin();
 
     for (size_t i = 0; i < analog_range.values.size(); i++) {
-        auto const xCanvasPos = time_frame->getTimeAtIndex(**time_begin);
+        auto const xCanvasPos = static_cast<float>(time_frame->getTimeAtIndex(**time_begin));
         auto const yCanvasPos = analog_range.values[i];
 
         // Check for gap if this isn't the first point
@@ -813,7 +806,7 @@ void OpenGLWidget::_drawAnalogSeriesWithGapDetection(std::vector<float> const &
     }
 }
 
-void OpenGLWidget::_drawAnalogSeriesAsMarkers(std::vector<float> const & data,
+void OpenGLWidget::_drawAnalogSeriesAsMarkers(std::span<float const> data,
                                               std::shared_ptr<TimeFrame> const & time_frame,
                                               AnalogTimeSeries::TimeValueSpanPair analog_range) {
     m_vertices.clear();
@@ -822,7 +815,7 @@ void OpenGLWidget::_drawAnalogSeriesAsMarkers(std::vector<float> const & data,
 
     for (size_t i = 0; i < analog_range.values.size(); i++) {
 
-        auto const xCanvasPos = time_frame->getTimeAtIndex(**time_begin);
+        auto const xCanvasPos = static_cast<float>(time_frame->getTimeAtIndex(**time_begin));
         auto const yCanvasPos = analog_range.values[i];
 
         m_vertices.push_back(xCanvasPos);
@@ -857,7 +850,7 @@ void OpenGLWidget::paintGL() {
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
     //This has been converted to master coordinates
-    int const currentTime = _time;
+    int64_t const currentTime = _time;
 
     int64_t const zoom = _xAxis.getEnd() - _xAxis.getStart();
     _xAxis.setCenterAndZoom(currentTime, zoom);
@@ -986,10 +979,23 @@ void OpenGLWidget::addDigitalEventSeries(
     display_options->hex_color = color.empty() ? TimeSeriesDefaultValues::getColorForIndex(_digital_event_series.size()) : color;
     display_options->is_visible = true;
 
-    _digital_event_series[key] = DigitalEventSeriesData{
-            std::move(series),
-            std::move(time_frame),
-            std::move(display_options)};
+    // Replacing a series must not leave its observer behind
+    if (_digital_event_series.contains(key)) {
+        removeDigitalEventSeries(key);
+    }
+
+    auto & event_data = _digital_event_series[key];
+    event_data.series = std::move(series);
+    event_data.time_frame = std::move(time_frame);
+    event_data.display_options = std::move(display_options);
+
+    // Rebuild the cached vertices whenever the data changes
+    event_data.observer_id = event_data.series->addObserver([this, key]() {
+        auto it = _digital_event_series.find(key);
+        if (it != _digital_event_series.end()) {
+            it->second.geometry.cache.invalidate();
+        }
+    });
 
     updateCanvas(_time);
 }
@@ -997,6 +1003,10 @@ void OpenGLWidget::addDigitalEventSeries(
 void OpenGLWidget::removeDigitalEventSeries(std::string const & key) {
     auto item = _digital_event_series.find(key);
     if (item != _digital_event_series.end()) {
+        item->second.series->removeObserver(item->second.observer_id);
+        makeCurrent();
+        _releaseSeriesVertexBuffer(item->second.geometry);
+        doneCurrent();
         _digital_event_series.erase(item);
     }
     updateCanvas(_time);
@@ -1014,10 +1024,23 @@ void OpenGLWidget::addDigitalIntervalSeries(
     display_options->hex_color = color.empty() ? TimeSeriesDefaultValues::getColorForIndex(_digital_interval_series.size()) : color;
     display_options->is_visible = true;
 
-    _digital_interval_series[key] = DigitalIntervalSeriesData{
-            std::move(series),
-            std::move(time_frame),
-            std::move(display_options)};
+    // Replacing a series must not leave its observer behind
+    if (_digital_interval_series.contains(key)) {
+        removeDigitalIntervalSeries(key);
+    }
+
+    auto & interval_data = _digital_interval_series[key];
+    interval_data.series = std::move(series);
+    interval_data.time_frame = std::move(time_frame);
+    interval_data.display_options = std::move(display_options);
+
+    // Rebuild the cached vertices whenever the data changes
+    interval_data.observer_id = interval_data.series->addObserver([this, key]() {
+        auto it = _digital_interval_series.find(key);
+        if (it != _digital_interval_series.end()) {
+            it->second.geometry.cache.invalidate();
+        }
+    });
 
     updateCanvas(_time);
 }
@@ -1025,6 +1048,10 @@ void OpenGLWidget::addDigitalIntervalSeries(
 void OpenGLWidget::removeDigitalIntervalSeries(std::string const & key) {
     auto item = _digital_interval_series.find(key);
     if (item != _digital_interval_series.end()) {
+        item->second.series->removeObserver(item->second.observer_id);
+        makeCurrent();
+        _releaseSeriesVertexBuffer(item->second.geometry);
+        doneCurrent();
         _digital_interval_series.erase(item);
     }
     updateCanvas(_time);
@@ -1250,7 +1277,7 @@ std::optional<std::pair<int64_t, int64_t>> OpenGLWidget::findIntervalAtTime(std:
         query_time_index = static_cast<int64_t>(std::round(time_coord));
     } else {
         // Different time frame - convert master time to series time frame index
-        query_time_index = time_frame->getIndexAtTime(time_coord).getValue();
+        query_time_index = time_frame->getIndexAtTime(static_cast<double>(time_coord)).getValue();
     }
 
     // Find all intervals that contain this time point in the series' time frame
@@ -1267,8 +1294,8 @@ std::optional<std::pair<int64_t, int64_t>> OpenGLWidget::findIntervalAtTime(std:
             interval_end_master = interval.end;
         } else {
             // Convert series indices to master time frame coordinates
-            interval_start_master = static_cast<int64_t>(time_frame->getTimeAtIndex(TimeFrameIndex(interval.start)));
-            interval_end_master = static_cast<int64_t>(time_frame->getTimeAtIndex(TimeFrameIndex(interval.end)));
+            interval_start_master = time_frame->getTimeAtIndex(TimeFrameIndex(interval.start));
+            interval_end_master = time_frame->getTimeAtIndex(TimeFrameIndex(interval.end));
         }
 
         return std::make_pair(interval_start_master, interval_end_master);
@@ -1368,7 +1395,7 @@ void OpenGLWidget::updateIntervalDrag(QPoint const & current_pos) {
         current_time_series_index = static_cast<int64_t>(std::round(current_time_master));
     } else {
         // Different time frame - convert master time to series time frame index
-        current_time_series_index = time_frame->getIndexAtTime(current_time_master).getValue();
+        current_time_series_index = time_frame->getIndexAtTime(static_cast<double>(current_time_master)).getValue();
     }
 
     // Convert original interval bounds to series time frame for constraints
@@ -1379,8 +1406,8 @@ void OpenGLWidget::updateIntervalDrag(QPoint const & current_pos) {
         original_end_series = _original_end_time;
     } else {
         // Convert master time coordinates to series time frame indices
-        original_start_series = time_frame->getIndexAtTime(static_cast<float>(_original_start_time)).getValue();
-        original_end_series = time_frame->getIndexAtTime(static_cast<float>(_original_end_time)).getValue();
+        original_start_series = time_frame->getIndexAtTime(static_cast<double>(_original_start_time)).getValue();
+        original_end_series = time_frame->getIndexAtTime(static_cast<double>(_original_end_time)).getValue();
     }
 
     // Perform dragging logic in series time frame
@@ -1444,8 +1471,8 @@ void OpenGLWidget::updateIntervalDrag(QPoint const & current_pos) {
     } else {
         // Convert series indices back to master time coordinates
         try {
-            _dragged_start_time = static_cast<int64_t>(time_frame->getTimeAtIndex(TimeFrameIndex(new_start_series)));
-            _dragged_end_time = static_cast<int64_t>(time_frame->getTimeAtIndex(TimeFrameIndex(new_end_series)));
+            _dragged_start_time = time_frame->getTimeAtIndex(TimeFrameIndex(new_start_series));
+            _dragged_end_time = time_frame->getTimeAtIndex(TimeFrameIndex(new_end_series));
         } catch (...) {
             // Conversion failed - abort drag
             cancelIntervalDrag();
@@ -1485,10 +1512,10 @@ void OpenGLWidget::finishIntervalDrag() {
             new_end_series = _dragged_end_time;
         } else {
             // Convert master time coordinates to series time frame indices
-            original_start_series = time_frame->getIndexAtTime(static_cast<float>(_original_start_time)).getValue();
-            original_end_series = time_frame->getIndexAtTime(static_cast<float>(_original_end_time)).getValue();
-            new_start_series = time_frame->getIndexAtTime(static_cast<float>(_dragged_start_time)).getValue();
-            new_end_series = time_frame->getIndexAtTime(static_cast<float>(_dragged_end_time)).getValue();
+            original_start_series = time_frame->getIndexAtTime(static_cast<double>(_original_start_time)).getValue();
+            original_end_series = time_frame->getIndexAtTime(static_cast<double>(_original_end_time)).getValue();
+            new_start_series = time_frame->getIndexAtTime(static_cast<double>(_dragged_start_time)).getValue();
+            new_end_series = time_frame->getIndexAtTime(static_cast<double>(_dragged_end_time)).getValue();
         }
 
         // Validate converted coordinates
@@ -1722,8 +1749,8 @@ void OpenGLWidget::updateNewIntervalCreation(QPoint const & current_pos) {
         current_time_series = current_time_coord;
     } else {
         // Convert master time coordinates to series time frame indices
-        click_time_series = time_frame->getIndexAtTime(static_cast<float>(_new_interval_click_time)).getValue();
-        current_time_series = time_frame->getIndexAtTime(static_cast<float>(current_time_coord)).getValue();
+        click_time_series = time_frame->getIndexAtTime(static_cast<double>(_new_interval_click_time)).getValue();
+        current_time_series = time_frame->getIndexAtTime(static_cast<double>(current_time_coord)).getValue();
     }
 
     // Determine interval bounds (always ensure start < end)
@@ -1774,8 +1801,8 @@ void OpenGLWidget::updateNewIntervalCreation(QPoint const & current_pos) {
     } else {
         // Convert series indices back to master time coordinates
         try {
-            _new_interval_start_time = static_cast<int64_t>(time_frame->getTimeAtIndex(TimeFrameIndex(new_start_series)));
-            _new_interval_end_time = static_cast<int64_t>(time_frame->getTimeAtIndex(TimeFrameIndex(new_end_series)));
+            _new_interval_start_time = time_frame->getTimeAtIndex(TimeFrameIndex(new_start_series));
+            _new_interval_end_time = time_frame->getTimeAtIndex(TimeFrameIndex(new_end_series));
         } catch (...) {
             // Conversion failed - abort creation
             cancelNewIntervalCreation();
@@ -1813,8 +1840,8 @@ void OpenGLWidget::finishNewIntervalCreation() {
             new_end_series = _new_interval_end_time;
         } else {
             // Convert master time coordinates to series time frame indices
-            new_start_series = time_frame->getIndexAtTime(static_cast<float>(_new_interval_start_time)).getValue();
-            new_end_series = time_frame->getIndexAtTime(static_cast<float>(_new_interval_end_time)).getValue();
+            new_start_series = time_frame->getIndexAtTime(static_cast<double>(_new_interval_start_time)).getValue();
+            new_end_series = time_frame->getIndexAtTime(static_cast<double>(_new_interval_end_time)).getValue();
         }
 
         // Validate converted coordinates
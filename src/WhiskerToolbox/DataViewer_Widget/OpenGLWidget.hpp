@@ -3,6 +3,7 @@
 
 #include "ShaderManager/ShaderManager.hpp"
 #include "AnalogTimeSeries/Analog_Time_Series.hpp"
+#include "DataViewer/SeriesVertexCache.hpp"
 #include "DataViewer/XAxis.hpp"
 #include "TimeFrame/TimeFrame.hpp"
 
@@ -22,8 +23,10 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 
@@ -43,16 +46,31 @@ struct AnalogSeriesData {
     std::unique_ptr<NewAnalogTimeSeriesDisplayOptions> display_options;
 };
 
+/**
+ * @brief Vertices of one series and the GPU buffer they are uploaded to
+ *
+ * The buffer is only re-uploaded when the cached vertices were rebuilt.
+ */
+struct SeriesVertexBuffer {
+    SeriesVertexCache cache;
+    QOpenGLBuffer buffer{QOpenGLBuffer::VertexBuffer};
+    uint64_t uploaded_generation{0};
+};
+
 struct DigitalEventSeriesData {
     std::shared_ptr<DigitalEventSeries> series;
     std::shared_ptr<TimeFrame> time_frame;
     std::unique_ptr<NewDigitalEventSeriesDisplayOptions> display_options;
+    SeriesVertexBuffer geometry;
+    int observer_id{-1};
 };
 
 struct DigitalIntervalSeriesData {
     std::shared_ptr<DigitalIntervalSeries> series;
     std::shared_ptr<TimeFrame> time_frame;
     std::unique_ptr<NewDigitalIntervalSeriesDisplayOptions> display_options;
+    SeriesVertexBuffer geometry;
+    int observer_id{-1};
 };
 
 struct LineParameters {
@@ -292,10 +310,19 @@ public:
      * Individual data series may have different time frames that need to be
      * converted to/from the master time frame for proper synchronization.
      * 
+     * Event and interval vertices are built in master-clock coordinates, so
+     * their caches are invalidated and rebuilt against the new clock.
+     *
      * @param master_time_frame Shared pointer to the master time frame
      */
     void setMasterTimeFrame(std::shared_ptr<TimeFrame> master_time_frame) {
-        _master_time_frame = master_time_frame;
+        _master_time_frame = std::move(master_time_frame);
+        for (auto & [key, data]: _digital_event_series) {
+            data.geometry.cache.invalidate();
+        }
+        for (auto & [key, data]: _digital_interval_series) {
+            data.geometry.cache.invalidate();
+        }
     }
 
     /**
@@ -365,7 +392,7 @@ public:
     }
 
 public slots:
-    void updateCanvas(int time);
+    void updateCanvas(int64_t time);
 
 signals:
     void mouseHover(float time_coordinate, float canvas_y, QString const & series_info);
@@ -402,22 +429,29 @@ private:
     void _updateYViewBoundaries();
 
     // Gap detection helper methods for analog series
-    void _drawAnalogSeriesWithGapDetection(std::vector<float> const & data,
+    void _drawAnalogSeriesWithGapDetection(std::span<float const> data,
                                            std::shared_ptr<TimeFrame> const & time_frame,
                                            AnalogTimeSeries::TimeValueSpanPair analog_range,
                                            float gap_threshold);
 
-    void _drawAnalogSeriesAsMarkers(std::vector<float> const & data,
+    void _drawAnalogSeriesAsMarkers(std::span<float const> data,
                                     std::shared_ptr<TimeFrame> const & time_frame,
                                     AnalogTimeSeries::TimeValueSpanPair analog_range);
 
+    /**
+     * @brief Upload the series vertices if they changed and draw them with one call
+     */
+    void _drawSeriesVertexBuffer(SeriesVertexBuffer & geometry, GLenum mode);
+
+    void _releaseSeriesVertexBuffer(SeriesVertexBuffer & geometry);
+
     std::unordered_map<std::string, AnalogSeriesData> _analog_series;
     std::unordered_map<std::string, DigitalEventSeriesData> _digital_event_series;
     std::unordered_map<std::string, DigitalIntervalSeriesData> _digital_interval_series;
     std::unordered_map<std::string, int> _series_y_position;
 
     XAxis _xAxis;
-    int _time{0};
+    int64_t _time{0};
 
     QOpenGLShaderProgram * m_program{nullptr};
     QOpenGLBuffer m_vbo;
@@ -11,6 +11,8 @@
 #include "Media_Widget/Media_Window/Media_Window.hpp"
 #include "MediaWidgetManager/MediaWidgetManager.hpp"
 #include "TimeScrollBar/TimeScrollBar.hpp"
+#include "utils/ordered_pipeline.hpp"
+#include "utils/parallel_for.hpp"
 
 #include "opencv2/opencv.hpp"
 #include <QFileDialog>
@@ -20,6 +22,7 @@
 #include <QTableWidget>
 #include <QTableWidgetItem>
 
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
 #include <regex>
@@ -128,6 +131,19 @@ void Export_Video_Widget::_exportVideo() {
         return;
     }
 
+    // The UI thread only renders; scaling, colour conversion and encoding run on
+    // worker threads. The bounded queue stalls rendering if encoding falls behind.
+    size_t const workers = std::max<size_t>(parallel_worker_count(), 2) - 1;
+    _export_pipeline = std::make_unique<OrderedPipeline<QImage, cv::Mat>>(
+            workers,
+            2 * workers + 2,
+            [output_width, output_height](QImage & frame) {
+                return _toVideoFrame(frame, output_width, output_height);
+            },
+            [this](cv::Mat & frame) {
+                _video_writer->write(frame);
+            });
+
     connect(scene, &Media_Window::canvasUpdated, this, &Export_Video_Widget::_handleCanvasUpdated);
 
     if (!_video_sequences.empty()) {
@@ -144,9 +160,9 @@ void Export_Video_Widget::_exportVideo() {
             if (sequence.has_title) {
                 std::cout << "Generating " << sequence.title_frames << " title frames for sequence " << (seq_idx + 1) << std::endl;
 
+                QImage const title_frame = _generateTitleFrame(output_width, output_height,
+                                                               sequence.title_text, sequence.title_font_size);
                 for (int i = 0; i < sequence.title_frames; i++) {
-                    QImage title_frame = _generateTitleFrame(output_width, output_height,
-                                                             sequence.title_text, sequence.title_font_size);
                     _writeFrameToVideo(title_frame);
                 }
             }
@@ -170,6 +186,7 @@ void Export_Video_Widget::_exportVideo() {
             if (auto* scene = _getCurrentMediaWindow()) {
                 disconnect(scene, &Media_Window::canvasUpdated, this, &Export_Video_Widget::_handleCanvasUpdated);
             }
+            _finishExportPipeline();
             _video_writer->release();
             return;
         }
@@ -184,8 +201,8 @@ void Export_Video_Widget::_exportVideo() {
 
             std::cout << "Generating " << title_frame_count << " title frames" << std::endl;
 
+            QImage const title_frame = _generateTitleFrame(output_width, output_height, title_text, font_size);
             for (int i = 0; i < title_frame_count; i++) {
-                QImage title_frame = _generateTitleFrame(output_width, output_height, title_text, font_size);
                 _writeFrameToVideo(title_frame);
             }
         }
@@ -199,6 +216,7 @@ void Export_Video_Widget::_exportVideo() {
     if (auto* scene = _getCurrentMediaWindow()) {
         disconnect(scene, &Media_Window::canvasUpdated, this, &Export_Video_Widget::_handleCanvasUpdated);
     }
+    _finishExportPipeline();
     _video_writer->release();
 
     // Generate audio track if enabled
@@ -247,14 +265,8 @@ void Export_Video_Widget::_handleCanvasUpdated(QImage const & canvasImage) {
     auto current_time = _data_manager->getCurrentTime();
     std::cout << "Saving frame " << current_time << std::endl;
 
-    // Resize canvas image to output dimensions
-    int output_width = ui->output_width_spinbox->value();
-    int output_height = ui->output_height_spinbox->value();
-
-    QImage resized_image = canvasImage.scaled(output_width, output_height, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
-
-    // Use the same conversion process as title frames
-    _writeFrameToVideo(resized_image);
+    // Resizing to the output dimensions happens on the export workers
+    _writeFrameToVideo(canvasImage);
 }
 
 void Export_Video_Widget::_updateTitlePreview() {
@@ -278,19 +290,41 @@ void Export_Video_Widget::_updateTitlePreview() {
 }
 
 void Export_Video_Widget::_writeFrameToVideo(QImage const & frame) {
+    if (!_export_pipeline) {
+        return;
+    }
+    // QImage is implicitly shared, so queuing it does not copy the pixels
+    _export_pipeline->push(frame);
+}
+
+void Export_Video_Widget::_finishExportPipeline() {
+    if (!_export_pipeline) {
+        return;
+    }
+    try {
+        _export_pipeline->finish();
+    } catch (std::exception const & e) {
+        std::cout << "Video export failed: " << e.what() << std::endl;
+    }
+    _export_pipeline.reset();
+}
+
+cv::Mat Export_Video_Widget::_toVideoFrame(QImage const & frame, int width, int height) {
+    QImage const resized = (frame.width() == width && frame.height() == height)
+                                   ? frame
+                                   : frame.scaled(width, height, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+
     // Ensure consistent format conversion for all frames
-    QImage convertedImage = frame.convertToFormat(QImage::Format_RGB888);
+    QImage const convertedImage = resized.convertToFormat(QImage::Format_RGB888);
 
     // Create cv::Mat with explicit stride to ensure consistency
     cv::Mat const mat(convertedImage.height(), convertedImage.width(), CV_8UC3,
-                      const_cast<uchar *>(convertedImage.bits()), convertedImage.bytesPerLine());
+                      const_cast<uchar *>(convertedImage.constBits()), static_cast<size_t>(convertedImage.bytesPerLine()));
 
-    // Convert RGB to BGR for OpenCV
+    // Convert RGB to BGR for OpenCV; the result owns its pixels
     cv::Mat matBGR;
     cv::cvtColor(mat, matBGR, cv::COLOR_RGB2BGR);
-
-    // Write the frame to the video
-    _video_writer->write(matBGR);
+    return matBGR;
 }
 
 void Export_Video_Widget::_addSequence() {
@@ -16,7 +16,11 @@ class DigitalEventSeries;
 class TimeFrame;
 class QTableWidgetItem;
 
+template<typename Input, typename Output>
+class OrderedPipeline;
+
 namespace cv {
+class Mat;
 class VideoWriter;
 }
 
@@ -75,6 +79,9 @@ private:
     TimeScrollBar * _time_scrollbar;
     std::unique_ptr<cv::VideoWriter> _video_writer;
 
+    // Scales, converts and encodes rendered frames off the UI thread during an export
+    std::unique_ptr<OrderedPipeline<QImage, cv::Mat>> _export_pipeline;
+
     // Currently selected media widget for export
     std::string _selected_media_widget_id;
 
@@ -100,6 +107,8 @@ private slots:
 private:
     QImage _generateTitleFrame(int width, int height, QString const & text, int font_size);
     void _writeFrameToVideo(QImage const & frame);
+    void _finishExportPipeline();
+    static cv::Mat _toVideoFrame(QImage const & frame, int width, int height);
     std::pair<int, int> _getMediaDimensions() const;
     Media_Window* _getCurrentMediaWindow() const;
     void _updateMediaWidgetComboBox();
@@ -25,6 +25,29 @@ public:
     virtual bool predict(arma::Mat<double> const & features,
                          arma::Row<size_t> & predictions) = 0;
 
+    /**
+     * @brief Trains the model on a single-precision feature matrix
+     *
+     * Feature matrices assembled as float take half the memory of double ones.
+     * The default widens to double and calls train(); models that can learn
+     * from float directly override this.
+     */
+    virtual bool trainFloat(arma::Mat<float> const & features,
+                            arma::Row<size_t> const & labels,
+                            MLModelParametersBase const * params) {
+        return train(arma::conv_to<arma::Mat<double>>::from(features), labels, params);
+    }
+
+    /**
+     * @brief Predicts labels for a single-precision feature matrix
+     *
+     * The default widens to double and calls predict().
+     */
+    virtual bool predictFloat(arma::Mat<float> const & features,
+                              arma::Row<size_t> & predictions) {
+        return predict(arma::conv_to<arma::Mat<double>>::from(features), predictions);
+    }
+
     virtual bool predictProbabilities(arma::Mat<double> const & features,
                                       arma::Row<size_t> & predictions,
                                       arma::Mat<double> & probabilities) {
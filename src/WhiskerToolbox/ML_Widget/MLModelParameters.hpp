@@ -22,6 +22,7 @@ struct RandomForestParameters : public MLModelParametersBase {
     int minimumLeafSize = 1;
     double minimumGainSplit = 1e-7;// Default in mlpack for DecisionTree which RF uses.
     int maximumDepth = 0;          // 0 means no limit in mlpack RF.
+    int seed = 0;                  // Tree i is grown from seed + i, so fits are reproducible.
     bool warmStart = false;        // mlpack RF doesn't have a direct warm_start for Train().
                                    // This usually means reusing previous fit and adding more estimators.
     // double subsampleRatio = 1.0; // For bootstrapping, mlpack's RF does this by default.
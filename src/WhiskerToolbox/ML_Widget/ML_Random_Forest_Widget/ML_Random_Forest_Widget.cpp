@@ -24,6 +24,7 @@ std::unique_ptr<MLModelParametersBase> ML_Random_Forest_Widget::getParameters()
     params->minimumLeafSize = ui->spinBox_2->value(); // Corresponds to minLeafSize in UI
     params->minimumGainSplit = ui->doubleSpinBox->value(); // Corresponds to minGainSplit in UI
     params->maximumDepth = ui->spinBox_3->value();    // Corresponds to maxDepth in UI
+    params->seed = ui->seedSpinBox->value();
     // params->warmStart = ui->checkBox->isChecked(); // mlpack RF doesn't have direct warm_start
     return params;
 }
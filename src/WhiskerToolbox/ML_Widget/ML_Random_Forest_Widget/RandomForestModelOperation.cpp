@@ -1,11 +1,20 @@
 #include "RandomForestModelOperation.hpp"
 #include "ML_Widget/MLModelParameters.hpp" // For RandomForestParameters
 #include "mlpack.hpp" // General mlpack include for RandomForest
+
+#include "DataManager/utils/parallel_for.hpp"
+
+#include <algorithm>
 #include <iostream> // For error messages
 
-RandomForestModelOperation::RandomForestModelOperation()
-    : _model(std::make_unique<mlpack::RandomForest<mlpack::GiniGain, mlpack::MultipleRandomDimensionSelect>>())
-{}
+namespace {
+
+// Columns handed to a prediction worker at a time
+constexpr size_t min_columns_per_task = 256;
+
+}// namespace
+
+RandomForestModelOperation::RandomForestModelOperation() = default;
 
 std::string RandomForestModelOperation::getName() const {
     return "Random Forest";
@@ -18,11 +27,29 @@ std::unique_ptr<MLModelParametersBase> RandomForestModelOperation::getDefaultPar
 bool RandomForestModelOperation::train(arma::Mat<double> const& features,
                                      arma::Row<size_t> const& labels,
                                      MLModelParametersBase const* params_base) {
-    if (!_model) {
-        std::cerr << "RandomForestModelOperation error: Model not initialized." << std::endl;
-        return false;
-    }
+    return _train(features, labels, params_base);
+}
+
+bool RandomForestModelOperation::trainFloat(arma::Mat<float> const& features,
+                                            arma::Row<size_t> const& labels,
+                                            MLModelParametersBase const* params_base) {
+    return _train(features, labels, params_base);
+}
+
+bool RandomForestModelOperation::predict(arma::Mat<double> const& features,
+                                       arma::Row<size_t>& predictions) {
+    return _predict(features, predictions, nullptr);
+}
+
+bool RandomForestModelOperation::predictFloat(arma::Mat<float> const& features,
+                                              arma::Row<size_t>& predictions) {
+    return _predict(features, predictions, nullptr);
+}
 
+template<typename MatType>
+bool RandomForestModelOperation::_train(MatType const& features,
+                                        arma::Row<size_t> const& labels,
+                                        MLModelParametersBase const* params_base) {
     const RandomForestParameters* rfParams = dynamic_cast<const RandomForestParameters*>(params_base);
 
     if (labels.empty()) {
@@ -36,51 +63,77 @@ bool RandomForestModelOperation::train(arma::Mat<double> const& features,
     }
 
     // Default values from RandomForestParameters struct
-    int numTrees = 10;
-    int minimumLeafSize = 1;
-    int maximumDepth = 0; // 0 means no limit in mlpack
-    // double minimumGainSplit = 1e-7; // Not directly settable on RandomForest::Train or constructor easily.
-                                      // It's a property of the underlying DecisionTree.
-
+    RandomForestParameters params;
     if (rfParams) {
-        numTrees = rfParams->numTrees;
-        minimumLeafSize = rfParams->minimumLeafSize;
-        maximumDepth = rfParams->maximumDepth;
-        // minimumGainSplit would be used if customizing the DecisionTreeType for RF.
+        params = *rfParams;
     } else {
         std::cerr << "RandomForestModelOperation::train: Warning - RandomForestParameters not provided, using defaults." << std::endl;
     }
+    auto const numTrees = static_cast<size_t>(std::max(params.numTrees, 1));
+    auto const minimumLeafSize = static_cast<size_t>(std::max(params.minimumLeafSize, 1));
+    auto const maximumDepth = static_cast<size_t>(std::max(params.maximumDepth, 0)); // 0 means no limit in mlpack
+    auto const seed = static_cast<size_t>(std::max(params.seed, 0));
 
+    std::vector<Forest> trees(numTrees);
     try {
-        // mlpack::RandomForest model(features, labels, _numClasses, numTrees, minimumLeafSize, maximumDepth);
-        // The constructor trains the model. We need to assign it to _model.
-        // Re-construct the model with parameters as mlpack RF trains on construction or via separate Train method
-        // For parameters like minGainSplit, one might need to customize the DecisionTreeType template parameter of RandomForest
-        // or mlpack would need to expose more setters.
-        // Using the direct train method for simplicity if available or re-create.
-        _model = std::make_unique<mlpack::RandomForest<mlpack::GiniGain, mlpack::MultipleRandomDimensionSelect>>(features, labels, _numClasses, numTrees, minimumLeafSize, maximumDepth);
-        // The line above already trains the model. If there was a separate Train method with these params, it would be:
-        // _model->Train(features, labels, _numClasses, numTrees, minimumLeafSize, maximumDepth);
-        // However, RandomForest constructor itself performs the training with these hyperparams.
+        // Trees are independent, so they are grown concurrently. Tree i reseeds
+        // the generators of the thread growing it with seed + i first; mlpack and
+        // Armadillo keep those generators per thread, so each tree sees the same
+        // random stream however the trees are spread across threads.
+        parallel_for_chunks(numTrees, 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                mlpack::RandomSeed(seed + i);
+                trees[i] = Forest(features, labels, _numClasses, 1, minimumLeafSize, params.minimumGainSplit, maximumDepth);
+            }
+        });
     } catch (const std::exception& e) {
         std::cerr << "RandomForestModelOperation::train failed: " << e.what() << std::endl;
         return false;
     }
+    _trees = std::move(trees);
     return true;
 }
 
-bool RandomForestModelOperation::predict(arma::Mat<double> const& features,
-                                       arma::Row<size_t>& predictions) {
-    if (!_model) {
+template<typename MatType>
+bool RandomForestModelOperation::_predict(MatType const& features,
+                                          arma::Row<size_t>& predictions,
+                                          arma::Mat<double>* probabilities) {
+    if (_trees.empty()) {
         std::cerr << "RandomForestModelOperation error: Model not trained or initialized." << std::endl;
         return false;
     }
     if (features.empty()) {
         std::cerr << "RandomForestModelOperation::predict: Input features are empty." << std::endl;
+        if (probabilities) {
+            probabilities->clear();
+        }
         return false;
     }
+
+    predictions.set_size(features.n_cols);
+    if (probabilities) {
+        probabilities->set_size(_numClasses, features.n_cols);
+    }
     try {
-        _model->Classify(features, predictions);
+        // Columns are classified independently, so they are split across threads;
+        // the class is the one with the highest probability averaged over trees
+        parallel_for_chunks(features.n_cols, min_columns_per_task, [&](size_t begin, size_t end) {
+            arma::vec tree_probabilities;
+            arma::vec mean_probabilities(_numClasses);
+            size_t tree_prediction = 0;
+            for (size_t c = begin; c < end; ++c) {
+                mean_probabilities.zeros();
+                for (auto const& tree : _trees) {
+                    tree.Classify(features.col(c), tree_prediction, tree_probabilities);
+                    mean_probabilities += tree_probabilities;
+                }
+                mean_probabilities /= static_cast<double>(_trees.size());
+                predictions(c) = mean_probabilities.index_max();
+                if (probabilities) {
+                    probabilities->col(c) = mean_probabilities;
+                }
+            }
+        });
     } catch (const std::exception& e) {
         std::cerr << "RandomForestModelOperation::predict failed: " << e.what() << std::endl;
         return false;
@@ -91,20 +144,5 @@ bool RandomForestModelOperation::predict(arma::Mat<double> const& features,
 bool RandomForestModelOperation::predictProbabilities(arma::Mat<double> const& features,
                                                       arma::Row<size_t>& predictions,
                                                       arma::Mat<double>& probabilities) {
-    if (!_model || _numClasses == 0) {
-        std::cerr << "RandomForestModelOperation error: Model not trained or numClasses not set for probability prediction." << std::endl;
-        return false;
-    }
-    if (features.empty()) {
-        std::cerr << "RandomForestModelOperation::predictProbabilities: Input features are empty." << std::endl;
-        probabilities.clear();
-        return false;
-    }
-    try {
-        _model->Classify(features, predictions, probabilities); // RF Classify can also output probabilities
-    } catch (const std::exception& e) {
-        std::cerr << "RandomForestModelOperation::predictProbabilities failed: " << e.what() << std::endl;
-        return false;
-    }
-    return true;
+    return _predict(features, predictions, &probabilities);
 }
@@ -6,6 +6,7 @@
 #include "mlpack.hpp"
 
 #include <memory>
+#include <vector>
 
 class RandomForestModelOperation : public MLModelOperation {
 public:
@@ -14,11 +15,24 @@ public:
     [[nodiscard]] std::unique_ptr<MLModelParametersBase> getDefaultParameters() const override;
     bool train(arma::Mat<double> const& features, arma::Row<size_t> const& labels, MLModelParametersBase const* params) override;
     bool predict(arma::Mat<double> const& features, arma::Row<size_t>& predictions) override;
+    bool trainFloat(arma::Mat<float> const& features, arma::Row<size_t> const& labels, MLModelParametersBase const* params) override;
+    bool predictFloat(arma::Mat<float> const& features, arma::Row<size_t>& predictions) override;
     bool predictProbabilities(arma::Mat<double> const& features,
                               arma::Row<size_t>& predictions,
                               arma::Mat<double>& probabilities) override;
 private:
-    std::unique_ptr<mlpack::RandomForest<mlpack::GiniGain, mlpack::MultipleRandomDimensionSelect>> _model;
+    using Forest = mlpack::RandomForest<mlpack::GiniGain, mlpack::MultipleRandomDimensionSelect>;
+
+    // mlpack trees split on the matrix element type, so float and double share one path
+    template<typename MatType>
+    bool _train(MatType const& features, arma::Row<size_t> const& labels, MLModelParametersBase const* params_base);
+    template<typename MatType>
+    bool _predict(MatType const& features, arma::Row<size_t>& predictions, arma::Mat<double>* probabilities);
+
+    // One single-tree forest per tree. Each is grown on its own thread from its
+    // own seed, so the ensemble does not depend on how many threads trained it.
+    // Averaging their class probabilities is what RandomForest::Classify does.
+    std::vector<Forest> _trees;
     size_t _numClasses = 0; // Required for RandomForest training
 };
 
@@ -8,6 +8,7 @@
 //https://stackoverflow.com/questions/72533139/libtorch-errors-when-used-with-qt-opencv-and-point-cloud-library
 #undef slots
 #include "DataManager/Tensors/Tensor_Data.hpp"
+#include "feature_assembly.hpp"
 #include "mlpack_conversion.hpp"
 #define slots Q_SLOTS
 
@@ -15,13 +16,13 @@
 #include "DataManager/DigitalTimeSeries/Digital_Interval_Series.hpp"
 #include "DataManager/Points/Point_Data.hpp"
 
-#include "DataManager/utils/armadillo_wrap/analog_armadillo.hpp"
 #include "MLModelOperation.hpp"
 #include "MLModelRegistry.hpp"
 #include "MLParameterWidgetBase.hpp"
 #include "ML_Naive_Bayes_Widget/ML_Naive_Bayes_Widget.hpp"
 #include "ML_Random_Forest_Widget/ML_Random_Forest_Widget.hpp"
 #include "TimeFrame/TimeFrame.hpp"
+#include "Tracing/Tracing.hpp"
 #include "Transformations/IdentityTransform.hpp"
 #include "Transformations/LagLeadTransform.hpp"
 #include "Transformations/SquaredTransform.hpp"
@@ -31,12 +32,64 @@
 #include <QGraphicsPixmapItem>
 #include <QGraphicsScene>
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <map>
 #include <numeric>
 #include <optional>
+#include <span>
+
+namespace {
+
+// A prediction chunk of the design matrix is kept to about this many bytes, so
+// it and its base samples stay cache resident while the model runs over it
+constexpr std::size_t prediction_chunk_bytes = std::size_t{4} << 20;
+constexpr std::size_t min_prediction_chunk_columns = 1024;
+
+/**
+ * @brief Frames at positions [first, last) of the frames not in @p excluded
+ *
+ * Prediction runs on every frame outside the training set. This gives one
+ * window of that sequence without building it for the whole session.
+ *
+ * @param excluded Sorted, unique frames to skip
+ */
+std::vector<std::size_t> frames_outside(std::vector<std::size_t> const & excluded,
+                                        std::size_t first,
+                                        std::size_t last) {
+    // The frame at position p is the smallest f with more than p non-excluded frames in [0, f]
+    std::size_t lo = first;
+    std::size_t hi = first + excluded.size();
+    while (lo < hi) {
+        std::size_t const mid = lo + (hi - lo) / 2;
+        auto const excluded_up_to_mid = static_cast<std::size_t>(
+                std::upper_bound(excluded.begin(), excluded.end(), mid) - excluded.begin());
+        if (mid + 1 - excluded_up_to_mid > first) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+
+    std::vector<std::size_t> frames;
+    frames.reserve(last - first);
+    auto next_excluded = std::lower_bound(excluded.begin(), excluded.end(), lo);
+    for (std::size_t frame = lo; frames.size() < last - first; ++frame) {
+        if (next_excluded != excluded.end() && *next_excluded == frame) {
+            ++next_excluded;
+            continue;
+        }
+        frames.push_back(frame);
+    }
+    return frames;
+}
+
+}// namespace
 
 
 ML_Widget::ML_Widget(std::shared_ptr<DataManager> data_manager,
@@ -192,69 +245,18 @@ void ML_Widget::_onSelectedTableChanged(QString const & table_id) {
     }
 }
 
-arma::Mat<double> ML_Widget::_buildFeatureMatrixFromTable(std::shared_ptr<TableView> const & table,
-                                                          std::vector<std::string> const & feature_columns,
-                                                          std::vector<size_t> & kept_row_indices) const {
-    if (!table) return arma::Mat<double>();
-    // Gather numeric columns as vectors<double>
-    auto & tv = *table;
-    std::vector<std::vector<double>> cols;
-    cols.reserve(feature_columns.size());
-    auto & nonConst = const_cast<TableView &>(tv);
-    size_t const nrows = tv.getRowCount();
-    for (auto const & name: feature_columns) {
-        auto ti = tv.getColumnTypeIndex(name);
-        if (ti == typeid(double)) {
-            cols.push_back(nonConst.getColumnValues<double>(name));
-        } else if (ti == typeid(float)) {
-            auto const & v = nonConst.getColumnValues<float>(name);
-            std::vector<double> d;
-            d.reserve(v.size());
-            for (float x: v) d.push_back(static_cast<double>(x));
-            cols.emplace_back(std::move(d));
-        } else if (ti == typeid(int)) {
-            auto const & v = nonConst.getColumnValues<int>(name);
-            std::vector<double> d;
-            d.reserve(v.size());
-            for (int x: v) d.push_back(static_cast<double>(x));
-            cols.emplace_back(std::move(d));
-        } else if (ti == typeid(int64_t)) {
-            auto const & v = nonConst.getColumnValues<int64_t>(name);
-            std::vector<double> d;
-            d.reserve(v.size());
-            for (int64_t x: v) d.push_back(static_cast<double>(x));
-            cols.emplace_back(std::move(d));
-        }
-    }
-    // Drop rows with NaN/Inf if requested
+arma::Mat<float> ML_Widget::_buildFeatureMatrixFromTable(std::shared_ptr<TableView> const & table,
+                                                         std::vector<std::string> const & feature_columns,
+                                                         std::vector<std::string> const & mask_columns,
+                                                         std::vector<size_t> & kept_row_indices) const {
     kept_row_indices.clear();
-    kept_row_indices.reserve(nrows);
+    if (!table) return arma::Mat<float>();
+    // Rows are selected first (masks, and NaN/Inf if requested) so the columns are written only once,
+    // straight into the features x samples matrix
+    auto & nonConst = const_cast<TableView &>(*table);
     bool drop = ui->drop_nan_checkbox && ui->drop_nan_checkbox->isChecked();
-    for (size_t r = 0; r < nrows; ++r) {
-        bool ok = true;
-        if (drop) {
-            for (auto const & c: cols) {
-                if (r >= c.size()) {
-                    ok = false;
-                    break;
-                }
-                double v = c[r];
-                if (!std::isfinite(v)) {
-                    ok = false;
-                    break;
-                }
-            }
-        }
-        if (ok) kept_row_indices.push_back(r);
-    }
-    arma::Mat<double> X(kept_row_indices.size(), cols.size());
-    for (size_t j = 0; j < cols.size(); ++j) {
-        for (size_t i = 0; i < kept_row_indices.size(); ++i) {
-            X(i, j) = cols[j][kept_row_indices[i]];
-        }
-    }
-    // Convert to features x samples (rows=features, cols=samples)
-    return X.t();
+    kept_row_indices = select_table_rows(nonConst, feature_columns, mask_columns, drop);
+    return assemble_table_features<float>(nonConst, feature_columns, kept_row_indices);
 }
 
 std::optional<arma::Row<size_t>> ML_Widget::_buildLabelsFromTable(std::shared_ptr<TableView> const & table,
@@ -285,39 +287,6 @@ std::optional<arma::Row<size_t>> ML_Widget::_buildLabelsFromTable(std::shared_pt
     return std::nullopt;
 }
 
-std::vector<size_t> ML_Widget::_applyMasksFromTable(std::shared_ptr<TableView> const & table,
-                                                    std::vector<std::string> const & mask_columns,
-                                                    std::vector<size_t> const & candidate_rows) const {
-    if (!table || mask_columns.empty()) return candidate_rows;
-    auto & tv = *table;
-    auto & nonConst = const_cast<TableView &>(tv);
-    std::vector<size_t> kept;
-    kept.reserve(candidate_rows.size());
-    for (size_t r: candidate_rows) {
-        bool keep = true;
-        for (auto const & name: mask_columns) {
-            auto ti = tv.getColumnTypeIndex(name);
-            if (ti == typeid(bool)) {
-                auto const & v = nonConst.getColumnValues<bool>(name);
-                if (r >= v.size() || !v[r]) {
-                    keep = false;
-                    break;
-                }
-            } else if (ti == typeid(int)) {
-                auto const & v = nonConst.getColumnValues<int>(name);
-                if (r >= v.size() || v[r] == 0) {
-                    keep = false;
-                    break;
-                }
-            } else {
-                // unsupported mask type -> ignore
-            }
-        }
-        if (keep) kept.push_back(r);
-    }
-    return kept;
-}
-
 void ML_Widget::closeEvent(QCloseEvent * event) {
     std::cout << "Close event detected" << std::endl;
     QWidget::closeEvent(event);
@@ -428,7 +397,7 @@ void ML_Widget::_fitModel() {
     if (reg && !_selected_table_id.isEmpty()) {
         table = reg->getBuiltTable(_selected_table_id.toStdString());
     }
-    arma::Mat<double> feature_array;
+    arma::Mat<float> feature_array;
     arma::Row<size_t> labels;
     std::vector<size_t> kept_rows;
     // Declare legacy inputs outside branches so they can be reused for prediction
@@ -456,16 +425,8 @@ void ML_Widget::_fitModel() {
             std::cerr << "Select at least one feature column and a label column from the table." << std::endl;
             return;
         }
-        // Build features
-        feature_array = _buildFeatureMatrixFromTable(table, _selected_feature_columns, kept_rows);
-        // Apply masks (post-drop) -> further filter kept_rows
-        kept_rows = _applyMasksFromTable(table, _selected_mask_columns, kept_rows);
-        // If masks removed rows, subselect the feature matrix columns accordingly
-        if (!kept_rows.empty() && kept_rows.size() != static_cast<size_t>(feature_array.n_cols)) {
-            arma::Mat<double> filtered(feature_array.n_rows, kept_rows.size());
-            for (size_t i = 0; i < kept_rows.size(); ++i) filtered.col(i) = feature_array.col(kept_rows[i]);
-            feature_array = std::move(filtered);
-        }
+        // Build features for the rows that pass the masks
+        feature_array = _buildFeatureMatrixFromTable(table, _selected_feature_columns, _selected_mask_columns, kept_rows);
         // Build labels aligned to kept_rows
         auto labels_opt = _buildLabelsFromTable(table, _selected_label_column, kept_rows);
         if (!labels_opt) {
@@ -493,7 +454,7 @@ void ML_Widget::_fitModel() {
     }
 
     // Train the model
-    arma::Mat<double> balanced_feature_array;
+    arma::Mat<float> balanced_feature_array;
     arma::Row<size_t> balanced_labels;
 
     if (!_trainModel(feature_array, labels, balanced_feature_array, balanced_labels)) {
@@ -512,7 +473,7 @@ void ML_Widget::_fitModel() {
 std::optional<arma::Row<size_t>> ML_Widget::_prepareTrainingData(
         std::vector<FeatureProcessingWidget::ProcessedFeatureInfo> const & active_proc_features,
         std::vector<std::size_t> & training_timestamps,
-        arma::Mat<double> & feature_array,
+        arma::Mat<float> & feature_array,
         arma::Mat<double> & outcome_array) const {
 
     // Get training interval data and create timestamps
@@ -584,9 +545,9 @@ std::optional<arma::Row<size_t>> ML_Widget::_prepareTrainingData(
     return labels;
 }
 
-bool ML_Widget::_trainModel(arma::Mat<double> const & feature_array,
+bool ML_Widget::_trainModel(arma::Mat<float> const & feature_array,
                             arma::Row<size_t> const & labels,
-                            arma::Mat<double> & balanced_feature_array,
+                            arma::Mat<float> & balanced_feature_array,
                             arma::Row<size_t> & balanced_labels) {
 
     auto const balancing_flag = _class_balancing_widget->isBalancingEnabled();
@@ -631,7 +592,7 @@ bool ML_Widget::_trainModel(arma::Mat<double> const & feature_array,
     }
 
     // Train the model
-    bool trained = _current_selected_model_operation->train(balanced_feature_array, balanced_labels, model_params_ptr.get());
+    bool trained = _current_selected_model_operation->trainFloat(balanced_feature_array, balanced_labels, model_params_ptr.get());
     if (!trained) {
         std::cerr << "Model training failed for " << _current_selected_model_operation->getName() << std::endl;
         return false;
@@ -641,7 +602,7 @@ bool ML_Widget::_trainModel(arma::Mat<double> const & feature_array,
     // Calculate training accuracy and detailed metrics
     arma::Row<size_t> training_predictions;
     if (balanced_feature_array.n_cols > 0) {
-        bool training_predicted = _current_selected_model_operation->predict(balanced_feature_array, training_predictions);
+        bool training_predicted = _current_selected_model_operation->predictFloat(balanced_feature_array, training_predictions);
         if (training_predicted && balanced_labels.n_elem > 0) {
             // Calculate basic accuracy (for console output)
             double const accuracy = 100.0 * (static_cast<double>(arma::accu(training_predictions == balanced_labels))) /
@@ -667,100 +628,39 @@ bool ML_Widget::_predictNewData(std::vector<FeatureProcessingWidget::ProcessedFe
     auto * reg = _data_manager->getTableRegistry();
     std::shared_ptr<TableView> table;
     if (reg && !_selected_table_id.isEmpty()) table = reg->getBuiltTable(_selected_table_id.toStdString());
-    arma::Mat<double> prediction_feature_array;
-    std::vector<std::size_t> prediction_timestamps; // legacy path only
-    std::vector<size_t> kept_rows;
-    if (table) {
-        // reuse previously selected feature/mask columns
-        if (_selected_feature_columns.empty()) {
-            std::cout << "No selected table feature columns; skipping prediction." << std::endl;
+    if (!table) {
+        // legacy path: predict every frame outside the training set
+        if (!ui->predict_all_check->isChecked()) {
+            std::cout << "Prediction not set to predict all frames." << std::endl;
             return true;
         }
-        prediction_feature_array = _buildFeatureMatrixFromTable(table, _selected_feature_columns, kept_rows);
-        kept_rows = _applyMasksFromTable(table, _selected_mask_columns, kept_rows);
-        if (!kept_rows.empty() && kept_rows.size() != static_cast<size_t>(prediction_feature_array.n_cols)) {
-            arma::Mat<double> filtered(prediction_feature_array.n_rows, kept_rows.size());
-            for (size_t i = 0; i < kept_rows.size(); ++i) filtered.col(i) = prediction_feature_array.col(kept_rows[i]);
-            prediction_feature_array = std::move(filtered);
-        }
+        return _predictFramesInChunks(active_proc_features, training_timestamps);
+    }
+
+    // reuse previously selected feature/mask columns
+    if (_selected_feature_columns.empty()) {
+        std::cout << "No selected table feature columns; skipping prediction." << std::endl;
+        return true;
+    }
+    std::vector<size_t> kept_rows;
+    arma::Mat<float> prediction_feature_array = _buildFeatureMatrixFromTable(table, _selected_feature_columns, _selected_mask_columns, kept_rows);
     if (ui->zscore_checkbox && ui->zscore_checkbox->isChecked()) {
         // z-score across rows (features)
         for (arma::uword r = 0; r < prediction_feature_array.n_rows; ++r) {
-            arma::rowvec v = prediction_feature_array.row(r);
+            arma::frowvec v = prediction_feature_array.row(r);
             arma::uvec finite_idx = arma::find_finite(v);
             if (finite_idx.n_elem > 1) {
-                double mean = arma::mean(v(finite_idx));
-                double sd = arma::stddev(v(finite_idx));
-                if (sd > 1e-10) prediction_feature_array.row(r) = (v - mean) / sd;
-            }
-        }
-    }
-    prediction_feature_array.replace(arma::datum::nan, 0.0);
-    } else {
-        // legacy path
-        // Determine prediction timestamps
-        int current_time_end_frame;
-        if (ui->predict_all_check->isChecked()) {
-            current_time_end_frame = _data_manager->getTime()->getTotalFrameCount();
-        } else {
-            std::cout << "Prediction not set to predict all frames." << std::endl;
-            return true;
-        }
-        if (_data_manager->getTime()->getTotalFrameCount() == 0) current_time_end_frame = 0;
-
-        if (current_time_end_frame > 0) {
-            std::unordered_set<std::size_t> train_ts_set(training_timestamps.begin(), training_timestamps.end());
-            for (std::size_t i = 0; i < static_cast<std::size_t>(current_time_end_frame); ++i) {
-                if (train_ts_set.find(i) == train_ts_set.end()) {
-                    prediction_timestamps.push_back(i);
-                }
-            }
-        }
-
-        if (prediction_timestamps.empty()) {
-            std::cout << "No frames identified for prediction." << std::endl;
-            return true;// Not an error condition
-        }
-
-        std::cout << "Number of prediction timestamps: " << prediction_timestamps.size()
-                  << " (Range: " << prediction_timestamps.front() << " to " << prediction_timestamps.back() << ")" << std::endl;
-
-        // Create feature matrix for prediction
-        std::string pred_feature_matrix_error;
-        prediction_feature_array = _createFeatureMatrix(
-                active_proc_features, prediction_timestamps, pred_feature_matrix_error);
-
-        if (!pred_feature_matrix_error.empty()) {
-            std::cerr << "Error(s) creating prediction feature matrix:\n"
-                      << pred_feature_matrix_error << std::endl;
-        }
-
-        std::cout << "The prediction mask nan values: " << prediction_feature_array.has_nan() << std::endl;
-        prediction_feature_array.replace(arma::datum::nan, 0.0);// Prediction fails if there is a NaN value
-        std::cout << "After nan replacement: " << prediction_feature_array.has_nan() << std::endl;
-
-        // Apply z-score normalization if enabled (legacy toggle removed; using new checkbox if present)
-        if (ui->zscore_checkbox && ui->zscore_checkbox->isChecked()) {
-            for (arma::uword r = 0; r < prediction_feature_array.n_rows; ++r) {
-                arma::rowvec v = prediction_feature_array.row(r);
-                arma::uvec finite_idx = arma::find_finite(v);
-                if (finite_idx.n_elem > 1) {
-                    double mean = arma::mean(v(finite_idx));
-                    double sd = arma::stddev(v(finite_idx));
-                    if (sd > 1e-10) prediction_feature_array.row(r) = (v - mean) / sd;
-                }
+                float mean = arma::mean(v(finite_idx));
+                float sd = arma::stddev(v(finite_idx));
+                if (sd > 1e-10f) prediction_feature_array.row(r) = (v - mean) / sd;
             }
         }
-
-        if (prediction_feature_array.n_cols == 0) {
-            std::cout << "No features to predict (prediction_feature_array is empty)." << std::endl;
-            return true;
-        }
     }
+    prediction_feature_array.replace(std::numeric_limits<float>::quiet_NaN(), 0.0f);
 
     // Make predictions
     arma::Row<size_t> future_predictions;
-    bool future_predicted = _current_selected_model_operation->predict(prediction_feature_array, future_predictions);
+    bool future_predicted = _current_selected_model_operation->predictFloat(prediction_feature_array, future_predictions);
 
     if (!future_predicted) {
         std::cerr << "Prediction on new data failed." << std::endl;
@@ -776,35 +676,174 @@ bool ML_Widget::_predictNewData(std::vector<FeatureProcessingWidget::ProcessedFe
         std::cout << "Prediction vector on new data is empty." << std::endl;
     }
 
-    // Apply predictions to a selected series or outcome
-    // If table path used, we map predicted rows to timeframe indices via row descriptors
-    if (table) {
-        std::vector<std::size_t> tf_indices;
-        tf_indices.reserve(kept_rows.size());
-        for (size_t colIdx = 0; colIdx < kept_rows.size(); ++colIdx) {
-            auto desc = table->getRowDescriptor(kept_rows[colIdx]);
-            if (auto t = std::get_if<TimeFrameIndex>(&desc)) {
-                tf_indices.push_back(static_cast<std::size_t>(t->getValue()));
-            }
+    // Map predicted rows to timeframe indices via row descriptors
+    std::vector<std::size_t> tf_indices;
+    tf_indices.reserve(kept_rows.size());
+    for (size_t colIdx = 0; colIdx < kept_rows.size(); ++colIdx) {
+        auto desc = table->getRowDescriptor(kept_rows[colIdx]);
+        if (auto t = std::get_if<TimeFrameIndex>(&desc)) {
+            tf_indices.push_back(static_cast<std::size_t>(t->getValue()));
         }
-        auto target = ui->prediction_target_combo->currentText().toStdString();
-        auto outcome_series = _data_manager->getData<DigitalIntervalSeries>(target);
-        if (outcome_series && tf_indices.size() == prediction_vec.size()) {
-            outcome_series->setEventsAtTimes(tf_indices, prediction_vec);
-            std::cout << "Predictions applied to outcome series: " << target << std::endl;
+    }
+    auto target = ui->prediction_target_combo->currentText().toStdString();
+    auto outcome_series = _data_manager->getData<DigitalIntervalSeries>(target);
+    if (outcome_series && tf_indices.size() == prediction_vec.size()) {
+        if (std::adjacent_find(tf_indices.begin(), tf_indices.end(), std::greater_equal<>()) == tf_indices.end()) {
+            outcome_series->setEventsAtSortedTimes(std::span<std::size_t const>(tf_indices), std::span<size_t const>(prediction_vec));
         } else {
-            std::cerr << "Could not apply predictions (target not found or size mismatch)." << std::endl;
+            outcome_series->setEventsAtTimes(tf_indices, prediction_vec);
         }
+        std::cout << "Predictions applied to outcome series: " << target << std::endl;
     } else {
-        for (auto const & key: _selected_outcomes) {
-            auto outcome_series = _data_manager->getData<DigitalIntervalSeries>(key);
-            if (outcome_series) {
-                outcome_series->setEventsAtTimes(prediction_timestamps, prediction_vec);
-                std::cout << "Predictions applied to outcome series: " << key << std::endl;
+        std::cerr << "Could not apply predictions (target not found or size mismatch)." << std::endl;
+    }
+
+    return true;
+}
+
+bool ML_Widget::_predictFramesInChunks(std::vector<FeatureProcessingWidget::ProcessedFeatureInfo> const & active_proc_features,
+                                       std::vector<std::size_t> const & training_timestamps) {
+
+    auto const frame_count = static_cast<std::size_t>(std::max(_data_manager->getTime()->getTotalFrameCount(), 0));
+    auto const training_in_range = static_cast<std::size_t>(
+            std::lower_bound(training_timestamps.begin(), training_timestamps.end(), frame_count) - training_timestamps.begin());
+    std::size_t const n_samples = frame_count - training_in_range;
+
+    if (n_samples == 0) {
+        std::cout << "No frames identified for prediction." << std::endl;
+        return true;// Not an error condition
+    }
+
+    std::string plan_error;
+    auto const plan = _planFeatureMatrix(active_proc_features, plan_error);
+    if (!plan_error.empty()) {
+        std::cerr << "Error(s) creating prediction feature matrix:\n"
+                  << plan_error << std::endl;
+    }
+    auto const n_features = plan.layout.rowCount();
+    if (n_features == 0) {
+        std::cout << "No features to predict (prediction feature matrix is empty)." << std::endl;
+        return true;
+    }
+
+    std::vector<std::pair<std::string, std::shared_ptr<DigitalIntervalSeries>>> outcome_series;
+    for (auto const & key: _selected_outcomes) {
+        if (auto series = _data_manager->getData<DigitalIntervalSeries>(key)) {
+            outcome_series.emplace_back(key, std::move(series));
+        } else {
+            std::cerr << "Could not get outcome series '" << key << "' to apply predictions." << std::endl;
+        }
+    }
+
+    std::size_t const chunk_size = std::max(min_prediction_chunk_columns,
+                                            prediction_chunk_bytes / (static_cast<std::size_t>(n_features) * sizeof(float)));
+    TRACE_ZONE_NAMED(zone, "predict frames in chunks", "ml", "");
+    TRACE_ZONE_VALUE(zone, "frames", n_samples);
+    TRACE_ZONE_VALUE(zone, "chunk_size", chunk_size);
+
+    // Each chunk only reads the base samples it needs, plus the margin its
+    // lag/lead rows look across, so the whole session is never held in memory
+    arma::Mat<float> base;
+    arma::Mat<float> chunk;
+    std::vector<std::size_t> chunk_frames;
+    auto const assemble_chunk = [&](std::size_t first, std::size_t last) {
+        std::size_t const window_first = first - std::min<std::size_t>(first, plan.layout.lookBehind());
+        std::size_t const window_last = std::min(n_samples, last + plan.layout.lookAhead());
+        auto const window_frames = frames_outside(training_timestamps, window_first, window_last);
+
+        base.set_size(plan.base_row_count, window_frames.size());
+        _fillBaseMatrix(plan, window_frames, base);
+
+        chunk.set_size(n_features, last - first);
+        assemble_features(base, plan.layout, first - window_first, chunk);
+        chunk.replace(std::numeric_limits<float>::quiet_NaN(), 0.0f);// Prediction fails if there is a NaN value
+
+        chunk_frames.assign(window_frames.begin() + static_cast<std::ptrdiff_t>(first - window_first),
+                            window_frames.begin() + static_cast<std::ptrdiff_t>(last - window_first));
+    };
+
+    // The z-score uses statistics over every prediction frame, so they are
+    // gathered in a first pass and merged chunk by chunk
+    bool const zscore = ui->zscore_checkbox && ui->zscore_checkbox->isChecked();
+    arma::Col<double> means(n_features, arma::fill::zeros);
+    arma::Col<double> scales(n_features, arma::fill::ones);
+    if (zscore) {
+        arma::Col<double> counts(n_features, arma::fill::zeros);
+        arma::Col<double> m2(n_features, arma::fill::zeros);
+        for (std::size_t first = 0; first < n_samples; first += chunk_size) {
+            assemble_chunk(first, std::min(n_samples, first + chunk_size));
+
+            arma::Col<double> chunk_counts(n_features, arma::fill::zeros);
+            arma::Col<double> chunk_sums(n_features, arma::fill::zeros);
+            for (arma::uword c = 0; c < chunk.n_cols; ++c) {
+                for (arma::uword r = 0; r < n_features; ++r) {
+                    if (std::isfinite(chunk(r, c))) {
+                        chunk_counts(r) += 1.0;
+                        chunk_sums(r) += chunk(r, c);
+                    }
+                }
+            }
+            arma::Col<double> const chunk_means = chunk_sums / arma::clamp(chunk_counts, 1.0, arma::datum::inf);
+            arma::Col<double> chunk_m2(n_features, arma::fill::zeros);
+            for (arma::uword c = 0; c < chunk.n_cols; ++c) {
+                for (arma::uword r = 0; r < n_features; ++r) {
+                    if (std::isfinite(chunk(r, c))) {
+                        double const d = chunk(r, c) - chunk_means(r);
+                        chunk_m2(r) += d * d;
+                    }
+                }
+            }
+
+            // Chan et al. pairwise update
+            for (arma::uword r = 0; r < n_features; ++r) {
+                double const total = counts(r) + chunk_counts(r);
+                if (total == 0.0) continue;
+                double const delta = chunk_means(r) - means(r);
+                means(r) += delta * chunk_counts(r) / total;
+                m2(r) += chunk_m2(r) + delta * delta * counts(r) * chunk_counts(r) / total;
+                counts(r) = total;
+            }
+        }
+        for (arma::uword r = 0; r < n_features; ++r) {
+            double const sd = counts(r) > 1.0 ? std::sqrt(m2(r) / (counts(r) - 1.0)) : 0.0;
+            if (sd > 1e-10) {
+                scales(r) = sd;
             } else {
-                std::cerr << "Could not get outcome series '" << key << "' to apply predictions." << std::endl;
+                means(r) = 0.0;
+            }
+        }
+    }
+
+    arma::Row<size_t> predictions;
+    std::size_t positive_count = 0;
+    for (std::size_t first = 0; first < n_samples; first += chunk_size) {
+        assemble_chunk(first, std::min(n_samples, first + chunk_size));
+
+        if (zscore) {
+            for (arma::uword c = 0; c < chunk.n_cols; ++c) {
+                for (arma::uword r = 0; r < n_features; ++r) {
+                    chunk(r, c) = static_cast<float>((chunk(r, c) - means(r)) / scales(r));
+                }
             }
         }
+
+        if (!_current_selected_model_operation->predictFloat(chunk, predictions)) {
+            std::cerr << "Prediction on new data failed." << std::endl;
+            return false;
+        }
+        positive_count += static_cast<std::size_t>(arma::accu(predictions != 0));
+
+        for (auto const & [key, series]: outcome_series) {
+            series->setEventsAtSortedTimes(std::span<std::size_t const>(chunk_frames),
+                                           std::span<size_t const>(predictions.memptr(), predictions.n_elem),
+                                           false);
+        }
+    }
+
+    TRACE_ZONE_VALUE(zone, "positive", positive_count);
+    for (auto const & [key, series]: outcome_series) {
+        series->notifyObservers();
+        std::cout << "Predictions applied to outcome series: " << key << std::endl;
     }
 
     return true;
@@ -922,25 +961,16 @@ void ML_Widget::_updateClassDistribution() {
     }
 }
 
-arma::Mat<double> ML_Widget::_createFeatureMatrix(
+ML_Widget::FeaturePlan ML_Widget::_planFeatureMatrix(
         std::vector<FeatureProcessingWidget::ProcessedFeatureInfo> const & processed_features,
-        std::vector<std::size_t> const & timestamps,
         std::string & error_message) const {
-    arma::Mat<double> final_feature_matrix;
-    if (processed_features.empty()) {
-        error_message = "No features selected or processed.";
-        return final_feature_matrix;// Return empty matrix
-    }
-    if (timestamps.empty()) {
-        error_message = "No timestamps provided for feature matrix creation.";
-        return final_feature_matrix;
-    }
-
-    std::vector<arma::Mat<double>> feature_component_matrices;
+    FeaturePlan plan;
 
+    // Each distinct base feature gets its own rows of the base matrix; features
+    // sharing a key reuse them
+    std::map<std::string, std::size_t> base_index;
     for (auto const & p_feature: processed_features) {
-        // arma::Mat<double> current_feature_data_matrix; // Will be set by the transformation strategy
-        auto base_key = p_feature.base_feature_key;
+        auto const & base_key = p_feature.base_feature_key;
 
         DM_DataType data_type = _data_manager->getType(base_key);
 
@@ -951,64 +981,76 @@ arma::Mat<double> ML_Widget::_createFeatureMatrix(
                              "' for feature '" + base_key + "'. No registered strategy found.\n";
             continue;
         }
-
-        auto const & transform_strategy = it->second;
-        arma::Mat<double> current_feature_data_matrix = transform_strategy->apply(
-                _data_manager.get(), base_key, data_type, timestamps,
-                p_feature.transformation,
-                error_message);
-
-        std::cout << "Transformation resulted in feature data matrix of size "
-                  << current_feature_data_matrix.n_cols << " x "
-                  << current_feature_data_matrix.n_rows << std::endl;
-
-        if (!error_message.empty() && current_feature_data_matrix.empty()) {
-            // Error message already populated by the apply method or internal checks
-            // No need to add "Warning: Data for feature..." again if apply itself reported it.
-            // Just ensure error_message is cumulative if needed.
-            // std::cout << "Error from transform apply: " << error_message << std::endl; // For debugging
-            continue;// Skip this feature if apply failed and returned empty matrix with error
-        }
-        if (current_feature_data_matrix.empty() && error_message.empty()) {
-            // This case means apply returned empty but didn't set an error, which might be an issue
-            // in the transform's implementation or a valid case of no data for this specific transform.
-            error_message += "Warning: Transformation for feature '" + base_key + "' resulted in an empty matrix without explicit error. Skipping.\n";
+        if (!it->second->isSupported(data_type)) {
+            error_message += "Data type '" + convert_data_type_to_string(data_type) + "' is not supported by this transformation for feature '" + base_key + "'.\n";
             continue;
         }
 
-        // The old data fetching and transformation specific if/else block is now replaced by the strategy call.
+        if (!base_index.contains(base_key)) {
+            auto const n_rows = static_cast<arma::uword>(feature_row_count(_data_manager.get(), base_key, data_type));
+            if (n_rows == 0) {
+                error_message += "Data for feature '" + base_key + "' resulted in an empty matrix after fetching.\n";
+                continue;
+            }
+            base_index[base_key] = plan.base_features.size();
+            plan.base_features.push_back(FeaturePlan::BaseFeature{base_key, data_type, plan.base_row_count, n_rows});
+            plan.base_row_count += n_rows;
+        }
+
+        // Rows are laid out in the order of the processed features, as before
+        auto const & base_feature = plan.base_features[base_index.at(base_key)];
+        it->second->appendToLayout(base_feature.first_row, base_feature.n_rows,
+                                   p_feature.transformation, plan.layout, error_message);
+    }
+
+    return plan;
+}
 
-        feature_component_matrices.push_back(current_feature_data_matrix);
+void ML_Widget::_fillBaseMatrix(FeaturePlan const & plan,
+                                std::vector<std::size_t> const & timestamps,
+                                arma::Mat<float> & base) const {
+    for (auto const & base_feature: plan.base_features) {
+        fill_feature_rows(_data_manager.get(), base_feature.key, base_feature.data_type, timestamps, base, base_feature.first_row);
     }
+}
 
-    if (feature_component_matrices.empty()) {
+arma::Mat<float> ML_Widget::_createFeatureMatrix(
+        std::vector<FeatureProcessingWidget::ProcessedFeatureInfo> const & processed_features,
+        std::vector<std::size_t> const & timestamps,
+        std::string & error_message) const {
+    arma::Mat<float> final_feature_matrix;
+    if (processed_features.empty()) {
+        error_message = "No features selected or processed.";
+        return final_feature_matrix;// Return empty matrix
+    }
+    if (timestamps.empty()) {
+        error_message = "No timestamps provided for feature matrix creation.";
+        return final_feature_matrix;
+    }
+
+    // Each distinct base feature is written once into its rows of a float base matrix
+    // (all sources are single precision). Transformations then only describe their
+    // rows as references into it, so lag/lead blocks are not copied until the
+    // design matrix is assembled.
+    auto const plan = _planFeatureMatrix(processed_features, error_message);
+    if (plan.layout.rowCount() == 0) {
         error_message = "No feature components were successfully processed into matrices.";
         return final_feature_matrix;// Return empty
     }
 
-    // Concatenate all feature component matrices. They should all have timestamps.size() columns.
-    // Armadillo join_rows (vertical concatenation) is what we need if each matrix has features as rows and samples as columns.
-    // The conversion functions (e.g. convertAnalogTimeSeriesToMlpackArray) return arma::Row<double> (1 row, N samples).
-    // So we need to transpose them to be N rows, 1 sample when stacking, then transpose back, OR ensure all are (num_features_for_this_component x num_samples).
-    // Let's standardize that each current_feature_data_matrix is (num_sub_features x num_timestamps).
-    // convertAnalogTimeSeriesToMlpackArray returns (1 x num_timestamps), so it's fine.
-    // convertToMlpackArray (DigitalInterval) returns (1 x num_timestamps), fine.
-    // convertToMlpackMatrix (Points) returns (num_point_coords x num_timestamps), fine.
-    // convertTensorDataToMlpackMatrix returns (flattened_tensor_dim x num_timestamps), fine.
-
-    final_feature_matrix = feature_component_matrices[0];
-    for (size_t i = 1; i < feature_component_matrices.size(); ++i) {
-        if (feature_component_matrices[i].n_cols == final_feature_matrix.n_cols) {
-            final_feature_matrix = arma::join_cols(final_feature_matrix, feature_component_matrices[i]);
-        } else {
-            error_message += "Error: Mismatched number of samples (columns) when joining feature matrices. Skipping a component.";
-            // Potentially skip this component or handle error more gracefully
-        }
-    }
+    arma::Mat<float> base_matrix(plan.base_row_count, timestamps.size());
+    _fillBaseMatrix(plan, timestamps, base_matrix);
+
+    final_feature_matrix = assemble_features<float>(base_matrix, plan.layout);
+
+    std::cout << "Assembled feature matrix of size "
+              << final_feature_matrix.n_rows << " x "
+              << final_feature_matrix.n_cols << std::endl;
+
     return final_feature_matrix;
 }
 
-arma::Mat<double> ML_Widget::_removeNaNColumns(arma::Mat<double> const & matrix, std::vector<std::size_t> & timestamps) const {
+arma::Mat<float> ML_Widget::_removeNaNColumns(arma::Mat<float> const & matrix, std::vector<std::size_t> & timestamps) const {
     if (matrix.empty() || timestamps.empty()) {
         return matrix;
     }
@@ -1041,11 +1083,11 @@ arma::Mat<double> ML_Widget::_removeNaNColumns(arma::Mat<double> const & matrix,
     if (valid_columns.empty()) {
         std::cout << "Warning: All columns contained NaN values. Returning empty matrix." << std::endl;
         timestamps.clear();
-        return arma::Mat<double>();
+        return arma::Mat<float>();
     }
 
     // Create new matrix with only valid columns
-    arma::Mat<double> cleaned_matrix(matrix.n_rows, valid_columns.size());
+    arma::Mat<float> cleaned_matrix(matrix.n_rows, valid_columns.size());
     std::vector<std::size_t> cleaned_timestamps;
 
     for (size_t i = 0; i < valid_columns.size(); ++i) {
@@ -1057,13 +1099,13 @@ arma::Mat<double> ML_Widget::_removeNaNColumns(arma::Mat<double> const & matrix,
     return cleaned_matrix;
 }
 
-arma::Mat<double> ML_Widget::_zScoreNormalizeFeatures(arma::Mat<double> const & matrix,
-                                                      std::vector<FeatureProcessingWidget::ProcessedFeatureInfo> const & processed_features) const {
+arma::Mat<float> ML_Widget::_zScoreNormalizeFeatures(arma::Mat<float> const & matrix,
+                                                     std::vector<FeatureProcessingWidget::ProcessedFeatureInfo> const & processed_features) const {
     if (matrix.empty()) {
         return matrix;
     }
 
-    arma::Mat<double> normalized_matrix = matrix;
+    arma::Mat<float> normalized_matrix = matrix;
     arma::uword current_row = 0;
 
     for (auto const & p_feature: processed_features) {
@@ -1101,15 +1143,15 @@ arma::Mat<double> ML_Widget::_zScoreNormalizeFeatures(arma::Mat<double> const &
             // Normalize each row (feature) separately
             for (arma::uword row = current_row; row < current_row + feature_rows; ++row) {
                 if (row < normalized_matrix.n_rows) {
-                    arma::rowvec feature_row = normalized_matrix.row(row);
+                    arma::frowvec feature_row = normalized_matrix.row(row);
 
                     // Check if this row has any finite values
                     arma::uvec finite_indices = arma::find_finite(feature_row);
                     if (finite_indices.n_elem > 1) {// Need at least 2 values for std calculation
-                        double mean_val = arma::mean(feature_row(finite_indices));
-                        double std_val = arma::stddev(feature_row(finite_indices));
+                        float mean_val = arma::mean(feature_row(finite_indices));
+                        float std_val = arma::stddev(feature_row(finite_indices));
 
-                        if (std_val > 1e-10) {// Avoid division by zero
+                        if (std_val > 1e-10f) {// Avoid division by zero
                             normalized_matrix.row(row) = (feature_row - mean_val) / std_val;
                         }
                     }
@@ -1151,47 +1193,31 @@ arma::Mat<double> create_arrays(
         std::unordered_set<std::string> const & data_keys,
         std::vector<std::size_t> & timestamps,
         DataManager * data_manager) {
-    std::vector<arma::Mat<double>> component_arrays;
+    // Every key is written straight into its rows of one preallocated matrix
+    std::vector<std::pair<std::string, arma::uword>> components;
+    arma::uword total_rows = 0;
 
     for (auto const & key: data_keys) {
         auto const data_type = data_manager->getType(key);
-        arma::Mat<double> current_array_component;
-
-        if (data_type == DM_DataType::Analog) {
-            auto analog_series = data_manager->getData<AnalogTimeSeries>(key);
-            if (analog_series) current_array_component = convertAnalogTimeSeriesToMlpackArray(analog_series.get(), timestamps).t();
-        } else if (data_type == DM_DataType::DigitalInterval) {
-            auto digital_series = data_manager->getData<DigitalIntervalSeries>(key);
-            if (digital_series) current_array_component = convertToMlpackArray(digital_series.get(), timestamps).t();
-        } else if (data_type == DM_DataType::Points) {
-            auto point_data = data_manager->getData<PointData>(key);
-            if (point_data) current_array_component = convertToMlpackMatrix(point_data.get(), timestamps);
-        } else if (data_type == DM_DataType::Tensor) {
-            auto tensor_data = data_manager->getData<TensorData>(key);
-            if (tensor_data) current_array_component = convertTensorDataToMlpackMatrix(tensor_data.get(), timestamps);
-        } else {
-            std::cerr << "Unsupported data type for key '" << key << "': " << convert_data_type_to_string(data_type) << std::endl;
-            continue;
-        }
-        if (!current_array_component.empty()) {
-            if (data_type == DM_DataType::Analog || data_type == DM_DataType::DigitalInterval) {
-                component_arrays.push_back(current_array_component.t());
-            } else {
-                component_arrays.push_back(current_array_component);
+        auto const n_rows = static_cast<arma::uword>(feature_row_count(data_manager, key, data_type));
+        if (n_rows == 0) {
+            if (data_type != DM_DataType::Analog && data_type != DM_DataType::DigitalInterval &&
+                data_type != DM_DataType::Points && data_type != DM_DataType::Tensor) {
+                std::cerr << "Unsupported data type for key '" << key << "': " << convert_data_type_to_string(data_type) << std::endl;
             }
+            continue;
         }
+        components.emplace_back(key, total_rows);
+        total_rows += n_rows;
     }
 
-    arma::Mat<double> concatenated_array;
-    if (!component_arrays.empty()) {
-        concatenated_array = component_arrays[0];
-        for (std::size_t i = 1; i < component_arrays.size(); i++) {
-            if (component_arrays[i].n_cols == concatenated_array.n_cols) {
-                concatenated_array = arma::join_cols(concatenated_array, component_arrays[i]);
-            } else if (component_arrays[i].n_rows == concatenated_array.n_rows) {
-                // This case should not happen if timestamps is common for all
-            }
-        }
+    if (total_rows == 0) {
+        return arma::Mat<double>();
+    }
+
+    arma::Mat<double> concatenated_array(total_rows, timestamps.size());
+    for (auto const & [key, first_row]: components) {
+        fill_feature_rows(data_manager, key, data_manager->getType(key), timestamps, concatenated_array, first_row);
     }
     return concatenated_array;
 }
@@ -61,24 +61,46 @@ private:
     // Table-based ML helpers
     void _populateAvailableTablesAndColumns();
     void _onSelectedTableChanged(QString const & table_id);
-    arma::Mat<double> _buildFeatureMatrixFromTable(std::shared_ptr<TableView> const & table,
-                                                   std::vector<std::string> const & feature_columns,
-                                                   std::vector<size_t> & kept_row_indices) const;
+    arma::Mat<float> _buildFeatureMatrixFromTable(std::shared_ptr<TableView> const & table,
+                                                  std::vector<std::string> const & feature_columns,
+                                                  std::vector<std::string> const & mask_columns,
+                                                  std::vector<size_t> & kept_row_indices) const;
     std::optional<arma::Row<size_t>> _buildLabelsFromTable(std::shared_ptr<TableView> const & table,
                                                            std::string const & label_column,
                                                            std::vector<size_t> const & kept_row_indices) const;
-    std::vector<size_t> _applyMasksFromTable(std::shared_ptr<TableView> const & table,
-                                             std::vector<std::string> const & mask_columns,
-                                             std::vector<size_t> const & candidate_rows) const;
 
-    arma::Mat<double> _createFeatureMatrix(
+    /**
+     * @brief Base features and design matrix rows for a set of processed features
+     *
+     * The base matrix can be filled for any set of timestamps, so the design
+     * matrix can be assembled for the whole set at once or one chunk at a time.
+     */
+    struct FeaturePlan {
+        struct BaseFeature {
+            std::string key;
+            DM_DataType data_type;
+            arma::uword first_row;
+            arma::uword n_rows;
+        };
+        std::vector<BaseFeature> base_features;
+        arma::uword base_row_count{0};
+        FeatureLayout layout;
+    };
+
+    FeaturePlan _planFeatureMatrix(std::vector<FeatureProcessingWidget::ProcessedFeatureInfo> const & processed_features,
+                                   std::string & error_message) const;
+    void _fillBaseMatrix(FeaturePlan const & plan,
+                         std::vector<std::size_t> const & timestamps,
+                         arma::Mat<float> & base) const;
+
+    arma::Mat<float> _createFeatureMatrix(
             std::vector<FeatureProcessingWidget::ProcessedFeatureInfo> const & processed_features,
             std::vector<std::size_t> const & timestamps,
             std::string & error_message) const;
 
-    arma::Mat<double> _removeNaNColumns(arma::Mat<double> const & matrix, std::vector<std::size_t> & timestamps) const;
-    arma::Mat<double> _zScoreNormalizeFeatures(arma::Mat<double> const & matrix,
-                                               std::vector<FeatureProcessingWidget::ProcessedFeatureInfo> const & processed_features) const;
+    arma::Mat<float> _removeNaNColumns(arma::Mat<float> const & matrix, std::vector<std::size_t> & timestamps) const;
+    arma::Mat<float> _zScoreNormalizeFeatures(arma::Mat<float> const & matrix,
+                                              std::vector<FeatureProcessingWidget::ProcessedFeatureInfo> const & processed_features) const;
 
     /**
      * @brief Prepare training data including feature matrix and outcome arrays
@@ -91,7 +113,7 @@ private:
     std::optional<arma::Row<size_t>> _prepareTrainingData(
             std::vector<FeatureProcessingWidget::ProcessedFeatureInfo> const & active_proc_features,
             std::vector<std::size_t> & training_timestamps,
-            arma::Mat<double> & feature_array,
+            arma::Mat<float> & feature_array,
             arma::Mat<double> & outcome_array) const;
 
     /**
@@ -102,9 +124,9 @@ private:
      * @param balanced_labels Output balanced labels
      * @return bool True if training successful, false otherwise
      */
-    bool _trainModel(arma::Mat<double> const & feature_array,
+    bool _trainModel(arma::Mat<float> const & feature_array,
                      arma::Row<size_t> const & labels,
-                     arma::Mat<double> & balanced_feature_array,
+                     arma::Mat<float> & balanced_feature_array,
                      arma::Row<size_t> & balanced_labels);
 
     /**
@@ -116,6 +138,19 @@ private:
     bool _predictNewData(std::vector<FeatureProcessingWidget::ProcessedFeatureInfo> const & active_proc_features,
                          std::vector<std::size_t> const & training_timestamps);
 
+    /**
+     * @brief Predict every frame outside the training set, a chunk at a time
+     *
+     * Feature chunks are assembled as float, classified and written straight
+     * into the selected outcome series, so memory stays bounded by the chunk
+     * size however long the session is.
+     * @param active_proc_features Vector of processed feature information
+     * @param training_timestamps Sorted, unique training timestamps to exclude
+     * @return bool True if prediction successful, false otherwise
+     */
+    bool _predictFramesInChunks(std::vector<FeatureProcessingWidget::ProcessedFeatureInfo> const & active_proc_features,
+                                std::vector<std::size_t> const & training_timestamps);
+
     std::shared_ptr<DataManager> _data_manager;
     TimeScrollBar * _time_scrollbar;
     Ui::ML_Widget * ui;
@@ -2,6 +2,7 @@
 #define ITRANSFORMATION_HPP
 
 #include "DataManager/DataManagerTypes.hpp"//DM_DataType
+#include "ML_Widget/feature_assembly.hpp"
 #include "TransformationsCommon.hpp"
 
 #include <armadillo>
@@ -35,6 +36,24 @@ public:
             WhiskerTransformations::AppliedTransformation const & transform_config,
             std::string & error_message) const = 0;
 
+    /**
+     * @brief Appends the rows this transformation produces to a feature layout.
+     * The rows refer back to the base rows of the feature instead of copying them,
+     * so the design matrix is only materialized once (see assemble_features).
+     * @param base_row First row of the feature in the base matrix.
+     * @param n_base_rows Number of rows the feature occupies in the base matrix.
+     * @param transform_config The configuration for the transformation.
+     * @param layout The layout to append to.
+     * @param error_message Output string for any errors encountered.
+     * @return True if rows were appended, false if the configuration is invalid.
+     */
+    virtual bool appendToLayout(
+            arma::uword base_row,
+            arma::uword n_base_rows,
+            WhiskerTransformations::AppliedTransformation const & transform_config,
+            FeatureLayout & layout,
+            std::string & error_message) const = 0;
+
     /**
      * @brief Checks if this transformation can be applied to the given data type.
      * @param type The DM_DataType to check.
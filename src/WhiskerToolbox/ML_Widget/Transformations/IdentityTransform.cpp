@@ -10,3 +10,17 @@ arma::Mat<double> IdentityTransform::_applyTransformationLogic(
 
     return base_data;
 }
+
+bool IdentityTransform::appendToLayout(
+        arma::uword base_row,
+        arma::uword n_base_rows,
+        WhiskerTransformations::AppliedTransformation const & transform_config,
+        FeatureLayout & layout,
+        std::string & error_message) const {
+
+    static_cast<void>(transform_config);
+    static_cast<void>(error_message);
+
+    layout.addRows(base_row, n_base_rows);
+    return true;
+}
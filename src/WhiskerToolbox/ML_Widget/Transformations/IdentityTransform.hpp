@@ -14,6 +14,12 @@ public:
         const WhiskerTransformations::AppliedTransformation& transform_config,
         std::string& error_message) const override;
 
+    bool appendToLayout(
+        arma::uword base_row,
+        arma::uword n_base_rows,
+        const WhiskerTransformations::AppliedTransformation& transform_config,
+        FeatureLayout& layout,
+        std::string& error_message) const override;
 };
 
 #endif //IDENTITYTRANSFORM_HPP 
\ No newline at end of file
@@ -10,6 +10,13 @@ public:
         const WhiskerTransformations::AppliedTransformation& transform_config,
         std::string& error_message) const override;
 
+    bool appendToLayout(
+        arma::uword base_row,
+        arma::uword n_base_rows,
+        const WhiskerTransformations::AppliedTransformation& transform_config,
+        FeatureLayout& layout,
+        std::string& error_message) const override;
+
     /**
      * @brief Checks if this transformation can be applied to the given data type.
      * @param type The DM_DataType to check.
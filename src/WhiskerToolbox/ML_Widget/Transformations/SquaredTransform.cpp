@@ -15,6 +15,21 @@ arma::Mat<double> SquaredTransform::_applyTransformationLogic(
     return arma::pow(base_data, 2);
 }
 
+bool SquaredTransform::appendToLayout(
+        arma::uword base_row,
+        arma::uword n_base_rows,
+        WhiskerTransformations::AppliedTransformation const & transform_config,
+        FeatureLayout & layout,
+        std::string & error_message) const {
+
+    static_cast<void>(transform_config);
+    static_cast<void>(error_message);
+
+    // Squared on the fly when the design matrix is assembled
+    layout.addRows(base_row, n_base_rows, 0, FeatureRowOp::Square);
+    return true;
+}
+
 bool SquaredTransform::isSupported(DM_DataType type) const {
     return type == DM_DataType::Analog ||
            type == DM_DataType::Points ||
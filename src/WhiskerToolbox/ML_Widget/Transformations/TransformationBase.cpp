@@ -1,13 +1,8 @@
 #include "TransformationBase.hpp"
 
-#include "DataManager/AnalogTimeSeries/Analog_Time_Series.hpp"
 #include "DataManager/DataManager.hpp"
-#include "DataManager/DigitalTimeSeries/Digital_Interval_Series.hpp"
-#include "DataManager/Points/Point_Data.hpp"
-#include "DataManager/Tensors/Tensor_Data.hpp"
 
-#include "DataManager/utils/armadillo_wrap/analog_armadillo.hpp"
-#include "ML_Widget/mlpack_conversion.hpp"
+#include "ML_Widget/feature_assembly.hpp"
 
 arma::Mat<double> TransformationBase::fetchBaseData(
         DataManager * dm,
@@ -26,27 +21,14 @@ arma::Mat<double> TransformationBase::fetchBaseData(
         return base_data_matrix;
     }
 
-    if (data_type == DM_DataType::Analog) {
-        auto analog_series = dm->getData<AnalogTimeSeries>(base_key);
-        if (analog_series) {
-            base_data_matrix = convertAnalogTimeSeriesToMlpackArray(analog_series.get(), timestamps);
+    auto const n_rows = feature_row_count(dm, base_key, data_type);
+    if (n_rows > 0) {
+        base_data_matrix.set_size(n_rows, timestamps.size());
+        if (!fill_feature_rows(dm, base_key, data_type, timestamps, base_data_matrix, 0)) {
+            base_data_matrix.clear();
         }
-    } else if (data_type == DM_DataType::DigitalInterval) {
-        auto digital_series = dm->getData<DigitalIntervalSeries>(base_key);
-        if (digital_series) {
-            base_data_matrix = convertToMlpackArray(digital_series.get(), timestamps);
-        }
-    } else if (data_type == DM_DataType::Points) {
-        auto point_data = dm->getData<PointData>(base_key);
-        if (point_data) {
-            base_data_matrix = convertToMlpackMatrix(point_data.get(), timestamps);
-        }
-    } else if (data_type == DM_DataType::Tensor) {
-        auto tensor_data = dm->getData<TensorData>(base_key);
-        if (tensor_data) {
-            base_data_matrix = convertTensorDataToMlpackMatrix(tensor_data.get(), timestamps);
-        }
-    } else {
+    } else if (data_type != DM_DataType::Analog && data_type != DM_DataType::DigitalInterval &&
+               data_type != DM_DataType::Points && data_type != DM_DataType::Tensor) {
         error_message += "Unsupported data type '" + convert_data_type_to_string(data_type) + "' for feature '" + base_key + "'.\n";
     }
 
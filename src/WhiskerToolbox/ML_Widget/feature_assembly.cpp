@@ -0,0 +1,364 @@
+#include "feature_assembly.hpp"
+
+#include "DataManager/AnalogTimeSeries/Analog_Time_Series.hpp"
+#include "DataManager/DataManager.hpp"
+#include "DataManager/DigitalTimeSeries/Digital_Interval_Series.hpp"
+#include "DataManager/Points/Point_Data.hpp"
+#include "DataManager/Tensors/Tensor_Data.hpp"
+#include "DataManager/utils/TableView/core/TableView.h"
+#include "DataManager/utils/parallel_for.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <variant>
+
+namespace {
+
+// Samples handed to a worker at a time; below this threading does not pay off
+constexpr std::size_t min_samples_per_task = 2048;
+
+using NumericColumn = std::variant<
+        std::vector<double> const *,
+        std::vector<float> const *,
+        std::vector<int> const *,
+        std::vector<int64_t> const *>;
+
+/**
+ * @brief Fetch a numeric table column without copying it
+ *
+ * TableView builds columns lazily, so this must run on one thread; the
+ * returned vectors can then be read concurrently.
+ */
+std::optional<NumericColumn> get_numeric_column(TableView & table, std::string const & name) {
+    auto const type = table.getColumnTypeIndex(name);
+    if (type == typeid(double)) {
+        return NumericColumn{&table.getColumnValues<double>(name)};
+    }
+    if (type == typeid(float)) {
+        return NumericColumn{&table.getColumnValues<float>(name)};
+    }
+    if (type == typeid(int)) {
+        return NumericColumn{&table.getColumnValues<int>(name)};
+    }
+    if (type == typeid(int64_t)) {
+        return NumericColumn{&table.getColumnValues<int64_t>(name)};
+    }
+    return std::nullopt;
+}
+
+template<typename eT>
+void fill_analog_rows(AnalogTimeSeries const & series,
+                      std::vector<std::size_t> const & timestamps,
+                      arma::Mat<eT> & base,
+                      arma::uword row) {
+    auto const data = series.getAnalogTimeSeriesSpan();
+    parallel_for_chunks(timestamps.size(), min_samples_per_task, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t c = begin; c < end; ++c) {
+            auto const time = TimeFrameIndex(static_cast<int64_t>(timestamps[c]));
+            auto const index = series.findDataArrayIndexGreaterOrEqual(time);
+            if (index.has_value() && series.getTimeFrameIndexAtDataArrayIndex(index.value()) == time) {
+                base(row, c) = static_cast<eT>(data[index.value().getValue()]);
+            } else {
+                base(row, c) = std::numeric_limits<eT>::quiet_NaN();
+            }
+        }
+    });
+}
+
+template<typename eT>
+void fill_digital_interval_rows(DigitalIntervalSeries const & series,
+                                std::vector<std::size_t> const & timestamps,
+                                arma::Mat<eT> & base,
+                                arma::uword row) {
+    // Sort by start and keep the running maximum end, so each lookup is one
+    // binary search even when intervals overlap
+    auto intervals = series.getDigitalIntervalSeries();
+    std::sort(intervals.begin(), intervals.end(), [](Interval const & a, Interval const & b) {
+        return a.start < b.start;
+    });
+    std::vector<int64_t> starts(intervals.size());
+    std::vector<int64_t> max_ends(intervals.size());
+    int64_t running_end = std::numeric_limits<int64_t>::min();
+    for (std::size_t i = 0; i < intervals.size(); ++i) {
+        starts[i] = intervals[i].start;
+        running_end = std::max(running_end, intervals[i].end);
+        max_ends[i] = running_end;
+    }
+
+    parallel_for_chunks(timestamps.size(), min_samples_per_task, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t c = begin; c < end; ++c) {
+            auto const time = static_cast<int64_t>(timestamps[c]);
+            auto const after = std::upper_bound(starts.begin(), starts.end(), time);
+            bool const inside = after != starts.begin() && max_ends[static_cast<std::size_t>(after - starts.begin()) - 1] >= time;
+            base(row, c) = inside ? eT{1} : eT{0};
+        }
+    });
+}
+
+template<typename eT>
+void fill_point_rows(PointData const & point_data,
+                     std::vector<std::size_t> const & timestamps,
+                     arma::Mat<eT> & base,
+                     arma::uword first_row,
+                     arma::uword n_rows) {
+    parallel_for_chunks(timestamps.size(), min_samples_per_task, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t c = begin; c < end; ++c) {
+            auto const points = point_data.getAtTime(TimeFrameIndex(static_cast<int64_t>(timestamps[c])));
+            eT * column = base.colptr(c) + first_row;
+
+            if (points.empty()) {
+                std::fill_n(column, n_rows, std::numeric_limits<eT>::quiet_NaN());
+                continue;
+            }
+
+            std::fill_n(column, n_rows, eT{0});
+            std::size_t const n_points = std::min<std::size_t>(points.size(), n_rows / 2);
+            for (std::size_t p = 0; p < n_points; ++p) {
+                column[p * 2] = static_cast<eT>(points[p].x);
+                column[p * 2 + 1] = static_cast<eT>(points[p].y);
+            }
+        }
+    });
+}
+
+template<typename eT>
+void fill_tensor_rows(TensorData const & tensor_data,
+                      std::vector<std::size_t> const & timestamps,
+                      arma::Mat<eT> & base,
+                      arma::uword first_row,
+                      arma::uword n_rows) {
+    parallel_for_chunks(timestamps.size(), min_samples_per_task, [&](std::size_t begin, std::size_t end) {
+        std::vector<float> frame_copy;
+        for (std::size_t c = begin; c < end; ++c) {
+            auto const time = TimeFrameIndex(static_cast<int64_t>(timestamps[c]));
+            // Contiguous storage is read in place; per-frame storage has to be copied out
+            std::span<float const> values;
+            if (tensor_data.isContiguous()) {
+                values = tensor_data.getTensorViewAtTime(time);
+            } else {
+                frame_copy = tensor_data.getTensorDataAtTime(time);
+                values = frame_copy;
+            }
+            eT * column = base.colptr(c) + first_row;
+
+            if (values.empty()) {
+                std::fill_n(column, n_rows, std::numeric_limits<eT>::quiet_NaN());
+                continue;
+            }
+
+            std::size_t const n_values = std::min<std::size_t>(values.size(), n_rows);
+            std::transform(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(n_values), column,
+                           [](float v) { return static_cast<eT>(v); });
+            std::fill(column + n_values, column + n_rows, eT{0});
+        }
+    });
+}
+
+}// namespace
+
+void FeatureLayout::addRows(arma::uword base_row, arma::uword n_rows, int shift, FeatureRowOp op) {
+    _rows.reserve(_rows.size() + n_rows);
+    for (arma::uword r = 0; r < n_rows; ++r) {
+        _rows.push_back(FeatureRowRef{.base_row = base_row + r, .shift = shift, .op = op});
+    }
+}
+
+void FeatureLayout::addShiftedRows(arma::uword base_row, arma::uword n_rows, int min_shift, int max_shift) {
+    for (int shift = min_shift; shift <= max_shift; ++shift) {
+        addRows(base_row, n_rows, shift);
+    }
+}
+
+arma::uword FeatureLayout::lookBehind() const {
+    int max_shift = 0;
+    for (auto const & row: _rows) {
+        max_shift = std::max(max_shift, row.shift);
+    }
+    return static_cast<arma::uword>(max_shift);
+}
+
+arma::uword FeatureLayout::lookAhead() const {
+    int min_shift = 0;
+    for (auto const & row: _rows) {
+        min_shift = std::min(min_shift, row.shift);
+    }
+    return static_cast<arma::uword>(-min_shift);
+}
+
+template<typename eT, typename BaseT>
+void assemble_features(arma::Mat<BaseT> const & base,
+                       FeatureLayout const & layout,
+                       arma::uword first_col,
+                       arma::Mat<eT> & out) {
+    auto const & rows = layout.rows();
+    auto const n_base_cols = static_cast<int64_t>(base.n_cols);
+
+    parallel_for_chunks(out.n_cols, min_samples_per_task, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t c = begin; c < end; ++c) {
+            auto const col = static_cast<int64_t>(first_col + c);
+            eT * column = out.colptr(c);
+            for (std::size_t r = 0; r < rows.size(); ++r) {
+                auto const source = col - rows[r].shift;
+                if (source < 0 || source >= n_base_cols) {
+                    column[r] = std::numeric_limits<eT>::quiet_NaN();
+                    continue;
+                }
+                auto const value = static_cast<eT>(base(rows[r].base_row, static_cast<arma::uword>(source)));
+                column[r] = rows[r].op == FeatureRowOp::Square ? value * value : value;
+            }
+        }
+    });
+}
+
+template<typename eT, typename BaseT>
+arma::Mat<eT> assemble_features(arma::Mat<BaseT> const & base, FeatureLayout const & layout) {
+    arma::Mat<eT> out(layout.rowCount(), base.n_cols);
+    assemble_features(base, layout, 0, out);
+    return out;
+}
+
+std::size_t feature_row_count(DataManager * dm, std::string const & key, DM_DataType data_type) {
+    if (!dm) {
+        return 0;
+    }
+
+    if (data_type == DM_DataType::Analog) {
+        return dm->getData<AnalogTimeSeries>(key) ? 1 : 0;
+    }
+    if (data_type == DM_DataType::DigitalInterval) {
+        return dm->getData<DigitalIntervalSeries>(key) ? 1 : 0;
+    }
+    if (data_type == DM_DataType::Points) {
+        auto point_data = dm->getData<PointData>(key);
+        return point_data ? point_data->getMaxPoints() * 2 : 0;
+    }
+    if (data_type == DM_DataType::Tensor) {
+        auto tensor_data = dm->getData<TensorData>(key);
+        if (!tensor_data) {
+            return 0;
+        }
+        auto const feature_shape = tensor_data->getFeatureShape();
+        return std::accumulate(feature_shape.begin(), feature_shape.end(), std::size_t{1}, std::multiplies<>());
+    }
+    return 0;
+}
+
+template<typename eT>
+bool fill_feature_rows(DataManager * dm,
+                       std::string const & key,
+                       DM_DataType data_type,
+                       std::vector<std::size_t> const & timestamps,
+                       arma::Mat<eT> & base,
+                       arma::uword first_row) {
+    auto const n_rows = static_cast<arma::uword>(feature_row_count(dm, key, data_type));
+    if (n_rows == 0 || first_row + n_rows > base.n_rows || base.n_cols != timestamps.size()) {
+        return false;
+    }
+
+    if (data_type == DM_DataType::Analog) {
+        fill_analog_rows(*dm->getData<AnalogTimeSeries>(key), timestamps, base, first_row);
+    } else if (data_type == DM_DataType::DigitalInterval) {
+        fill_digital_interval_rows(*dm->getData<DigitalIntervalSeries>(key), timestamps, base, first_row);
+    } else if (data_type == DM_DataType::Points) {
+        fill_point_rows(*dm->getData<PointData>(key), timestamps, base, first_row, n_rows);
+    } else if (data_type == DM_DataType::Tensor) {
+        fill_tensor_rows(*dm->getData<TensorData>(key), timestamps, base, first_row, n_rows);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+std::vector<std::size_t> select_table_rows(TableView & table,
+                                           std::vector<std::string> const & feature_columns,
+                                           std::vector<std::string> const & mask_columns,
+                                           bool drop_non_finite) {
+    std::size_t const n_rows = table.getRowCount();
+    std::vector<char> keep(n_rows, 1);
+
+    for (auto const & name: mask_columns) {
+        auto const type = table.getColumnTypeIndex(name);
+        if (type == typeid(bool)) {
+            auto const & values = table.getColumnValues<bool>(name);
+            for (std::size_t r = 0; r < n_rows; ++r) {
+                keep[r] = keep[r] && r < values.size() && values[r];
+            }
+        } else if (type == typeid(int)) {
+            auto const & values = table.getColumnValues<int>(name);
+            for (std::size_t r = 0; r < n_rows; ++r) {
+                keep[r] = keep[r] && r < values.size() && values[r] != 0;
+            }
+        }
+        // Other mask types are ignored
+    }
+
+    if (drop_non_finite) {
+        for (auto const & name: feature_columns) {
+            auto const column = get_numeric_column(table, name);
+            if (!column.has_value()) {
+                continue;
+            }
+            std::visit([&](auto const * values) {
+                for (std::size_t r = 0; r < n_rows; ++r) {
+                    keep[r] = keep[r] && r < values->size() && std::isfinite(static_cast<double>((*values)[r]));
+                }
+            },
+                       column.value());
+        }
+    }
+
+    std::vector<std::size_t> rows;
+    rows.reserve(n_rows);
+    for (std::size_t r = 0; r < n_rows; ++r) {
+        if (keep[r]) {
+            rows.push_back(r);
+        }
+    }
+    return rows;
+}
+
+template<typename eT>
+arma::Mat<eT> assemble_table_features(TableView & table,
+                                      std::vector<std::string> const & feature_columns,
+                                      std::vector<std::size_t> const & rows) {
+    std::vector<NumericColumn> columns;
+    columns.reserve(feature_columns.size());
+    for (auto const & name: feature_columns) {
+        if (auto column = get_numeric_column(table, name)) {
+            columns.push_back(column.value());
+        }
+    }
+
+    arma::Mat<eT> out(columns.size(), rows.size());
+    parallel_for_chunks(rows.size(), min_samples_per_task, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t j = 0; j < columns.size(); ++j) {
+            std::visit([&](auto const * values) {
+                for (std::size_t c = begin; c < end; ++c) {
+                    auto const r = rows[c];
+                    out(j, c) = r < values->size() ? static_cast<eT>((*values)[r]) : std::numeric_limits<eT>::quiet_NaN();
+                }
+            },
+                       columns[j]);
+        }
+    });
+    return out;
+}
+
+template void assemble_features<double, float>(arma::Mat<float> const &, FeatureLayout const &, arma::uword, arma::Mat<double> &);
+template void assemble_features<float, float>(arma::Mat<float> const &, FeatureLayout const &, arma::uword, arma::Mat<float> &);
+template arma::Mat<double> assemble_features<double, float>(arma::Mat<float> const &, FeatureLayout const &);
+template arma::Mat<float> assemble_features<float, float>(arma::Mat<float> const &, FeatureLayout const &);
+template void assemble_features<double, double>(arma::Mat<double> const &, FeatureLayout const &, arma::uword, arma::Mat<double> &);
+template arma::Mat<double> assemble_features<double, double>(arma::Mat<double> const &, FeatureLayout const &);
+
+template bool fill_feature_rows<float>(DataManager *, std::string const &, DM_DataType, std::vector<std::size_t> const &, arma::Mat<float> &, arma::uword);
+template bool fill_feature_rows<double>(DataManager *, std::string const &, DM_DataType, std::vector<std::size_t> const &, arma::Mat<double> &, arma::uword);
+
+template arma::Mat<double> assemble_table_features<double>(TableView &, std::vector<std::string> const &, std::vector<std::size_t> const &);
+template arma::Mat<float> assemble_table_features<float>(TableView &, std::vector<std::string> const &, std::vector<std::size_t> const &);
@@ -0,0 +1,160 @@
+#ifndef WHISKERTOOLBOX_FEATURE_ASSEMBLY_HPP
+#define WHISKERTOOLBOX_FEATURE_ASSEMBLY_HPP
+
+#include "DataManager/DataManagerTypes.hpp"//DM_DataType
+
+#include <armadillo>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class DataManager;
+class TableView;
+
+/*
+ * Feature matrices are column-major with one column per sample and one row
+ * per feature, which is the layout mlpack expects. A design matrix is built in
+ * two steps:
+ *
+ * 1. Each distinct base feature is written once into its rows of a
+ *    preallocated base matrix (fill_feature_rows / assemble_table_features).
+ * 2. Transformations only describe their output rows as references into the
+ *    base matrix (FeatureLayout). Lag/lead rows are the same base rows read at
+ *    a sample offset, so they cost nothing until the design matrix is
+ *    materialized by assemble_features(), straight into its destination.
+ *
+ * Both steps split the samples across threads. The element type of the
+ * design matrix is a template parameter, so float32 matrices can be built
+ * without going through double.
+ */
+
+/**
+ * @brief Element-wise operation applied when a layout row is materialized
+ */
+enum class FeatureRowOp {
+    Identity,
+    Square
+};
+
+/**
+ * @brief One row of a design matrix, expressed as a row of the base matrix
+ *
+ * Output column c reads base column c - shift. Columns that fall outside the
+ * base matrix are NaN.
+ */
+struct FeatureRowRef {
+    arma::uword base_row{0};
+    int shift{0};
+    FeatureRowOp op{FeatureRowOp::Identity};
+};
+
+/**
+ * @brief Rows of a design matrix described as references into a base matrix
+ */
+class FeatureLayout {
+public:
+    /**
+     * @brief Append rows that read @p n_rows base rows starting at @p base_row
+     */
+    void addRows(arma::uword base_row, arma::uword n_rows, int shift = 0, FeatureRowOp op = FeatureRowOp::Identity);
+
+    /**
+     * @brief Append one block of rows per shift in [min_shift, max_shift]
+     *
+     * Blocks are ordered by shift and rows by base row within a block, the
+     * same order LagLeadTransform used for its stacked copies.
+     */
+    void addShiftedRows(arma::uword base_row, arma::uword n_rows, int min_shift, int max_shift);
+
+    [[nodiscard]] std::vector<FeatureRowRef> const & rows() const { return _rows; }
+
+    /**
+     * @brief Number of earlier samples any row reads (the largest positive shift)
+     *
+     * Together with lookAhead() this is the margin of base samples needed
+     * around a chunk of design matrix columns.
+     */
+    [[nodiscard]] arma::uword lookBehind() const;
+
+    /**
+     * @brief Number of later samples any row reads (the largest negative shift)
+     */
+    [[nodiscard]] arma::uword lookAhead() const;
+
+    [[nodiscard]] arma::uword rowCount() const { return static_cast<arma::uword>(_rows.size()); }
+
+private:
+    std::vector<FeatureRowRef> _rows;
+};
+
+/**
+ * @brief Materialize columns [first_col, first_col + out.n_cols) of a design matrix
+ *
+ * @p out must already be sized to layout.rowCount() rows; its columns are
+ * filled in parallel. Calling this for successive column ranges builds a long
+ * design matrix one chunk at a time.
+ */
+template<typename eT, typename BaseT>
+void assemble_features(arma::Mat<BaseT> const & base,
+                       FeatureLayout const & layout,
+                       arma::uword first_col,
+                       arma::Mat<eT> & out);
+
+/**
+ * @brief Materialize the whole design matrix described by @p layout
+ */
+template<typename eT, typename BaseT>
+arma::Mat<eT> assemble_features(arma::Mat<BaseT> const & base, FeatureLayout const & layout);
+
+/**
+ * @brief Number of base rows a data object contributes to a feature matrix
+ *
+ * Analog and digital interval series give one row, point data two rows per
+ * point (x, y) and tensors one row per element of the feature shape.
+ *
+ * @return The row count, or 0 if the key is missing or the type is unsupported
+ */
+std::size_t feature_row_count(DataManager * dm, std::string const & key, DM_DataType data_type);
+
+/**
+ * @brief Write a data object into rows [first_row, first_row + feature_row_count()) of @p base
+ *
+ * Samples with no data are NaN. Digital interval series give 1 inside an
+ * interval and 0 elsewhere.
+ *
+ * @param base Preallocated base matrix with one column per timestamp
+ * @return False if the key is missing, the type is unsupported or @p base is too small
+ */
+template<typename eT>
+bool fill_feature_rows(DataManager * dm,
+                       std::string const & key,
+                       DM_DataType data_type,
+                       std::vector<std::size_t> const & timestamps,
+                       arma::Mat<eT> & base,
+                       arma::uword first_row);
+
+/**
+ * @brief Select the table rows to train or predict on
+ *
+ * A row is kept when every mask column is true (non-zero for int columns)
+ * and, if @p drop_non_finite is set, every feature column is finite.
+ */
+std::vector<std::size_t> select_table_rows(TableView & table,
+                                           std::vector<std::string> const & feature_columns,
+                                           std::vector<std::string> const & mask_columns,
+                                           bool drop_non_finite);
+
+/**
+ * @brief Write table columns straight into a features x samples matrix
+ *
+ * Each feature column becomes one row, read at @p rows. Numeric columns of
+ * type double, float, int and int64_t are supported; other columns are left
+ * as NaN.
+ */
+template<typename eT>
+arma::Mat<eT> assemble_table_features(TableView & table,
+                                      std::vector<std::string> const & feature_columns,
+                                      std::vector<std::size_t> const & rows);
+
+#endif//WHISKERTOOLBOX_FEATURE_ASSEMBLY_HPP
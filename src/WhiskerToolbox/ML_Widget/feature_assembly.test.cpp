@@ -0,0 +1,188 @@
+#include "feature_assembly.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <armadillo>
+
+#include <cmath>
+#include <cstdint>
+
+namespace {
+
+// Base matrix whose element (r, c) is 100 * r + c, so every value names its row and sample
+template<typename eT>
+arma::Mat<eT> make_base(arma::uword n_rows, arma::uword n_cols) {
+    arma::Mat<eT> base(n_rows, n_cols);
+    for (arma::uword c = 0; c < n_cols; ++c) {
+        for (arma::uword r = 0; r < n_rows; ++r) {
+            base(r, c) = static_cast<eT>(100 * r + c);
+        }
+    }
+    return base;
+}
+
+// The stacked copies LagLeadTransform built before layouts: one block of all
+// base rows per shift, with samples shifted out of range set to NaN
+arma::Mat<double> stacked_lag_lead(arma::Mat<double> const & base, int min_shift, int max_shift) {
+    auto const n_blocks = static_cast<arma::uword>(max_shift - min_shift + 1);
+    arma::Mat<double> result(base.n_rows * n_blocks, base.n_cols);
+    for (int shift = min_shift; shift <= max_shift; ++shift) {
+        arma::uword const first_row = static_cast<arma::uword>(shift - min_shift) * base.n_rows;
+        for (arma::uword c = 0; c < base.n_cols; ++c) {
+            auto const source = static_cast<int64_t>(c) - shift;
+            for (arma::uword r = 0; r < base.n_rows; ++r) {
+                result(first_row + r, c) = (source >= 0 && source < static_cast<int64_t>(base.n_cols))
+                                                   ? base(r, static_cast<arma::uword>(source))
+                                                   : std::nan("");
+            }
+        }
+    }
+    return result;
+}
+
+// NaN-aware element-wise equality
+template<typename eT>
+bool same_values(arma::Mat<eT> const & a, arma::Mat<double> const & b) {
+    if (a.n_rows != b.n_rows || a.n_cols != b.n_cols) {
+        return false;
+    }
+    for (arma::uword c = 0; c < a.n_cols; ++c) {
+        for (arma::uword r = 0; r < a.n_rows; ++r) {
+            auto const x = static_cast<double>(a(r, c));
+            auto const y = b(r, c);
+            if (std::isnan(x) != std::isnan(y) || (!std::isnan(x) && x != y)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}// namespace
+
+TEST_CASE("FeatureLayout - rows reference base rows in order", "[ML_Widget][feature_assembly]") {
+    FeatureLayout layout;
+    layout.addRows(2, 3);
+    layout.addRows(0, 1, 0, FeatureRowOp::Square);
+
+    auto const & rows = layout.rows();
+    REQUIRE(layout.rowCount() == 4);
+    REQUIRE(rows[0].base_row == 2);
+    REQUIRE(rows[2].base_row == 4);
+    REQUIRE(rows[2].op == FeatureRowOp::Identity);
+    REQUIRE(rows[3].base_row == 0);
+    REQUIRE(rows[3].op == FeatureRowOp::Square);
+    REQUIRE(layout.lookBehind() == 0);
+    REQUIRE(layout.lookAhead() == 0);
+}
+
+TEST_CASE("FeatureLayout - shifted rows are blocked by shift", "[ML_Widget][feature_assembly]") {
+    FeatureLayout layout;
+    layout.addShiftedRows(1, 2, -2, 1);
+
+    auto const & rows = layout.rows();
+    REQUIRE(layout.rowCount() == 8);
+    for (arma::uword block = 0; block < 4; ++block) {
+        REQUIRE(rows[block * 2].shift == static_cast<int>(block) - 2);
+        REQUIRE(rows[block * 2].base_row == 1);
+        REQUIRE(rows[block * 2 + 1].shift == static_cast<int>(block) - 2);
+        REQUIRE(rows[block * 2 + 1].base_row == 2);
+    }
+    REQUIRE(layout.lookBehind() == 1);
+    REQUIRE(layout.lookAhead() == 2);
+}
+
+TEST_CASE("assemble_features - identity and squared rows", "[ML_Widget][feature_assembly]") {
+    auto const base = make_base<float>(3, 5);
+
+    FeatureLayout layout;
+    layout.addRows(1, 2);
+    layout.addRows(0, 1, 0, FeatureRowOp::Square);
+
+    auto const out = assemble_features<float>(base, layout);
+
+    REQUIRE(out.n_rows == 3);
+    REQUIRE(out.n_cols == 5);
+    for (arma::uword c = 0; c < 5; ++c) {
+        REQUIRE(out(0, c) == base(1, c));
+        REQUIRE(out(1, c) == base(2, c));
+        REQUIRE(out(2, c) == base(0, c) * base(0, c));
+    }
+}
+
+TEST_CASE("assemble_features - lag and lead read shifted samples", "[ML_Widget][feature_assembly]") {
+    auto const base = make_base<float>(2, 6);
+
+    FeatureLayout layout;
+    layout.addRows(1, 1, 2); // Lag of two samples
+    layout.addRows(0, 1, -1);// Lead of one sample
+
+    auto const out = assemble_features<double>(base, layout);
+
+    SECTION("Interior samples read the shifted base column") {
+        for (arma::uword c = 2; c < 5; ++c) {
+            REQUIRE(out(0, c) == static_cast<double>(base(1, c - 2)));
+            REQUIRE(out(1, c) == static_cast<double>(base(0, c + 1)));
+        }
+    }
+
+    SECTION("Samples shifted past either end are NaN") {
+        REQUIRE(std::isnan(out(0, 0)));
+        REQUIRE(std::isnan(out(0, 1)));
+        REQUIRE_FALSE(std::isnan(out(0, 5)));
+        REQUIRE(std::isnan(out(1, 5)));
+        REQUIRE_FALSE(std::isnan(out(1, 0)));
+    }
+}
+
+TEST_CASE("assemble_features - shifts longer than the series are all NaN", "[ML_Widget][feature_assembly]") {
+    auto const base = make_base<float>(1, 3);
+
+    FeatureLayout layout;
+    layout.addRows(0, 1, 5);
+    layout.addRows(0, 1, -5);
+
+    auto const out = assemble_features<float>(base, layout);
+    for (arma::uword c = 0; c < 3; ++c) {
+        REQUIRE(std::isnan(out(0, c)));
+        REQUIRE(std::isnan(out(1, c)));
+    }
+}
+
+TEST_CASE("assemble_features - column ranges match the whole matrix", "[ML_Widget][feature_assembly]") {
+    auto const base = make_base<float>(3, 40);
+
+    FeatureLayout layout;
+    layout.addShiftedRows(0, 3, -3, 3);
+
+    auto const whole = assemble_features<double>(base, layout);
+
+    arma::uword const first_col = 17;
+    arma::Mat<double> chunk(layout.rowCount(), 10);
+    assemble_features(base, layout, first_col, chunk);
+
+    for (arma::uword c = 0; c < chunk.n_cols; ++c) {
+        for (arma::uword r = 0; r < chunk.n_rows; ++r) {
+            REQUIRE(chunk(r, c) == whole(r, first_col + c));
+        }
+    }
+}
+
+TEST_CASE("assemble_features - matches the stacked lag/lead copies", "[ML_Widget][feature_assembly]") {
+    // Wide enough that the columns are split across several workers
+    auto const base = make_base<double>(4, 5000);
+
+    FeatureLayout layout;
+    layout.addShiftedRows(0, base.n_rows, -2, 3);
+
+    auto const expected = stacked_lag_lead(base, -2, 3);
+
+    SECTION("Double design matrix") {
+        REQUIRE(same_values(assemble_features<double>(base, layout), expected));
+    }
+
+    SECTION("Float design matrix from a float base") {
+        auto const float_base = make_base<float>(4, 5000);
+        REQUIRE(same_values(assemble_features<float>(float_base, layout), expected));
+    }
+}
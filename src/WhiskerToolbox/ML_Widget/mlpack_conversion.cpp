@@ -190,10 +190,11 @@ inline void updateTensorDataFromMlpackMatrix(
     }
 }
 
+template<typename eT>
 bool balance_training_data_by_subsampling(
-        arma::Mat<double> const& features,
+        arma::Mat<eT> const& features,
         arma::Row<size_t> const& labels,
-        arma::Mat<double>& balanced_features,
+        arma::Mat<eT>& balanced_features,
         arma::Row<size_t>& balanced_labels,
         double max_ratio) { // Default max_ratio to 1.0
 
@@ -313,3 +314,6 @@ bool balance_training_data_by_subsampling(
 
     return true;
 }
+
+template bool balance_training_data_by_subsampling<double>(arma::Mat<double> const&, arma::Row<size_t> const&, arma::Mat<double>&, arma::Row<size_t>&, double);
+template bool balance_training_data_by_subsampling<float>(arma::Mat<float> const&, arma::Row<size_t> const&, arma::Mat<float>&, arma::Row<size_t>&, double);
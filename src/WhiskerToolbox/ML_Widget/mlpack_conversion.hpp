@@ -99,17 +99,18 @@ void updateTensorDataFromMlpackMatrix(
  * Ensures that each class still present after potential subsampling due to `max_ratio`
  * will have `std::min(original_sample_count_for_this_class, target_samples_for_this_class)` samples.
  *
- * @param features Input feature matrix (arma::Mat<double>).
+ * @param features Input feature matrix (arma::Mat<double> or arma::Mat<float>).
  * @param labels Input label row vector (arma::Row<size_t>).
  * @param balanced_features Output balanced feature matrix.
  * @param balanced_labels Output balanced label row vector.
  * @param max_ratio Maximum ratio of any class to the smallest class (e.g., 1.0 means 1:1, 2.0 means 2:1 for majority vs minority).
  * @return True if balancing was performed, false if an error occurred.
  */
+template<typename eT>
 bool balance_training_data_by_subsampling(
-        arma::Mat<double> const& features,
+        arma::Mat<eT> const& features,
         arma::Row<size_t> const& labels,
-        arma::Mat<double>& balanced_features,
+        arma::Mat<eT>& balanced_features,
         arma::Row<size_t>& balanced_labels,
         double max_ratio = 1.0);
 
@@ -37,6 +37,7 @@
 #include <QImage>
 #include <QKeyEvent>
 #include <QLineEdit>
+#include <QMessageBox>
 #include <QPlainTextEdit>
 #include <QTextEdit>
 #include <QComboBox>
@@ -194,9 +195,12 @@ void MainWindow::_loadJSONConfig() {
 
 void MainWindow::processLoadedData(std::vector<DataInfo> const & data_info) {
     bool hasMediaData = false;
+    QStringList failures;
     
     for (auto const & data: data_info) {
-        if (data.data_class == "VideoData") {
+        if (!data.error.empty()) {
+            failures.append(QString("%1: %2").arg(QString::fromStdString(data.key), QString::fromStdString(data.error)));
+        } else if (data.data_class == "VideoData") {
             hasMediaData = true;
         } else if (data.data_class == "ImageData") {
             hasMediaData = true;
@@ -207,6 +211,10 @@ void MainWindow::processLoadedData(std::vector<DataInfo> const & data_info) {
             _media_manager->setFeatureColorForAll(data.key, data.color);
         }
     }
+
+    if (!failures.isEmpty()) {
+        QMessageBox::warning(this, "Some Data Failed to Load", failures.join("\n"));
+    }
     
     // Only update media-related components if we loaded media data
     if (hasMediaData) {
@@ -237,10 +245,7 @@ void MainWindow::_updateFrameCount() {
                   << " the time vector has " << _data_manager->getTime()->getTotalFrameCount() << std::endl;
 
         if (_data_manager->getTime()->getTotalFrameCount() == 0) {
-            std::vector<int> t(frame_count);
-            std::iota(std::begin(t), std::end(t), 0);
-
-            auto new_timeframe = std::make_shared<TimeFrame>(t);
+            auto new_timeframe = TimeFrame::createRegular(frame_count);
 
             _data_manager->removeTime(TimeKey("time"));
             _data_manager->setTime(TimeKey("time"), new_timeframe);
@@ -1,12 +1,18 @@
 #include "media_export.hpp"
 
 #include "DataManager/Media/Media_Data.hpp"
+#include "DataManager/utils/ordered_pipeline.hpp"
+#include "DataManager/utils/parallel_for.hpp"
 #include "DataManager/utils/string_manip.hpp"
 
 #include <QImage>
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
 #include <iostream>
+#include <utility>
 
 
 std::string get_image_save_name(MediaData const * media, int const frame_id, MediaExportOptions const & opts) {
@@ -26,8 +32,9 @@ std::string get_image_save_name(MediaData const * media, int const frame_id, Med
     }
 }
 
-void save_image(MediaData * media, int const frame_id, MediaExportOptions const & opts)
-{
+namespace {
+
+std::filesystem::path prepare_save_dir(MediaExportOptions const & opts) {
     std::filesystem::path save_dir = opts.image_save_dir;
     save_dir.append(opts.image_folder);
     //std::filesystem::path save_dir = opts.image_save_dir + opts.image_folder;
@@ -35,25 +42,115 @@ void save_image(MediaData * media, int const frame_id, MediaExportOptions const
         std::filesystem::create_directory(save_dir);
         std::cout << "Created directory " << save_dir << std::endl;
     }
+    return save_dir;
+}
 
-    auto saveName = get_image_save_name(media, frame_id, opts);
-    auto full_save_path = save_dir / saveName;
-    
+/**
+ * @brief Decide whether a frame should be written to @p full_save_path
+ *
+ * @return false if the file exists and should be kept
+ */
+bool check_overwrite(std::filesystem::path const & full_save_path, MediaExportOptions const & opts) {
     // Check if file exists and handle according to overwrite setting
     if (std::filesystem::exists(full_save_path) && !opts.overwrite_existing) {
         std::cout << "Skipping existing file: " << full_save_path.string() << std::endl;
-        return;
+        return false;
     }
     
     // Log if we're overwriting an existing file
     if (std::filesystem::exists(full_save_path) && opts.overwrite_existing) {
         std::cout << "Overwriting existing file: " << full_save_path.string() << std::endl;
     }
+    return true;
+}
+
+bool write_frame(std::vector<uint8_t> const & image, int width, int height, std::filesystem::path const & full_save_path) {
+    QImage const labeled_image(image.data(), width, height, QImage::Format_Grayscale8);
+    return labeled_image.save(QString::fromStdString(full_save_path.string()));
+}
+
+/// A decoded frame waiting to be encoded
+struct EncodeJob {
+    std::vector<uint8_t> image;
+    int width = 0;
+    int height = 0;
+    std::filesystem::path path;
+};
+
+}// namespace
+
+void save_image(MediaData * media, int const frame_id, MediaExportOptions const & opts)
+{
+    auto const save_dir = prepare_save_dir(opts);
+
+    auto saveName = get_image_save_name(media, frame_id, opts);
+    auto full_save_path = save_dir / saveName;
+    
+    if (!check_overwrite(full_save_path, opts)) {
+        return;
+    }
     
-    auto image = media->getRawData(frame_id);
-    auto width = media->getWidth();
-    auto height = media->getHeight();
-    QImage const labeled_image(&image[0], width, height, QImage::Format_Grayscale8);
-    labeled_image.save(QString::fromStdString(full_save_path.string()));
+    auto const & image = media->getRawData(frame_id);
+    write_frame(image, media->getWidth(), media->getHeight(), full_save_path);
     std::cout << "Saved image to " << full_save_path.string() << std::endl;
 }
+
+MediaExportResult save_images(MediaData * media, std::vector<int> const & frame_ids, MediaExportOptions const & opts) {
+    MediaExportResult result;
+    if (media == nullptr || frame_ids.empty()) {
+        return result;
+    }
+
+    auto const start = std::chrono::steady_clock::now();
+    auto const save_dir = prepare_save_dir(opts);
+
+    // The calling thread decodes, so every other core can encode
+    size_t const workers = std::max<size_t>(parallel_worker_count(), 2) - 1;
+
+    OrderedPipeline<EncodeJob, bool> pipeline(
+            workers,
+            2 * workers,
+            [](EncodeJob & job) {
+                return write_frame(job.image, job.width, job.height, job.path);
+            },
+            [&result](bool & saved) {
+                if (saved) {
+                    ++result.saved;
+                }
+            });
+
+    for (int const frame_id: frame_ids) {
+        auto full_save_path = save_dir / get_image_save_name(media, frame_id, opts);
+        if (!check_overwrite(full_save_path, opts)) {
+            ++result.skipped;
+            continue;
+        }
+
+        EncodeJob job;
+        job.image = media->getRawData(frame_id);
+        job.width = media->getWidth();
+        job.height = media->getHeight();
+        job.path = std::move(full_save_path);
+        if (!pipeline.push(std::move(job))) {
+            break;
+        }
+    }
+
+    try {
+        pipeline.finish();
+    } catch (std::exception const & e) {
+        std::cerr << "Media export failed: " << e.what() << std::endl;
+    }
+
+    // Frames whose write failed, threw, or never ran after the pipeline stopped
+    result.failed = frame_ids.size() - result.saved - result.skipped;
+
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Saved " << result.saved << " images to " << save_dir.string()
+              << " in " << result.seconds << " s (" << result.framesPerSecond() << " frames/s)";
+    if (result.skipped > 0 || result.failed > 0) {
+        std::cout << ", skipped " << result.skipped << ", failed " << result.failed;
+    }
+    std::cout << std::endl;
+    return result;
+}
@@ -1,7 +1,9 @@
 #ifndef MEDIA_EXPORT_HPP
 #define MEDIA_EXPORT_HPP
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 class MediaData;
 
@@ -18,4 +20,30 @@ std::string get_image_save_name(MediaData const * media, int frame_id, MediaExpo
 
 void save_image(MediaData * media, int frame_id, MediaExportOptions const & opts);
 
+struct MediaExportResult {
+    size_t saved = 0;
+    size_t skipped = 0;///< Existing files kept because overwrite_existing is false
+    size_t failed = 0;
+    double seconds = 0.0;
+
+    [[nodiscard]] double framesPerSecond() const {
+        return seconds > 0.0 ? static_cast<double>(saved) / seconds : 0.0;
+    }
+};
+
+/**
+ * @brief Save many frames, encoding them concurrently
+ *
+ * Frames are decoded one after another on the calling thread, in the order
+ * given, so sequential video decoding stays efficient. Encoding and writing
+ * run on a pool of worker threads. The number of decoded frames waiting to be
+ * written is bounded, so memory use does not grow with the frame count.
+ *
+ * @param media Media to read raw frames from
+ * @param frame_ids Frames to export
+ * @param opts Naming and destination options, as for save_image
+ * @return Counts of saved, skipped and failed frames, and the elapsed time
+ */
+MediaExportResult save_images(MediaData * media, std::vector<int> const & frame_ids, MediaExportOptions const & opts);
+
 #endif // MEDIA_EXPORT_HPP
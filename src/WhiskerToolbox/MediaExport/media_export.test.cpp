@@ -0,0 +1,114 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "media_export.hpp"
+
+#include "DataManager/Media/Media_Data.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace {
+
+/// Media whose frames are filled with their own frame number
+class StubMediaData : public MediaData {
+public:
+    StubMediaData() {
+        updateWidth(4);
+        updateHeight(3);
+        setTotalFrameCount(100);
+    }
+
+    MediaType getMediaType() const override { return MediaType::Images; }
+
+    int frames_loaded = 0;
+
+protected:
+    void doLoadFrame(int frame_id) override {
+        ++frames_loaded;
+        setRawData(std::vector<uint8_t>(static_cast<size_t>(getWidth() * getHeight()), static_cast<uint8_t>(frame_id)));
+    }
+};
+
+struct ExportDirFixture {
+    std::filesystem::path const dir = std::filesystem::temp_directory_path() / "media_export_test";
+
+    ExportDirFixture() {
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+    }
+
+    ~ExportDirFixture() {
+        std::filesystem::remove_all(dir);
+    }
+
+    [[nodiscard]] MediaExportOptions options() const {
+        MediaExportOptions opts;
+        opts.image_save_dir = dir.string();
+        opts.image_folder = "images";
+        opts.frame_id_padding = 3;
+        return opts;
+    }
+};
+
+}// namespace
+
+TEST_CASE_METHOD(ExportDirFixture, "MediaExport - save_images writes every frame", "[MediaExport]") {
+    StubMediaData media;
+    auto const opts = options();
+
+    std::vector<int> const frame_ids{0, 5, 7, 42};
+    auto const result = save_images(&media, frame_ids, opts);
+
+    REQUIRE(result.saved == frame_ids.size());
+    REQUIRE(result.skipped == 0);
+    REQUIRE(result.failed == 0);
+    REQUIRE(media.frames_loaded == 4);
+
+    for (int const frame_id: frame_ids) {
+        REQUIRE(std::filesystem::exists(dir / "images" / get_image_save_name(&media, frame_id, opts)));
+    }
+}
+
+TEST_CASE_METHOD(ExportDirFixture, "MediaExport - save_images skips existing files", "[MediaExport]") {
+    StubMediaData media;
+    auto opts = options();
+
+    REQUIRE(save_images(&media, {1, 2}, opts).saved == 2);
+
+    SECTION("Existing files are kept without decoding the frame") {
+        media.frames_loaded = 0;
+        auto const result = save_images(&media, {1, 2, 3}, opts);
+        REQUIRE(result.saved == 1);
+        REQUIRE(result.skipped == 2);
+        REQUIRE(result.failed == 0);
+        REQUIRE(media.frames_loaded == 1);
+    }
+
+    SECTION("Existing files are rewritten when overwriting") {
+        opts.overwrite_existing = true;
+        auto const result = save_images(&media, {1, 2, 3}, opts);
+        REQUIRE(result.saved == 3);
+        REQUIRE(result.skipped == 0);
+    }
+}
+
+TEST_CASE_METHOD(ExportDirFixture, "MediaExport - save_images counts failed writes", "[MediaExport]") {
+    StubMediaData media;
+    auto opts = options();
+    opts.overwrite_existing = true;
+
+    // A directory in place of the image file makes the write fail
+    std::filesystem::create_directories(dir / "images" / get_image_save_name(&media, 2, opts));
+
+    auto const result = save_images(&media, {1, 2, 3}, opts);
+    REQUIRE(result.saved == 2);
+    REQUIRE(result.skipped == 0);
+    REQUIRE(result.failed == 1);
+}
+
+TEST_CASE("MediaExport - save_images without media does nothing", "[MediaExport]") {
+    auto const result = save_images(nullptr, {1, 2, 3}, MediaExportOptions{});
+    REQUIRE(result.saved == 0);
+    REQUIRE(result.failed == 0);
+}
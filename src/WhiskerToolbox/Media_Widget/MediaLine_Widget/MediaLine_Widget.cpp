@@ -237,10 +237,9 @@ void MediaLine_Widget::setActiveKey(std::string const& key) {
             auto line_data = _data_manager->getData<LineData>(_active_key);
             if (line_data) {
                 auto current_time = TimeFrameIndex(_data_manager->getCurrentTime());
-                auto lines = line_data->getAtTime(current_time);
                 
                 // Update the slider with the number of lines
-                int num_lines = static_cast<int>(lines.size());
+                int num_lines = static_cast<int>(line_data->getLineCountAtTime(current_time));
                 
                 ui->line_select_slider->blockSignals(true);
                 ui->line_select_slider->setMaximum(num_lines > 0 ? num_lines - 1 : 0);
@@ -291,8 +290,6 @@ void MediaLine_Widget::_clickedInVideo(qreal x_canvas, qreal y_canvas) {
     auto const current_time = TimeFrameIndex(_data_manager->getCurrentTime());
     auto const line_img_size = line_data->getImageSize();
 
-    auto lines = line_data->getAtTime(current_time);
-
     switch (_selection_mode) {
         case Selection_Mode::None: {
             std::cout << "Selection mode is None" << std::endl;
@@ -330,7 +327,7 @@ void MediaLine_Widget::_clickedInVideo(qreal x_canvas, qreal y_canvas) {
 
 void MediaLine_Widget::_addPointToLine(float x_media, float y_media, TimeFrameIndex current_time) {
     auto line_data = _data_manager->getData<LineData>(_active_key);
-    auto lines = line_data->getAtTime(current_time);
+    auto const num_lines = line_data->getLineCountAtTime(current_time);
     
     // Check if edge snapping is enabled
     bool use_edge_snapping = false;
@@ -350,7 +347,7 @@ void MediaLine_Widget::_addPointToLine(float x_media, float y_media, TimeFrameIn
         y_media = edge_point.second;
     }
     
-    if (lines.empty()) {
+    if (num_lines == 0) {
         // If no lines exist, create a new one with the single point
         _data_manager->getData<LineData>(_active_key)->addAtTime(current_time, {{x_media, y_media}});
         // After adding a new line, it's line index 0
@@ -363,12 +360,15 @@ void MediaLine_Widget::_addPointToLine(float x_media, float y_media, TimeFrameIn
                 current_time, _current_line_index, Point2D<float>{x_media, y_media});
         } else if (_smoothing_mode == Smoothing_Mode::PolynomialFit) {
             // Make sure current_line_index is valid
-            if (_current_line_index >= static_cast<int>(lines.size())) {
+            if (_current_line_index >= static_cast<int>(num_lines)) {
                 std::cout << "Warning: line index out of bounds, using first line" << std::endl;
                 _current_line_index = 0;
                 ui->line_select_slider->setValue(0);
             }
             
+            // The lines at this time are rebuilt below, so copy them out
+            auto lines = line_data->getAtTime(current_time);
+
             // Get a copy of the current line using the selected index
             auto line = lines[_current_line_index];
             
@@ -423,23 +423,16 @@ void MediaLine_Widget::_applyPolynomialFit(Line2D& line, int order) {
         return;
     }
     
-    // Extract x and y coordinates
-    std::vector<double> t(line.size());
-    std::vector<double> x_coords(line.size());
-    std::vector<double> y_coords(line.size());
-    
     // Use parameter t along the curve (0 to 1)
+    std::vector<double> t(line.size());
     for (size_t i = 0; i < line.size(); ++i) {
         t[i] = static_cast<double>(i) / (line.size() - 1);
-        x_coords[i] = line[i].x;
-        y_coords[i] = line[i].y;
     }
     
-    // Fit polynomials to x(t) and y(t) using the function from line_angle.hpp
-    std::vector<double> x_coeffs = fit_polynomial(t, x_coords, order);
-    std::vector<double> y_coeffs = fit_polynomial(t, y_coords, order);
+    // Fit polynomials to x(t) and y(t) together
+    auto const fit = fit_parametric_polynomial(t, std::span<Point2D<float> const>(line.begin(), line.end()), order);
     
-    if (x_coeffs.empty() || y_coeffs.empty()) {
+    if (!fit.success) {
         // Fall back to simple smoothing if fitting failed
         smooth_line(line);
         return;
@@ -454,8 +447,8 @@ void MediaLine_Widget::_applyPolynomialFit(Line2D& line, int order) {
         double t_param = static_cast<double>(i) / (num_points - 1);
         
         // Evaluate polynomials at t_param using the function from line_angle.hpp
-        double x_val = evaluate_polynomial(x_coeffs, t_param);
-        double y_val = evaluate_polynomial(y_coeffs, t_param);
+        double x_val = evaluate_polynomial(fit.x_coeffs, t_param);
+        double y_val = evaluate_polynomial(fit.y_coeffs, t_param);
         
         smooth_line.push_back(Point2D<float>{static_cast<float>(x_val), static_cast<float>(y_val)});
     }
@@ -532,10 +525,8 @@ void MediaLine_Widget::LoadFrame(int frame_id) {
     if (!_active_key.empty()) {
         auto line_data = _data_manager->getData<LineData>(_active_key);
         if (line_data) {
-            auto lines = line_data->getAtTime(TimeFrameIndex(frame_id));
-            
             // Update the line_select_slider's maximum value based on the number of lines
-            int num_lines = static_cast<int>(lines.size());
+            int num_lines = static_cast<int>(line_data->getLineCountAtTime(TimeFrameIndex(frame_id)));
             
             // Disconnect and reconnect to avoid triggering slider value changed signals
             // during this programmatic update
@@ -574,9 +565,9 @@ void MediaLine_Widget::_lineSelectionChanged(int index) {
         auto line_data = _data_manager->getData<LineData>(_active_key);
         if (line_data) {
             auto current_time = TimeFrameIndex(_data_manager->getCurrentTime());
-            auto lines = line_data->getAtTime(current_time);
+            auto const num_lines = line_data->getLineCountAtTime(current_time);
             
-            if (!lines.empty() && _current_line_index < static_cast<int>(lines.size())) {
+            if (num_lines > 0 && _current_line_index < static_cast<int>(num_lines)) {
                 // Here you can perform any specific actions needed when a different line is selected
                 // For example, updating a visualization to highlight the selected line
                 
@@ -901,7 +892,7 @@ int MediaLine_Widget::_findNearestLine(float x, float y) {
     }
     
     auto current_time = TimeFrameIndex(_data_manager->getCurrentTime());
-    auto lines = line_data->getAtTime(current_time);
+    auto const lines = line_data->getLineViewsAtTime(current_time);
     
     if (lines.empty()) {
         return -1;
@@ -911,7 +902,7 @@ int MediaLine_Widget::_findNearestLine(float x, float y) {
     float min_distance = _line_selection_threshold + 1; // Initialize beyond threshold
     
     for (int line_idx = 0; line_idx < static_cast<int>(lines.size()); ++line_idx) {
-        const auto& line = lines[line_idx];
+        auto const line = lines[static_cast<size_t>(line_idx)];
         
         if (line.empty()) {
             continue;
@@ -1012,32 +1003,22 @@ void MediaLine_Widget::_moveLineToTarget(const std::string& target_key) {
     }
     
     auto current_time = TimeFrameIndex(_data_manager->getCurrentTime());
-    auto lines = source_line_data->getAtTime(current_time);
+    auto const lines = source_line_data->getLineViewsAtTime(current_time);
     
     if (_selected_line_index >= static_cast<int>(lines.size())) {
         std::cerr << "Selected line index out of bounds" << std::endl;
         return;
     }
     
-    // Get the selected line
-    Line2D selected_line = lines[_selected_line_index];
+    // Copy the selected line out before either LineData changes
+    auto const selected_view = lines[static_cast<size_t>(_selected_line_index)];
+    Line2D selected_line(std::vector<Point2D<float>>(selected_view.begin(), selected_view.end()));
     
     // Add to target
     target_line_data->addAtTime(current_time, selected_line);
     
-    // Remove from source by rebuilding the vector without the selected line
-    std::vector<Line2D> remaining_lines;
-    for (int i = 0; i < static_cast<int>(lines.size()); ++i) {
-        if (i != _selected_line_index) {
-            remaining_lines.push_back(lines[i]);
-        }
-    }
-
-    // Clear and rebuild source lines
-    source_line_data->clearAtTime(TimeFrameIndex(current_time));
-    for (const auto& line : remaining_lines) {
-        source_line_data->addAtTime(current_time, line);
-    }
+    // Remove only the selected line from source; the other lines keep their ids
+    static_cast<void>(source_line_data->clearAtTime(current_time, _selected_line_index));
     
     // Clear selection since the line was moved
     _clearLineSelection();
@@ -1059,7 +1040,7 @@ void MediaLine_Widget::_copyLineToTarget(const std::string& target_key) {
     }
     
     auto current_time = TimeFrameIndex(_data_manager->getCurrentTime());
-    auto lines = source_line_data->getAtTime(current_time);
+    auto const lines = source_line_data->getLineViewsAtTime(current_time);
     
     if (_selected_line_index >= static_cast<int>(lines.size())) {
         std::cerr << "Selected line index out of bounds" << std::endl;
@@ -1067,7 +1048,8 @@ void MediaLine_Widget::_copyLineToTarget(const std::string& target_key) {
     }
     
     // Get the selected line and copy it to target
-    Line2D selected_line = lines[_selected_line_index];
+    auto const selected_view = lines[static_cast<size_t>(_selected_line_index)];
+    Line2D selected_line(std::vector<Point2D<float>>(selected_view.begin(), selected_view.end()));
     target_line_data->addAtTime(current_time, selected_line);
     
     std::cout << "Copied line from " << _active_key << " to " << target_key << std::endl;
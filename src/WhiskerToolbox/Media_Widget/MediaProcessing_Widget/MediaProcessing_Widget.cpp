@@ -20,6 +20,7 @@
 #include <QVBoxLayout>
 #include <QTimer>
 #include <iostream>
+#include <memory>
 
 MediaProcessing_Widget::MediaProcessing_Widget(std::shared_ptr<DataManager> data_manager, Media_Window * scene, QWidget * parent)
     : QWidget(parent),
@@ -437,9 +438,10 @@ void MediaProcessing_Widget::_applyClaheFilter() {
 
     if (_clahe_options.active) {
         // Add or update the CLAHE filter in the processing chain using the options structure
-        media_data->addProcessingStep("4__clahe", [options = _clahe_options](void* input) {
+        media_data->addProcessingStep("4__clahe", [options = _clahe_options,
+                                                  scratch = std::make_shared<ImageProcessing::FilterScratch>()](void* input) {
             cv::Mat* mat = static_cast<cv::Mat*>(input);
-            ImageProcessing::clahe(*mat, options);
+            ImageProcessing::clahe(*mat, options, *scratch);
         });
     } else {
         // Remove the CLAHE filter from the processing chain
@@ -460,9 +462,10 @@ void MediaProcessing_Widget::_applyBilateralFilter() {
 
     if (_bilateral_options.active) {
         // Add or update the bilateral filter in the processing chain using the options structure
-        media_data->addProcessingStep("5__bilateral", [options = _bilateral_options](void* input) {
+        media_data->addProcessingStep("5__bilateral", [options = _bilateral_options,
+                                                      scratch = std::make_shared<ImageProcessing::FilterScratch>()](void* input) {
             cv::Mat* mat = static_cast<cv::Mat*>(input);
-            ImageProcessing::bilateral_filter(*mat, options);
+            ImageProcessing::bilateral_filter(*mat, options, *scratch);
         });
     } else {
         // Remove the bilateral filter from the processing chain
@@ -483,9 +486,10 @@ void MediaProcessing_Widget::_applyMedianFilter() {
 
     if (_median_options.active) {
         // Add or update the median filter in the processing chain using the options structure
-        media_data->addProcessingStep("6__median", [options = _median_options](void* input) {
+        media_data->addProcessingStep("6__median", [options = _median_options,
+                                                   scratch = std::make_shared<ImageProcessing::FilterScratch>()](void* input) {
             cv::Mat* mat = static_cast<cv::Mat*>(input);
-            ImageProcessing::median_filter(*mat, options);
+            ImageProcessing::median_filter(*mat, options, *scratch);
         });
     } else {
         // Remove the median filter from the processing chain
@@ -28,6 +28,8 @@
 #include <QImage>
 #include <QPainter>
 
+#include <array>
+#include <cstdint>
 #include <iostream>
 
 
@@ -342,12 +344,15 @@ void Media_Window::UpdateCanvas() {
     _clearTensors();
     _clearTextOverlays();
 
+    _mask_compositor.resize(_canvasWidth, _canvasHeight);
+    _mask_compositor.clear();
+
     //_convertNewMediaToQImage();
     auto _media = _data_manager->getData<MediaData>("media");
     auto const current_time = _data_manager->getCurrentTime();
-    auto media_data = _media->getProcessedData(current_time);
+    auto const & media_data = _media->getProcessedData(current_time);
 
-    auto unscaled_image = QImage(&media_data[0],
+    auto unscaled_image = QImage(media_data.data(),
                                  _media->getWidth(),
                                  _media->getHeight(),
                                  _getQImageFormat());
@@ -432,9 +437,9 @@ void Media_Window::UpdateCanvas() {
 void Media_Window::_convertNewMediaToQImage() {
     auto _media = _data_manager->getData<MediaData>("media");
     auto const current_time = _data_manager->getCurrentTime();
-    auto media_data = _media->getProcessedData(current_time);
+    auto const & media_data = _media->getProcessedData(current_time);
 
-    auto unscaled_image = QImage(&media_data[0],
+    auto unscaled_image = QImage(media_data.data(),
                                  _media->getWidth(),
                                  _media->getHeight(),
                                  _getQImageFormat());
@@ -615,7 +620,7 @@ void Media_Window::_plotLineData() {
         auto line_timeframe = _data_manager->getTime(line_timeframe_key);
 
         auto line_data = _data_manager->getData<LineData>(line_key);
-        auto lineData = line_data->getAtTime(TimeFrameIndex(current_time), video_timeframe.get(), line_timeframe.get());
+        auto const lineData = line_data->getLineViewsAtTime(TimeFrameIndex(current_time), video_timeframe.get(), line_timeframe.get());
 
         // Check for line-specific image size scaling
         auto image_size = line_data->getImageSize();
@@ -635,7 +640,7 @@ void Media_Window::_plotLineData() {
         }
 
         for (int line_idx = 0; line_idx < static_cast<int>(lineData.size()); ++line_idx) {
-            auto const & single_line = lineData[line_idx];
+            auto const single_line = lineData[static_cast<size_t>(line_idx)];
 
             if (single_line.empty()) {
                 continue;
@@ -645,18 +650,16 @@ void Media_Window::_plotLineData() {
             bool const is_selected = (_line_config.get()->selected_line_index == line_idx);
 
             // Use segment if enabled, otherwise use full line
-            Line2D line_to_plot;
+            Line2D line_to_plot(std::vector<Point2D<float>>(single_line.begin(), single_line.end()));
             if (_line_config.get()->show_segment) {
                 float const start_percentage = static_cast<float>(_line_config.get()->segment_start_percentage) / 100.0f;
                 float const end_percentage = static_cast<float>(_line_config.get()->segment_end_percentage) / 100.0f;
-                line_to_plot = get_segment_between_percentages(single_line, start_percentage, end_percentage);
+                line_to_plot = get_segment_between_percentages(line_to_plot, start_percentage, end_percentage);
 
                 // If segment is empty (invalid percentages), skip this line
                 if (line_to_plot.empty()) {
                     continue;
                 }
-            } else {
-                line_to_plot = single_line;
             }
 
             QPainterPath path = QPainterPath();
@@ -866,6 +869,8 @@ void Media_Window::_plotMaskData() {
             }
         }
     }
+
+    _addMaskCompositePixmap();
 }
 
 void Media_Window::_plotSingleMaskData(std::vector<Mask2D> const & maskData, ImageSize mask_size, QRgb plot_color, MaskDisplayOptions const * mask_config) {
@@ -874,88 +879,56 @@ void Media_Window::_plotSingleMaskData(std::vector<Mask2D> const & maskData, Ima
         return;
     }
 
-    for (auto const & single_mask: maskData) {
-        // Normal mode: overlay mask on top of media
-        QImage unscaled_mask_image(mask_size.width, mask_size.height, QImage::Format::Format_ARGB32);
-        unscaled_mask_image.fill(0);
-
-        for (auto const point: single_mask) {
-            unscaled_mask_image.setPixel(
-                    QPoint(static_cast<int>(point.x), static_cast<int>(point.y)),
-                    plot_color);
-        }
+    // Normal mode: blend into the shared overlay; pixels are mapped to canvas
+    // coordinates so no per-mask image is created or rescaled
+    _mask_compositor.blendMasks(maskData, mask_size, static_cast<uint32_t>(plot_color));
+}
 
-        auto scaled_mask_image = unscaled_mask_image.scaled(_canvasWidth, _canvasHeight);
-        auto maskPixmap = addPixmap(QPixmap::fromImage(scaled_mask_image));
-        _masks.append(maskPixmap);
+void Media_Window::_addMaskCompositePixmap() {
+    if (_mask_compositor.empty()) {
+        return;
     }
-}
 
-QImage Media_Window::_applyTransparencyMasks(QImage const & media_image) {
-    std::cout << "Applying transparency masks..." << std::endl;
+    QImage const overlay(reinterpret_cast<uchar const *>(_mask_compositor.pixels()),
+                         _mask_compositor.width(),
+                         _mask_compositor.height(),
+                         static_cast<qsizetype>(_mask_compositor.width()) * 4,
+                         QImage::Format_ARGB32_Premultiplied);
 
-    std::cout << "Media image size: " << media_image.width() << "x" << media_image.height() << std::endl;
-    std::cout << "Canvas dimensions: " << _canvasWidth << "x" << _canvasHeight << std::endl;
+    auto maskPixmap = addPixmap(QPixmap::fromImage(overlay));
+    _masks.append(maskPixmap);
+}
 
+QImage Media_Window::_applyTransparencyMasks(QImage const & media_image) {
     auto video_timeframe = _data_manager->getTime(TimeKey("time"));
+    auto const current_time = _data_manager->getCurrentTime();
 
-    QImage final_image = media_image;
-
-    int transparency_mask_count = 0;
-    int const total_mask_points = 0;
+    _mask_compositor.resize(media_image.width(), media_image.height());
 
-    // Process all transparency masks
+    // Each transparency mask is one layer; media survives where every layer covers it
     for (auto const & [mask_key, mask_config]: _mask_configs) {
         if (!mask_config->is_visible || !mask_config->use_as_transparency) {
             continue;
         }
 
-        transparency_mask_count++;
-        std::cout << "Processing transparency mask: " << mask_key << std::endl;
-
         auto mask_data = _data_manager->getData<MaskData>(mask_key);
         auto image_size = mask_data->getImageSize();
 
         auto mask_timeframe_key = _data_manager->getTimeKey(mask_key);
         auto mask_timeframe = _data_manager->getTime(mask_timeframe_key);
 
-        std::cout << "Mask image size: " << image_size.width << "x" << image_size.height << std::endl;
-
-        auto const current_time = _data_manager->getCurrentTime();
         auto maskData = mask_data->getAtTime(TimeFrameIndex(current_time), video_timeframe.get(), mask_timeframe.get());
-
-        std::cout << "Mask data size: " << maskData.size() << std::endl;
-
-        // Calculate scaling factors
-        float const xAspect = static_cast<float>(_canvasWidth) / static_cast<float>(image_size.width);
-        float const yAspect = static_cast<float>(_canvasHeight) / static_cast<float>(image_size.height);
-
-        std::cout << "Scaling factors: x=" << xAspect << ", y=" << yAspect << std::endl;
-
-        QImage unscaled_mask_image(image_size.width, image_size.height, QImage::Format::Format_ARGB32);
-        unscaled_mask_image.fill(0);
-        // Add mask points to combined mask
-        for (auto const & single_mask: maskData) {
-            for (auto const point: single_mask) {
-                unscaled_mask_image.setPixel(
-                        QPoint(static_cast<int>(point.x), static_cast<int>(point.y)),
-                        qRgba(255, 255, 255, 255));
-            }
-        }
-
-        QImage const scaled_mask_image = unscaled_mask_image.scaled(_canvasWidth, _canvasHeight);
-        // I want to copy final_image where scaled_mask_image is white, and keep the rest of the image the same
-        for (int y = 0; y < _canvasHeight; ++y) {
-            for (int x = 0; x < _canvasWidth; ++x) {
-                if (scaled_mask_image.pixel(x, y) == qRgba(255, 255, 255, 255)) {
-                    final_image.setPixel(x, y, final_image.pixel(x, y));
-                } else {
-                    final_image.setPixel(x, y, qRgba(0, 0, 0, 255));
-                }
-            }
-        }
+        _mask_compositor.addTransparencyLayer(maskData, image_size);
     }
 
+    QImage final_image = media_image;
+
+    // Opaque black for RGBA images, black for grayscale
+    std::array<uint8_t, 4> const black = {0, 0, 0, 255};
+    _mask_compositor.applyTransparency(final_image.bits(),
+                                       static_cast<size_t>(final_image.bytesPerLine()),
+                                       final_image.depth() / 8,
+                                       black.data());
 
     return final_image;
 }
@@ -1169,10 +1142,10 @@ void Media_Window::_plotDigitalIntervalSeries() {
             if (needs_conversion) {
                 // Convert from video timeframe ("time") to interval series timeframe
                 // 1. Convert video time index to actual time value
-                int const video_time_value = video_timeframe->getTimeAtIndex(TimeFrameIndex(video_time));
+                int64_t const video_time_value = video_timeframe->getTimeAtIndex(TimeFrameIndex(video_time));
 
                 // 2. Convert time value to index in interval series timeframe
-                query_time = interval_timeframe->getIndexAtTime(static_cast<float>(video_time_value)).getValue();
+                query_time = interval_timeframe->getIndexAtTime(static_cast<double>(video_time_value)).getValue();
             }
 
             bool const event_present = interval_series->isEventAtTime(TimeFrameIndex(query_time));
@@ -1231,7 +1204,7 @@ void Media_Window::_plotDigitalIntervalBorders() {
         if (needs_conversion) {
             // Convert current video time to interval timeframe
             auto video_time = video_timeframe->getTimeAtIndex(TimeFrameIndex(current_time));
-            auto interval_index = interval_timeframe->getIndexAtTime(video_time);
+            auto interval_index = interval_timeframe->getIndexAtTime(static_cast<double>(video_time));
             interval_present = interval_series->isEventAtTime(interval_index);
         } else {
             // Direct comparison (no timeframe conversion needed)
@@ -5,6 +5,7 @@
 #include "CoreGeometry/masks.hpp"
 #include "../Media_Widget/DisplayOptions/CoordinateTypes.hpp"
 #include "../Media_Widget/DisplayOptions/DisplayOptions.hpp"
+#include "OverlayCompositor/OverlayCompositor.hpp"
 
 #include <QGraphicsEllipseItem>
 #include <QGraphicsItem>
@@ -178,6 +179,7 @@ private:
     QVector<QGraphicsPathItem *> _line_paths;
     QVector<QGraphicsItem *> _points;
     QVector<QGraphicsPixmapItem *> _masks;
+    OverlayCompositor _mask_compositor;///< All visible masks are blended here and shown as one pixmap
     QVector<QGraphicsRectItem *> _mask_bounding_boxes;
     QVector<QGraphicsPathItem *> _mask_outlines;
     QVector<QGraphicsRectItem *> _intervals;
@@ -220,6 +222,7 @@ private:
     void _clearMaskBoundingBoxes();
     void _clearMaskOutlines();
     void _plotSingleMaskData(std::vector<Mask2D> const & maskData, ImageSize mask_size, QRgb plot_color, MaskDisplayOptions const * mask_config);
+    void _addMaskCompositePixmap();
     QImage _applyTransparencyMasks(QImage const & media_image);
 
     void _plotPointData();
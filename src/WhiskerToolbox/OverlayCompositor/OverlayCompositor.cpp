@@ -0,0 +1,220 @@
+#include "OverlayCompositor.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace {
+
+uint32_t premultiply(uint32_t argb) {
+    uint32_t const a = argb >> 24;
+    auto channel = [a](uint32_t c) { return (c * a + 127) / 255; };
+    return (a << 24) |
+           (channel((argb >> 16) & 0xFF) << 16) |
+           (channel((argb >> 8) & 0xFF) << 8) |
+           channel(argb & 0xFF);
+}
+
+/// Source-over for premultiplied ARGB32
+uint32_t blend_over(uint32_t src, uint32_t dst, uint32_t inverse_alpha) {
+    auto channel = [inverse_alpha](uint32_t s, uint32_t d) {
+        return s + (d * inverse_alpha + 127) / 255;
+    };
+    return (channel(src >> 24, dst >> 24) << 24) |
+           (channel((src >> 16) & 0xFF, (dst >> 16) & 0xFF) << 16) |
+           (channel((src >> 8) & 0xFF, (dst >> 8) & 0xFF) << 8) |
+           channel(src & 0xFF, dst & 0xFF);
+}
+
+}// namespace
+
+OverlayCompositor::OverlayCompositor(int width, int height) {
+    resize(width, height);
+}
+
+void OverlayCompositor::resize(int width, int height) {
+    width = std::max(width, 0);
+    height = std::max(height, 0);
+    if (width == _width && height == _height) {
+        return;
+    }
+
+    _width = width;
+    _height = height;
+    auto const size = static_cast<size_t>(width) * static_cast<size_t>(height);
+    _pixels.assign(size, 0);
+    _coverage.assign(size, 0);
+    _dirty_x0 = _dirty_y0 = _dirty_x1 = _dirty_y1 = 0;
+    _transparency_layers = 0;
+
+    // Cached coordinate maps refer to the old canvas size
+    _x_map = AxisMap{};
+    _y_map = AxisMap{};
+}
+
+void OverlayCompositor::clear() {
+    if (!empty()) {
+        auto const row_length = static_cast<size_t>(_dirty_x1 - _dirty_x0);
+        for (int y = _dirty_y0; y < _dirty_y1; ++y) {
+            auto const offset = static_cast<size_t>(y) * static_cast<size_t>(_width) + static_cast<size_t>(_dirty_x0);
+            std::fill_n(_pixels.begin() + static_cast<std::ptrdiff_t>(offset), row_length, 0u);
+        }
+        _dirty_x0 = _dirty_y0 = _dirty_x1 = _dirty_y1 = 0;
+    }
+
+    if (_transparency_layers > 0) {
+        std::fill(_coverage.begin(), _coverage.end(), uint8_t{0});
+        _transparency_layers = 0;
+    }
+}
+
+void OverlayCompositor::blendMask(Mask2D const & mask, ImageSize mask_size, uint32_t argb) {
+    uint32_t const src = premultiply(argb);
+    uint32_t const inverse_alpha = 255 - (src >> 24);
+
+    // Track the touched region locally and merge it once per mask
+    int min_x = _width;
+    int min_y = _height;
+    int max_x = 0;
+    int max_y = 0;
+
+    _forEachCanvasRect(mask, mask_size, [&](int x0, int y0, int x1, int y1) {
+        for (int y = y0; y < y1; ++y) {
+            uint32_t * row = _pixels.data() + static_cast<size_t>(y) * static_cast<size_t>(_width);
+            for (int x = x0; x < x1; ++x) {
+                row[x] = blend_over(src, row[x], inverse_alpha);
+            }
+        }
+        min_x = std::min(min_x, x0);
+        min_y = std::min(min_y, y0);
+        max_x = std::max(max_x, x1);
+        max_y = std::max(max_y, y1);
+    });
+
+    if (min_x < max_x && min_y < max_y) {
+        _markDirty(min_x, min_y, max_x, max_y);
+    }
+}
+
+void OverlayCompositor::blendMasks(std::vector<Mask2D> const & masks, ImageSize mask_size, uint32_t argb) {
+    for (auto const & mask: masks) {
+        blendMask(mask, mask_size, argb);
+    }
+}
+
+void OverlayCompositor::addTransparencyLayer(std::vector<Mask2D> const & masks, ImageSize mask_size) {
+    if (_transparency_layers == std::numeric_limits<uint8_t>::max()) {
+        return;
+    }
+
+    // Only pixels covered by every previous layer can advance to the next count,
+    // so pixels covered twice within this layer are counted once
+    auto const previous = static_cast<uint8_t>(_transparency_layers);
+    auto const next = static_cast<uint8_t>(_transparency_layers + 1);
+
+    for (auto const & mask: masks) {
+        _forEachCanvasRect(mask, mask_size, [this, previous, next](int x0, int y0, int x1, int y1) {
+            for (int y = y0; y < y1; ++y) {
+                uint8_t * row = _coverage.data() + static_cast<size_t>(y) * static_cast<size_t>(_width);
+                for (int x = x0; x < x1; ++x) {
+                    if (row[x] == previous) {
+                        row[x] = next;
+                    }
+                }
+            }
+        });
+    }
+    ++_transparency_layers;
+}
+
+void OverlayCompositor::applyTransparency(uint8_t * pixels,
+                                          size_t bytes_per_line,
+                                          int bytes_per_pixel,
+                                          uint8_t const * fill) const {
+    if (_transparency_layers == 0 || pixels == nullptr || bytes_per_pixel <= 0) {
+        return;
+    }
+
+    auto const layers = static_cast<uint8_t>(_transparency_layers);
+    auto const pixel_bytes = static_cast<size_t>(bytes_per_pixel);
+
+    for (int y = 0; y < _height; ++y) {
+        uint8_t const * coverage = _coverage.data() + static_cast<size_t>(y) * static_cast<size_t>(_width);
+        uint8_t * row = pixels + static_cast<size_t>(y) * bytes_per_line;
+        for (int x = 0; x < _width; ++x) {
+            if (coverage[x] != layers) {
+                std::memcpy(row + static_cast<size_t>(x) * pixel_bytes, fill, pixel_bytes);
+            }
+        }
+    }
+}
+
+OverlayCompositor::AxisMap const & OverlayCompositor::_xMap(int source_width) {
+    if (_x_map.source_size != source_width || _x_map.canvas_size != _width) {
+        _buildMap(_x_map, source_width, _width);
+    }
+    return _x_map;
+}
+
+OverlayCompositor::AxisMap const & OverlayCompositor::_yMap(int source_height) {
+    if (_y_map.source_size != source_height || _y_map.canvas_size != _height) {
+        _buildMap(_y_map, source_height, _height);
+    }
+    return _y_map;
+}
+
+void OverlayCompositor::_buildMap(AxisMap & map, int source_size, int canvas_size) {
+    map.source_size = source_size;
+    map.canvas_size = canvas_size;
+    map.begin.resize(static_cast<size_t>(source_size) + 1);
+
+    // Canvas pixel c samples source pixel floor((c + 0.5) * S / C), as a
+    // nearest-neighbour rescale does. Source pixel i therefore covers the
+    // canvas pixels c with (2c + 1) * S >= 2 * i * C, up to the next pixel.
+    auto const S = static_cast<int64_t>(source_size);
+    auto const C = static_cast<int64_t>(canvas_size);
+    for (int64_t i = 0; i <= S; ++i) {
+        int64_t const numerator = 2 * i * C - S;
+        int64_t const c = numerator <= 0 ? 0 : (numerator + 2 * S - 1) / (2 * S);
+        map.begin[static_cast<size_t>(i)] = static_cast<int>(std::min(c, C));
+    }
+}
+
+template<typename PixelOp>
+void OverlayCompositor::_forEachCanvasRect(Mask2D const & mask, ImageSize mask_size, PixelOp && op) {
+    if (mask.empty() || mask_size.width <= 0 || mask_size.height <= 0 || _width == 0 || _height == 0) {
+        return;
+    }
+
+    auto const & x_map = _xMap(mask_size.width);
+    auto const & y_map = _yMap(mask_size.height);
+    auto const source_width = static_cast<uint32_t>(mask_size.width);
+    auto const source_height = static_cast<uint32_t>(mask_size.height);
+
+    for (auto const & point: mask) {
+        if (point.x >= source_width || point.y >= source_height) {
+            continue;
+        }
+        int const x0 = x_map.begin[point.x];
+        int const x1 = x_map.begin[point.x + 1];
+        int const y0 = y_map.begin[point.y];
+        int const y1 = y_map.begin[point.y + 1];
+        if (x0 < x1 && y0 < y1) {
+            op(x0, y0, x1, y1);
+        }
+    }
+}
+
+void OverlayCompositor::_markDirty(int x0, int y0, int x1, int y1) {
+    if (empty()) {
+        _dirty_x0 = x0;
+        _dirty_y0 = y0;
+        _dirty_x1 = x1;
+        _dirty_y1 = y1;
+        return;
+    }
+    _dirty_x0 = std::min(_dirty_x0, x0);
+    _dirty_y0 = std::min(_dirty_y0, y0);
+    _dirty_x1 = std::max(_dirty_x1, x1);
+    _dirty_y1 = std::max(_dirty_y1, y1);
+}
@@ -0,0 +1,129 @@
+#ifndef OVERLAY_COMPOSITOR_HPP
+#define OVERLAY_COMPOSITOR_HPP
+
+#include "CoreGeometry/ImageSize.hpp"
+#include "CoreGeometry/masks.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Blends mask overlays into a single canvas-sized RGBA buffer
+ *
+ * The media window used to build one full-frame image per mask, rescale it to
+ * the canvas and add it to the scene as a separate pixmap. The compositor
+ * instead keeps one persistent canvas buffer for every visible overlay:
+ *
+ * - Mask pixels are mapped to canvas coordinates (nearest neighbour, matching
+ *   an image rescale) instead of scaling images, so only the canvas rectangles
+ *   covered by each mask are touched.
+ * - Overlays are blended with source-over into premultiplied ARGB32
+ *   (0xAARRGGBB per pixel). The buffer can be wrapped directly by a
+ *   QImage::Format_ARGB32_Premultiplied image and drawn over the media.
+ * - Clearing only resets the region touched since the last clear.
+ *
+ * Transparency masks are accumulated separately: applyTransparency keeps the
+ * media pixels covered by every transparency layer and blacks out the rest.
+ *
+ * The class is independent of Qt so it can be tested and benchmarked offscreen.
+ */
+class OverlayCompositor {
+public:
+    OverlayCompositor() = default;
+    OverlayCompositor(int width, int height);
+
+    /**
+     * @brief Set the canvas size. Clears the canvas if the size changes.
+     */
+    void resize(int width, int height);
+
+    /**
+     * @brief Remove all overlays and transparency layers
+     */
+    void clear();
+
+    /**
+     * @brief Blend one mask into the canvas
+     *
+     * @param mask Pixels of the mask in mask image coordinates
+     * @param mask_size Size of the image the mask was drawn on
+     * @param argb Color as non-premultiplied 0xAARRGGBB (same layout as QRgb)
+     */
+    void blendMask(Mask2D const & mask, ImageSize mask_size, uint32_t argb);
+
+    /**
+     * @brief Blend every mask of a layer into the canvas
+     */
+    void blendMasks(std::vector<Mask2D> const & masks, ImageSize mask_size, uint32_t argb);
+
+    /**
+     * @brief Add one transparency layer made of the union of @p masks
+     */
+    void addTransparencyLayer(std::vector<Mask2D> const & masks, ImageSize mask_size);
+
+    /**
+     * @brief Black out media pixels that are not covered by every transparency layer
+     *
+     * @param pixels First byte of a canvas-sized image
+     * @param bytes_per_line Row stride of the image in bytes
+     * @param bytes_per_pixel 1 for grayscale, 4 for RGBA
+     * @param fill Bytes written to each pixel outside the layers (bytes_per_pixel of them)
+     */
+    void applyTransparency(uint8_t * pixels,
+                           size_t bytes_per_line,
+                           int bytes_per_pixel,
+                           uint8_t const * fill) const;
+
+    [[nodiscard]] int width() const { return _width; }
+    [[nodiscard]] int height() const { return _height; }
+
+    /**
+     * @brief Premultiplied ARGB32 canvas, width * height pixels in row order
+     */
+    [[nodiscard]] uint32_t const * pixels() const { return _pixels.data(); }
+
+    /**
+     * @brief True if no overlay was blended since the last clear
+     */
+    [[nodiscard]] bool empty() const { return _dirty_x0 >= _dirty_x1; }
+
+    [[nodiscard]] int transparencyLayerCount() const { return _transparency_layers; }
+
+private:
+    /// Canvas span [begin[i], begin[i + 1]) covered by source pixel i along one axis
+    struct AxisMap {
+        int source_size{0};
+        int canvas_size{0};
+        std::vector<int> begin;
+    };
+
+    AxisMap const & _xMap(int source_width);
+    AxisMap const & _yMap(int source_height);
+    static void _buildMap(AxisMap & map, int source_size, int canvas_size);
+
+    template<typename PixelOp>
+    void _forEachCanvasRect(Mask2D const & mask, ImageSize mask_size, PixelOp && op);
+
+    void _markDirty(int x0, int y0, int x1, int y1);
+
+    int _width{0};
+    int _height{0};
+    std::vector<uint32_t> _pixels;
+
+    // Region touched since the last clear, [x0, x1) x [y0, y1)
+    int _dirty_x0{0};
+    int _dirty_y0{0};
+    int _dirty_x1{0};
+    int _dirty_y1{0};
+
+    // Number of transparency layers covering each canvas pixel, counted only
+    // while the pixel is covered by every previous layer
+    std::vector<uint8_t> _coverage;
+    int _transparency_layers{0};
+
+    AxisMap _x_map;
+    AxisMap _y_map;
+};
+
+#endif// OVERLAY_COMPOSITOR_HPP
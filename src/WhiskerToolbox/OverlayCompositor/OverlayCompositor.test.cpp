@@ -0,0 +1,95 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "OverlayCompositor.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+uint32_t pixelAt(OverlayCompositor const & compositor, int x, int y) {
+    return compositor.pixels()[static_cast<size_t>(y) * static_cast<size_t>(compositor.width()) + static_cast<size_t>(x)];
+}
+
+}// namespace
+
+TEST_CASE("OverlayCompositor - Mask pixels are scaled to the canvas", "[OverlayCompositor]") {
+    OverlayCompositor compositor(8, 4);
+    REQUIRE(compositor.empty());
+
+    // A 4x2 mask image doubles in both directions on an 8x4 canvas
+    compositor.blendMask(Mask2D{{1, 1}}, ImageSize{4, 2}, 0xFFFF0000);
+    REQUIRE_FALSE(compositor.empty());
+
+    for (int y = 0; y < 4; ++y) {
+        for (int x = 0; x < 8; ++x) {
+            bool const covered = (x == 2 || x == 3) && (y == 2 || y == 3);
+            REQUIRE(pixelAt(compositor, x, y) == (covered ? 0xFFFF0000u : 0u));
+        }
+    }
+
+    SECTION("Points outside the mask image are ignored") {
+        compositor.clear();
+        compositor.blendMask(Mask2D{{4, 0}, {0, 2}}, ImageSize{4, 2}, 0xFFFF0000);
+        REQUIRE(compositor.empty());
+    }
+
+    SECTION("Downscaled masks sample pixel centers") {
+        compositor.clear();
+        OverlayCompositor small(2, 2);
+        // Canvas pixel 0 samples source pixel 1 of a 4 pixel wide image
+        small.blendMask(Mask2D{{0, 0}}, ImageSize{4, 4}, 0xFFFF0000);
+        REQUIRE(small.empty());
+        small.blendMask(Mask2D{{1, 1}}, ImageSize{4, 4}, 0xFFFF0000);
+        REQUIRE(pixelAt(small, 0, 0) == 0xFFFF0000u);
+    }
+}
+
+TEST_CASE("OverlayCompositor - Translucent overlays blend source-over", "[OverlayCompositor]") {
+    OverlayCompositor compositor(2, 2);
+
+    // 50% red, premultiplied
+    compositor.blendMask(Mask2D{{0, 0}}, ImageSize{2, 2}, 0x80FF0000);
+    REQUIRE(pixelAt(compositor, 0, 0) == 0x80800000u);
+
+    // Opaque blue on top replaces it
+    compositor.blendMask(Mask2D{{0, 0}}, ImageSize{2, 2}, 0xFF0000FF);
+    REQUIRE(pixelAt(compositor, 0, 0) == 0xFF0000FFu);
+
+    // 50% green over 50% red
+    compositor.blendMask(Mask2D{{1, 1}}, ImageSize{2, 2}, 0x80FF0000);
+    compositor.blendMask(Mask2D{{1, 1}}, ImageSize{2, 2}, 0x8000FF00);
+    uint32_t const mixed = pixelAt(compositor, 1, 1);
+    REQUIRE((mixed >> 24) == 0xC0);
+    REQUIRE(((mixed >> 16) & 0xFF) == 0x40);
+    REQUIRE(((mixed >> 8) & 0xFF) == 0x80);
+
+    SECTION("Clear resets only what was drawn") {
+        compositor.clear();
+        REQUIRE(compositor.empty());
+        REQUIRE(pixelAt(compositor, 0, 0) == 0u);
+        REQUIRE(pixelAt(compositor, 1, 1) == 0u);
+    }
+}
+
+TEST_CASE("OverlayCompositor - Transparency layers keep their intersection", "[OverlayCompositor]") {
+    OverlayCompositor compositor(4, 1);
+
+    compositor.addTransparencyLayer({Mask2D{{0, 0}, {1, 0}, {2, 0}}}, ImageSize{4, 1});
+    compositor.addTransparencyLayer({Mask2D{{1, 0}}, Mask2D{{2, 0}, {2, 0}}}, ImageSize{4, 1});
+    REQUIRE(compositor.transparencyLayerCount() == 2);
+
+    std::vector<uint8_t> gray = {10, 20, 30, 40};
+    uint8_t const black = 0;
+    compositor.applyTransparency(gray.data(), gray.size(), 1, &black);
+    std::vector<uint8_t> const expected = {0, 20, 30, 0};
+    REQUIRE(gray == expected);
+
+    SECTION("No layers leaves the media untouched") {
+        compositor.clear();
+        std::vector<uint8_t> untouched = {10, 20, 30, 40};
+        compositor.applyTransparency(untouched.data(), untouched.size(), 1, &black);
+        std::vector<uint8_t> const original = {10, 20, 30, 40};
+        REQUIRE(untouched == original);
+    }
+}
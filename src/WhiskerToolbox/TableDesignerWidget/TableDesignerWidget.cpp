@@ -13,6 +13,7 @@
 #include "DataManager/utils/TableView/computers/EventInIntervalComputer.h"
 #include "DataManager/utils/TableView/computers/IntervalReductionComputer.h"
 #include "DataManager/utils/TableView/core/TableViewBuilder.h"
+#include "DataManager/utils/TableView/export/TableViewExport.h"
 #include "DataManager/utils/TableView/interfaces/IColumnComputer.h"
 #include "DataManager/utils/TableView/interfaces/IRowSelector.h"
 #include "DataManager/utils/TableView/TableRegistry.hpp"
@@ -652,36 +653,15 @@ void TableDesignerWidget::onExportCsv() {
     std::string eol = "\n";
     if (lineEnding.startsWith("CRLF")) eol = "\r\n";
 
-    try {
-        std::ofstream file(filename.toStdString());
-        if (!file.is_open()) {
-            updateBuildStatus("Could not open file for writing", true);
-            return;
-        }
-        file << std::fixed << std::setprecision(precision);
+    TableCsvExportOptions options;
+    options.delimiter = delim;
+    options.line_ending = eol;
+    options.precision = precision;
+    options.include_header = includeHeader;
 
-        auto names = view->getColumnNames();
-        if (includeHeader) {
-            for (size_t i = 0; i < names.size(); ++i) {
-                if (i > 0) file << delim;
-                file << names[i];
-            }
-            file << eol;
-        }
-        size_t rows = view->getRowCount();
-        for (size_t r = 0; r < rows; ++r) {
-            for (size_t c = 0; c < names.size(); ++c) {
-                if (c > 0) file << delim;
-                try {
-                    auto const & vals = view->getColumnValues<double>(names[c].c_str());
-                    if (r < vals.size()) file << vals[r]; else file << "NaN";
-                } catch (...) {
-                    file << "NaN";
-                }
-            }
-            file << eol;
-        }
-        file.close();
+    try {
+        // Streams the table in row blocks so large tables are never fully materialized
+        exportTableToCsv(*view, std::filesystem::path(filename.toStdString()), options);
         updateBuildStatus(QString("Exported CSV: %1").arg(filename));
     } catch (std::exception const & e) {
         updateBuildStatus(QString("Export failed: %1").arg(e.what()), true);
@@ -15,6 +15,7 @@
 #include "qevent.h"
 #include <QElapsedTimer>
 #include <QFileDialog>
+#include <QThread>
 
 //https://stackoverflow.com/questions/72533139/libtorch-errors-when-used-with-qt-opencv-and-point-cloud-library
 #undef slots
@@ -29,6 +30,7 @@
 #include <algorithm>
 #include <iostream>
 #include <string>
+#include <vector>
 
 Line2D & convert_to_Line2D(whisker::Line2D & whisker_line) {
     return reinterpret_cast<Line2D &>(whisker_line);
@@ -63,7 +65,7 @@ Whisker_Widget::Whisker_Widget(std::shared_ptr<DataManager> data_manager,
 
     _janelia_config_widget = new Janelia_Config(_wt);
 
-    dl_model = std::make_unique<dl::SCM>();
+    dl_model = std::make_unique<dl::SCM>(QThread::idealThreadCount());
 
     connect(ui->trace_button, &QPushButton::clicked, this, &Whisker_Widget::_traceButton);
     connect(ui->dl_trace_button, &QPushButton::clicked, this, &Whisker_Widget::_dlTraceButton);
@@ -187,7 +189,26 @@ void Whisker_Widget::_dlTraceButton() {
     auto media = _data_manager->getData<MediaData>("media");
     auto const current_time = _data_manager->getCurrentTime();
 
-    _traceWhiskersDL(media->getProcessedData(current_time), media->getImageSize());
+    if (ui->num_frames_to_trace->value() <= 1) {
+        _traceWhiskersDL(media->getProcessedData(current_time), media->getImageSize());
+        return;
+    }
+
+    auto sam_output = _data_manager->getData<MaskData>("SAM_output");
+    if (!sam_output) {
+        std::cout << "No memory frames added yet" << std::endl;
+        return;
+    }
+
+    int const end_time = std::min(current_time + ui->num_frames_to_trace->value(), media->getTotalFrameCount());
+
+    std::vector<TimeFrameIndex> frames;
+    for (int time = current_time; time < end_time; ++time) {
+        frames.emplace_back(time);
+    }
+
+    // Frames are decoded and segmented one batch at a time
+    dl_model->process_frames(*media, frames, *sam_output);
 }
 
 void Whisker_Widget::_dlAddMemoryButton() {
@@ -210,14 +231,15 @@ void Whisker_Widget::_dlAddMemoryButton() {
         std::cout << "Whisker named " << whisker_name << " does not exist" << std::endl;
         return;
     }
-    auto whisker = _data_manager->getData<LineData>(whisker_name)->getAtTime(TimeFrameIndex(current_time));
+    auto const whiskers = _data_manager->getData<LineData>(whisker_name)->getLineViewsAtTime(TimeFrameIndex(current_time));
 
-    if (whisker.empty()) {
+    if (whiskers.empty()) {
         std::cout << "No whisker available for " << whisker_name << std::endl;
         return;
     }
 
-    auto memory_mask = line_to_image(whisker[0], media->getHeight(), media->getWidth());
+    Line2D whisker(std::vector<Point2D<float>>(whiskers[0].begin(), whiskers[0].end()));
+    auto memory_mask = line_to_image(whisker, media->getHeight(), media->getWidth());
 
     dl_model->add_memory_frame(image, memory_mask);
 
@@ -413,10 +435,10 @@ void order_whiskers_by_position(
         std::string whisker_name = whisker_group_name + "_" + std::to_string(i);
 
         if (dm->getData<LineData>(whisker_name)) {
-            auto whisker = dm->getData<LineData>(whisker_name)->getAtTime(current_time - TimeFrameIndex(1));
+            auto const whisker = dm->getData<LineData>(whisker_name)->getLineViewsAtTime(current_time - TimeFrameIndex(1));
             if (!whisker.empty()) {
                 if (!whisker[0].empty()) {
-                    previous_whiskers[i] = whisker[0];
+                    previous_whiskers[i] = Line2D(std::vector<Point2D<float>>(whisker[0].begin(), whisker[0].end()));
                 }
             }
         }
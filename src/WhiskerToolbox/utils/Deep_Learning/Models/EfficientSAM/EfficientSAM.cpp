@@ -1,13 +1,15 @@
 
 #include "EfficientSAM.hpp"
 
+#include "utils/Deep_Learning/inference_session.hpp"
 #include "utils/Deep_Learning/torch_helpers.hpp"
 #include <torch/torch.h>
 
 namespace dl {
 
 
-EfficientSAM::EfficientSAM()
+EfficientSAM::EfficientSAM(int const intra_op_threads)
+    : _intra_op_threads{intra_op_threads}
 {
     _module_path = "resources/efficient_sam_vitt_torchscript.pt";
 }
@@ -16,30 +18,41 @@ EfficientSAM::~EfficientSAM()= default;
 
 void EfficientSAM::load_model()
 {
-    if (!_module) {
-        _module = dl::load_torchscript_model(_module_path, device);
+    if (!is_loaded()) {
+        _session = std::make_unique<InferenceSession>(_module_path, InferenceSessionOptions{.intra_op_threads = _intra_op_threads});
     }
 }
 
+bool EfficientSAM::is_loaded() const
+{
+    return _session && _session->is_loaded();
+}
+
 std::vector<uint8_t> EfficientSAM::process_frame(
     std::vector<uint8_t> const & image,
     ImageSize const image_size,
     int const x,
     int const y)
 {
+    if (!is_loaded()) {
+        std::cout << "EfficientSAM model is not loaded" << std::endl;
+        return {};
+    }
+
     const int channels = 3;
 
-    auto image_tensor = dl::create_tensor_from_gray8(image, image_size);
-    if (channels > 1) {
-        image_tensor = image_tensor.repeat({1, channels, 1, 1});
-    }
+    c10::InferenceMode const guard;
 
-    image_tensor = image_tensor.to(torch::kFloat32).div(255).to(device);
+    // Convert the gray frame once and broadcast it to three channels
+    auto image_tensor = dl::create_tensor_from_gray8(image, image_size)
+                                .to(_session->device(), torch::kFloat32)
+                                .div_(255)
+                                .expand({1, channels, image_size.height, image_size.width});
 
     auto input_points = torch::tensor({{{{x, y}}}}, torch::kInt32);
     auto input_labels = torch::tensor({{{1}}}, torch::kInt32);
 
-    auto output = _module->forward({image_tensor, input_points, input_labels}).toTuple();
+    auto output = _session->forward({image_tensor, input_points, input_labels}).toTuple();
 
     auto predicted_logits = output->elements()[0].toTensor();
     auto predicted_iou = output->elements()[1].toTensor();
@@ -7,24 +7,27 @@
 #include <string>
 #include <vector>
 
-namespace torch::jit {class Module;}
-
 namespace dl {
 
+class InferenceSession;
+
 class EfficientSAM {
 
 
 public:
-    EfficientSAM();
+    explicit EfficientSAM(int intra_op_threads = 0);
     ~EfficientSAM();
 
     void load_model();
 
+    [[nodiscard]] bool is_loaded() const;
+
     std::vector<uint8_t> process_frame(std::vector<uint8_t> const & image, ImageSize image_size, int x, int y);
 
 private:
-    std::shared_ptr<torch::jit::Module> _module {nullptr};
+    std::unique_ptr<InferenceSession> _session {nullptr};
     std::string _module_path;
+    int _intra_op_threads {0};
 };
 
 
@@ -0,0 +1,32 @@
+#include "inference_session.hpp"
+
+#include "torch_helpers.hpp"
+
+#include <iostream>
+#include <utility>
+
+namespace dl {
+
+InferenceSession::InferenceSession(std::string module_path, InferenceSessionOptions const options)
+    : _module_path(std::move(module_path)) {
+
+    if (options.use_cuda) {
+        _device = get_device();
+    }
+
+    if (options.intra_op_threads > 0) {
+        torch::set_num_threads(options.intra_op_threads);
+    }
+
+    _module = load_torchscript_model(_module_path, _device);
+    if (!_module) {
+        std::cerr << "InferenceSession: could not load " << _module_path << std::endl;
+    }
+}
+
+torch::jit::IValue InferenceSession::forward(std::vector<torch::jit::IValue> inputs) {
+    c10::InferenceMode const guard;
+    return _module->forward(std::move(inputs));
+}
+
+}// namespace dl
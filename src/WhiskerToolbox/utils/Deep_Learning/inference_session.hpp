@@ -0,0 +1,56 @@
+#ifndef INFERENCE_SESSION_HPP
+#define INFERENCE_SESSION_HPP
+
+#include <torch/script.h>
+#include <torch/torch.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace dl {
+
+struct InferenceSessionOptions {
+    int intra_op_threads{0};///< Threads for a single operator on CPU; 0 keeps the libtorch default
+    bool use_cuda{true};    ///< Run on the GPU when CUDA is available
+};
+
+/**
+ * @brief TorchScript module loaded once and kept ready for repeated inference
+ *
+ * The module is loaded, moved to the selected device and put in eval mode when
+ * the session is created. Every forward pass then runs under
+ * c10::InferenceMode, which skips autograd bookkeeping and version counters
+ * entirely. Tensors that are reused across calls (model inputs, memory banks)
+ * should be created by the caller under InferenceMode as well, so they can be
+ * written in place between calls.
+ *
+ * The intra-op thread count is a process-wide libtorch setting; a session
+ * only changes it when @ref InferenceSessionOptions::intra_op_threads is set.
+ */
+class InferenceSession {
+public:
+    explicit InferenceSession(std::string module_path, InferenceSessionOptions options = {});
+
+    [[nodiscard]] bool is_loaded() const { return _module != nullptr; }
+
+    [[nodiscard]] torch::Device device() const { return _device; }
+
+    [[nodiscard]] std::string const & module_path() const { return _module_path; }
+
+    /**
+     * @brief Run the module's forward method
+     *
+     * @pre is_loaded()
+     */
+    torch::jit::IValue forward(std::vector<torch::jit::IValue> inputs);
+
+private:
+    std::string _module_path;
+    torch::Device _device{torch::kCPU};
+    std::shared_ptr<torch::jit::Module> _module{nullptr};
+};
+
+}// namespace dl
+
+#endif// INFERENCE_SESSION_HPP
@@ -2,15 +2,44 @@
 #include "scm.hpp"
 
 #include "CoreGeometry/masks.hpp"
+#include "DataManager/Masks/Mask_Data.hpp"
+#include "DataManager/Media/Media_Data.hpp"
 
+#include "inference_session.hpp"
 #include "torch_helpers.hpp"
 #include <torch/torch.h>
 
-#include <chrono>
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 
 namespace dl {
 
+namespace {
+
+// Side length of the square frames the model takes and returns
+constexpr int64_t model_input_size = 256;
+
+torch::nn::functional::InterpolateFuncOptions model_resize_options()
+{
+    return torch::nn::functional::InterpolateFuncOptions()
+            .size(std::vector<int64_t>({model_input_size, model_input_size}))
+            .mode(torch::kBilinear)
+            .antialias(true)
+            .align_corners(false);
+}
+
+// Wraps a gray8 frame as a [1, 1, H, W] byte tensor without copying it
+torch::Tensor wrap_gray8(std::vector<uint8_t> const & image, ImageSize const image_size)
+{
+    return torch::from_blob(
+            const_cast<uint8_t *>(image.data()),
+            {1, 1, image_size.height, image_size.width},
+            torch::TensorOptions().dtype(torch::kByte).device(torch::kCPU));
+}
+
+}// namespace
+
 struct memory_encoder_tensors {
     torch::Tensor memory_frame_tensor;
     torch::Tensor memory_label_tensor;
@@ -22,7 +51,13 @@ struct memory_encoder_tensors {
         mask_tensor{torch::zeros({0})} {}
 };
 
-SCM::SCM()
+struct scm_batch_tensors {
+    torch::Tensor input;///< [capacity, 3, 256, 256] float frames on the session device
+    size_t capacity{0};
+};
+
+SCM::SCM(int const intra_op_threads)
+    : _intra_op_threads{intra_op_threads}
 {
     //module_path = "resources/efficientvit_pytorch_cuda2.pt";
     module_path = "resources/efficientvit_pytorch_cuda.pt";
@@ -30,24 +65,22 @@ SCM::SCM()
     load_model();
 
     _memory_tensors = std::make_unique<memory_encoder_tensors>();
+    _batch = std::make_unique<scm_batch_tensors>();
 }
 
-// using forward declared unique pointer to memory_encoder_tensors. I need destructor in cpp file.
+// using forward declared unique pointers to the tensor structs. I need destructor in cpp file.
 SCM::~SCM() = default;
 
 void SCM::load_model()
 {
-    if (!module) {
-        module = dl::load_torchscript_model(module_path, device);
+    if (!_session || !_session->is_loaded()) {
+        _session = std::make_unique<InferenceSession>(module_path, InferenceSessionOptions{.intra_op_threads = _intra_op_threads});
     }
 }
 
-torch::Tensor convert_image_vec_to_tensor(std::vector<uint8_t> image, ImageSize image_size, int channels=3, bool smooth=false)
+torch::Tensor convert_image_vec_to_tensor(std::vector<uint8_t> const & image, ImageSize image_size, torch::Device const device, int channels=3, bool smooth=false)
 {
-    auto image_tensor = dl::create_tensor_from_gray8(image, image_size);
-    if (channels > 1) {
-        image_tensor = image_tensor.repeat({1, channels, 1, 1});
-    }
+    auto image_tensor = wrap_gray8(image, image_size);
     if (smooth)
     {
         auto filter_size = 5;
@@ -57,86 +90,182 @@ torch::Tensor convert_image_vec_to_tensor(std::vector<uint8_t> image, ImageSize
         image_tensor = image_tensor.mul(255).to(torch::kByte);
     }
 
-    auto data_input = torch::nn::functional::interpolate(
-        image_tensor,
-        torch::nn::functional::InterpolateFuncOptions().size(std::vector<int64_t>({256,256}))
-            .mode(torch::kBilinear)
-            .antialias(true)
-            .align_corners(false));
-
-    data_input = data_input.to(torch::kFloat32).div(255).contiguous().to(device);
+    // Resize the single gray channel, then broadcast it to the requested channels
+    auto data_input = torch::nn::functional::interpolate(image_tensor, model_resize_options());
+    if (channels > 1) {
+        data_input = data_input.expand({1, channels, model_input_size, model_input_size});
+    }
 
-    return data_input;
+    return data_input.to(device, torch::kFloat32).div_(255).contiguous();
 }
 
 void SCM::_create_memory_tensors()
 {
+    c10::InferenceMode const guard;
+
     auto const image_size = ImageSize{.width=_width, .height=_height};
+    auto const device = _session->device();
 
     auto memory_frame_tensor_list = std::vector<torch::Tensor>(memory_frames + 1);
     auto memory_label_tensor_list = std::vector<torch::Tensor>(memory_frames + 1);
     auto mask_vector = std::vector<float>(memory_frames + 1);
     for (auto & memory_pair : _memory) {
-        memory_frame_tensor_list[memory_pair.first] = convert_image_vec_to_tensor(memory_pair.second.memory_frame, image_size);
+        memory_frame_tensor_list[memory_pair.first] = convert_image_vec_to_tensor(memory_pair.second.memory_frame, image_size, device);
 
-        auto memory_label = convert_image_vec_to_tensor(memory_pair.second.memory_label, image_size, 1, true);
+        auto memory_label = convert_image_vec_to_tensor(memory_pair.second.memory_label, image_size, device, 1, true);
         memory_label = (memory_label > 0.0).to(torch::kFloat32);
             memory_label_tensor_list[memory_pair.first] = memory_label;
         mask_vector[memory_pair.first] = 1.0;
 
     }
 
+    auto const zeros_options = torch::TensorOptions().dtype(torch::kFloat32).device(device);
     for (auto i = 0; i < mask_vector.size(); i ++)
     {
         if (mask_vector[i] == 0.0) {
-            memory_frame_tensor_list[i] = torch::zeros({1, 3, 256, 256},torch::kFloat32).to(device);
-            memory_label_tensor_list[i] = torch::zeros({1, 1, 256, 256}, torch::kFloat32).to(device);
+            memory_frame_tensor_list[i] = torch::zeros({1, 3, model_input_size, model_input_size}, zeros_options);
+            memory_label_tensor_list[i] = torch::zeros({1, 1, model_input_size, model_input_size}, zeros_options);
         }
     }
 
+    // Built once per memory change and kept on the device for every frame
     _memory_tensors->memory_frame_tensor = torch::stack(memory_frame_tensor_list,1);
     _memory_tensors->memory_label_tensor = torch::stack(memory_label_tensor_list,1);
     _memory_tensors->mask_tensor = torch::tensor(mask_vector).unsqueeze(0).to(device);
 
 }
 
-Mask2D SCM::process_frame(std::vector<uint8_t>& image, ImageSize const image_size) {
+void SCM::_prepare_batch(size_t const batch_size)
+{
+    if (_batch->capacity >= batch_size && _batch->input.device() == _session->device()) {
+        return;
+    }
+
+    _batch->input = torch::empty(
+            {static_cast<int64_t>(batch_size), 3, model_input_size, model_input_size},
+            torch::TensorOptions().dtype(torch::kFloat32).device(_session->device()));
+    _batch->capacity = batch_size;
+}
+
+void SCM::_copy_frame_to_batch(std::vector<uint8_t> const & image, ImageSize const image_size, size_t const slot)
+{
+    // Resize the gray frame once and let the copy broadcast it to three
+    // channels and convert it to float in the same pass
+    auto const resized = torch::nn::functional::interpolate(wrap_gray8(image, image_size), model_resize_options());
+    _batch->input[static_cast<int64_t>(slot)].copy_(resized[0].expand({3, model_input_size, model_input_size}));
+}
+
+std::vector<Mask2D> SCM::_run_batch(size_t const frame_count)
+{
+    auto const count = static_cast<int64_t>(frame_count);
+
+    auto input = _batch->input.narrow(0, 0, count);
+    input.div_(255);
+
+    auto output = _session->forward(
+                            {input,
+                             _memory_tensors->memory_frame_tensor.expand({count, -1, -1, -1, -1}),
+                             _memory_tensors->memory_label_tensor.expand({count, -1, -1, -1, -1}),
+                             _memory_tensors->mask_tensor.expand({count, -1})}).toTensor();
 
-    device = dl::get_device();
+    output = output.mul(255).clamp(0,255).to(torch::kU8).to(torch::kCPU).contiguous();
 
-    if (!module) {
-        module = dl::load_torchscript_model("/home/wanglab/Desktop/efficientvit_pytorch_cuda3.pt", device);
+    auto const pixels = static_cast<size_t>(model_input_size * model_input_size);
+    auto const * data = output.data_ptr<uint8_t>();
+
+    std::vector<Mask2D> masks;
+    masks.reserve(frame_count);
+    std::vector<uint8_t> frame_output(pixels);
+    for (size_t i = 0; i < frame_count; ++i) {
+        std::copy_n(data + i * pixels, pixels, frame_output.begin());
+        masks.push_back(extract_line_pixels(frame_output, {.width=static_cast<int>(model_input_size), .height=static_cast<int>(model_input_size)}));
+    }
+    return masks;
+}
+
+Mask2D SCM::process_frame(std::vector<uint8_t> const & image, ImageSize const image_size) {
+
+    auto masks = process_frames(std::span<std::vector<uint8_t> const>(&image, 1), image_size, 1);
+    if (masks.empty()) {
+        return std::vector<Point2D<uint32_t>>{};
     }
+    return std::move(masks[0]);
+}
 
-    module->to(device);
+std::vector<Mask2D> SCM::process_frames(std::span<std::vector<uint8_t> const> images, ImageSize const image_size, size_t batch_size)
+{
+    if (!_session || !_session->is_loaded()) {
+        std::cout << "Model is not loaded" << std::endl;
+        return {};
+    }
 
     if (_memory.empty())
     {
         std::cout << "Currently no frames in memory. Please select some" << std::endl;
-        return std::vector<Point2D<uint32_t>>{};
+        return {};
     }
 
-    auto image_tensor = convert_image_vec_to_tensor(image, image_size);
+    if (images.empty()) {
+        return {};
+    }
 
-    //data_input = data_input.repeat({100, 1, 1, 1});
+    c10::InferenceMode const guard;
 
-    torch::NoGradGuard const no_grad;
+    batch_size = std::clamp<size_t>(batch_size, 1, images.size());
+    _prepare_batch(batch_size);
 
-    //torch::jit::setGraphExecutorOptimize(false);
-    auto output = module->forward(
-                            {image_tensor,
-                             _memory_tensors->memory_frame_tensor.to(device),
-                             _memory_tensors->memory_label_tensor.to(device),
-                             _memory_tensors->mask_tensor.to(device)}).toTensor();
+    std::vector<Mask2D> masks;
+    masks.reserve(images.size());
+    for (size_t start = 0; start < images.size(); start += batch_size) {
+        size_t const n = std::min(batch_size, images.size() - start);
+        for (size_t i = 0; i < n; ++i) {
+            _copy_frame_to_batch(images[start + i], image_size, i);
+        }
+        auto batch_masks = _run_batch(n);
+        std::move(batch_masks.begin(), batch_masks.end(), std::back_inserter(masks));
+    }
 
-    output = output.mul(255).clamp(0,255).to(torch::kU8).detach().to(torch::kCPU);
-    std::vector<uint8_t> const vec(output.data_ptr<uint8_t>(), output.data_ptr<uint8_t>() + output.numel());
+    return masks;
+}
 
-    auto mask = extract_line_pixels(vec, {.width=256, .height=256});
-    //auto output_line = convert_mask_to_line(vec, {_x, _y});
+void SCM::process_frames(MediaData & media, std::span<TimeFrameIndex const> frames, MaskData & output, size_t batch_size)
+{
+    if (!_session || !_session->is_loaded()) {
+        std::cout << "Model is not loaded" << std::endl;
+        return;
+    }
 
-    return mask;
+    if (_memory.empty())
+    {
+        std::cout << "Currently no frames in memory. Please select some" << std::endl;
+        return;
+    }
+
+    if (frames.empty()) {
+        return;
+    }
+
+    c10::InferenceMode const guard;
+
+    auto const image_size = media.getImageSize();
+    batch_size = std::clamp<size_t>(batch_size, 1, frames.size());
+    _prepare_batch(batch_size);
 
+    for (size_t start = 0; start < frames.size(); start += batch_size) {
+        size_t const n = std::min(batch_size, frames.size() - start);
+        // The media buffer is reused by the next read, so each frame is copied into its slot right away
+        for (size_t i = 0; i < n; ++i) {
+            auto const frame_number = static_cast<int>(frames[start + i].getValue());
+            _copy_frame_to_batch(media.getProcessedData(frame_number), image_size, i);
+        }
+
+        auto masks = _run_batch(n);
+        for (size_t i = 0; i < n; ++i) {
+            output.addAtTime(frames[start + i], std::move(masks[i]), false);
+        }
+    }
+
+    output.notifyObservers();
 }
 
 void SCM::add_memory_frame(std::vector<uint8_t> memory_frame, std::vector<uint8_t> memory_label)
@@ -161,6 +290,11 @@ void SCM::add_memory_frame(std::vector<uint8_t> memory_frame, std::vector<uint8_
         _memory[key_index] = memory_frame_pair{memory_frame, memory_label};
     }
 
+    if (!_session || !_session->is_loaded()) {
+        std::cout << "Model is not loaded" << std::endl;
+        return;
+    }
+
     _create_memory_tensors();
 
     std::cout << "memory frame added at " << key_index << std::endl;
@@ -5,29 +5,70 @@
 #include "CoreGeometry/ImageSize.hpp"
 #include "CoreGeometry/masks.hpp"
 #include "CoreGeometry/points.hpp"
+#include "TimeFrame/TimeFrame.hpp"
 
 #include <map>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
-namespace torch::jit {class Module;}
+class MaskData;
+class MediaData;
 
 namespace dl {
 
+class InferenceSession;
 struct memory_encoder_tensors;
+struct scm_batch_tensors;
 
 struct memory_frame_pair {
     std::vector<uint8_t> memory_frame;
     std::vector<uint8_t> memory_label;
 };
 
+/**
+ * @brief Whisker segmentation with a memory of labeled frames
+ *
+ * The model is loaded once into an InferenceSession when the SCM is created.
+ * The memory frames and labels are encoded onto the session device when a
+ * memory frame is added and stay there; frames are then processed in batches
+ * through a preallocated input tensor.
+ *
+ * @p intra_op_threads is forwarded to InferenceSessionOptions; 0 keeps the
+ * libtorch default.
+ */
 class SCM {
 public:
-    SCM();
+    static constexpr size_t default_batch_size = 8;
+
+    explicit SCM(int intra_op_threads = 0);
     ~SCM();
     void load_model();
-    Mask2D process_frame(std::vector<uint8_t>& image, ImageSize image_size);
+    Mask2D process_frame(std::vector<uint8_t> const & image, ImageSize image_size);
+
+    /**
+     * @brief Segment several frames of the same size in one forward pass per batch
+     *
+     * @param images Gray8 frames of @p image_size
+     * @return One mask per frame, in the model's 256 x 256 output space
+     */
+    std::vector<Mask2D> process_frames(std::span<std::vector<uint8_t> const> images,
+                                       ImageSize image_size,
+                                       size_t batch_size = default_batch_size);
+
+    /**
+     * @brief Segment frames of a media source and stream the masks into @p output
+     *
+     * Frames are read from @p media one batch at a time, so only one batch of
+     * decoded frames is ever held. Observers of @p output are notified once,
+     * after the last batch.
+     */
+    void process_frames(MediaData & media,
+                        std::span<TimeFrameIndex const> frames,
+                        MaskData & output,
+                        size_t batch_size = default_batch_size);
+
     void add_memory_frame(std::vector<uint8_t> memory_frame, std::vector<uint8_t> memory_label);
     void add_origin(float x, float y) {
         _x = x / static_cast<float>(_width) * 256;
@@ -37,10 +78,15 @@ public:
 
 private:
     void _create_memory_tensors();
+    void _prepare_batch(size_t batch_size);
+    void _copy_frame_to_batch(std::vector<uint8_t> const & image, ImageSize image_size, size_t slot);
+    std::vector<Mask2D> _run_batch(size_t frame_count);
 
-    std::shared_ptr<torch::jit::Module> module {nullptr};
+    std::unique_ptr<InferenceSession> _session {nullptr};
     std::unique_ptr<memory_encoder_tensors> _memory_tensors {nullptr};
+    std::unique_ptr<scm_batch_tensors> _batch {nullptr};
     std::string module_path;
+    int _intra_op_threads {0};
     std::map<int, memory_frame_pair> _memory;
     int memory_frames {4};
     float _x {0};
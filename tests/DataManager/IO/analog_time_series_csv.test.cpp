@@ -255,6 +255,78 @@ TEST_CASE_METHOD(AnalogTimeSeriesCSVTestFixture, "DM - AnalogTimeSeries - CSV lo
         std::filesystem::remove(json_filepath);
     }
     
+    SECTION("Load several CSV files with a clock defined later in the config") {
+        REQUIRE(saveCSVAnalogData());
+
+        // uint16_length clock with one timestamp per sample, listed after the data that uses it
+        std::filesystem::path clock_filepath = test_dir / "clock.bin";
+        {
+            std::ofstream clock_file(clock_filepath, std::ios::binary);
+            std::vector<uint16_t> samples(100, 0);
+            clock_file.write(reinterpret_cast<char const *>(samples.data()),
+                             static_cast<std::streamsize>(samples.size() * sizeof(uint16_t)));
+        }
+
+        std::string json_config = "[";
+        for (int i = 0; i < 4; ++i) {
+            json_config += R"({
+    "data_type": "analog",
+    "name": "multi_csv_analog_)" + std::to_string(i) + R"(",
+    "filepath": ")" + csv_filepath.string() + R"(",
+    "format": "csv",
+    "delimiter": ",",
+    "has_header": true,
+    "single_column_format": false,
+    "time_column": 0,
+    "data_column": 1,
+    "clock": "test_clock"
+},)";
+        }
+        json_config += R"({
+    "data_type": "time",
+    "name": "test_clock",
+    "filepath": ")" + clock_filepath.string() + R"(",
+    "format": "uint16_length"
+}])";
+
+        std::filesystem::path json_filepath = test_dir / "config_multi.json";
+        {
+            std::ofstream json_file(json_filepath);
+            REQUIRE(json_file.is_open());
+            json_file << json_config;
+        }
+
+        auto data_manager = std::make_unique<DataManager>();
+        auto data_info_list = load_data_from_json_config(data_manager.get(), json_filepath.string());
+
+        // The clock is committed first, then each analog channel in config order
+        REQUIRE(data_info_list.size() == 5);
+        REQUIRE(data_info_list[0].key == "test_clock");
+        REQUIRE(data_info_list[0].data_class == "TimeFrame");
+        for (int i = 0; i < 4; ++i) {
+            auto const & info = data_info_list[static_cast<size_t>(i) + 1];
+            REQUIRE(info.key == "multi_csv_analog_" + std::to_string(i) + "_0");
+            REQUIRE(info.data_class == "AnalogTimeSeries");
+            REQUIRE(info.error.empty());
+            REQUIRE(info.load_time_ms > 0.0);
+        }
+
+        auto clock = data_manager->getTime(TimeKey("test_clock"));
+        REQUIRE(clock != nullptr);
+        REQUIRE(clock->getTotalFrameCount() == 100);
+
+        for (int i = 0; i < 4; ++i) {
+            std::string const key = "multi_csv_analog_" + std::to_string(i) + "_0";
+            auto loaded_analog_data = data_manager->getData<AnalogTimeSeries>(key);
+            REQUIRE(loaded_analog_data != nullptr);
+            verifyAnalogDataEquality(*loaded_analog_data);
+            REQUIRE(data_manager->getTimeKey(key).str() == "test_clock");
+        }
+
+        std::filesystem::remove(clock_filepath);
+        std::filesystem::remove(json_filepath);
+    }
+
     SECTION("Test legacy CSV loader function") {
         // Create a simple single column CSV file
         std::filesystem::path legacy_filepath = test_dir / "legacy.csv";
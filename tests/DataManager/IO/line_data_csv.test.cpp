@@ -128,8 +128,12 @@ protected:
     }
     
     void verifyLineDataEquality(const LineData& loaded_data) const {
-        // Get times with data from both original and loaded
-        auto original_times = original_line_data->getTimesWithData();
+        verifyLineDataEquality(*original_line_data, loaded_data);
+    }
+
+    static void verifyLineDataEquality(const LineData& expected_data, const LineData& loaded_data) {
+        // Get times with data from both expected and loaded
+        auto original_times = expected_data.getTimesWithData();
         auto loaded_times = loaded_data.getTimesWithData();
         
         // Convert to vectors for easier comparison
@@ -147,7 +151,7 @@ protected:
             REQUIRE(original_times_vec[i] == loaded_times_vec[i]);
             
             TimeFrameIndex time = original_times_vec[i];
-            const auto& original_lines = original_line_data->getAtTime(time);
+            const auto& original_lines = expected_data.getAtTime(time);
             const auto& loaded_lines = loaded_data.getAtTime(time);
             
             REQUIRE(original_lines.size() == loaded_lines.size());
@@ -241,6 +245,8 @@ TEST_CASE_METHOD(LineDataCSVTestFixture, "DM - LineData - CSV load through DataM
         REQUIRE(info.key == "test_csv_lines");
         REQUIRE(info.data_class == "LineData");
         REQUIRE(info.color == "#00FF00");
+        REQUIRE(info.load_time_ms >= 0.0);
+        REQUIRE(info.error.empty());
         
         // Get the loaded LineData and verify its contents
         auto loaded_line_data = data_manager->getData<LineData>("test_csv_lines");
@@ -252,6 +258,75 @@ TEST_CASE_METHOD(LineDataCSVTestFixture, "DM - LineData - CSV load through DataM
         std::filesystem::remove(json_filepath);
     }
     
+    SECTION("Concurrent config load matches the serial loader and reports failures") {
+        REQUIRE(saveCSVLineData());
+
+        // A file whose frame column cannot be parsed makes its decode throw
+        std::filesystem::path broken_filepath = test_dir / "broken_lines.csv";
+        {
+            std::ofstream broken_file(broken_filepath);
+            broken_file << "Frame,X,Y\nnot_a_frame,\"1.0,2.0\",\"3.0,4.0\"\n";
+        }
+
+        auto line_entry = [](std::string const & name, std::filesystem::path const & path) {
+            return R"({
+    "data_type": "line",
+    "name": ")" + name + R"(",
+    "filepath": ")" + path.string() + R"(",
+    "format": "csv",
+    "delimiter": ",",
+    "coordinate_delimiter": ",",
+    "has_header": true,
+    "header_identifier": "Frame"
+})";
+        };
+
+        std::string json_config = "[";
+        for (int i = 0; i < 4; ++i) {
+            json_config += line_entry("concurrent_lines_" + std::to_string(i), csv_filepath) + ",";
+        }
+        json_config += line_entry("broken_lines", broken_filepath) + "]";
+
+        std::filesystem::path json_filepath = test_dir / "config_concurrent.json";
+        {
+            std::ofstream json_file(json_filepath);
+            REQUIRE(json_file.is_open());
+            json_file << json_config;
+        }
+
+        auto data_manager = std::make_unique<DataManager>();
+        auto data_info_list = load_data_from_json_config(data_manager.get(), json_filepath.string());
+
+        // The same file read directly on this thread
+        CSVSingleFileLineLoaderOptions load_opts;
+        load_opts.filepath = csv_filepath.string();
+        load_opts.delimiter = ",";
+        load_opts.coordinate_delimiter = ",";
+        load_opts.has_header = true;
+        load_opts.header_identifier = "Frame";
+        LineData const serial_line_data(load(load_opts));
+
+        // Every entry is reported, in config order
+        REQUIRE(data_info_list.size() == 5);
+        for (int i = 0; i < 4; ++i) {
+            auto const key = "concurrent_lines_" + std::to_string(i);
+            REQUIRE(data_info_list[static_cast<size_t>(i)].key == key);
+            REQUIRE(data_info_list[static_cast<size_t>(i)].error.empty());
+
+            auto loaded_line_data = data_manager->getData<LineData>(key);
+            REQUIRE(loaded_line_data != nullptr);
+            verifyLineDataEquality(serial_line_data, *loaded_line_data);
+        }
+
+        REQUIRE(data_info_list[4].key == "broken_lines");
+        REQUIRE(data_info_list[4].data_class == "LineData");
+        REQUIRE_FALSE(data_info_list[4].error.empty());
+        REQUIRE(data_manager->getData<LineData>("broken_lines") == nullptr);
+
+        std::filesystem::remove(broken_filepath);
+        std::filesystem::remove(json_filepath);
+    }
+
     SECTION("DataManager handles missing CSV file gracefully") {
         // Create JSON config pointing to non-existent file
         std::filesystem::path fake_filepath = test_dir / "nonexistent.csv";
@@ -0,0 +1,171 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "CoreGeometry/masks.hpp"
+#include "IO/HDF5/Mask_Data_HDF5.hpp"
+#include "IO/HDF5/hdf5_loaders.hpp"
+#include "IO/HDF5/hdf5_utilities.hpp"
+#include "Masks/Mask_Data.hpp"
+
+#include <H5Cpp.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+
+// More rows than one parallel decode task takes, so the masks are split across workers
+constexpr std::size_t test_row_count = 2500;
+
+/**
+ * @brief Writes frames plus ragged x/y coordinates the way the tracking exports store masks
+ *
+ * Row i has i % 5 points, so every fifth row is empty, and frame i is stored as 2 * i.
+ */
+class MaskDataHDF5TestFixture {
+public:
+    MaskDataHDF5TestFixture() {
+        test_dir = std::filesystem::current_path() / "test_hdf5_mask_output";
+        std::filesystem::create_directories(test_dir);
+        hdf5_filepath = test_dir / "test_masks.h5";
+
+        for (std::size_t i = 0; i < test_row_count; ++i) {
+            frames.push_back(static_cast<int>(2 * i));
+            std::vector<float> x_row;
+            std::vector<float> y_row;
+            for (std::size_t p = 0; p < i % 5; ++p) {
+                x_row.push_back(static_cast<float>(i % 640) + static_cast<float>(p) + 0.25f);
+                y_row.push_back(static_cast<float>(i % 480) + 2.0f * static_cast<float>(p) + 0.75f);
+            }
+            x_rows.push_back(std::move(x_row));
+            y_rows.push_back(std::move(y_row));
+        }
+
+        writeFile();
+    }
+
+    ~MaskDataHDF5TestFixture() {
+        std::filesystem::remove_all(test_dir);
+    }
+
+protected:
+    void writeFile() const {
+        H5::H5File file(hdf5_filepath.string(), H5F_ACC_TRUNC);
+        hsize_t const dims[1] = {test_row_count};
+        H5::DataSpace const space(1, dims);
+
+        auto frames_dataset = file.createDataSet("frames", H5::PredType::NATIVE_INT32, space);
+        frames_dataset.write(frames.data(), H5::PredType::NATIVE_INT32);
+
+        H5::VarLenType const varlen_type(H5::PredType::NATIVE_FLOAT);
+        for (auto const & [key, rows]: {std::pair{"x", &x_rows}, std::pair{"y", &y_rows}}) {
+            std::vector<hvl_t> varlen_specs(rows->size());
+            for (std::size_t i = 0; i < rows->size(); ++i) {
+                varlen_specs[i].len = (*rows)[i].size();
+                varlen_specs[i].p = const_cast<float *>((*rows)[i].data());
+            }
+            auto dataset = file.createDataSet(key, varlen_type, space);
+            dataset.write(varlen_specs.data(), varlen_type);
+        }
+        file.close();
+    }
+
+    std::filesystem::path test_dir;
+    std::filesystem::path hdf5_filepath;
+    std::vector<int> frames;
+    std::vector<std::vector<float>> x_rows;
+    std::vector<std::vector<float>> y_rows;
+};
+
+void requireSameRows(std::vector<float> const & values,
+                     std::vector<std::size_t> const & offsets,
+                     std::vector<std::vector<float>> const & expected) {
+    REQUIRE(offsets.size() == expected.size() + 1);
+    REQUIRE(offsets.front() == 0);
+    REQUIRE(offsets.back() == values.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        REQUIRE(std::vector<float>(values.begin() + static_cast<std::ptrdiff_t>(offsets[i]),
+                                   values.begin() + static_cast<std::ptrdiff_t>(offsets[i + 1])) == expected[i]);
+    }
+}
+
+}// namespace
+
+TEST_CASE_METHOD(MaskDataHDF5TestFixture, "DM - HDF5 - flat ragged read matches the per-row read", "[HDF5][IO][Mask]") {
+    H5::H5File file(hdf5_filepath.string(), H5F_ACC_RDONLY);
+    H5::DataSet dataset = file.openDataSet("x");
+
+    auto const per_row = hdf5::load_ragged_array<float>(dataset);
+    REQUIRE(per_row == x_rows);
+
+    SECTION("One row per chunk") {
+        std::vector<float> values;
+        std::vector<std::size_t> offsets;
+        hdf5::load_ragged_array_flat<float>(dataset, values, offsets, 1);
+        requireSameRows(values, offsets, per_row);
+    }
+
+    SECTION("Three rows per chunk, with a partial last chunk") {
+        REQUIRE(test_row_count % 3 != 0);
+        std::vector<float> values;
+        std::vector<std::size_t> offsets;
+        hdf5::load_ragged_array_flat<float>(dataset, values, offsets, 3);
+        requireSameRows(values, offsets, per_row);
+    }
+
+    SECTION("Empty rows keep their place") {
+        std::vector<float> values;
+        std::vector<std::size_t> offsets;
+        hdf5::load_ragged_array_flat<float>(dataset, values, offsets, 3);
+        REQUIRE(offsets[1] == offsets[0]);
+        REQUIRE(offsets[6] == offsets[5]);
+        REQUIRE(offsets[7] - offsets[6] == 1);
+    }
+}
+
+TEST_CASE_METHOD(MaskDataHDF5TestFixture, "DM - HDF5 - read_ragged_hdf5_flat matches read_ragged_hdf5", "[HDF5][IO][Mask]") {
+    auto const flat = Loader::read_ragged_hdf5_flat({hdf5_filepath.string(), "y"});
+    auto const per_row = Loader::read_ragged_hdf5({hdf5_filepath.string(), "y"});
+
+    REQUIRE(flat.rows() == per_row.size());
+    for (std::size_t i = 0; i < per_row.size(); ++i) {
+        auto const row = flat.row(i);
+        REQUIRE(std::vector<float>(row.begin(), row.end()) == per_row[i]);
+    }
+}
+
+TEST_CASE_METHOD(MaskDataHDF5TestFixture, "DM - HDF5 - parallel mask decode matches serial decode", "[HDF5][IO][Mask]") {
+    HDF5MaskLoaderOptions opts;
+    opts.filename = hdf5_filepath.string();
+    opts.frame_key = "frames";
+    opts.x_key = "x";
+    opts.y_key = "y";
+
+    auto const loaded = load(opts);
+    REQUIRE(loaded != nullptr);
+
+    // The same rows decoded and inserted one at a time
+    MaskData expected;
+    for (std::size_t i = 0; i < test_row_count; ++i) {
+        expected.addAtTime(TimeFrameIndex(frames[i]),
+                           create_mask(std::span<float const>(x_rows[i]), std::span<float const>(y_rows[i])),
+                           false);
+    }
+
+    for (std::size_t i = 0; i < test_row_count; ++i) {
+        auto const time = TimeFrameIndex(frames[i]);
+        auto const & loaded_masks = loaded->getAtTime(time);
+        auto const & expected_masks = expected.getAtTime(time);
+
+        REQUIRE(loaded_masks.size() == expected_masks.size());
+        for (std::size_t m = 0; m < expected_masks.size(); ++m) {
+            REQUIRE(loaded_masks[m].size() == expected_masks[m].size());
+            for (std::size_t p = 0; p < expected_masks[m].size(); ++p) {
+                REQUIRE(loaded_masks[m][p].x == expected_masks[m][p].x);
+                REQUIRE(loaded_masks[m][p].y == expected_masks[m][p].y);
+            }
+        }
+    }
+}
@@ -8,8 +8,10 @@
 #include "DigitalTimeSeries/Digital_Interval_Series.hpp"
 
 #include <memory>
+#include <numeric>
 #include <vector>
 #include <random>
+#include <stdexcept>
 
 TEST_CASE("Multi-TimeFrame Integration Tests", "[integration][timeframe]") {
     
@@ -284,4 +286,129 @@ TEST_CASE("Multi-TimeFrame Integration Tests", "[integration][timeframe]") {
         REQUIRE_THAT(neural_during_behavior.front(), 
                     Catch::Matchers::WithinAbs(neural_signal[3000], 0.1f));
     }
-}
\ No newline at end of file
+}
+TEST_CASE("TimeFrame - Implicit clock representation", "[timeframe][implicit]") {
+
+    SECTION("Regular clocks are stored implicitly") {
+        std::vector<int> times(1000);
+        for (int i = 0; i < 1000; ++i) {
+            times[static_cast<size_t>(i)] = 5 + i * 3;
+        }
+        TimeFrame const explicit_input(times);
+
+        REQUIRE(explicit_input.isImplicit());
+        REQUIRE(explicit_input.getTotalFrameCount() == 1000);
+        REQUIRE(explicit_input.getTimeAtIndex(TimeFrameIndex(10)) == 35);
+        REQUIRE(explicit_input.getIndexAtTime(35.0) == TimeFrameIndex(10));
+        REQUIRE(explicit_input.getIndexAtTime(36.0) == TimeFrameIndex(10));
+        REQUIRE(explicit_input.getIndexAtTime(37.0) == TimeFrameIndex(11));
+        REQUIRE(explicit_input.getIndexAtTime(36.0, false) == TimeFrameIndex(11));
+        REQUIRE(explicit_input.getIndexAtTime(-100.0) == TimeFrameIndex(0));
+        REQUIRE(explicit_input.getIndexAtTime(1.0e9) == TimeFrameIndex(999));
+    }
+
+    SECTION("Irregular clocks keep explicit times") {
+        std::vector<int> const times = {0, 1, 4, 9, 16, 25, 36};
+        TimeFrame const irregular(times);
+
+        REQUIRE_FALSE(irregular.isImplicit());
+        REQUIRE(irregular.getTimeAtIndex(TimeFrameIndex(4)) == 16);
+        REQUIRE(irregular.getIndexAtTime(20.0) == TimeFrameIndex(4));
+    }
+
+    SECTION("Piecewise-affine clock with a resync after dropped samples") {
+        // 30 kHz-style clock at period 1 that skips 50 ticks after index 1000
+        std::vector<AffineClockSegment> segments = {{0, 0, 1}, {1000, 1050, 1}};
+        TimeFrame const clock(segments, 2000);
+
+        REQUIRE(clock.isImplicit());
+        REQUIRE(clock.getTimeAtIndex(TimeFrameIndex(999)) == 999);
+        REQUIRE(clock.getTimeAtIndex(TimeFrameIndex(1000)) == 1050);
+        REQUIRE(clock.getTimeAtIndex(TimeFrameIndex(1999)) == 2049);
+
+        REQUIRE(clock.getIndexAtTime(1050.0) == TimeFrameIndex(1000));
+        REQUIRE(clock.getIndexAtTime(1010.0) == TimeFrameIndex(999));
+        REQUIRE(clock.getIndexAtTime(1040.0) == TimeFrameIndex(1000));
+        REQUIRE(clock.getIndexAtTime(1010.0, false) == TimeFrameIndex(1000));
+
+        // Explicit times with the same shape compress to the same segments
+        std::vector<int64_t> times;
+        for (int64_t i = 0; i < 2000; ++i) {
+            times.push_back(i < 1000 ? i : i + 50);
+        }
+        TimeFrame const from_vector(times);
+        REQUIRE(from_vector.getSegments() == segments);
+    }
+
+    SECTION("Sessions longer than the int range") {
+        // Two hours at 30 kHz, then stretched well beyond 2^31 ticks
+        int64_t const frame_count = int64_t{216000000} * 20;
+        auto clock = TimeFrame::createRegular(frame_count, 0, 1);
+
+        REQUIRE(clock->getFrameCount() == frame_count);
+        REQUIRE(clock->getTimeAtIndex(TimeFrameIndex(4000000000)) == 4000000000);
+        REQUIRE(clock->getIndexAtTime(4000000000.0) == TimeFrameIndex(4000000000));
+    }
+
+    SECTION("Invalid segments are rejected") {
+        REQUIRE_THROWS_AS(TimeFrame(std::vector<AffineClockSegment>{{1, 0, 1}}, 10), std::invalid_argument);
+        REQUIRE_THROWS_AS(TimeFrame(std::vector<AffineClockSegment>{{0, 0, 0}}, 10), std::invalid_argument);
+        REQUIRE_THROWS_AS(TimeFrame(std::vector<AffineClockSegment>{{0, 0, 1}, {5, 2, 1}}, 10), std::invalid_argument);
+    }
+}
+
+TEST_CASE("TimeFrame - Batched index conversion", "[timeframe][conversion]") {
+    // Master clock ticks every 1, camera every 300 starting at 1 (as in the integration tests above)
+    std::vector<int> master_times(30000);
+    std::iota(master_times.begin(), master_times.end(), 1);
+    std::vector<int> camera_times;
+    for (int i = 0; i < 100; ++i) {
+        camera_times.push_back(1 + i * 300 + (i % 3));// Slightly irregular so it is stored explicitly
+    }
+    auto master = std::make_shared<TimeFrame>(master_times);
+    auto camera = std::make_shared<TimeFrame>(camera_times);
+    REQUIRE_FALSE(camera->isImplicit());
+
+    std::vector<TimeFrameIndex> master_indices;
+    for (int64_t i = 0; i < 30000; i += 37) {
+        master_indices.emplace_back(i);
+    }
+
+    SECTION("Sorted batch matches per-index conversion") {
+        for (bool const preceding: {true, false}) {
+            auto const converted = convertTimeFrameIndices(master_indices, master.get(), camera.get(), preceding);
+            REQUIRE(converted.size() == master_indices.size());
+            for (size_t i = 0; i < master_indices.size(); ++i) {
+                auto const time = master->getTimeAtIndex(master_indices[i]);
+                REQUIRE(converted[i] == camera->getIndexAtTime(static_cast<double>(time), preceding));
+            }
+        }
+    }
+
+    SECTION("Unsorted batch is still correct") {
+        std::vector<TimeFrameIndex> shuffled(master_indices.rbegin(), master_indices.rend());
+        auto const converted = convertTimeFrameIndices(shuffled, master.get(), camera.get());
+        for (size_t i = 0; i < shuffled.size(); ++i) {
+            REQUIRE(converted[i] == convertTimeFrameIndex(shuffled[i], master.get(), camera.get()));
+        }
+    }
+
+    SECTION("Cached conversion map") {
+        auto const map = master->getConversionMap(*camera);
+        REQUIRE(map != nullptr);
+        REQUIRE(map->size() == 30000);
+        REQUIRE((*map)[0] == TimeFrameIndex(0));
+        REQUIRE((*map)[300] == camera->getIndexAtTime(301.0));
+
+        // The map is built once per pair of clocks
+        REQUIRE(master->getConversionMap(*camera) == map);
+        REQUIRE(camera->getConversionMap(*master) != nullptr);
+
+        REQUIRE(convertTimeFrameIndex(TimeFrameIndex(12345), master.get(), camera.get()) == (*map)[12345]);
+    }
+
+    SECTION("Same clock is an identity") {
+        auto const converted = convertTimeFrameIndices(master_indices, master.get(), master.get());
+        REQUIRE(converted == master_indices);
+    }
+}
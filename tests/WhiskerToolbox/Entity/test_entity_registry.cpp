@@ -3,6 +3,9 @@
 #include "Entity/EntityRegistry.hpp"
 #include "TimeFrame/TimeFrame.hpp"
 
+#include <cstdint>
+#include <vector>
+
 TEST_CASE("EntityRegistry - Basic ID generation", "[entityregistry][basic]") {
     EntityRegistry registry;
     
@@ -163,3 +166,79 @@ TEST_CASE("EntityRegistry - Large scale operations", "[entityregistry][scale]")
         REQUIRE(descriptor_opt->data_key == "scale_data_" + std::to_string(i));
     }
 }
+
+TEST_CASE("EntityRegistry - Bulk registration at one time", "[entityregistry][bulk]") {
+    EntityRegistry registry;
+
+    TimeFrameIndex time_index(42);
+    auto ids = registry.ensureIds("bulk_data", EntityKind::LineEntity, time_index, 5);
+    REQUIRE(ids.size() == 5);
+
+    // New entities receive one contiguous run
+    for (size_t i = 0; i < ids.size(); ++i) {
+        REQUIRE(ids[i] == ids[0] + i);
+    }
+
+    // Bulk and single registration agree
+    for (int i = 0; i < 5; ++i) {
+        REQUIRE(registry.ensureId("bulk_data", EntityKind::LineEntity, time_index, i) == ids[static_cast<size_t>(i)]);
+    }
+
+    // Partially registered ranges keep existing ids and extend with new ones
+    auto more = registry.ensureIds("bulk_data", EntityKind::LineEntity, time_index, 4, 3);
+    REQUIRE(more.size() == 4);
+    REQUIRE(more[0] == ids[3]);
+    REQUIRE(more[1] == ids[4]);
+    REQUIRE(more[2] != more[3]);
+
+    auto descriptor = registry.get(more[3]);
+    REQUIRE(descriptor.has_value());
+    REQUIRE(descriptor->data_key == "bulk_data");
+    REQUIRE(descriptor->kind == EntityKind::LineEntity);
+    REQUIRE(descriptor->time_value == 42);
+    REQUIRE(descriptor->local_index == 6);
+
+    REQUIRE(registry.size() == 7);
+    REQUIRE(registry.ensureIds("bulk_data", EntityKind::LineEntity, time_index, 0).empty());
+}
+
+TEST_CASE("EntityRegistry - Bulk registration of time and index pairs", "[entityregistry][bulk]") {
+    EntityRegistry registry;
+
+    std::vector<TimeFrameIndex> const times = {TimeFrameIndex(10), TimeFrameIndex(-3), TimeFrameIndex(1000000000), TimeFrameIndex(10)};
+    std::vector<int> const local_indices = {0, 2, 1, 1};
+
+    auto ids = registry.ensureIds("pairs", EntityKind::IntervalEntity, times, local_indices);
+    REQUIRE(ids.size() == times.size());
+
+    for (size_t i = 0; i < ids.size(); ++i) {
+        REQUIRE(registry.ensureId("pairs", EntityKind::IntervalEntity, times[i], local_indices[i]) == ids[i]);
+
+        auto descriptor = registry.get(ids[i]);
+        REQUIRE(descriptor.has_value());
+        REQUIRE(descriptor->time_value == times[i].getValue());
+        REQUIRE(descriptor->local_index == local_indices[i]);
+    }
+}
+
+TEST_CASE("EntityRegistry - Sparse and out of order times", "[entityregistry][sparse]") {
+    EntityRegistry registry;
+
+    // Mix of descending, widely spaced and negative times exercises both the dense and sparse lookups
+    std::vector<int64_t> const time_values = {500, 499, 0, -20, 7000000000, 12, 7000000001, 100000, 498};
+    std::vector<EntityId> ids;
+    for (auto t: time_values) {
+        ids.push_back(registry.ensureId("sparse_data", EntityKind::EventEntity, TimeFrameIndex(t), 0));
+    }
+
+    for (size_t i = 0; i < ids.size(); ++i) {
+        REQUIRE(ids[i] == static_cast<EntityId>(i));
+        REQUIRE(registry.ensureId("sparse_data", EntityKind::EventEntity, TimeFrameIndex(time_values[i]), 0) == ids[i]);
+
+        auto descriptor = registry.get(ids[i]);
+        REQUIRE(descriptor.has_value());
+        REQUIRE(descriptor->time_value == time_values[i]);
+    }
+
+    REQUIRE_FALSE(registry.get(static_cast<EntityId>(time_values.size())).has_value());
+}
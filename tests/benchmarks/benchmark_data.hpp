@@ -0,0 +1,298 @@
+#ifndef BENCHMARK_DATA_HPP
+#define BENCHMARK_DATA_HPP
+
+#include "AnalogTimeSeries/Analog_Time_Series.hpp"
+#include "CoreGeometry/ImageSize.hpp"
+#include "CoreGeometry/lines.hpp"
+#include "CoreGeometry/masks.hpp"
+#include "CoreGeometry/points.hpp"
+#include "DigitalTimeSeries/Digital_Event_Series.hpp"
+#include "DigitalTimeSeries/Digital_Interval_Series.hpp"
+#include "Lines/Line_Data.hpp"
+#include "Masks/Mask_Data.hpp"
+#include "Media/Media_Data.hpp"
+#include "Points/Point_Data.hpp"
+#include "Tensors/Tensor_Data.hpp"
+#include "TimeFrame/TimeFrame.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <vector>
+
+/**
+ * @brief Synthetic data for the DataManager benchmarks
+ *
+ * Every generator is deterministic (fixed seed), so two runs of the suite
+ * time exactly the same work and can be compared against a stored baseline.
+ * Shapes follow what a whisker-tracking session produces: analog channels
+ * sampled every frame, sparse events, non-overlapping intervals, one traced
+ * whisker per frame and a blob-shaped mask per frame.
+ */
+namespace benchmark_data {
+
+inline constexpr std::uint32_t seed = 42;
+
+inline std::vector<TimeFrameIndex> frame_indices(std::size_t count, std::int64_t step = 1) {
+    std::vector<TimeFrameIndex> times;
+    times.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        times.emplace_back(static_cast<std::int64_t>(i) * step);
+    }
+    return times;
+}
+
+/**
+ * @brief Sum of two sines plus gaussian noise, one sample per frame
+ */
+inline std::vector<float> analog_values(std::size_t count) {
+    std::mt19937 gen(seed);
+    std::normal_distribution<float> noise(0.0f, 0.1f);
+
+    std::vector<float> values;
+    values.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto const t = static_cast<float>(i) / 1000.0f;
+        values.push_back(std::sin(2.0f * std::numbers::pi_v<float> * 8.0f * t) +
+                         0.5f * std::sin(2.0f * std::numbers::pi_v<float> * 60.0f * t) +
+                         noise(gen));
+    }
+    return values;
+}
+
+inline std::shared_ptr<AnalogTimeSeries> analog_series(std::size_t count) {
+    return std::make_shared<AnalogTimeSeries>(analog_values(count), frame_indices(count));
+}
+
+/**
+ * @brief Sorted event times with exponential spacing, averaging @p mean_spacing frames apart
+ */
+inline std::vector<float> event_times(std::size_t count, float mean_spacing = 10.0f) {
+    std::mt19937 gen(seed);
+    std::exponential_distribution<float> spacing(1.0f / mean_spacing);
+
+    std::vector<float> times;
+    times.reserve(count);
+    float time = 0.0f;
+    for (std::size_t i = 0; i < count; ++i) {
+        time += std::floor(spacing(gen)) + 1.0f;
+        times.push_back(time);
+    }
+    return times;
+}
+
+inline std::shared_ptr<DigitalEventSeries> event_series(std::size_t count) {
+    return std::make_shared<DigitalEventSeries>(event_times(count));
+}
+
+/**
+ * @brief Sorted, non-overlapping intervals of 5-50 frames separated by gaps of 1-100 frames
+ */
+inline std::vector<Interval> intervals(std::size_t count) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::int64_t> length(5, 50);
+    std::uniform_int_distribution<std::int64_t> gap(1, 100);
+
+    std::vector<Interval> result;
+    result.reserve(count);
+    std::int64_t start = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        start += gap(gen);
+        auto const end = start + length(gen);
+        result.push_back(Interval{start, end});
+        start = end;
+    }
+    return result;
+}
+
+inline std::shared_ptr<DigitalIntervalSeries> interval_series(std::size_t count) {
+    return std::make_shared<DigitalIntervalSeries>(intervals(count));
+}
+
+inline ImageSize const image_size{640, 480};
+
+inline std::shared_ptr<PointData> point_data(std::size_t frames, std::size_t points_per_frame) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> x(0.0f, static_cast<float>(image_size.width));
+    std::uniform_real_distribution<float> y(0.0f, static_cast<float>(image_size.height));
+
+    auto data = std::make_shared<PointData>();
+    data->setImageSize(image_size);
+    std::vector<Point2D<float>> points(points_per_frame);
+    for (std::size_t frame = 0; frame < frames; ++frame) {
+        for (auto & point: points) {
+            point = {x(gen), y(gen)};
+        }
+        data->addPointsAtTime(TimeFrameIndex(static_cast<std::int64_t>(frame)), points, false);
+    }
+    return data;
+}
+
+/**
+ * @brief A whisker-like curve from the follicle outward that sweeps back and forth over time
+ */
+inline Line2D whisker(std::size_t frame, std::size_t vertices) {
+    auto const angle = 0.5f * std::sin(static_cast<float>(frame) / 20.0f);
+    std::vector<Point2D<float>> points;
+    points.reserve(vertices);
+    for (std::size_t i = 0; i < vertices; ++i) {
+        auto const s = static_cast<float>(i) * 2.0f;
+        auto const bend = 0.001f * s * s;
+        points.emplace_back(320.0f + s * std::cos(angle) - bend * std::sin(angle),
+                            240.0f + s * std::sin(angle) + bend * std::cos(angle));
+    }
+    return Line2D(std::move(points));
+}
+
+inline std::shared_ptr<LineData> line_data(std::size_t frames, std::size_t vertices_per_line) {
+    auto data = std::make_shared<LineData>();
+    data->setImageSize(image_size);
+    for (std::size_t frame = 0; frame < frames; ++frame) {
+        data->addAtTime(TimeFrameIndex(static_cast<std::int64_t>(frame)), whisker(frame, vertices_per_line), false);
+    }
+    return data;
+}
+
+/**
+ * @brief A filled ellipse with a small hole and a few stray pixels
+ *
+ * The hole and the strays give hole filling, connected components and
+ * median filtering something to do.
+ */
+inline Mask2D blob(std::size_t frame, std::uint32_t radius) {
+    auto const cx = 200 + static_cast<std::int64_t>(frame % 200);
+    auto const cy = 240;
+    auto const r = static_cast<std::int64_t>(radius);
+
+    Mask2D mask;
+    for (std::int64_t dy = -r; dy <= r; ++dy) {
+        for (std::int64_t dx = -2 * r; dx <= 2 * r; ++dx) {
+            auto const inside = dx * dx + 4 * dy * dy <= 4 * r * r;
+            auto const in_hole = dx * dx + dy * dy <= (r / 4) * (r / 4);
+            if (inside && !in_hole) {
+                mask.emplace_back(static_cast<std::uint32_t>(cx + dx), static_cast<std::uint32_t>(cy + dy));
+            }
+        }
+    }
+    for (std::uint32_t i = 0; i < 4; ++i) {
+        mask.emplace_back(static_cast<std::uint32_t>(cx) + 3 * radius + 5 * i, static_cast<std::uint32_t>(cy));
+    }
+    return mask;
+}
+
+inline std::shared_ptr<MaskData> mask_data(std::size_t frames, std::uint32_t radius) {
+    auto data = std::make_shared<MaskData>();
+    data->setImageSize(image_size);
+    for (std::size_t frame = 0; frame < frames; ++frame) {
+        data->addAtTime(TimeFrameIndex(static_cast<std::int64_t>(frame)), blob(frame, radius), false);
+    }
+    return data;
+}
+
+inline TensorData tensor_data(std::size_t frames, std::vector<std::size_t> const & feature_shape) {
+    std::size_t feature_size = 1;
+    for (auto const dim: feature_shape) {
+        feature_size *= dim;
+    }
+    std::vector<float> values(frames * feature_size);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<float>(i % 251) / 251.0f;
+    }
+
+    TensorData data;
+    data.setContiguousData(frame_indices(frames), std::move(values), feature_shape);
+    return data;
+}
+
+/**
+ * @brief Camera clock with a small jitter on a 4 ms period, as read from a frame-timestamp file
+ */
+inline std::shared_ptr<TimeFrame> camera_clock(std::size_t frames) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::int64_t> jitter(0, 2);
+
+    std::vector<std::int64_t> times;
+    times.reserve(frames);
+    std::int64_t time = 0;
+    for (std::size_t i = 0; i < frames; ++i) {
+        time += 4 + jitter(gen);
+        times.push_back(time);
+    }
+    return std::make_shared<TimeFrame>(std::move(times));
+}
+
+/**
+ * @brief Gray8 video of a few dark whiskers sweeping over a bright background
+ *
+ * Frames are drawn when they are loaded, so media transforms are timed
+ * without decoding a video file.
+ */
+class SyntheticMedia final : public MediaData {
+public:
+    static constexpr std::size_t whiskers_per_frame = 3;
+
+    explicit SyntheticMedia(int frames) {
+        updateWidth(image_size.width);
+        updateHeight(image_size.height);
+        setTotalFrameCount(frames);
+    }
+
+    [[nodiscard]] MediaType getMediaType() const override { return MediaType::Video; }
+
+protected:
+    void doLoadFrame(int frame_id) override {
+        auto const width = static_cast<std::size_t>(image_size.width);
+        auto const height = static_cast<std::size_t>(image_size.height);
+        std::vector<std::uint8_t> frame(width * height, 200);
+
+        for (std::size_t w = 0; w < whiskers_per_frame; ++w) {
+            auto const line = whisker(static_cast<std::size_t>(frame_id) + 15 * w, 120);
+            auto const offset = (static_cast<float>(w) - 1.0f) * 60.0f;
+            // Two pixels wide, sampled densely enough that the stroke has no gaps
+            for (std::size_t i = 1; i < line.size(); ++i) {
+                for (int step = 0; step < 4; ++step) {
+                    auto const t = static_cast<float>(step) / 4.0f;
+                    auto const x = line[i - 1].x + t * (line[i].x - line[i - 1].x);
+                    auto const y = line[i - 1].y + t * (line[i].y - line[i - 1].y) + offset;
+                    if (x < 0.0f || y < 0.0f || x + 1.0f >= static_cast<float>(width) || y >= static_cast<float>(height)) {
+                        continue;
+                    }
+                    auto const pixel = static_cast<std::size_t>(y) * width + static_cast<std::size_t>(x);
+                    frame[pixel] = 40;
+                    frame[pixel + 1] = 40;
+                }
+            }
+        }
+        setRawData(std::move(frame));
+    }
+};
+
+/**
+ * @brief Scratch directory for loader and saver benchmarks, removed on destruction
+ */
+class ScratchDirectory {
+public:
+    explicit ScratchDirectory(std::string const & name)
+        : _path(std::filesystem::temp_directory_path() / ("whiskertoolbox_benchmark_" + name)) {
+        std::filesystem::create_directories(_path);
+    }
+    ~ScratchDirectory() {
+        std::error_code ec;
+        std::filesystem::remove_all(_path, ec);
+    }
+    ScratchDirectory(ScratchDirectory const &) = delete;
+    ScratchDirectory & operator=(ScratchDirectory const &) = delete;
+
+    [[nodiscard]] std::filesystem::path const & path() const { return _path; }
+
+private:
+    std::filesystem::path _path;
+};
+
+}// namespace benchmark_data
+
+#endif// BENCHMARK_DATA_HPP
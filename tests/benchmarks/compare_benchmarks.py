@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""Compare DataManagerBenchmarks results against a stored baseline.
+
+Catch2 only reports benchmark statistics through its XML reporter, so run the
+suite with
+
+    DataManagerBenchmarks "[!benchmark]" --reporter XML::out=results.xml
+
+Store a baseline as JSON ({benchmark name: mean ns}) with
+
+    compare_benchmarks.py results.xml --write-baseline baseline.json
+
+and check a later run against it with
+
+    compare_benchmarks.py results.xml --baseline baseline.json --threshold 0.10
+
+The script exits with status 1 when any benchmark's mean is slower than the
+baseline by more than the threshold.
+"""
+
+import argparse
+import json
+import sys
+import xml.etree.ElementTree as ET
+
+
+def load_results(path):
+    """Return {benchmark name: mean time in ns} from a Catch2 XML report or a JSON baseline."""
+    if path.endswith(".json"):
+        with open(path) as f:
+            return {name: float(mean) for name, mean in json.load(f).items()}
+
+    results = {}
+    for benchmark in ET.parse(path).getroot().iter("BenchmarkResults"):
+        mean = benchmark.find("mean")
+        if mean is not None:
+            results[benchmark.get("name")] = float(mean.get("value"))
+    return results
+
+
+def format_ns(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return f"{ns / scale:.3f} {unit}"
+    return f"{ns:.1f} ns"
+
+
+def compare(current, baseline, threshold):
+    """Print a comparison table and return the names of regressed benchmarks."""
+    regressions = []
+    width = max((len(name) for name in current), default=10)
+    print(f"{'benchmark':<{width}}  {'baseline':>12}  {'current':>12}  {'change':>8}")
+    for name in sorted(current):
+        mean = current[name]
+        if name not in baseline:
+            print(f"{name:<{width}}  {'-':>12}  {format_ns(mean):>12}  {'new':>8}")
+            continue
+        change = mean / baseline[name] - 1.0
+        flag = ""
+        if change > threshold:
+            flag = "  REGRESSION"
+            regressions.append(name)
+        print(f"{name:<{width}}  {format_ns(baseline[name]):>12}  {format_ns(mean):>12}  {change:>+8.1%}{flag}")
+
+    for name in sorted(set(baseline) - set(current)):
+        print(f"{name:<{width}}  {format_ns(baseline[name]):>12}  {'-':>12}  {'missing':>8}")
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("results", help="Catch2 XML report or JSON results file")
+    parser.add_argument("--baseline", help="JSON baseline to compare against")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="relative slowdown counted as a regression (default 0.10)")
+    parser.add_argument("--write-baseline", metavar="PATH", help="write the results as a JSON baseline")
+    args = parser.parse_args()
+
+    current = load_results(args.results)
+    if not current:
+        print(f"no benchmark results found in {args.results}", file=sys.stderr)
+        return 2
+
+    if args.write_baseline:
+        with open(args.write_baseline, "w") as f:
+            json.dump(current, f, indent=2, sort_keys=True)
+            f.write("\n")
+        print(f"wrote {len(current)} benchmarks to {args.write_baseline}")
+
+    if args.baseline:
+        regressions = compare(current, load_results(args.baseline), args.threshold)
+        if regressions:
+            print(f"\n{len(regressions)} benchmark(s) regressed by more than {args.threshold:.0%}", file=sys.stderr)
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,186 @@
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include "benchmark_data.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace benchmark_data;
+
+TEST_CASE("Benchmark AnalogTimeSeries", "[!benchmark][containers][analog]") {
+    auto const values = analog_values(1'000'000);
+    auto const times = frame_indices(1'000'000);
+    auto const series = analog_series(1'000'000);
+
+    BENCHMARK("Analog construct 1M") {
+        return AnalogTimeSeries(values, times);
+    };
+
+    BENCHMARK("Analog iterate span 1M") {
+        double sum = 0.0;
+        for (auto const value: series->getAnalogTimeSeriesSpan()) {
+            sum += value;
+        }
+        return sum;
+    };
+
+    BENCHMARK("Analog summary statistics 1M") {
+        return series->getSummaryStatistics();
+    };
+
+    BENCHMARK("Analog 1000 range slices of 1M") {
+        std::size_t total = 0;
+        for (std::int64_t start = 0; start < 1'000'000; start += 1000) {
+            total += series->getDataInTimeFrameIndexRange(TimeFrameIndex(start), TimeFrameIndex(start + 499)).size();
+        }
+        return total;
+    };
+}
+
+TEST_CASE("Benchmark DigitalEventSeries", "[!benchmark][containers][digital]") {
+    auto const times = event_times(100'000);
+    auto const series = event_series(100'000);
+    auto const last = static_cast<std::int64_t>(times.back());
+
+    BENCHMARK("Events construct 100k") {
+        return DigitalEventSeries(times);
+    };
+
+    BENCHMARK("Events 1000 range queries of 100k") {
+        std::size_t total = 0;
+        for (std::int64_t start = 0; start < last; start += last / 1000) {
+            for ([[maybe_unused]] auto const event: series->getEventsInRange(TimeFrameIndex(start), TimeFrameIndex(start + 100))) {
+                ++total;
+            }
+        }
+        return total;
+    };
+}
+
+TEST_CASE("Benchmark DigitalIntervalSeries", "[!benchmark][containers][digital]") {
+    auto const source = intervals(100'000);
+    auto const series = interval_series(100'000);
+    auto const last = source.back().end;
+
+    BENCHMARK("Intervals construct 100k") {
+        return DigitalIntervalSeries(source);
+    };
+
+    BENCHMARK("Intervals 1000 isEventAtTime of 100k") {
+        std::size_t hits = 0;
+        for (std::int64_t time = 0; time < last; time += last / 1000) {
+            if (series->isEventAtTime(TimeFrameIndex(time))) {
+                ++hits;
+            }
+        }
+        return hits;
+    };
+
+    BENCHMARK("Intervals setEventsAtSortedTimes 1M") {
+        std::vector<std::int64_t> sample_times(1'000'000);
+        std::vector<std::uint8_t> states(sample_times.size());
+        for (std::size_t i = 0; i < sample_times.size(); ++i) {
+            sample_times[i] = static_cast<std::int64_t>(i);
+            states[i] = (i / 37) % 3 == 0 ? 1 : 0;
+        }
+        DigitalIntervalSeries result;
+        result.setEventsAtSortedTimes(std::span<std::int64_t const>(sample_times), std::span<std::uint8_t const>(states), false);
+        return result.size();
+    };
+}
+
+TEST_CASE("Benchmark PointData", "[!benchmark][containers][points]") {
+    auto const points = point_data(100'000, 4);
+
+    BENCHMARK("Points construct 100k frames x 4") {
+        return point_data(100'000, 4);
+    };
+
+    BENCHMARK("Points iterate all 100k frames") {
+        double sum = 0.0;
+        for (auto const & [time, frame_points]: points->GetAllPointsAsRange()) {
+            for (auto const & point: frame_points) {
+                sum += point.x;
+            }
+        }
+        return sum;
+    };
+
+    BENCHMARK("Points getAtTime 100k") {
+        std::size_t total = 0;
+        for (std::int64_t time = 0; time < 100'000; ++time) {
+            total += points->getAtTime(TimeFrameIndex(time)).size();
+        }
+        return total;
+    };
+}
+
+TEST_CASE("Benchmark LineData", "[!benchmark][containers][lines]") {
+    auto const lines = line_data(20'000, 100);
+
+    BENCHMARK("Lines construct 20k frames x 100 vertices") {
+        return line_data(20'000, 100);
+    };
+
+    BENCHMARK("Lines iterate views 20k frames") {
+        double sum = 0.0;
+        for (auto const time: lines->getTimesWithData()) {
+            for (auto const line: lines->getLineViewsAtTime(time)) {
+                sum += line.back().x;
+            }
+        }
+        return sum;
+    };
+
+    BENCHMARK("Lines copy getAtTime 20k frames") {
+        std::size_t total = 0;
+        for (auto const time: lines->getTimesWithData()) {
+            total += lines->getAtTime(time).size();
+        }
+        return total;
+    };
+}
+
+TEST_CASE("Benchmark MaskData", "[!benchmark][containers][masks]") {
+    auto const masks = mask_data(5'000, 20);
+
+    BENCHMARK("Masks construct 5k frames") {
+        return mask_data(5'000, 20);
+    };
+
+    BENCHMARK("Masks iterate all 5k frames") {
+        std::size_t pixels = 0;
+        for (auto const & entry: masks->getAllAsRange()) {
+            for (auto const & mask: entry.masks) {
+                pixels += mask.size();
+            }
+        }
+        return pixels;
+    };
+}
+
+TEST_CASE("Benchmark TensorData", "[!benchmark][containers][tensors]") {
+    auto const tensors = tensor_data(10'000, {8, 8, 16});
+
+    BENCHMARK("Tensors construct 10k frames of 8x8x16") {
+        return tensor_data(10'000, {8, 8, 16}).size();
+    };
+
+    BENCHMARK("Tensors view every frame of 10k") {
+        double sum = 0.0;
+        for (auto const time: tensors.getTimesWithTensors()) {
+            sum += tensors.getTensorViewAtTime(time)[0];
+        }
+        return sum;
+    };
+
+    BENCHMARK("Tensors channel slice every frame of 10k") {
+        std::size_t total = 0;
+        for (auto const time: tensors.getTimesWithTensors()) {
+            total += tensors.getChannelSlice(time, 3).size();
+        }
+        return total;
+    };
+}
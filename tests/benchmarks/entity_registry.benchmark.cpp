@@ -0,0 +1,63 @@
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+
+#include "Entity/EntityRegistry.hpp"
+#include "TimeFrame/TimeFrame.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// Registers ids the way LineData and PointData do: a handful of entities at every frame
+static EntityId register_per_entity(EntityRegistry & registry, int frames, int entities_per_frame) {
+    EntityId last = 0;
+    for (int t = 0; t < frames; ++t) {
+        for (int i = 0; i < entities_per_frame; ++i) {
+            last = registry.ensureId("lines", EntityKind::LineEntity, TimeFrameIndex(t), i);
+        }
+    }
+    return last;
+}
+
+static EntityId register_in_bulk(EntityRegistry & registry, int frames, int entities_per_frame) {
+    EntityId last = 0;
+    for (int t = 0; t < frames; ++t) {
+        auto const ids = registry.ensureIds("lines", EntityKind::LineEntity, TimeFrameIndex(t), entities_per_frame);
+        last = ids.back();
+    }
+    return last;
+}
+
+TEST_CASE("Benchmark Entity Registry", "[!benchmark]") {
+    int const frames = 100000;
+    int const entities_per_frame = 10;
+
+    BENCHMARK("ensureId 1M entities") {
+        EntityRegistry registry;
+        return register_per_entity(registry, frames, entities_per_frame);
+    };
+
+    BENCHMARK("ensureIds 1M entities") {
+        EntityRegistry registry;
+        return register_in_bulk(registry, frames, entities_per_frame);
+    };
+
+    BENCHMARK_ADVANCED("ensureId lookup of registered entities")(Catch::Benchmark::Chronometer meter) {
+        EntityRegistry registry;
+        register_in_bulk(registry, frames, entities_per_frame);
+        meter.measure([&registry, frames, entities_per_frame] {
+            return register_per_entity(registry, frames, entities_per_frame);
+        });
+    };
+
+    BENCHMARK_ADVANCED("get 1M descriptors")(Catch::Benchmark::Chronometer meter) {
+        EntityRegistry registry;
+        auto const count = register_in_bulk(registry, frames, entities_per_frame) + 1;
+        meter.measure([&registry, count] {
+            int64_t sum = 0;
+            for (EntityId id = 0; id < count; ++id) {
+                sum += registry.get(id)->local_index;
+            }
+            return sum;
+        });
+    };
+}
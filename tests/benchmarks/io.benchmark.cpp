@@ -0,0 +1,206 @@
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include "benchmark_data.hpp"
+
+#include "AnalogTimeSeries/IO/Binary/Analog_Time_Series_Binary.hpp"
+#include "AnalogTimeSeries/IO/CSV/Analog_Time_Series_CSV.hpp"
+#include "AnalogTimeSeries/IO/numpy/Analog_Time_Series_numpy.hpp"
+#include "DigitalTimeSeries/IO/CSV/Digital_Event_Series_CSV.hpp"
+#include "Lines/IO/CSV/Line_Data_CSV.hpp"
+#include "Points/IO/CSV/Point_Data_CSV.hpp"
+#include "Tensors/IO/numpy/Tensor_Data_numpy.hpp"
+
+#ifdef ENABLE_HDF5
+#include "IO/HDF5/Mask_Data_HDF5.hpp"
+
+#include <H5Cpp.h>
+#endif
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace benchmark_data;
+
+// Each saver writes the file its loader reads back, so the loaders always see
+// the format the application produces.
+
+TEST_CASE("Benchmark Analog IO", "[!benchmark][io][analog]") {
+    ScratchDirectory const scratch("analog_io");
+    auto series = analog_series(1'000'000);
+
+    CSVAnalogSaverOptions csv_save_opts;
+    csv_save_opts.filename = "analog.csv";
+    csv_save_opts.parent_dir = scratch.path().string();
+    BENCHMARK("Analog CSV save 1M") {
+        save(series.get(), csv_save_opts);
+    };
+
+    CSVAnalogLoaderOptions csv_load_opts;
+    csv_load_opts.filepath = (scratch.path() / "analog.csv").string();
+    csv_load_opts.has_header = true;
+    csv_load_opts.single_column_format = false;
+    BENCHMARK("Analog CSV load 1M") {
+        return load(csv_load_opts);
+    };
+
+    // Four interleaved int16 channels, as written by acquisition hardware
+    auto const binary_path = scratch.path() / "analog.bin";
+    {
+        std::vector<std::int16_t> samples(4 * 1'000'000);
+        for (std::size_t i = 0; i < samples.size(); ++i) {
+            samples[i] = static_cast<std::int16_t>(static_cast<int>((i * 37) % 2000) - 1000);
+        }
+        std::ofstream out(binary_path, std::ios::binary);
+        out.write(reinterpret_cast<char const *>(samples.data()), static_cast<std::streamsize>(samples.size() * sizeof(std::int16_t)));
+    }
+    BinaryAnalogLoaderOptions binary_opts;
+    binary_opts.filename = binary_path.string();
+    binary_opts.num_channels = 4;
+    BENCHMARK("Analog binary load 4 channels x 1M") {
+        return load(binary_opts);
+    };
+
+    // The same channels as a (1M, 4) float32 array
+    auto const npy_path = (scratch.path() / "analog.npy").string();
+    {
+        std::vector<float> samples(4 * 1'000'000);
+        for (std::size_t i = 0; i < samples.size(); ++i) {
+            samples[i] = static_cast<float>((i * 37) % 2000) - 1000.0f;
+        }
+        std::string header = "{'descr': '<f4', 'fortran_order': False, 'shape': (1000000, 4), }";
+        header.append(63 - (10 + header.size()) % 64, ' ');
+        header += '\n';
+        std::ofstream out(npy_path, std::ios::binary);
+        out.write("\x93NUMPY\x01\x00", 8);
+        out.put(static_cast<char>(header.size() & 0xFF));
+        out.put(static_cast<char>(header.size() >> 8));
+        out.write(header.data(), static_cast<std::streamsize>(header.size()));
+        out.write(reinterpret_cast<char const *>(samples.data()), static_cast<std::streamsize>(samples.size() * sizeof(float)));
+    }
+    BENCHMARK("Analog numpy load 4 channels x 1M") {
+        return load(NumpyAnalogLoaderOptions{.filepath = npy_path, .array_name = {}});
+    };
+}
+
+TEST_CASE("Benchmark DigitalEvent IO", "[!benchmark][io][digital]") {
+    ScratchDirectory const scratch("event_io");
+    auto events = event_series(100'000);
+
+    CSVEventSaverOptions save_opts;
+    save_opts.filename = "events.csv";
+    save_opts.parent_dir = scratch.path().string();
+    BENCHMARK("Events CSV save 100k") {
+        save(events.get(), save_opts);
+    };
+
+    CSVEventLoaderOptions load_opts;
+    load_opts.filepath = (scratch.path() / "events.csv").string();
+    load_opts.has_header = true;
+    BENCHMARK("Events CSV load 100k") {
+        return load(load_opts);
+    };
+}
+
+TEST_CASE("Benchmark Point IO", "[!benchmark][io][points]") {
+    ScratchDirectory const scratch("point_io");
+    auto points = point_data(100'000, 1);
+
+    CSVPointSaverOptions save_opts;
+    save_opts.filename = "points.csv";
+    save_opts.parent_dir = scratch.path().string();
+    BENCHMARK("Points CSV save 100k") {
+        save(points.get(), save_opts);
+    };
+
+    CSVPointLoaderOptions load_opts;
+    load_opts.filename = (scratch.path() / "points.csv").string();
+    load_opts.column_delim = ',';
+    BENCHMARK("Points CSV load 100k") {
+        return load(load_opts);
+    };
+}
+
+TEST_CASE("Benchmark Line IO", "[!benchmark][io][lines]") {
+    ScratchDirectory const scratch("line_io");
+    auto lines = line_data(10'000, 100);
+
+    CSVSingleFileLineSaverOptions save_opts;
+    save_opts.filename = "lines.csv";
+    save_opts.parent_dir = scratch.path().string();
+    BENCHMARK("Lines CSV save 10k x 100 vertices") {
+        save(lines.get(), save_opts);
+    };
+
+    CSVSingleFileLineLoaderOptions load_opts;
+    load_opts.filepath = (scratch.path() / "lines.csv").string();
+    BENCHMARK("Lines CSV load 10k x 100 vertices") {
+        return load(load_opts);
+    };
+}
+
+TEST_CASE("Benchmark Tensor IO", "[!benchmark][io][tensors]") {
+    ScratchDirectory const scratch("tensor_io");
+    auto const tensors = tensor_data(10'000, {8, 8, 16});
+    auto const path = (scratch.path() / "tensors.npy").string();
+
+    BENCHMARK("Tensors numpy save 10k x 8x8x16") {
+        return saveTensorDataToNpy(path, tensors);
+    };
+
+    BENCHMARK("Tensors numpy load 10k x 8x8x16") {
+        TensorData loaded;
+        loadNpyToTensorData(path, loaded);
+        return loaded.size();
+    };
+}
+
+#ifdef ENABLE_HDF5
+TEST_CASE("Benchmark Mask IO", "[!benchmark][io][masks]") {
+    ScratchDirectory const scratch("mask_io");
+    auto const masks = mask_data(10'000, 12);
+    auto const path = (scratch.path() / "masks.h5").string();
+
+    // Frames plus ragged x/y pixel coordinates, one row per mask, as the
+    // tracking exports store them
+    {
+        std::vector<int> frames;
+        std::vector<std::vector<float>> x_rows;
+        std::vector<std::vector<float>> y_rows;
+        for (auto const & [time, frame_masks]: masks->getAllAsRange()) {
+            for (auto const & mask: frame_masks) {
+                frames.push_back(static_cast<int>(time.getValue()));
+                auto & x = x_rows.emplace_back();
+                auto & y = y_rows.emplace_back();
+                for (auto const & point: mask) {
+                    x.push_back(static_cast<float>(point.x));
+                    y.push_back(static_cast<float>(point.y));
+                }
+            }
+        }
+
+        H5::H5File file(path, H5F_ACC_TRUNC);
+        hsize_t const dims[1] = {frames.size()};
+        H5::DataSpace const space(1, dims);
+        file.createDataSet("frames", H5::PredType::NATIVE_INT32, space).write(frames.data(), H5::PredType::NATIVE_INT32);
+
+        H5::VarLenType const varlen_type(H5::PredType::NATIVE_FLOAT);
+        for (auto const & [key, rows]: {std::pair{"widths", &x_rows}, std::pair{"heights", &y_rows}}) {
+            std::vector<hvl_t> varlen_rows(rows->size());
+            for (std::size_t i = 0; i < rows->size(); ++i) {
+                varlen_rows[i].len = (*rows)[i].size();
+                varlen_rows[i].p = (*rows)[i].data();
+            }
+            file.createDataSet(key, varlen_type, space).write(varlen_rows.data(), varlen_type);
+        }
+    }
+
+    HDF5MaskLoaderOptions load_opts;
+    load_opts.filename = path;
+    BENCHMARK("Masks HDF5 load 10k") {
+        return load(load_opts);
+    };
+}
+#endif
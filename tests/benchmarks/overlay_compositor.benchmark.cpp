@@ -0,0 +1,71 @@
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+
+#include "OverlayCompositor.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Blob-shaped masks the way segmentation output looks: a filled disc per mask
+static std::vector<Mask2D> make_mask_layer(ImageSize size, int masks_per_layer, int radius, std::mt19937 & rng) {
+    std::uniform_int_distribution<int> x_dist(radius, size.width - radius - 1);
+    std::uniform_int_distribution<int> y_dist(radius, size.height - radius - 1);
+
+    std::vector<Mask2D> layer;
+    for (int m = 0; m < masks_per_layer; ++m) {
+        int const cx = x_dist(rng);
+        int const cy = y_dist(rng);
+        Mask2D mask;
+        for (int dy = -radius; dy <= radius; ++dy) {
+            for (int dx = -radius; dx <= radius; ++dx) {
+                if (dx * dx + dy * dy <= radius * radius) {
+                    mask.emplace_back(static_cast<uint32_t>(cx + dx), static_cast<uint32_t>(cy + dy));
+                }
+            }
+        }
+        layer.push_back(std::move(mask));
+    }
+    return layer;
+}
+
+TEST_CASE("Benchmark Overlay Compositor", "[!benchmark]") {
+    ImageSize const video_size{1280, 1024};
+    int const layer_count = 10;
+
+    std::mt19937 rng(42);
+    std::vector<std::vector<Mask2D>> layers;
+    for (int i = 0; i < layer_count; ++i) {
+        layers.push_back(make_mask_layer(video_size, 3, 60, rng));
+    }
+
+    OverlayCompositor compositor(video_size.width, video_size.height);
+
+    BENCHMARK("10 mask layers, canvas at video size") {
+        compositor.clear();
+        for (auto const & layer: layers) {
+            compositor.blendMasks(layer, video_size, 0x80FF0000);
+        }
+        return compositor.pixels()[0];
+    };
+
+    OverlayCompositor scaled(1920, 1536);
+
+    BENCHMARK("10 mask layers, upscaled canvas") {
+        scaled.clear();
+        for (auto const & layer: layers) {
+            scaled.blendMasks(layer, video_size, 0x80FF0000);
+        }
+        return scaled.pixels()[0];
+    };
+
+    std::vector<uint8_t> media(static_cast<size_t>(video_size.width) * static_cast<size_t>(video_size.height), 128);
+    uint8_t const black = 0;
+
+    BENCHMARK("Transparency layer on a grayscale frame") {
+        compositor.clear();
+        compositor.addTransparencyLayer(layers[0], video_size);
+        compositor.applyTransparency(media.data(), static_cast<size_t>(video_size.width), 1, &black);
+        return media[0];
+    };
+}
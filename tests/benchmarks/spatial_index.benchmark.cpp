@@ -0,0 +1,116 @@
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include "benchmark_data.hpp"
+
+#include "QuadTree.hpp"
+#include "RTree.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace benchmark_data;
+
+namespace {
+
+struct ScatterPoint {
+    float x;
+    float y;
+};
+
+// Points spread over the video frame, like every tracked point of a session shown at once
+std::vector<ScatterPoint> scatter(std::size_t count) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> x(0.0f, static_cast<float>(image_size.width));
+    std::uniform_real_distribution<float> y(0.0f, static_cast<float>(image_size.height));
+
+    std::vector<ScatterPoint> points(count);
+    for (auto & point: points) {
+        point = {x(gen), y(gen)};
+    }
+    return points;
+}
+
+BoundingBox const frame_bounds(0.0f, 0.0f, static_cast<float>(image_size.width), static_cast<float>(image_size.height));
+
+}// namespace
+
+TEST_CASE("Benchmark QuadTree", "[!benchmark][spatial]") {
+    auto const points = scatter(100'000);
+
+    QuadTree<std::int64_t> tree(frame_bounds);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        tree.insert(points[i].x, points[i].y, static_cast<std::int64_t>(i));
+    }
+
+    BENCHMARK("QuadTree insert 100k") {
+        QuadTree<std::int64_t> built(frame_bounds);
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            built.insert(points[i].x, points[i].y, static_cast<std::int64_t>(i));
+        }
+        return built.size();
+    };
+
+    BENCHMARK("QuadTree 1000 box queries of 100k") {
+        std::vector<QuadTreePoint<std::int64_t> const *> results;
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < 1000; ++i) {
+            results.clear();
+            tree.queryPointers(BoundingBox(points[i].x - 10.0f, points[i].y - 10.0f, points[i].x + 10.0f, points[i].y + 10.0f), results);
+            total += results.size();
+        }
+        return total;
+    };
+
+    BENCHMARK("QuadTree 10000 nearest of 100k") {
+        std::size_t found = 0;
+        for (std::size_t i = 0; i < 10000; ++i) {
+            if (tree.findNearest(points[i].x + 0.5f, points[i].y + 0.5f, 5.0f) != nullptr) {
+                ++found;
+            }
+        }
+        return found;
+    };
+}
+
+TEST_CASE("Benchmark RTree", "[!benchmark][spatial]") {
+    // Small boxes, like the bounding boxes of masks or line segments
+    auto const corners = scatter(50'000);
+
+    RTree<std::int64_t> tree;
+    for (std::size_t i = 0; i < corners.size(); ++i) {
+        tree.insert(corners[i].x, corners[i].y, corners[i].x + 8.0f, corners[i].y + 8.0f, static_cast<std::int64_t>(i));
+    }
+
+    BENCHMARK("RTree insert 50k boxes") {
+        RTree<std::int64_t> built;
+        for (std::size_t i = 0; i < corners.size(); ++i) {
+            built.insert(corners[i].x, corners[i].y, corners[i].x + 8.0f, corners[i].y + 8.0f, static_cast<std::int64_t>(i));
+        }
+        return built.size();
+    };
+
+    BENCHMARK("RTree 1000 box queries of 50k") {
+        std::vector<RTreeEntry<std::int64_t> const *> results;
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < 1000; ++i) {
+            results.clear();
+            tree.queryPointers(BoundingBox(corners[i].x - 10.0f, corners[i].y - 10.0f, corners[i].x + 10.0f, corners[i].y + 10.0f), results);
+            total += results.size();
+        }
+        return total;
+    };
+
+    BENCHMARK("RTree 10000 point queries of 50k") {
+        std::vector<RTreeEntry<std::int64_t> const *> results;
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < 10000; ++i) {
+            results.clear();
+            tree.queryPointPointers(corners[i].x + 1.0f, corners[i].y + 1.0f, results);
+            total += results.size();
+        }
+        return total;
+    };
+}
@@ -0,0 +1,113 @@
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include "benchmark_data.hpp"
+
+#include "utils/TableView/adapters/AnalogDataAdapter.h"
+#include "utils/TableView/adapters/DigitalEventDataAdapter.h"
+#include "utils/TableView/adapters/DigitalIntervalDataAdapter.h"
+#include "utils/TableView/adapters/LineDataAdapter.h"
+#include "utils/TableView/computers/AnalogSliceGathererComputer.h"
+#include "utils/TableView/computers/AnalogTimestampOffsetsMultiComputer.h"
+#include "utils/TableView/computers/EventInIntervalComputer.h"
+#include "utils/TableView/computers/IntervalOverlapComputer.h"
+#include "utils/TableView/computers/IntervalPropertyComputer.h"
+#include "utils/TableView/computers/IntervalReductionComputer.h"
+#include "utils/TableView/computers/LineSamplingMultiComputer.h"
+#include "utils/TableView/computers/TimestampInIntervalComputer.h"
+#include "utils/TableView/computers/TimestampValueComputer.h"
+#include "utils/TableView/core/ExecutionPlan.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace benchmark_data;
+
+namespace {
+
+// 2k behavioural trials over a session of about 160k frames, all on one clock
+struct TableViewWorkload {
+    std::vector<Interval> trial_intervals = intervals(2'000);
+    std::int64_t frames = trial_intervals.back().end + 1;
+    std::shared_ptr<TimeFrame> clock = TimeFrame::createRegular(frames);
+
+    std::shared_ptr<IAnalogSource> analog = std::make_shared<AnalogDataAdapter>(
+            analog_series(static_cast<std::size_t>(frames)), clock, "analog");
+    std::shared_ptr<IEventSource> events = std::make_shared<DigitalEventDataAdapter>(
+            std::make_shared<DigitalEventSeries>(event_times(static_cast<std::size_t>(frames) / 10)), clock, "events");
+    std::shared_ptr<IIntervalSource> column_intervals = std::make_shared<DigitalIntervalDataAdapter>(
+            interval_series(2'000), clock, "intervals");
+    std::shared_ptr<ILineSource> lines = std::make_shared<LineDataAdapter>(
+            line_data(20'000, 100), clock, "lines");
+
+    ExecutionPlan interval_plan = [this] {
+        std::vector<TimeFrameInterval> rows;
+        rows.reserve(trial_intervals.size());
+        for (auto const & interval: trial_intervals) {
+            rows.push_back(TimeFrameInterval{TimeFrameIndex(interval.start), TimeFrameIndex(interval.end)});
+        }
+        return ExecutionPlan(std::move(rows), clock);
+    }();
+
+    ExecutionPlan timestamp_plan = ExecutionPlan(frame_indices(20'000), clock);
+};
+
+}// namespace
+
+TEST_CASE("Benchmark TableView interval computers", "[!benchmark][tableview]") {
+    TableViewWorkload const workload;
+
+    BENCHMARK("TV IntervalReduction Mean 2k rows") {
+        return IntervalReductionComputer(workload.analog, ReductionType::Mean).compute(workload.interval_plan);
+    };
+
+    BENCHMARK("TV IntervalReduction StdDev 2k rows") {
+        return IntervalReductionComputer(workload.analog, ReductionType::StdDev).compute(workload.interval_plan);
+    };
+
+    BENCHMARK("TV AnalogSliceGatherer 2k rows") {
+        return AnalogSliceGathererComputer<std::vector<float>>(workload.analog).compute(workload.interval_plan);
+    };
+
+    BENCHMARK("TV EventInInterval Count 2k rows") {
+        return EventInIntervalComputer<int>(workload.events, EventOperation::Count, "events").compute(workload.interval_plan);
+    };
+
+    BENCHMARK("TV EventInInterval Gather 2k rows") {
+        return EventInIntervalComputer<std::vector<float>>(workload.events, EventOperation::Gather, "events").compute(workload.interval_plan);
+    };
+
+    BENCHMARK("TV IntervalOverlap CountOverlaps 2k rows") {
+        return IntervalOverlapComputer<int64_t>(workload.column_intervals, IntervalOverlapOperation::CountOverlaps, "intervals").compute(workload.interval_plan);
+    };
+
+    BENCHMARK("TV IntervalOverlap AssignID 2k rows") {
+        return IntervalOverlapComputer<int64_t>(workload.column_intervals, IntervalOverlapOperation::AssignID, "intervals").compute(workload.interval_plan);
+    };
+
+    BENCHMARK("TV IntervalProperty Duration 2k rows") {
+        return IntervalPropertyComputer<int64_t>(workload.column_intervals, IntervalProperty::Duration, "intervals").compute(workload.interval_plan);
+    };
+}
+
+TEST_CASE("Benchmark TableView timestamp computers", "[!benchmark][tableview]") {
+    TableViewWorkload const workload;
+
+    BENCHMARK("TV TimestampValue 20k rows") {
+        return TimestampValueComputer(workload.analog).compute(workload.timestamp_plan);
+    };
+
+    BENCHMARK("TV AnalogTimestampOffsets 3 offsets 20k rows") {
+        return AnalogTimestampOffsetsMultiComputer(workload.analog, "analog", {-50, 0, 50}).computeBatch(workload.timestamp_plan);
+    };
+
+    BENCHMARK("TV TimestampInInterval 20k rows") {
+        return TimestampInIntervalComputer(workload.column_intervals, "intervals").compute(workload.timestamp_plan);
+    };
+
+    BENCHMARK("TV LineSampling 10 segments 20k rows") {
+        return LineSamplingMultiComputer(workload.lines, "lines", workload.clock, 10).computeBatch(workload.timestamp_plan);
+    };
+}
@@ -0,0 +1,63 @@
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include "benchmark_data.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace benchmark_data;
+
+TEST_CASE("Benchmark TimeFrame conversion", "[!benchmark][timeframe]") {
+    auto const camera = camera_clock(1'000'000);
+    auto const regular = TimeFrame::createRegular(4'000'000);
+
+    std::vector<std::int64_t> camera_times;
+    camera_times.reserve(1'000'000);
+    for (std::int64_t i = 0; i < 1'000'000; ++i) {
+        camera_times.push_back(camera->getTimeAtIndex(TimeFrameIndex(i)));
+    }
+
+    BENCHMARK("TimeFrame construct explicit 1M") {
+        return TimeFrame(camera_times);
+    };
+
+    BENCHMARK("TimeFrame getTimeAtIndex 1M") {
+        std::int64_t sum = 0;
+        for (std::int64_t i = 0; i < 1'000'000; ++i) {
+            sum += camera->getTimeAtIndex(TimeFrameIndex(i));
+        }
+        return sum;
+    };
+
+    BENCHMARK("TimeFrame getIndexAtTime 100k") {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < camera_times.size(); i += 10) {
+            sum += camera->getIndexAtTime(static_cast<double>(camera_times[i])).getValue();
+        }
+        return sum;
+    };
+
+    BENCHMARK("TimeFrame getIndicesAtTimes sorted 1M") {
+        return camera->getIndicesAtTimes(camera_times);
+    };
+
+    BENCHMARK("TimeFrame getIndicesAtTimes implicit clock 1M") {
+        return regular->getIndicesAtTimes(camera_times);
+    };
+
+    BENCHMARK_ADVANCED("TimeFrame getConversionMap uncached 1M")(Catch::Benchmark::Chronometer meter) {
+        std::vector<std::shared_ptr<TimeFrame>> sources;
+        for (int i = 0; i < meter.runs(); ++i) {
+            sources.push_back(camera_clock(1'000'000));
+        }
+        meter.measure([&](int i) {
+            return sources[static_cast<std::size_t>(i)]->getConversionMap(*regular);
+        });
+    };
+
+    BENCHMARK("TimeFrame getConversionMap cached") {
+        return camera->getConversionMap(*regular);
+    };
+}
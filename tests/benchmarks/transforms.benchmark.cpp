@@ -0,0 +1,248 @@
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include "benchmark_data.hpp"
+
+#include "transforms/AnalogTimeSeries/AnalogFilter/analog_filter.hpp"
+#include "transforms/AnalogTimeSeries/AnalogHilbertPhase/analog_hilbert_phase.hpp"
+#include "transforms/AnalogTimeSeries/Analog_Event_Threshold/analog_event_threshold.hpp"
+#include "transforms/AnalogTimeSeries/analog_interval_threshold.hpp"
+#include "transforms/AnalogTimeSeries/analog_scaling.hpp"
+#include "transforms/DigitalIntervalSeries/digital_interval_group.hpp"
+#include "transforms/Lines/line_angle.hpp"
+#include "transforms/Lines/line_clip.hpp"
+#include "transforms/Lines/line_curvature.hpp"
+#include "transforms/Lines/line_min_point_dist.hpp"
+#include "transforms/Lines/line_point_extraction.hpp"
+#include "transforms/Lines/line_subsegment.hpp"
+#include "transforms/Masks/mask_area.hpp"
+#include "transforms/Masks/mask_centroid.hpp"
+#include "transforms/Masks/mask_connected_component.hpp"
+#include "transforms/Masks/mask_hole_filling.hpp"
+#include "transforms/Masks/mask_median_filter.hpp"
+#include "transforms/Masks/mask_principal_axis.hpp"
+#include "transforms/Masks/mask_skeletonize.hpp"
+#include "transforms/Masks/mask_to_line.hpp"
+#include "transforms/Media/whisker_tracing.hpp"
+
+#include <memory>
+#include <vector>
+
+using namespace benchmark_data;
+
+TEST_CASE("Benchmark Analog Event Threshold", "[!benchmark][transforms][analog]") {
+    auto ats_1k = analog_series(1000);
+    auto ats_10k = analog_series(10000);
+    auto ats_100k = analog_series(100000);
+
+    ThresholdParams params;
+    params.thresholdValue = 0.5;
+    params.direction = ThresholdParams::ThresholdDirection::POSITIVE;
+    params.lockoutTime = 0.0;
+
+    BENCHMARK("Event Threshold 1k") {
+        return event_threshold(ats_1k.get(), params);
+    };
+
+    BENCHMARK("Event Threshold 10k") {
+        return event_threshold(ats_10k.get(), params);
+    };
+
+    BENCHMARK("Event Threshold 100k") {
+        return event_threshold(ats_100k.get(), params);
+    };
+}
+
+TEST_CASE("Benchmark Analog Interval Threshold", "[!benchmark][transforms][analog]") {
+    auto ats = analog_series(1'000'000);
+
+    IntervalThresholdParams params;
+    params.thresholdValue = 0.5;
+    params.minDuration = 5.0;
+
+    BENCHMARK("Interval Threshold 1M") {
+        return interval_threshold(ats.get(), params);
+    };
+}
+
+TEST_CASE("Benchmark Analog Filter", "[!benchmark][transforms][analog]") {
+    auto ats = analog_series(100000);
+
+    AnalogFilterParams params;
+    params.filter_type = AnalogFilterParams::FilterType::Lowpass;
+    params.cutoff_frequency = 50.0;
+    params.order = 4;
+    params.sampling_rate = 1000.0;
+
+    BENCHMARK("4th Order Lowpass Filter 100k") {
+        return filter_analog(ats.get(), params);
+    };
+
+    params.zero_phase = true;
+    BENCHMARK("4th Order Zero-Phase Lowpass Filter 100k") {
+        return filter_analog(ats.get(), params);
+    };
+}
+
+TEST_CASE("Benchmark Analog Hilbert Phase", "[!benchmark][transforms][analog]") {
+    auto ats_1k = analog_series(1000);
+    auto ats_10k = analog_series(10000);
+    auto ats_100k = analog_series(100000);
+
+    HilbertPhaseParams params;
+    params.lowFrequency = 5.0;
+    params.highFrequency = 12.0;
+    params.discontinuityThreshold = 100;
+
+    BENCHMARK("Hilbert Phase 1k") {
+        return hilbert_phase(ats_1k.get(), params);
+    };
+
+    BENCHMARK("Hilbert Phase 10k") {
+        return hilbert_phase(ats_10k.get(), params);
+    };
+
+    BENCHMARK("Hilbert Phase 100k") {
+        return hilbert_phase(ats_100k.get(), params);
+    };
+}
+
+TEST_CASE("Benchmark Analog Scaling", "[!benchmark][transforms][analog]") {
+    // The series caches its statistics after the first scaling, so every run
+    // gets a fresh series to measure the statistics pass as well
+    auto const fresh_series = [](int runs) {
+        std::vector<std::shared_ptr<AnalogTimeSeries>> series;
+        for (int i = 0; i < runs; ++i) {
+            series.push_back(analog_series(1'000'000));
+        }
+        return series;
+    };
+
+    AnalogScalingParams params;
+    params.method = ScalingMethod::ZScore;
+    BENCHMARK_ADVANCED("Z-Score Scaling 1M")(Catch::Benchmark::Chronometer meter) {
+        auto const series = fresh_series(meter.runs());
+        meter.measure([&](int i) {
+            return scale_analog_time_series(series[static_cast<std::size_t>(i)].get(), params);
+        });
+    };
+
+    params.method = ScalingMethod::RobustScaling;
+    BENCHMARK_ADVANCED("Robust Scaling 1M")(Catch::Benchmark::Chronometer meter) {
+        auto const series = fresh_series(meter.runs());
+        meter.measure([&](int i) {
+            return scale_analog_time_series(series[static_cast<std::size_t>(i)].get(), params);
+        });
+    };
+}
+
+TEST_CASE("Benchmark Digital Interval Grouping", "[!benchmark][transforms][digital]") {
+    auto intervals_100k = interval_series(100'000);
+
+    GroupParams params;
+    params.maxSpacing = 50.0;
+
+    BENCHMARK("Group Intervals 100k") {
+        return group_intervals(intervals_100k.get(), params);
+    };
+}
+
+TEST_CASE("Benchmark Line Transforms", "[!benchmark][transforms][lines]") {
+    auto lines = line_data(5'000, 100);
+    auto points = point_data(5'000, 1);
+
+    LineAngleParameters angle_params;
+    BENCHMARK("Line Angle direct 5k") {
+        return line_angle(lines.get(), &angle_params);
+    };
+
+    angle_params.method = AngleCalculationMethod::PolynomialFit;
+    BENCHMARK("Line Angle polynomial 5k") {
+        return line_angle(lines.get(), &angle_params);
+    };
+
+    LineCurvatureParameters curvature_params;
+    BENCHMARK("Line Curvature 5k") {
+        return line_curvature(lines.get(), &curvature_params);
+    };
+
+    BENCHMARK("Line Min Point Distance 5k") {
+        return line_min_point_dist(lines.get(), points.get());
+    };
+
+    LinePointExtractionParameters point_params;
+    BENCHMARK("Line Point Extraction 5k") {
+        return extract_line_point(lines.get(), point_params);
+    };
+
+    LineSubsegmentParameters subsegment_params;
+    BENCHMARK("Line Subsegment 5k") {
+        return extract_line_subsegment(lines.get(), subsegment_params);
+    };
+
+    // A vertical reference line crossing every whisker near its middle
+    LineClipParameters clip_params;
+    clip_params.reference_line_data = std::make_shared<LineData>();
+    clip_params.reference_line_data->addAtTime(TimeFrameIndex(0), std::vector<float>{400.0f, 400.0f}, std::vector<float>{0.0f, 480.0f}, false);
+    BENCHMARK("Line Clip 5k") {
+        return clip_lines(lines.get(), &clip_params);
+    };
+}
+
+TEST_CASE("Benchmark Mask Transforms", "[!benchmark][transforms][masks]") {
+    auto masks = mask_data(1'000, 20);
+
+    BENCHMARK("Mask Area 1k") {
+        return area(masks.get());
+    };
+
+    BENCHMARK("Mask Centroid 1k") {
+        return calculate_mask_centroid(masks.get());
+    };
+
+    BENCHMARK("Mask Principal Axis 1k") {
+        return calculate_mask_principal_axis(masks.get());
+    };
+
+    MaskConnectedComponentParameters component_params;
+    BENCHMARK("Mask Connected Components 1k") {
+        return remove_small_connected_components(masks.get(), &component_params);
+    };
+
+    MaskHoleFillingParameters hole_params;
+    BENCHMARK("Mask Hole Filling 1k") {
+        return fill_mask_holes(masks.get(), &hole_params);
+    };
+
+    MaskMedianFilterParameters median_params;
+    BENCHMARK("Mask Median Filter 1k") {
+        return apply_median_filter(masks.get(), &median_params);
+    };
+
+    BENCHMARK("Mask Skeletonize 1k") {
+        return skeletonize_mask(masks.get());
+    };
+
+    MaskToLineParameters line_params;
+    line_params.reference_x = 200.0f;
+    line_params.reference_y = 240.0f;
+    BENCHMARK("Mask To Line 1k") {
+        return mask_to_line(masks.get(), &line_params);
+    };
+}
+
+TEST_CASE("Benchmark Whisker Tracing", "[!benchmark][transforms][media]") {
+    DataTypeVariant const media = std::shared_ptr<MediaData>(std::make_shared<SyntheticMedia>(50));
+
+    WhiskerTracingOperation operation;
+    WhiskerTracingParameters params;
+
+    BENCHMARK("Whisker Tracing batched 50 frames") {
+        return operation.execute(media, &params);
+    };
+
+    params.use_parallel_processing = false;
+    BENCHMARK("Whisker Tracing serial 50 frames") {
+        return operation.execute(media, &params);
+    };
+}